@@ -471,9 +471,14 @@ extern "C" {
 
     CFG_BSP_TFTLCD                  If defined, this will cause drivers for
                                 a pre-determined LCD screen to be included
-                                during build.  Only one LCD driver can be
-                                included during the build process (for ex.
-                                'drivers/displays/hw/ILI9325.c')
+                                during build.  Normally only one LCD driver
+                                is included (for ex. CFG_BSP_LCD_ST7735),
+                                and the lcd.h functions call it directly.
+                                Each panel has a handle (st7735Panel,
+                                etc.) that is selected at run time with
+                                drawSetTarget.  Several panels of the
+                                same type can share a bus, each with its
+                                own chip select (see st7735_t, etc.).
     CFG_BSP_TFTLCD_INCLUDESMALLFONTS If set to 1, smallfont support will be
                                 included for 3x6, 5x8, 7x8 and 8x8 fonts.
                                 This should only be enabled if these small
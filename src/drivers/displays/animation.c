@@ -0,0 +1,444 @@
+/**************************************************************************/
+/*!
+    @file     animation.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <string.h>
+
+#include "animation.h"
+#include "core/delay/delay.h"
+
+/* sin(pi/2 * i/32) in Q15, used for the sine easing curve */
+static const uint16_t animationSineTable[33] =
+{
+  0, 1608, 3212, 4808, 6393, 7962, 9512, 11039, 12540, 14010, 15447,
+  16846, 18205, 19520, 20788, 22006, 23170, 24279, 25330, 26320, 27246,
+  28106, 28899, 29622, 30274, 30853, 31357, 31786, 32138, 32413, 32610,
+  32729, 32768
+};
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Private Methods ------------------------------ */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Reads the timeline clock in microseconds
+*/
+/**************************************************************************/
+static int64_t animationNow(animationTimeline_t *tl)
+{
+  timespan_t now;
+
+  tl->clock(&now);
+  return timespanToMicroseconds(&now);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Multiplies two Q15 values
+*/
+/**************************************************************************/
+static inline int32_t animationMul(int32_t a, int32_t b)
+{
+  return (a * b) >> 15;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Applies the value of every track at the specified time and
+            renders one frame
+*/
+/**************************************************************************/
+static void animationApply(animationTimeline_t *tl, int64_t time)
+{
+  animationTrack_t *track;
+
+  for (track = tl->tracks; track < tl->tracks + tl->trackCount; track++)
+  {
+    track->value = animationTrackValueAt(track, time);
+    if (track->apply)
+    {
+      track->apply(track->param, track->value);
+    }
+  }
+
+  if (tl->frame)
+  {
+    tl->frame(tl->frameParam);
+  }
+
+  tl->framesRendered++;
+}
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Public Methods ------------------------------- */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Initialises a timeline
+
+    The duration of the timeline is the time of the last keyframe on any
+    track.  The frame rate defaults to ANIMATION_DEFAULT_FPS.
+
+    @param[in]  tl
+                The timeline to initialise
+    @param[in]  tracks
+                The tracks to animate
+    @param[in]  trackCount
+                Number of entries in tracks
+    @param[in]  clock
+                Function that returns the current time from a monotonic
+                clock, or NULL to use animationClockSystick
+*/
+/**************************************************************************/
+void animationInit(animationTimeline_t *tl, animationTrack_t *tracks, uint8_t trackCount, animationClockFunc_t clock)
+{
+  uint8_t i;
+  int64_t last;
+
+  memset(tl, 0, sizeof(animationTimeline_t));
+  tl->tracks = tracks;
+  tl->trackCount = trackCount;
+  tl->clock = clock ? clock : animationClockSystick;
+  tl->frameInterval = 1000000 / ANIMATION_DEFAULT_FPS;
+
+  for (i = 0; i < trackCount; i++)
+  {
+    if (tracks[i].keyframeCount)
+    {
+      last = (int64_t)tracks[i].keyframes[tracks[i].keyframeCount - 1].time * 1000;
+      if (last > tl->duration)
+      {
+        tl->duration = last;
+      }
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Sets the target time between two frames
+
+    @param[in]  tl
+                The timeline
+    @param[in]  interval
+                Time between frames (1/fps).  Frames are never rendered
+                more often than this.
+*/
+/**************************************************************************/
+void animationSetFrameInterval(animationTimeline_t *tl, timespan_t *interval)
+{
+  tl->frameInterval = timespanToMicroseconds(interval);
+  if (tl->frameInterval < 1)
+  {
+    tl->frameInterval = 1;
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Starts (or restarts) the timeline and renders the first frame
+*/
+/**************************************************************************/
+void animationStart(animationTimeline_t *tl)
+{
+  tl->start = animationNow(tl);
+  tl->running = true;
+  tl->nextFrame = 0;
+  tl->framesRendered = 0;
+  tl->framesSkipped = 0;
+  animationUpdate(tl);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Stops the timeline, leaving the tracks at their last value
+*/
+/**************************************************************************/
+void animationStop(animationTimeline_t *tl)
+{
+  tl->running = false;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Renders a frame if one is due, and should be called
+            regularly from the main loop
+
+    Track values are always computed from the time on the clock, not
+    from the number of frames rendered, so the animation keeps its
+    duration however long each frame takes to draw.  Frames are due on
+    a fixed grid (one every frame interval).  If drawing falls behind
+    and several grid points have already passed, only the most recent
+    frame is rendered and the others are counted in framesSkipped.
+
+    The final keyframe is always rendered before a non-looping timeline
+    stops.
+
+    @param[in]  tl
+                The timeline
+
+    @return     True while the timeline is running
+*/
+/**************************************************************************/
+bool animationUpdate(animationTimeline_t *tl)
+{
+  int64_t elapsed, missed;
+  bool    finished = false;
+
+  if (!tl->running)
+    return false;
+
+  elapsed = animationNow(tl) - tl->start;
+  if (elapsed < tl->nextFrame)
+    return true;
+
+  /* Count the frames that are too late to bother drawing */
+  missed = (elapsed - tl->nextFrame) / tl->frameInterval;
+  tl->framesSkipped += (uint32_t)missed;
+  tl->nextFrame = (elapsed / tl->frameInterval + 1) * tl->frameInterval;
+
+  if (elapsed >= tl->duration)
+  {
+    if ((tl->flags & ANIMATION_FLAG_LOOP) && (tl->duration > 0))
+    {
+      elapsed %= tl->duration;
+    }
+    else
+    {
+      elapsed = tl->duration;
+      finished = true;
+    }
+  }
+
+  animationApply(tl, elapsed);
+
+  if (finished)
+  {
+    tl->running = false;
+  }
+
+  return tl->running;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Runs a (non-looping) timeline to the end, sleeping between
+            frames
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/animation.h"
+    #include "drivers/displays/graphic/drawing.h"
+
+    // Slide a panel in from the left, then fade its contents in
+    static const animationKeyframe_t slide[] =
+    {
+      { 0,   -120, ANIMATION_EASE_CUBICOUT },
+      { 400, 10,   ANIMATION_EASE_LINEAR }
+    };
+    static const animationKeyframe_t fade[] =
+    {
+      { 0,   0,    ANIMATION_EASE_LINEAR },
+      { 300, 0,    ANIMATION_EASE_QUADINOUT },
+      { 600, 100,  ANIMATION_EASE_LINEAR }
+    };
+
+    static void renderPanel(void *param)
+    {
+      animationTrack_t *tracks = (animationTrack_t *)param;
+      int32_t x = tracks[0].value;
+      uint16_t text = colorsAlphaBlend(COLOR_BLACK, COLOR_WHITE, tracks[1].value);
+      ...
+    }
+
+    animationTrack_t tracks[2] = { { slide, 2 }, { fade, 3 } };
+    animationTimeline_t tl;
+
+    animationInit(&tl, tracks, 2, NULL);
+    tl.frame = renderPanel;
+    tl.frameParam = tracks;
+    animationRun(&tl);
+
+    @endcode
+*/
+/**************************************************************************/
+void animationRun(animationTimeline_t *tl)
+{
+  int64_t wait;
+
+  tl->flags &= ~ANIMATION_FLAG_LOOP;
+  animationStart(tl);
+
+  while (animationUpdate(tl))
+  {
+    wait = tl->nextFrame - (animationNow(tl) - tl->start);
+    if (wait > 0)
+    {
+      delay((uint32_t)((wait + 999) / 1000));
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Gets the time since the timeline was started
+*/
+/**************************************************************************/
+error_t animationGetElapsed(animationTimeline_t *tl, timespan_t *elapsed)
+{
+  return timespanCreate((animationNow(tl) - tl->start) * 1000, elapsed);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Maps linear progress to an easing curve
+
+    @param[in]  easing
+                The easing curve
+    @param[in]  progress
+                Q15 fixed-point progress, from 0 to ANIMATION_ONE
+
+    @return     The eased progress in Q15.  This normally stays between 0
+                and ANIMATION_ONE, but ANIMATION_EASE_BACKOUT overshoots.
+*/
+/**************************************************************************/
+int32_t animationEase(animationEasing_t easing, int32_t progress)
+{
+  int32_t p, q, i, frac, s;
+
+  if (progress <= 0)
+    return 0;
+  if (progress >= ANIMATION_ONE)
+    return ANIMATION_ONE;
+
+  p = progress;
+  q = ANIMATION_ONE - p;
+
+  switch (easing)
+  {
+    case ANIMATION_EASE_STEP:
+      return 0;
+    case ANIMATION_EASE_QUADIN:
+      return animationMul(p, p);
+    case ANIMATION_EASE_QUADOUT:
+      return ANIMATION_ONE - animationMul(q, q);
+    case ANIMATION_EASE_QUADINOUT:
+      return p < ANIMATION_ONE / 2 ? 2 * animationMul(p, p)
+                                   : ANIMATION_ONE - 2 * animationMul(q, q);
+    case ANIMATION_EASE_CUBICIN:
+      return animationMul(animationMul(p, p), p);
+    case ANIMATION_EASE_CUBICOUT:
+      return ANIMATION_ONE - animationMul(animationMul(q, q), q);
+    case ANIMATION_EASE_CUBICINOUT:
+      return p < ANIMATION_ONE / 2 ? 4 * animationMul(animationMul(p, p), p)
+                                   : ANIMATION_ONE - 4 * animationMul(animationMul(q, q), q);
+    case ANIMATION_EASE_SINEINOUT:
+      /* (1 - cos(pi * p)) / 2 = sin(pi/2 * p)^2 */
+      i = p >> 10;
+      frac = p & 0x3FF;
+      s = animationSineTable[i] + (((animationSineTable[i + 1] - animationSineTable[i]) * frac) >> 10);
+      return animationMul(s, s);
+    case ANIMATION_EASE_BACKOUT:
+      /* 1 + c3 * (p - 1)^3 + c1 * (p - 1)^2, c1 = 1.70158, c3 = c1 + 1 */
+      s = animationMul(q, q);
+      return ANIMATION_ONE + (int32_t)((55756LL * s - 88524LL * animationMul(s, q)) >> 15);
+    case ANIMATION_EASE_LINEAR:
+    default:
+      return p;
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Gets the value of a track at the specified time
+
+    @param[in]  track
+                The track
+    @param[in]  time
+                Time since the start of the timeline in microseconds
+
+    @return     The value interpolated between the keyframes either side
+                of time, using the easing curve of the earlier keyframe.
+                Before the first keyframe the first value is returned,
+                and after the last keyframe the last value.
+*/
+/**************************************************************************/
+int32_t animationTrackValueAt(const animationTrack_t *track, int64_t time)
+{
+  const animationKeyframe_t *k0, *k1;
+  int64_t t0, t1;
+  int32_t progress;
+  uint8_t i;
+
+  if (track->keyframeCount == 0)
+    return 0;
+
+  k0 = &track->keyframes[0];
+  if (time <= (int64_t)k0->time * 1000)
+    return k0->value;
+
+  for (i = 1; i < track->keyframeCount; i++)
+  {
+    k1 = &track->keyframes[i];
+    t1 = (int64_t)k1->time * 1000;
+    if (time < t1)
+    {
+      t0 = (int64_t)k0->time * 1000;
+      progress = (int32_t)(((time - t0) * ANIMATION_ONE) / (t1 - t0));
+      return k0->value + (int32_t)(((int64_t)(k1->value - k0->value) * animationEase(k0->easing, progress)) >> 15);
+    }
+    k0 = k1;
+  }
+
+  return k0->value;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Default timeline clock, based on the 1ms systick counter
+            used by delay()
+*/
+/**************************************************************************/
+void animationClockSystick(timespan_t *now)
+{
+  timespanCreate((int64_t)delayGetTicks() * 1000000LL, now);
+}
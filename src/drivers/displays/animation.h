@@ -0,0 +1,132 @@
+/**************************************************************************/
+/*!
+    @file     animation.h
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#ifndef __ANIMATION_H__
+#define __ANIMATION_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "bspconfig.h"
+#include "drivers/timespan.h"
+
+/*=========================================================================
+    ANIMATION SETTINGS
+    -----------------------------------------------------------------------
+    ANIMATION_DEFAULT_FPS   The frame rate used until a different frame
+                            interval is set with animationSetFrameInterval
+    -----------------------------------------------------------------------*/
+    #define ANIMATION_DEFAULT_FPS       (30)
+/*=========================================================================*/
+
+/* Easing curves work with Q15 fixed-point progress (0..ANIMATION_ONE) */
+#define ANIMATION_ONE                   (32768)
+
+/* Timeline flags */
+#define ANIMATION_FLAG_LOOP             (0x01)  // Restart from the first keyframe at the end
+
+typedef enum
+{
+  ANIMATION_EASE_LINEAR = 0,
+  ANIMATION_EASE_STEP,                  // Holds the start value until the next keyframe
+  ANIMATION_EASE_QUADIN,
+  ANIMATION_EASE_QUADOUT,
+  ANIMATION_EASE_QUADINOUT,
+  ANIMATION_EASE_CUBICIN,
+  ANIMATION_EASE_CUBICOUT,
+  ANIMATION_EASE_CUBICINOUT,
+  ANIMATION_EASE_SINEINOUT,
+  ANIMATION_EASE_BACKOUT                // Overshoots slightly then settles
+} animationEasing_t;
+
+typedef struct
+{
+  uint32_t          time;       // Offset from the start of the timeline in milliseconds
+  int32_t           value;
+  animationEasing_t easing;     // Curve used between this keyframe and the next one
+} animationKeyframe_t;
+
+/* Receives the current value of a track */
+typedef void (*animationApplyFunc_t)(void *param, int32_t value);
+
+/* Called once per frame after all tracks have been applied */
+typedef void (*animationFrameFunc_t)(void *param);
+
+/* Returns the current time from a monotonic clock */
+typedef void (*animationClockFunc_t)(timespan_t *now);
+
+typedef struct
+{
+  const animationKeyframe_t *keyframes;   // Sorted by time
+  uint8_t                   keyframeCount;
+  animationApplyFunc_t      apply;
+  void                      *param;       // Passed to apply
+  int32_t                   value;        // Value applied in the last frame
+} animationTrack_t;
+
+typedef struct
+{
+  animationTrack_t     *tracks;
+  uint8_t              trackCount;
+  animationFrameFunc_t frame;             // Can be NULL
+  void                 *frameParam;       // Passed to frame
+  animationClockFunc_t clock;
+  uint8_t              flags;             // ANIMATION_FLAG_* flags
+  bool                 running;
+  int64_t              start;             // Clock time when started (us)
+  int64_t              duration;          // Time of the last keyframe (us)
+  int64_t              frameInterval;     // Target time between frames (us)
+  int64_t              nextFrame;         // Elapsed time when the next frame is due (us)
+  uint32_t             framesRendered;
+  uint32_t             framesSkipped;     // Frames dropped to keep up with the clock
+} animationTimeline_t;
+
+void    animationInit             ( animationTimeline_t *tl, animationTrack_t *tracks, uint8_t trackCount, animationClockFunc_t clock );
+void    animationSetFrameInterval ( animationTimeline_t *tl, timespan_t *interval );
+void    animationStart            ( animationTimeline_t *tl );
+void    animationStop             ( animationTimeline_t *tl );
+bool    animationUpdate           ( animationTimeline_t *tl );
+void    animationRun              ( animationTimeline_t *tl );
+error_t animationGetElapsed       ( animationTimeline_t *tl, timespan_t *elapsed );
+int32_t animationEase             ( animationEasing_t easing, int32_t progress );
+int32_t animationTrackValueAt     ( const animationTrack_t *track, int64_t time );
+void    animationClockSystick     ( timespan_t *now );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,855 @@
+/**************************************************************************/
+/*!
+    @file     assets.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <string.h>
+
+#include "assets.h"
+
+/* A block of a streamed pack held in the cache */
+typedef struct
+{
+  const assetsPack_t  *pack;    // NULL if the slot is free
+  uint32_t            block;    // Offset in the pack / ASSETS_CACHE_BLOCKSIZE
+  uint32_t            lastUsed;
+} assetsCacheBlock_t;
+
+static assetsCacheBlock_t _assetsCacheBlocks[ASSETS_CACHE_MAXBLOCKS];
+static uint8_t            *_assetsCacheData = NULL;
+static uint8_t            _assetsCacheCount = 0;
+static uint32_t           _assetsCacheClock = 0;
+static assetsCacheStats_t _assetsCacheStats;
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Private Methods ------------------------------ */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Returns the cache slot holding a block, loading it into the
+            least recently used slot if it isn't cached yet
+
+    @return The slot index, or -1 if the block couldn't be read
+*/
+/**************************************************************************/
+static int8_t assetsCacheGetBlock(const assetsPack_t *pack, uint32_t block)
+{
+  uint32_t start = block * ASSETS_CACHE_BLOCKSIZE;
+  uint32_t len;
+  int8_t   slot = 0;
+  uint8_t  i;
+
+  _assetsCacheClock++;
+  for (i = 0; i < _assetsCacheCount; i++)
+  {
+    if ((_assetsCacheBlocks[i].pack == pack) && (_assetsCacheBlocks[i].block == block))
+    {
+      _assetsCacheBlocks[i].lastUsed = _assetsCacheClock;
+      _assetsCacheStats.hits++;
+      return i;
+    }
+    if ((_assetsCacheBlocks[slot].pack != NULL) &&
+        ((_assetsCacheBlocks[i].pack == NULL) || (_assetsCacheBlocks[i].lastUsed < _assetsCacheBlocks[slot].lastUsed)))
+    {
+      slot = i;
+    }
+  }
+
+  /* Reuse the free or least recently used slot */
+  if (_assetsCacheBlocks[slot].pack != NULL)
+  {
+    _assetsCacheStats.evictions++;
+  }
+  _assetsCacheBlocks[slot].pack = NULL;
+  _assetsCacheStats.misses++;
+
+  /* The last block of the pack is usually short */
+  len = pack->size - start < ASSETS_CACHE_BLOCKSIZE ? pack->size - start : ASSETS_CACHE_BLOCKSIZE;
+  if (pack->read(pack->param, start, &_assetsCacheData[slot * ASSETS_CACHE_BLOCKSIZE], len) != len)
+  {
+    return -1;
+  }
+
+  _assetsCacheBlocks[slot].pack = pack;
+  _assetsCacheBlocks[slot].block = block;
+  _assetsCacheBlocks[slot].lastUsed = _assetsCacheClock;
+
+  return slot;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Reads len bytes at offset in the pack
+
+    Reads from streamed packs go through the block cache unless 'cached'
+    is false, which is used for image data: an image is read once from
+    start to finish, and would otherwise push the index and font blocks
+    out of the cache.
+*/
+/**************************************************************************/
+static error_t assetsReadAt(const assetsPack_t *pack, uint32_t offset, void *buf, uint32_t len, bool cached)
+{
+  uint8_t  *dst = (uint8_t *)buf;
+  uint32_t within, count;
+  int8_t   slot;
+
+  if ((offset > pack->size) || (len > pack->size - offset))
+  {
+    return ERROR_ASSETS_INVALIDFORMAT;
+  }
+
+  if (pack->data != NULL)
+  {
+    memcpy(dst, &pack->data[offset], len);
+    return ERROR_NONE;
+  }
+
+  if (!cached || (_assetsCacheCount == 0))
+  {
+    _assetsCacheStats.uncached++;
+    return pack->read(pack->param, offset, dst, len) == len ? ERROR_NONE : ERROR_ASSETS_READFAILED;
+  }
+
+  while (len)
+  {
+    slot = assetsCacheGetBlock(pack, offset / ASSETS_CACHE_BLOCKSIZE);
+    if (slot < 0)
+    {
+      return ERROR_ASSETS_READFAILED;
+    }
+    within = offset % ASSETS_CACHE_BLOCKSIZE;
+    count = ASSETS_CACHE_BLOCKSIZE - within < len ? ASSETS_CACHE_BLOCKSIZE - within : len;
+    memcpy(dst, &_assetsCacheData[slot * ASSETS_CACHE_BLOCKSIZE + within], count);
+    dst += count;
+    offset += count;
+    len -= count;
+  }
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Reads the pack header and checks that the index fits
+*/
+/**************************************************************************/
+static error_t assetsReadHeader(assetsPack_t *pack)
+{
+  assetsHeader_t header;
+
+  /* The size isn't known yet, so the header can't go through the cache */
+  if (pack->data != NULL)
+  {
+    memcpy(&header, pack->data, sizeof(assetsHeader_t));
+  }
+  else if (pack->read(pack->param, 0, (uint8_t *)&header, sizeof(assetsHeader_t)) != sizeof(assetsHeader_t))
+  {
+    return ERROR_ASSETS_READFAILED;
+  }
+
+  if ((header.magic != ASSETS_MAGIC) || (header.version != ASSETS_VERSION) ||
+      (header.size < sizeof(assetsHeader_t) + (uint32_t)header.count * sizeof(assetsEntry_t)))
+  {
+    return ERROR_ASSETS_INVALIDFORMAT;
+  }
+
+  pack->count = header.count;
+  pack->size = header.size;
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Drops any cached blocks belonging to a pack
+*/
+/**************************************************************************/
+static void assetsCacheDrop(const assetsPack_t *pack)
+{
+  uint8_t i;
+
+  for (i = 0; i < _assetsCacheCount; i++)
+  {
+    if (_assetsCacheBlocks[i].pack == pack)
+    {
+      _assetsCacheBlocks[i].pack = NULL;
+    }
+  }
+}
+
+#ifdef CFG_BSP_SDCARD
+/**************************************************************************/
+/*!
+    @brief  Read function for assetsOpenFile
+*/
+/**************************************************************************/
+static uint32_t assetsReadFile(void *param, uint32_t offset, uint8_t *buf, uint32_t len)
+{
+  FIL  *file = (FIL *)param;
+  UINT bytesRead = 0;
+
+  if ((f_tell(file) != offset) && (f_lseek(file, offset) != FR_OK))
+  {
+    return 0;
+  }
+  if (f_read(file, buf, len, &bytesRead) != FR_OK)
+  {
+    return 0;
+  }
+
+  return bytesRead;
+}
+#endif
+
+#ifdef CFG_BSP_TFTLCD
+/* Position in a JPEG asset, for assetsReadJpeg */
+typedef struct
+{
+  assetsPack_t    *pack;
+  assetsEntry_t   entry;
+  uint32_t        pos;
+} assetsJpegSource_t;
+
+/**************************************************************************/
+/*!
+    @brief  Input function for assetsDrawJpeg
+*/
+/**************************************************************************/
+static uint32_t assetsReadJpeg(void *param, uint8_t *buf, uint32_t len)
+{
+  assetsJpegSource_t *src = (assetsJpegSource_t *)param;
+
+  if (len > src->entry.length - src->pos)
+  {
+    len = src->entry.length - src->pos;
+  }
+  if (assetsReadAt(src->pack, src->entry.offset + src->pos, buf, len, false))
+  {
+    return 0;
+  }
+  src->pos += len;
+
+  return len;
+}
+#endif
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Public Methods ------------------------------- */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Opens a pack held in flash or RAM
+
+    The pack is used in place, so images and glyphs are drawn straight
+    from it without going through the cache.
+
+    @param[in]  pack
+                The pack state to initialise
+    @param[in]  data
+                The pack as written by tools/assetpack (4-byte aligned)
+
+    @return     ERROR_ASSETS_INVALIDFORMAT if the data isn't a pack
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/assets.h"
+    #include "assets/ui.h"    // Generated by tools/assetpack
+
+    static assetsPack_t ui;
+
+    assetsOpen(&ui, ui_pack);
+    assetsDrawImage(&ui, ASSET_LOGO, 0, 0);
+
+    @endcode
+*/
+/**************************************************************************/
+error_t assetsOpen(assetsPack_t *pack, const uint8_t *data)
+{
+  memset(pack, 0, sizeof(assetsPack_t));
+
+  if ((data == NULL) || ((uintptr_t)data & 3))
+  {
+    return ERROR_INVALIDPARAMETER;
+  }
+
+  pack->data = data;
+  return assetsReadHeader(pack);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Opens a pack on external storage, read through a function
+
+    Index lookups and font glyphs are read through the block cache (see
+    assetsCacheInit), image data is read directly.
+
+    @param[in]  pack
+                The pack state to initialise
+    @param[in]  read
+                Function used to read from the pack
+    @param[in]  param
+                Context pointer passed to the read function
+
+    @return     ERROR_ASSETS_READFAILED or ERROR_ASSETS_INVALIDFORMAT if
+                the header couldn't be read or isn't valid
+*/
+/**************************************************************************/
+error_t assetsOpenStream(assetsPack_t *pack, assetsReadFunc_t read, void *param)
+{
+  /* The pack state may be reused, so forget any blocks cached for it */
+  assetsCacheDrop(pack);
+  memset(pack, 0, sizeof(assetsPack_t));
+
+  if (read == NULL)
+  {
+    return ERROR_INVALIDPARAMETER;
+  }
+
+  pack->read = read;
+  pack->param = param;
+  return assetsReadHeader(pack);
+}
+
+#ifdef CFG_BSP_SDCARD
+/**************************************************************************/
+/*!
+    @brief  Opens a pack stored as a file on the SD card
+
+    The file must already be open for reading, and stay open for as long
+    as the pack is used.
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/assets.h"
+    #include "assets/photos.h"    // Generated by tools/assetpack
+
+    static uint32_t cacheBuffer[2048 / 4];
+    static assetsPack_t photos;
+    static FIL file;
+
+    assetsCacheInit(cacheBuffer, sizeof(cacheBuffer));
+    if (f_open(&file, "/photos.pak", FA_READ | FA_OPEN_EXISTING) == FR_OK)
+    {
+      assetsOpenFile(&photos, &file);
+      assetsDrawImage(&photos, ASSET_BEACH, 0, 0);
+    }
+
+    @endcode
+*/
+/**************************************************************************/
+error_t assetsOpenFile(assetsPack_t *pack, FIL *file)
+{
+  return assetsOpenStream(pack, assetsReadFile, file);
+}
+#endif
+
+/**************************************************************************/
+/*!
+    @brief  Looks up an asset in the pack's index
+
+    @param[in]  pack
+                The pack
+    @param[in]  id
+                The asset ID
+    @param[out] entry
+                The asset's index entry
+
+    @return     ERROR_ASSETS_NOTFOUND if there's no asset with that ID
+*/
+/**************************************************************************/
+error_t assetsFind(assetsPack_t *pack, uint16_t id, assetsEntry_t *entry)
+{
+  uint16_t lo = 0, hi = pack->count, mid;
+
+  /* The index is sorted by ID */
+  while (lo < hi)
+  {
+    mid = (lo + hi) / 2;
+    ASSERT_STATUS(assetsReadAt(pack, sizeof(assetsHeader_t) + (uint32_t)mid * sizeof(assetsEntry_t),
+                               entry, sizeof(assetsEntry_t), true));
+    if (entry->id == id)
+    {
+      return (entry->offset <= pack->size) && (entry->length <= pack->size - entry->offset) ?
+             ERROR_NONE : ERROR_ASSETS_INVALIDFORMAT;
+    }
+    if (entry->id < id)
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+
+  return ERROR_ASSETS_NOTFOUND;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Reads part of an asset
+
+    @param[in]  pack
+                The pack
+    @param[in]  entry
+                The asset, from assetsFind
+    @param[in]  offset
+                Offset of the first byte to read within the asset
+    @param[out] buf
+                Receives the data
+    @param[in]  len
+                Number of bytes to read
+
+    @return     ERROR_INVALIDPARAMETER if the range goes past the end of
+                the asset
+*/
+/**************************************************************************/
+error_t assetsRead(assetsPack_t *pack, const assetsEntry_t *entry, uint32_t offset, void *buf, uint32_t len)
+{
+  if ((offset > entry->length) || (len > entry->length - offset))
+  {
+    return ERROR_INVALIDPARAMETER;
+  }
+
+  return assetsReadAt(pack, entry->offset + offset, buf, len, true);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns a pointer to an asset's data, or NULL if the pack is
+            streamed and the data has to be read with assetsRead
+*/
+/**************************************************************************/
+const uint8_t *assetsGetPointer(assetsPack_t *pack, const assetsEntry_t *entry)
+{
+  return pack->data != NULL ? &pack->data[entry->offset] : NULL;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Sets up the block cache used by streamed packs
+
+    Blocks are ASSETS_CACHE_BLOCKSIZE bytes, aligned in the pack, and
+    are evicted least recently used first.  Without a cache every read
+    from a streamed pack goes to storage, which is slow for the many
+    small reads made by index lookups and text.
+
+    @param[in]  buffer
+                RAM for the cached blocks, or NULL to disable the cache
+    @param[in]  size
+                Size of the buffer in bytes.  Up to ASSETS_CACHE_MAXBLOCKS
+                blocks are used.
+
+    @return     ERROR_INVALIDPARAMETER if the buffer can't hold a block
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/assets.h"
+
+    static uint32_t cacheBuffer[2048 / 4];
+    assetsCacheStats_t stats;
+
+    assetsCacheInit(cacheBuffer, sizeof(cacheBuffer));
+
+    // ... draw from a pack on the SD card ...
+
+    assetsCacheGetStats(&stats);
+    printf("%u hits, %u misses%s", stats.hits, stats.misses, CFG_PRINTF_NEWLINE);
+
+    @endcode
+*/
+/**************************************************************************/
+error_t assetsCacheInit(void *buffer, uint32_t size)
+{
+  _assetsCacheData = NULL;
+  _assetsCacheCount = 0;
+
+  if (buffer == NULL)
+  {
+    return ERROR_NONE;
+  }
+  if (size < ASSETS_CACHE_BLOCKSIZE)
+  {
+    return ERROR_INVALIDPARAMETER;
+  }
+
+  _assetsCacheData = (uint8_t *)buffer;
+  size /= ASSETS_CACHE_BLOCKSIZE;
+  _assetsCacheCount = size > ASSETS_CACHE_MAXBLOCKS ? ASSETS_CACHE_MAXBLOCKS : size;
+
+  assetsCacheFlush();
+  assetsCacheResetStats();
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Drops every cached block
+
+    Call this if a pack file is changed while it's open.
+*/
+/**************************************************************************/
+void assetsCacheFlush(void)
+{
+  memset(_assetsCacheBlocks, 0, sizeof(_assetsCacheBlocks));
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the cache counters
+*/
+/**************************************************************************/
+void assetsCacheGetStats(assetsCacheStats_t *stats)
+{
+  *stats = _assetsCacheStats;
+  stats->blocks = _assetsCacheCount;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Clears the hit, miss, eviction and uncached read counters
+*/
+/**************************************************************************/
+void assetsCacheResetStats(void)
+{
+  memset(&_assetsCacheStats, 0, sizeof(assetsCacheStats_t));
+}
+
+#ifdef CFG_BSP_TFTLCD
+/**************************************************************************/
+/*!
+    @brief  Draws an ASSETS_TYPE_RGB565 image, clipped to the screen
+
+    Images in a pack in flash go out in one lcdWritePixels burst,
+    streamed images are read and written 32 pixels at a time.
+
+    @param[in]  pack
+                The pack
+    @param[in]  id
+                The image's asset ID
+    @param[in]  x
+                Left edge of the image
+    @param[in]  y
+                Top edge of the image
+
+    @return     ERROR_INVALIDPARAMETER if the asset isn't an RGB565 image
+*/
+/**************************************************************************/
+error_t assetsDrawImage(assetsPack_t *pack, uint16_t id, uint16_t x, uint16_t y)
+{
+  assetsEntry_t entry;
+  uint16_t buffer[32];
+  uint16_t cw, ch, row, col, n;
+
+  ASSERT_STATUS(assetsFind(pack, id, &entry));
+  if ((entry.type != ASSETS_TYPE_RGB565) || (entry.length < (uint32_t)entry.width * entry.height * 2))
+  {
+    return ERROR_INVALIDPARAMETER;
+  }
+
+  /* Clip to the screen */
+  if ((entry.width == 0) || (entry.height == 0) || (x >= lcdGetWidth()) || (y >= lcdGetHeight()))
+  {
+    return ERROR_NONE;
+  }
+  cw = entry.width > lcdGetWidth() - x ? lcdGetWidth() - x : entry.width;
+  ch = entry.height > lcdGetHeight() - y ? lcdGetHeight() - y : entry.height;
+
+  lcdSetWindow(x, y, x + cw - 1, y + ch - 1);
+
+  if ((pack->data != NULL) && (cw == entry.width))
+  {
+    lcdWritePixels((uint16_t *)&pack->data[entry.offset], (uint32_t)cw * ch);
+    return ERROR_NONE;
+  }
+
+  for (row = 0; row < ch; row++)
+  {
+    for (col = 0; col < cw; col += n)
+    {
+      n = cw - col > 32 ? 32 : cw - col;
+      ASSERT_STATUS(assetsReadAt(pack, entry.offset + ((uint32_t)row * entry.width + col) * 2,
+                                 buffer, n * 2, false));
+      lcdWritePixels(buffer, n);
+    }
+  }
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Decodes and draws an ASSETS_TYPE_JPEG image
+
+    @param[in]  pack
+                The pack
+    @param[in]  id
+                The image's asset ID
+    @param[in]  jd
+                Decoder state (see jpegInit)
+    @param[in]  x
+                Left edge of the image
+    @param[in]  y
+                Top edge of the image
+    @param[in]  scale
+                Scale factor
+
+    @return     ERROR_INVALIDPARAMETER if the asset isn't a JPEG image,
+                or any error from the decoder
+*/
+/**************************************************************************/
+error_t assetsDrawJpeg(assetsPack_t *pack, uint16_t id, jpegDecoder_t *jd, uint16_t x, uint16_t y, jpegScale_t scale)
+{
+  assetsJpegSource_t src;
+
+  ASSERT_STATUS(assetsFind(pack, id, &src.entry));
+  if (src.entry.type != ASSETS_TYPE_JPEG)
+  {
+    return ERROR_INVALIDPARAMETER;
+  }
+
+  if (pack->data != NULL)
+  {
+    return jpegDrawBuffer(jd, &pack->data[src.entry.offset], src.entry.length, x, y, scale);
+  }
+
+  src.pack = pack;
+  src.pos = 0;
+  ASSERT_STATUS(jpegInit(jd, assetsReadJpeg, &src));
+  return jpegDecode(jd, x, y, scale);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Opens an ASSETS_TYPE_FONT font, to be drawn with FONT_ASSET
+
+    Glyphs in a pack in flash are drawn in place.  With a streamed pack
+    each glyph is read into 'buffer' before it's drawn, and glyphs that
+    don't fit are left blank, so the buffer should hold the largest
+    glyph of the font (the packer prints its size).
+
+    @param[in]  pack
+                The pack, which must stay open while the font is used
+    @param[in]  id
+                The font's asset ID
+    @param[out] font
+                The font state to initialise
+    @param[in]  buffer
+                Glyph buffer, only needed for a streamed pack
+    @param[in]  size
+                Size of the glyph buffer in bytes
+
+    @return     ERROR_INVALIDPARAMETER if the asset isn't a font or a
+                streamed pack has no glyph buffer
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/assets.h"
+    #include "drivers/displays/graphic/drawing.h"
+    #include "assets/ui.h"    // Generated by tools/assetpack
+
+    static assetsFont_t title;
+    static uint8_t      glyphBuffer[512];
+    const font_t        titleFont = FONT_ASSET(&title);
+
+    assetsOpenFont(&ui, ASSET_TITLEFONT, &title, glyphBuffer, sizeof(glyphBuffer));
+    drawText(10, 10, &titleFont, "Settings", COLORTABLE_AA4_WHITEONBLACK);
+
+    @endcode
+*/
+/**************************************************************************/
+error_t assetsOpenFont(assetsPack_t *pack, uint16_t id, assetsFont_t *font, uint8_t *buffer, uint16_t size)
+{
+  assetsEntry_t entry;
+  assetsFontHeader_t header;
+  uint32_t glyphs;
+
+  memset(font, 0, sizeof(assetsFont_t));
+
+  ASSERT_STATUS(assetsFind(pack, id, &entry));
+  if ((entry.type != ASSETS_TYPE_FONT) || ((pack->data == NULL) && (buffer == NULL)))
+  {
+    return ERROR_INVALIDPARAMETER;
+  }
+  if (entry.length < sizeof(assetsFontHeader_t))
+  {
+    return ERROR_ASSETS_INVALIDFORMAT;
+  }
+  ASSERT_STATUS(assetsReadAt(pack, entry.offset, &header, sizeof(assetsFontHeader_t), true));
+
+  /* Ranges are padded to keep the glyph records aligned */
+  glyphs = sizeof(assetsFontHeader_t) + (((uint32_t)header.rangeCount * sizeof(aafontsCharRange_t) + 3) & ~3);
+  if (((header.fontType != AAFONTS_FONTTYPE_AA2) && (header.fontType != AAFONTS_FONTTYPE_AA4)) ||
+      (header.encoding > AAFONTS_ENCODING_RLE) || (header.glyphCount == 0) ||
+      (entry.length < glyphs + (uint32_t)header.glyphCount * sizeof(assetsFontGlyph_t)))
+  {
+    return ERROR_ASSETS_INVALIDFORMAT;
+  }
+
+  font->info.fontType = (aafontsFontType_t)header.fontType;
+  font->info.fontHeight = header.fontHeight;
+  font->info.unknownCharWidth = header.unknownCharWidth;
+  font->info.heightUpperCase = header.heightUpperCase;
+  font->info.heightLowerCase = header.heightLowerCase;
+  font->info.baseline = header.baseline;
+  font->info.firstChar = header.firstChar;
+  font->info.lastChar = header.lastChar;
+  font->info.rangeCount = header.rangeCount;
+  font->info.encoding = (aafontsEncoding_t)header.encoding;
+  font->pack = pack;
+  font->offset = entry.offset;
+  font->length = entry.length;
+  font->glyphs = entry.offset + glyphs;
+  font->buffer = buffer;
+  font->bufferSize = size;
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Looks up a character in a font from a pack
+
+    @param[in]  font
+                The font, from assetsOpenFont
+    @param[in]  c
+                The character
+    @param[out] charInfo
+                Receives the glyph's metrics
+    @param[in]  load
+                If false only the metrics are needed, and charData is
+                left NULL.  Otherwise charData points to the glyph in
+                the pack or in the font's glyph buffer, and a glyph that
+                can't be loaded gets no rows.
+
+    @return     charInfo, or NULL if the character isn't in the font
+*/
+/**************************************************************************/
+const aafontsCharInfo_t *assetsGetCharInfo(const assetsFont_t *font, uint16_t c, aafontsCharInfo_t *charInfo, bool load)
+{
+  aafontsCharRange_t range;
+  assetsFontGlyph_t  glyph;
+  uint16_t lo = 0, hi = font->info.rangeCount, mid, index;
+
+  if ((font->pack == NULL) || (c < font->info.firstChar) || (c > font->info.lastChar))
+  {
+    return NULL;
+  }
+
+  /* Same lookup as aafontsGetCharInfo, with the tables in the pack */
+  index = c - font->info.firstChar;
+  if (font->info.rangeCount)
+  {
+    for (;;)
+    {
+      if (lo >= hi)
+      {
+        return NULL;
+      }
+      mid = (lo + hi) / 2;
+      if (assetsReadAt(font->pack, font->offset + sizeof(assetsFontHeader_t) + (uint32_t)mid * sizeof(aafontsCharRange_t),
+                       &range, sizeof(aafontsCharRange_t), true))
+      {
+        return NULL;
+      }
+      if (c < range.first)
+      {
+        hi = mid;
+      }
+      else if (c > range.last)
+      {
+        lo = mid + 1;
+      }
+      else
+      {
+        index = range.index + (c - range.first);
+        break;
+      }
+    }
+  }
+
+  if ((font->glyphs + (uint32_t)(index + 1) * sizeof(assetsFontGlyph_t) > font->offset + font->length) ||
+      assetsReadAt(font->pack, font->glyphs + (uint32_t)index * sizeof(assetsFontGlyph_t), &glyph, sizeof(assetsFontGlyph_t), true))
+  {
+    return NULL;
+  }
+
+  charInfo->width = glyph.width;
+  charInfo->bytesPerRow = glyph.bytesPerRow;
+  charInfo->yOffset = glyph.yOffset;
+  charInfo->height = glyph.height;
+  charInfo->charData = NULL;
+
+  if (!load || (glyph.offset == 0))
+  {
+    return charInfo;
+  }
+
+  /* Raw glyphs are read row by row, so they must hold every row */
+  if ((glyph.offset > font->length) || (glyph.length > font->length - glyph.offset) ||
+      ((font->info.encoding == AAFONTS_ENCODING_RAW) && (glyph.length < (uint32_t)glyph.height * glyph.bytesPerRow)))
+  {
+    charInfo->height = 0;
+  }
+  else if (font->pack->data != NULL)
+  {
+    charInfo->charData = &font->pack->data[font->offset + glyph.offset];
+  }
+  else if ((glyph.length <= font->bufferSize) &&
+           !assetsReadAt(font->pack, font->offset + glyph.offset, font->buffer, glyph.length, true))
+  {
+    charInfo->charData = font->buffer;
+  }
+  else
+  {
+    charInfo->height = 0;
+  }
+
+  return charInfo;
+}
+#endif
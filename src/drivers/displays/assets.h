@@ -0,0 +1,201 @@
+/**************************************************************************/
+/*!
+    @file     assets.h
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#ifndef __ASSETS_H__
+#define __ASSETS_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "bspconfig.h"
+#ifdef CFG_BSP_TFTLCD
+  #include "drivers/displays/graphic/aafonts.h"
+  #include "drivers/displays/graphic/jpeg.h"
+#endif
+#ifdef CFG_BSP_SDCARD
+  #include "drivers/storage/fatfs/ff.h"
+#endif
+
+/*=========================================================================
+    ASSET PACK SETTINGS
+    -----------------------------------------------------------------------
+    ASSETS_CACHE_BLOCKSIZE  Bytes per block of the cache used for packs
+                            streamed from external storage.  512 matches
+                            one SD card sector.
+    ASSETS_CACHE_MAXBLOCKS  Maximum number of blocks in the cache.  The
+                            block data lives in the buffer passed to
+                            assetsCacheInit, and each slot adds 12 bytes
+                            of bookkeeping here.
+    -----------------------------------------------------------------------*/
+    #define ASSETS_CACHE_BLOCKSIZE      (512)
+    #define ASSETS_CACHE_MAXBLOCKS      (8)
+/*=========================================================================*/
+
+/* Pack layout, built by tools/assetpack.  All fields are little endian
+   and every asset starts on a 4-byte boundary:
+
+     assetsHeader_t
+     assetsEntry_t  [count]     sorted by id
+     asset data                 at the offsets given in the index */
+#define ASSETS_MAGIC                (0x4B504141)  // "AAPK"
+#define ASSETS_VERSION              (1)
+
+typedef enum
+{
+  ASSETS_TYPE_RAW = 0,          // Any data, read with assetsRead
+  ASSETS_TYPE_RGB565 = 1,       // width x height pixels, row by row
+  ASSETS_TYPE_JPEG = 2,         // Baseline JPEG file (see jpeg.h)
+  ASSETS_TYPE_FONT = 3          // Anti-aliased font, see assetsFontHeader_t
+} assetsType_t;
+
+typedef struct
+{
+  uint32_t magic;               // ASSETS_MAGIC
+  uint16_t version;             // ASSETS_VERSION
+  uint16_t count;               // Number of entries in the index
+  uint32_t size;                // Size of the whole pack in bytes
+  uint32_t reserved;
+} assetsHeader_t;
+
+typedef struct
+{
+  uint16_t id;                  // Asset ID, see the header generated by the packer
+  uint8_t  type;                // assetsType_t
+  uint8_t  reserved;
+  uint16_t width;               // Image width in pixels (0 for other types)
+  uint16_t height;              // Image height or font height in pixels
+  uint32_t offset;              // Start of the data from the start of the pack
+  uint32_t length;              // Size of the data in bytes
+} assetsEntry_t;
+
+/* ASSETS_TYPE_FONT data, with offsets from the start of the asset:
+
+     assetsFontHeader_t
+     aafontsCharRange_t [rangeCount]  padded to a multiple of 4 bytes
+     assetsFontGlyph_t  [glyphCount]
+     glyph data */
+typedef struct
+{
+  uint8_t  fontType;            // aafontsFontType_t
+  uint8_t  encoding;            // aafontsEncoding_t
+  uint16_t fontHeight;
+  uint16_t unknownCharWidth;
+  uint16_t heightUpperCase;
+  uint16_t heightLowerCase;
+  uint16_t baseline;
+  uint16_t firstChar;
+  uint16_t lastChar;
+  uint16_t rangeCount;          // 0 if the glyphs run from firstChar to lastChar
+  uint16_t glyphCount;
+} assetsFontHeader_t;
+
+typedef struct
+{
+  uint8_t  width;
+  uint8_t  bytesPerRow;
+  uint8_t  yOffset;
+  uint8_t  height;
+  uint32_t offset;              // Start of the glyph data, 0 for a blank glyph
+  uint32_t length;              // Size of the glyph data in bytes
+} assetsFontGlyph_t;
+
+/* Reads len bytes at offset in a streamed pack, returning the number of
+   bytes actually read */
+typedef uint32_t (*assetsReadFunc_t)(void *param, uint32_t offset, uint8_t *buf, uint32_t len);
+
+/* An open pack, see assetsOpen and assetsOpenStream */
+typedef struct
+{
+  const uint8_t    *data;       // The pack in flash or RAM, NULL if streamed
+  assetsReadFunc_t read;        // Streamed packs only
+  void             *param;
+  uint16_t         count;       // Number of assets
+  uint32_t         size;        // Size of the pack in bytes
+} assetsPack_t;
+
+typedef struct
+{
+  uint32_t hits;                // Blocks found in the cache
+  uint32_t misses;              // Blocks read from storage into the cache
+  uint32_t evictions;           // Blocks dropped to make room
+  uint32_t uncached;            // Image data reads, which skip the cache
+  uint16_t blocks;              // Number of blocks the cache holds
+} assetsCacheStats_t;
+
+#ifdef CFG_BSP_TFTLCD
+/* A font in a pack, usable anywhere a font_t is taken (see FONT_ASSET).
+   info has the font's metrics, but no charTable or ranges, so it can't
+   be passed to the aafonts* functions directly. */
+typedef struct
+{
+  aafontsFont_t    info;
+  assetsPack_t     *pack;
+  uint32_t         offset;      // Start of the font in the pack
+  uint32_t         length;      // Size of the font in bytes
+  uint32_t         glyphs;      // Start of the assetsFontGlyph_t records
+  uint8_t          *buffer;     // Holds the glyph being drawn from a streamed pack
+  uint16_t         bufferSize;
+} assetsFont_t;
+#endif
+
+error_t   assetsOpen              ( assetsPack_t *pack, const uint8_t *data );
+error_t   assetsOpenStream        ( assetsPack_t *pack, assetsReadFunc_t read, void *param );
+#ifdef CFG_BSP_SDCARD
+error_t   assetsOpenFile          ( assetsPack_t *pack, FIL *file );
+#endif
+error_t   assetsFind              ( assetsPack_t *pack, uint16_t id, assetsEntry_t *entry );
+error_t   assetsRead              ( assetsPack_t *pack, const assetsEntry_t *entry, uint32_t offset, void *buf, uint32_t len );
+const uint8_t *assetsGetPointer   ( assetsPack_t *pack, const assetsEntry_t *entry );
+
+error_t   assetsCacheInit         ( void *buffer, uint32_t size );
+void      assetsCacheFlush        ( void );
+void      assetsCacheGetStats     ( assetsCacheStats_t *stats );
+void      assetsCacheResetStats   ( void );
+
+#ifdef CFG_BSP_TFTLCD
+error_t   assetsDrawImage         ( assetsPack_t *pack, uint16_t id, uint16_t x, uint16_t y );
+error_t   assetsDrawJpeg          ( assetsPack_t *pack, uint16_t id, jpegDecoder_t *jd, uint16_t x, uint16_t y, jpegScale_t scale );
+error_t   assetsOpenFont          ( assetsPack_t *pack, uint16_t id, assetsFont_t *font, uint8_t *buffer, uint16_t size );
+
+/* Used by the font engine (font.c) */
+const aafontsCharInfo_t *assetsGetCharInfo ( const assetsFont_t *font, uint16_t c, aafontsCharInfo_t *charInfo, bool load );
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -46,6 +46,8 @@
 #include "core/i2c/i2c.h"
 #include "core/delay/delay.h"
 #include "drivers/displays/smallfonts.h"
+#include "drivers/displays/font.h"
+#include "drivers/displays/floodfill.h"
 
 #define DELAY(mS)     do { delay(mS); } while(0);
 
@@ -54,11 +56,102 @@ uint8_t _ssd1306buffer[SSD1306_LCDWIDTH * SSD1306_LCDHEIGHT / 8];
 extern volatile uint8_t   I2CMasterBuffer[I2C_BUFSIZE];
 extern volatile uint8_t   I2CSlaveBuffer[I2C_BUFSIZE];
 extern volatile uint32_t  I2CReadLength, I2CWriteLength;
+extern volatile uint32_t  I2CMasterState;
+extern volatile uint32_t  RdIndex, WrIndex;
+
+#if SSD1306_ASYNC_DOUBLEBUFFER
+static uint8_t _ssd1306frontbuffer[sizeof(_ssd1306buffer)];
+#endif
+
+/* Background refresh state (see ssd1306RefreshAsync) */
+static struct
+{
+  volatile bool             busy;         /**< Transfer in progress */
+  uint8_t const            *frame;        /**< Frame being sent */
+  uint16_t                  index;        /**< Next frame byte to send */
+  uint32_t                  startTick;    /**< Tick the frame started */
+  uint32_t                  chunkTick;    /**< Tick the current chunk started */
+  uint32_t                  frameTime;    /**< Last completed frame time in ms */
+  error_t                   status;       /**< Status of the last frame */
+  ssd1306RefreshCallback_t  callback;
+} _ssd1306async;
 
 /**************************************************************************/
 /* Private Methods                                                        */
 /**************************************************************************/
 
+/**************************************************************************/
+/*!
+    @brief  Starts the interrupt-driven transfer of whatever is currently
+            in I2CMasterBuffer and returns without waiting for it
+
+    The I2C ISR clocks the bytes out and leaves I2CMasterState at
+    I2C_OK (or an error state) once the STOP condition is queued.
+*/
+/**************************************************************************/
+static void ssd1306AsyncStartChunk(void)
+{
+  _ssd1306async.chunkTick = delayGetTicks();
+  I2CReadLength = 0;
+  RdIndex = 0;
+  WrIndex = 0;
+  I2CMasterState = I2C_IDLE;
+  LPC_I2C->CONSET = I2CONSET_STA;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Queues the next slice of the frame as a single data burst
+
+    Each burst carries one control byte (Co = 0, D/C = 1) followed by as
+    many GDDRAM bytes as fit in I2CMasterBuffer, rather than one three
+    byte transaction per data byte as in ssd1306Refresh.
+*/
+/**************************************************************************/
+static void ssd1306AsyncNextChunk(void)
+{
+  uint16_t len = sizeof(_ssd1306buffer) - _ssd1306async.index;
+  uint16_t i;
+
+  if (len > I2C_BUFSIZE - 2)
+  {
+    len = I2C_BUFSIZE - 2;
+  }
+
+  I2CMasterBuffer[0] = SSD1306_I2C_ADDRESS;
+  I2CMasterBuffer[1] = 0x40;  /* Co = 0, D/C = 1 */
+  for (i = 0; i < len; i++)
+  {
+    I2CMasterBuffer[i + 2] = _ssd1306async.frame[_ssd1306async.index + i];
+  }
+  I2CWriteLength = len + 2;
+  _ssd1306async.index += len;
+
+  ssd1306AsyncStartChunk();
+}
+
+/**************************************************************************/
+/*!
+    @brief  Ends the background refresh and reports it to the callback
+*/
+/**************************************************************************/
+static void ssd1306AsyncFinish(error_t status)
+{
+  ssd1306RefreshCallback_t callback = _ssd1306async.callback;
+
+  _ssd1306async.status = status;
+  if (status == ERROR_NONE)
+  {
+    _ssd1306async.frameTime = delayGetTicks() - _ssd1306async.startTick;
+  }
+  _ssd1306async.busy = false;
+
+  if (callback)
+  {
+    callback(status, _ssd1306async.frameTime);
+  }
+}
+
 /**************************************************************************/
 /*!
     @brief Sends a command via I2C
@@ -71,6 +164,10 @@ error_t ssd1306SendCommand(uint8_t byte)
 {
   uint8_t control = 0x00;   /* Co = 0, D/C = 0 */
 
+  /* Let any background refresh release the bus first (this only
+     services the transfer when no ISR does) */
+  ssd1306RefreshWait();
+
   /* Send the specified bytes */
   I2CWriteLength = 3;
   I2CReadLength = 0;
@@ -95,6 +192,10 @@ error_t ssd1306SendData(uint8_t data)
 {
   uint8_t control = 0x40;   /* Co = 0, D/C = 1 */
 
+  /* Let any background refresh release the bus first (this only
+     services the transfer when no ISR does) */
+  ssd1306RefreshWait();
+
   /* Send the specified bytes */
   I2CWriteLength = 3;
   I2CReadLength = 0;
@@ -107,61 +208,174 @@ error_t ssd1306SendData(uint8_t data)
   return ERROR_NONE;
 }
 
+#ifdef CFG_BSP_TFTLCD
+/* Anti-aliased fonts only exist in builds with a TFT (see font.h) */
 /**************************************************************************/
 /*!
-    @brief  Draws a single graphic character using the supplied font
+    @brief  Sets a run of text pixels.  The display only has one bit per
+            pixel, so anti-aliased pixels are set from half intensity up.
 */
 /**************************************************************************/
-void ssd1306DrawChar(uint16_t x, uint16_t y, uint8_t c, struct FONT_DEF font)
+static inline void ssd1306TextSpan(uint8_t threshold, uint16_t x, uint16_t y, uint16_t len, uint8_t level)
 {
-  uint8_t col;
-  uint8_t column[font.u8Width];
-  uint16_t xoffset, yoffset;
+  if ((level >= threshold) && (x < SSD1306_LCDWIDTH) && (y < SSD1306_LCDHEIGHT))
+  {
+    ssd1306FillRect(x, y, len < SSD1306_LCDWIDTH ? len : SSD1306_LCDWIDTH, 1, true);
+  }
+}
+
+#define FONTRENDER_NAME       ssd1306TextRender
+#define FONTRENDER_CONTEXT    uint8_t
+#define FONTRENDER_SPAN       ssd1306TextSpan
+#include "drivers/displays/fontrender.h"
+#endif
+
+/**************************************************************************/
+/*!
+    @brief  ORs a column of 8 vertical pixels (LSB at the top) into the
+            page buffer, splitting it across two pages when y isn't a
+            multiple of 8
+*/
+/**************************************************************************/
+static inline void ssd1306TextColumn(uint16_t x, uint16_t y, uint8_t bits)
+{
+  uint8_t *p;
 
-  /* Make sure we are not exceeding the display limits
-     This also gets checked in ssd1306DrawPixel, but if we start
-     outside the limits we can avoid some unecessary work at the outset */
-  if ((x > SSD1306_LCDWIDTH) || (y > SSD1306_LCDHEIGHT))
+  if ((x >= SSD1306_LCDWIDTH) || (y >= SSD1306_LCDHEIGHT) || (bits == 0))
     return;
 
-  /* Check if the requested character is available */
-  if ((c >= font.u8FirstChar) && (c <= font.u8LastChar))
+  p = &_ssd1306buffer[(y / 8) * SSD1306_LCDWIDTH + x];
+  p[0] |= bits << (y % 8);
+  if ((y % 8) && (y / 8 + 1 < SSD1306_LCDHEIGHT / 8))
   {
-    /* Retrieve appropriate columns from font data */
-    for (col = 0; col < font.u8Width; col++)
-    {
-      column[col] = font.au8FontTable[((c - font.u8FirstChar) * font.u8Width) + col];    /* Get first column of appropriate character */
-    }
+    p[SSD1306_LCDWIDTH] |= bits >> (8 - y % 8);
   }
-  else
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws a small font glyph, which is already stored as one
+            page byte per column
+*/
+/**************************************************************************/
+static void ssd1306TextColumns(uint16_t x, uint16_t y, const fontGlyph_t *glyph)
+{
+  uint8_t mask = glyph->rows < 8 ? (1 << glyph->rows) - 1 : 0xFF;
+  uint8_t col;
+
+  for (col = 0; (col < glyph->width) && (x + col < SSD1306_LCDWIDTH); col++)
   {
-    /* Requested character is not available in this font ... send a space instead */
-    for (col = 0; col < font.u8Width; col++)
-    {
-      column[col] = 0xFF;    /* Send solid space */
-    }
+    ssd1306TextColumn(x + col, y + glyph->yOffset, glyph->data[col] & mask);
   }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws a 1-bit glyph stored in rows (FONT_INFO fonts), turning
+            each block of 8x8 pixels into 8 page bytes with a bit
+            matrix transpose
+*/
+/**************************************************************************/
+static void ssd1306TextRows(uint16_t x, uint16_t y, const fontGlyph_t *glyph)
+{
+  uint32_t hi, lo, t;
+  uint8_t block[8];
+  uint8_t row, band, col, i, n;
 
-  /* Render each column */
-  for (xoffset = 0; xoffset < font.u8Width; xoffset++)
+  y += glyph->yOffset;
+  for (row = 0; row < glyph->rows; row += 8)
   {
-    for (yoffset = 0; yoffset < (font.u8Height + 1); yoffset++)
+    band = glyph->rows - row < 8 ? glyph->rows - row : 8;
+    for (col = 0; (col < glyph->width) && (x + col < SSD1306_LCDWIDTH); col += 8)
     {
-      uint8_t bit = 0x00;
-      bit = (column[xoffset] << (8 - (yoffset + 1)));   /* Shift current row bit left */
-      bit = (bit >> 7);                                 /* Shift current row but right (results in 0x01 for black, and 0x00 for white) */
-      if (bit)
+      /* Bottom row first, so that row i ends up in bit i */
+      for (i = 0; i < 8; i++)
+      {
+        block[i] = 7 - i < band ? glyph->data[(row + 7 - i) * glyph->stride + col / 8] : 0;
+      }
+
+      hi = ((uint32_t)block[0] << 24) | ((uint32_t)block[1] << 16) | ((uint32_t)block[2] << 8) | block[3];
+      lo = ((uint32_t)block[4] << 24) | ((uint32_t)block[5] << 16) | ((uint32_t)block[6] << 8) | block[7];
+      if ((hi | lo) == 0)
+        continue;
+
+      t = (hi ^ (hi >> 7)) & 0x00AA00AA;  hi = hi ^ t ^ (t << 7);
+      t = (lo ^ (lo >> 7)) & 0x00AA00AA;  lo = lo ^ t ^ (t << 7);
+      t = (hi ^ (hi >> 14)) & 0x0000CCCC; hi = hi ^ t ^ (t << 14);
+      t = (lo ^ (lo >> 14)) & 0x0000CCCC; lo = lo ^ t ^ (t << 14);
+      t = (hi & 0xF0F0F0F0) | ((lo >> 4) & 0x0F0F0F0F);
+      lo = ((hi << 4) & 0xF0F0F0F0) | (lo & 0x0F0F0F0F);
+      hi = t;
+
+      /* Padding bits past the glyph width aren't drawn */
+      n = glyph->width - col < 8 ? glyph->width - col : 8;
+      for (i = 0; i < n; i++)
       {
-        ssd1306DrawPixel(x + xoffset, y + yoffset);
+        ssd1306TextColumn(x + col + i, y + row, (i < 4 ? hi >> (24 - i * 8) : lo >> (56 - i * 8)) & 0xFF);
       }
     }
   }
 }
 
+/**************************************************************************/
+/*!
+    @brief  Pixel access functions used by ssd1306FloodFill
+*/
+/**************************************************************************/
+static uint16_t ssd1306FloodFillGetPixel(uint16_t x, uint16_t y)
+{
+  return ssd1306GetPixel(x, y);
+}
+
+static void ssd1306FloodFillSpan(uint16_t x0, uint16_t x1, uint16_t y, uint16_t color)
+{
+  ssd1306FillRect(x0, y, x1 - x0 + 1, 1, color ? true : false);
+}
+
 /**************************************************************************/
 /* Public Methods                                                         */
 /**************************************************************************/
 
+/**************************************************************************/
+/*!
+    @brief  Sets or clears a rectangular block of pixels, working on
+            whole page bytes (8 vertical pixels) rather than pixel by
+            pixel
+*/
+/**************************************************************************/
+void ssd1306FillRect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, bool on)
+{
+  uint8_t page, lastPage, mask, col;
+  uint8_t *p;
+  uint16_t y1;
+
+  if ((x >= SSD1306_LCDWIDTH) || (y >= SSD1306_LCDHEIGHT) || (w == 0) || (h == 0))
+    return;
+
+  /* Clip to the display */
+  if (x + w > SSD1306_LCDWIDTH) w = SSD1306_LCDWIDTH - x;
+  y1 = (uint16_t)y + h - 1;
+  if (y1 >= SSD1306_LCDHEIGHT) y1 = SSD1306_LCDHEIGHT - 1;
+
+  lastPage = y1 / 8;
+  for (page = y / 8; page <= lastPage; page++)
+  {
+    /* Work out which bits of this page fall inside the rectangle */
+    mask = 0xFF;
+    if (page == y / 8)    mask &= (uint8_t)(0xFF << (y % 8));
+    if (page == lastPage) mask &= (uint8_t)(0xFF >> (7 - (y1 % 8)));
+
+    p = &_ssd1306buffer[page * SSD1306_LCDWIDTH + x];
+    for (col = 0; col < w; col++)
+    {
+      if (on)
+        p[col] |= mask;
+      else
+        p[col] &= ~mask;
+    }
+  }
+}
+
 /**************************************************************************/
 /*!
     @brief Initialises the SSD1306 LCD display
@@ -299,6 +513,179 @@ void ssd1306Refresh(void)
   }
 }
 
+/**************************************************************************/
+/*!
+    @brief  Starts a non-blocking refresh of the LCD
+
+    The addressing commands and the frame are sent as a series of
+    interrupt-driven I2C bursts.  The function returns as soon as the
+    first burst is queued; ssd1306RefreshService chains the remaining
+    bursts and calls 'callback' once the whole frame is on the panel.
+
+    With SSD1306_ASYNC_DOUBLEBUFFER set the frame is copied first, so
+    _ssd1306buffer can be redrawn immediately.  Otherwise leave it alone
+    until the callback fires.
+
+    @param[in]  callback
+                Called with the transfer status and frame time in ms
+                when the refresh ends (can be NULL)
+
+    @return     ERROR_DISPLAY_BUSY if the previous frame is still being
+                sent, in which case the new frame can simply be skipped
+
+    @section Example
+
+    @code
+
+    static volatile bool frameDone = true;
+
+    void frameSent(error_t status, uint32_t frameTime)
+    {
+      frameDone = true;
+    }
+
+    while (1)
+    {
+      // Keep the I2C bursts flowing between other work
+      ssd1306RefreshService();
+      usbProcess();
+
+      if (frameDone)
+      {
+        frameDone = false;
+        renderNextFrame();
+        ssd1306RefreshAsync(frameSent);
+      }
+    }
+
+    @endcode
+*/
+/**************************************************************************/
+error_t ssd1306RefreshAsync(ssd1306RefreshCallback_t callback)
+{
+  if (_ssd1306async.busy)
+  {
+    return ERROR_DISPLAY_BUSY;
+  }
+
+  #if SSD1306_ASYNC_DOUBLEBUFFER
+    memcpy(_ssd1306frontbuffer, _ssd1306buffer, sizeof(_ssd1306buffer));
+    _ssd1306async.frame = _ssd1306frontbuffer;
+  #else
+    _ssd1306async.frame = _ssd1306buffer;
+  #endif
+
+  _ssd1306async.index = 0;
+  _ssd1306async.callback = callback;
+  _ssd1306async.startTick = delayGetTicks();
+  _ssd1306async.busy = true;
+
+  /* Reset the GDDRAM pointer, all three commands in one burst */
+  I2CMasterBuffer[0] = SSD1306_I2C_ADDRESS;
+  I2CMasterBuffer[1] = 0x00;  /* Co = 0, D/C = 0 */
+  I2CMasterBuffer[2] = SSD1306_SETLOWCOLUMN | 0x0;
+  I2CMasterBuffer[3] = SSD1306_SETHIGHCOLUMN | 0x0;
+  I2CMasterBuffer[4] = SSD1306_SETSTARTLINE | 0x0;
+  I2CWriteLength = 5;
+  ssd1306AsyncStartChunk();
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Advances a background refresh started by ssd1306RefreshAsync
+
+    Call this regularly from the main loop, or from a periodic timer
+    interrupt with SSD1306_ASYNC_SERVICEINISR set to 1, but not both.
+    Each call checks whether the current burst has left the I2C block
+    and, if so, queues the next one, so the call itself never blocks.
+
+    @return     true while the refresh is still in progress
+*/
+/**************************************************************************/
+bool ssd1306RefreshService(void)
+{
+  uint32_t state;
+
+  if (!_ssd1306async.busy)
+  {
+    return false;
+  }
+
+  state = I2CMasterState;
+  switch (state)
+  {
+    case I2C_OK:
+      if (_ssd1306async.index < sizeof(_ssd1306buffer))
+      {
+        ssd1306AsyncNextChunk();
+      }
+      else
+      {
+        ssd1306AsyncFinish(ERROR_NONE);
+      }
+      break;
+    case I2C_NACK_ON_ADDRESS:
+    case I2C_NACK_ON_DATA:
+      ssd1306AsyncFinish(ERROR_I2C_NOACK);
+      break;
+    case I2C_ARBITRATION_LOST:
+      ssd1306AsyncFinish(ERROR_UNEXPECTEDVALUE);
+      break;
+    default:
+      /* Still clocking bytes out */
+      if (delayGetTicks() - _ssd1306async.chunkTick > SSD1306_ASYNC_TIMEOUT)
+      {
+        LPC_I2C->CONSET = I2CONSET_STO;
+        ssd1306AsyncFinish(ERROR_OPERATIONTIMEDOUT);
+      }
+      break;
+  }
+
+  return _ssd1306async.busy;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns true while a background refresh is in progress
+*/
+/**************************************************************************/
+bool ssd1306RefreshBusy(void)
+{
+  return _ssd1306async.busy;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Blocks until any background refresh has completed
+
+    @return     The status of the last background refresh
+*/
+/**************************************************************************/
+error_t ssd1306RefreshWait(void)
+{
+  #if SSD1306_ASYNC_SERVICEINISR
+    /* The timer ISR owns ssd1306RefreshService, so only watch it */
+    while (ssd1306RefreshBusy());
+  #else
+    while (ssd1306RefreshService());
+  #endif
+
+  return _ssd1306async.status;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns how long the last completed background refresh took
+            to reach the panel, in ms
+*/
+/**************************************************************************/
+uint32_t ssd1306RefreshGetFrameTime(void)
+{
+  return _ssd1306async.frameTime;
+}
+
 /**************************************************************************/
 /*!
     @brief  Draws a string using the supplied font data.
@@ -334,11 +721,80 @@ void ssd1306Refresh(void)
 /**************************************************************************/
 void ssd1306DrawString(uint16_t x, uint16_t y, char* text, struct FONT_DEF font)
 {
-  volatile uint8_t l;
-  for (l = 0; l < strlen(text); l++)
+  font_t textFont = FONT_SMALL(&font);
+
+  ssd1306DrawText(x, y, &textFont, text);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws a string in any font supported by font.h
+
+    Small fonts are stored a column byte at a time, the same layout as
+    the pages in the frame buffer, so each glyph column is ORed into
+    the buffer as a whole byte (split across two pages if y isn't a
+    multiple of 8).  Bitmap (FONT_INFO) glyphs are turned into column
+    bytes 8x8 pixels at a time on the way.  Anti-aliased fonts are drawn
+    a run of pixels at a time, and pixels are set if they are at least
+    half intensity.
+
+    @param[in]  x
+                Starting x co-ordinate
+    @param[in]  y
+                Starting y co-ordinate (top of the character cell)
+    @param[in]  font
+                The font to render with
+    @param[in]  str
+                The string to render
+
+    @return The x co-ordinate after the last character
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/bitmap/ssd1306/ssd1306_i2c.h"
+    #include "drivers/displays/graphic/fonts/dejavusans9.h"
+
+    font_t font = FONT_BITMAP(&dejaVuSans9ptFontInfo);
+
+    ssd1306Init(SSD1306_INTERNALVCC);
+    ssd1306DrawText(1, 10, &font, "DejaVu Sans 9");
+    ssd1306Refresh();
+
+    @endcode
+*/
+/**************************************************************************/
+uint16_t ssd1306DrawText(uint16_t x, uint16_t y, const font_t *font, const char *str)
+{
+  fontGlyph_t glyph;
+  uint16_t c;
+
+  #ifdef CFG_BSP_TFTLCD
+  if (fontGetLevels(font) > 1)
+  {
+    return ssd1306TextRenderString((fontGetLevels(font) + 1) / 2, x, y, font, str);
+  }
+  #endif
+
+  while ((c = fontNextChar(font, &str)) != 0)
   {
-    ssd1306DrawChar(x + (l * (font.u8Width + 1)), y, text[l], font);
+    fontGetGlyph(font, c, &glyph);
+    if ((x < SSD1306_LCDWIDTH) && (glyph.data != NULL))
+    {
+      if (glyph.layout == FONT_LAYOUT_COLUMNS)
+      {
+        ssd1306TextColumns(x, y, &glyph);
+      }
+      else
+      {
+        ssd1306TextRows(x, y, &glyph);
+      }
+    }
+    x += glyph.advance;
   }
+
+  return x;
 }
 
 /**************************************************************************/
@@ -409,3 +865,124 @@ void ssd1306ShiftFrameBuffer( uint8_t height )
     }
   }
 }
+
+/**************************************************************************/
+/*!
+    @brief  Renders a QR code symbol into the frame buffer
+
+    The quiet zone and light modules are rendered as lit pixels, and dark
+    modules as unlit pixels, so that the symbol reads the same way as a
+    printed code.  Rows of modules are rendered as page-wide byte masks
+    rather than individual pixels.
+
+    @param[in]  x
+                The horizontal location of the top-left corner of the
+                quiet zone
+    @param[in]  y
+                The vertical location of the top-left corner of the
+                quiet zone
+    @param[in]  qr
+                Pointer to a qrcode_t populated by qrcodeEncode
+    @param[in]  scale
+                The size of a single module in pixels (1 or more).  A
+                version 1 symbol (21x21 modules + quiet zone) fits on a
+                128x32 display at scale 1, and a 128x64 display at scale 2
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/bitmap/ssd1306/ssd1306_i2c.h"
+    #include "drivers/displays/qrcode.h"
+
+    static qrcode_t qr;
+    uint8_t work[QRCODE_BUFFER_LEN_MAX];
+
+    ssd1306Init(SSD1306_INTERNALVCC);
+
+    if (!qrcodeEncode(&qr, (uint8_t *)"0123456789", 10, QRCODE_ECC_MEDIUM, work))
+    {
+      ssd1306DrawQRCode(0, 0, &qr, 2);
+      ssd1306Refresh();
+    }
+
+    @endcode
+*/
+/**************************************************************************/
+void ssd1306DrawQRCode(uint8_t x, uint8_t y, const qrcode_t *qr, uint8_t scale)
+{
+  uint16_t total, left, top, px, py;
+  uint8_t  row, col, start;
+
+  if ((qr == NULL) || (scale == 0))
+    return;
+
+  /* Light background and quiet zone */
+  total = (qr->size + QRCODE_QUIETZONE * 2) * scale;
+  ssd1306FillRect(x, y, total > 255 ? 255 : total, total > 255 ? 255 : total, true);
+
+  /* Clear each horizontal run of dark modules */
+  left = x + QRCODE_QUIETZONE * scale;
+  top = y + QRCODE_QUIETZONE * scale;
+  for (row = 0; row < qr->size; row++)
+  {
+    col = 0;
+    while (col < qr->size)
+    {
+      if (!qrcodeGetModule(qr, col, row))
+      {
+        col++;
+        continue;
+      }
+      start = col;
+      while ((col < qr->size) && qrcodeGetModule(qr, col, row))
+      {
+        col++;
+      }
+      px = left + start * scale;
+      py = top + row * scale;
+      if ((px < SSD1306_LCDWIDTH) && (py < SSD1306_LCDHEIGHT))
+      {
+        ssd1306FillRect(px, py, (col - start) * scale > 255 ? 255 : (col - start) * scale, scale, false);
+      }
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Fills the 4-connected area of lit or unlit pixels around x/y
+            in the frame buffer with the opposite state
+
+    @param[in]  x
+                Horizontal position of the seed pixel
+    @param[in]  y
+                Vertical position of the seed pixel
+    @param[in]  on
+                True to light the area, false to clear it
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/bitmap/ssd1306/ssd1306_i2c.h"
+
+    ssd1306FloodFill(64, 16, true);
+    ssd1306Refresh();
+
+    @endcode
+*/
+/**************************************************************************/
+error_t ssd1306FloodFill(uint8_t x, uint8_t y, bool on)
+{
+  floodfillSurface_t surface;
+
+  surface.x = 0;
+  surface.y = 0;
+  surface.width = SSD1306_LCDWIDTH;
+  surface.height = SSD1306_LCDHEIGHT;
+  surface.getPixel = ssd1306FloodFillGetPixel;
+  surface.fillSpan = ssd1306FloodFillSpan;
+
+  return floodfill(&surface, x, y, on ? 1 : 0, NULL);
+}
@@ -43,6 +43,8 @@ extern "C" {
 #include "bspconfig.h"
 
 #include "drivers/displays/smallfonts.h"
+#include "drivers/displays/font.h"
+#include "drivers/displays/qrcode.h"
 
 /*=========================================================================
     Display Size
@@ -88,6 +90,37 @@ extern "C" {
 /*=========================================================================*/
 
 
+/*=========================================================================
+    Background Refresh
+    -----------------------------------------------------------------------
+    SSD1306_ASYNC_DOUBLEBUFFER  If set to 1, ssd1306RefreshAsync copies
+                                the frame into a second buffer before
+                                the transfer starts, so drawing can
+                                continue in _ssd1306buffer straight
+                                away.  Costs an extra 1KB (128x64) or
+                                512 bytes (128x32) of SRAM.  If set to
+                                0 the transfer streams directly from
+                                _ssd1306buffer and the frame must not be
+                                touched until the refresh completes.
+
+    SSD1306_ASYNC_TIMEOUT       Maximum time in ms a single I2C chunk
+                                may take before the background refresh
+                                is aborted with ERROR_OPERATIONTIMEDOUT
+
+    SSD1306_ASYNC_SERVICEINISR  Set to 1 if ssd1306RefreshService is
+                                called from a periodic timer interrupt.
+                                ssd1306RefreshWait (and the blocking
+                                command and data writes) then only wait
+                                for the ISR to finish the frame instead
+                                of servicing it themselves.  Set to 0
+                                if it's called from the main loop.
+    ---------------------------------------------------------------------*/
+    #define SSD1306_ASYNC_DOUBLEBUFFER    (1)
+    #define SSD1306_ASYNC_TIMEOUT         (10)
+    #define SSD1306_ASYNC_SERVICEINISR    (0)
+/*=========================================================================*/
+
+
 /*=========================================================================
     Commands
     ---------------------------------------------------------------------*/
@@ -117,14 +150,31 @@ extern "C" {
     #define SSD1306_SWITCHCAPVCC          0x02
 /*=========================================================================*/
 
+/**************************************************************************/
+/*!
+    @brief  Called once a background refresh completes, with the
+            final transfer status and the frame time in ms
+*/
+/**************************************************************************/
+typedef void (*ssd1306RefreshCallback_t)(error_t status, uint32_t frameTime);
+
 error_t ssd1306Init ( uint8_t vccstate );
 void    ssd1306DrawPixel ( uint8_t x, uint8_t y );
 void    ssd1306ClearPixel ( uint8_t x, uint8_t y );
 uint8_t ssd1306GetPixel ( uint8_t x, uint8_t y );
 void    ssd1306ClearScreen ( void );
 void    ssd1306Refresh ( void );
+error_t ssd1306RefreshAsync ( ssd1306RefreshCallback_t callback );
+bool    ssd1306RefreshService ( void );
+bool    ssd1306RefreshBusy ( void );
+error_t ssd1306RefreshWait ( void );
+uint32_t ssd1306RefreshGetFrameTime ( void );
 void    ssd1306DrawString( uint16_t x, uint16_t y, char* text, struct FONT_DEF font );
+uint16_t ssd1306DrawText ( uint16_t x, uint16_t y, const font_t *font, const char *str );
 void    ssd1306ShiftFrameBuffer( uint8_t height );
+void    ssd1306FillRect ( uint8_t x, uint8_t y, uint8_t w, uint8_t h, bool on );
+void    ssd1306DrawQRCode ( uint8_t x, uint8_t y, const qrcode_t *qr, uint8_t scale );
+error_t ssd1306FloodFill ( uint8_t x, uint8_t y, bool on );
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,335 @@
+/**************************************************************************/
+/*!
+    @file     floodfill.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <string.h>
+
+#include "floodfill.h"
+
+typedef struct
+{
+  uint16_t x;
+  uint16_t y;
+} floodfillSeed_t;
+
+typedef struct
+{
+  const floodfillSurface_t *surface;
+  uint16_t        target;       // The color being replaced
+  uint16_t        color;        // The fill color
+  floodfillSeed_t stack[FLOODFILL_STACKSIZE];
+  uint8_t         count;
+  bool            overflow;     // A seed was dropped during this pass
+  uint16_t        dropXMin;     // Bounding box of the dropped seeds
+  uint16_t        dropXMax;
+  uint16_t        dropYMin;
+  uint16_t        dropYMax;
+  bool            useMap;       // The surface fits in map
+  uint8_t         map[FLOODFILL_MAPSIZE];   // Pixels this fill has changed
+} floodfillState_t;
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Private Methods ------------------------------ */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Pushes a seed onto the span stack
+
+    When the stack is full, seeds that have been filled in the meantime
+    are squeezed out first.  If it's still full the seed is dropped and
+    its position is added to the area that will be rescanned later.
+*/
+/**************************************************************************/
+static void floodfillPush(floodfillState_t *s, uint16_t x, uint16_t y)
+{
+  uint8_t i, n;
+
+  if (s->count == FLOODFILL_STACKSIZE)
+  {
+    for (i = 0, n = 0; i < s->count; i++)
+    {
+      if (s->surface->getPixel(s->stack[i].x, s->stack[i].y) == s->target)
+      {
+        s->stack[n++] = s->stack[i];
+      }
+    }
+    s->count = n;
+  }
+
+  if (s->count == FLOODFILL_STACKSIZE)
+  {
+    if (!s->overflow)
+    {
+      s->overflow = true;
+      s->dropXMin = s->dropXMax = x;
+      s->dropYMin = s->dropYMax = y;
+    }
+    else
+    {
+      if (x < s->dropXMin) s->dropXMin = x;
+      if (x > s->dropXMax) s->dropXMax = x;
+      if (y < s->dropYMin) s->dropYMin = y;
+      if (y > s->dropYMax) s->dropYMax = y;
+    }
+    return;
+  }
+
+  s->stack[s->count].x = x;
+  s->stack[s->count].y = y;
+  s->count++;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the bit in the fill map for pixel x/y
+*/
+/**************************************************************************/
+static inline uint32_t floodfillMapIndex(const floodfillState_t *s, uint16_t x, uint16_t y)
+{
+  return (uint32_t)(y - s->surface->y) * s->surface->width + (x - s->surface->x);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns true if this fill changed pixel x/y
+*/
+/**************************************************************************/
+static bool floodfillFilled(const floodfillState_t *s, uint16_t x, uint16_t y)
+{
+  uint32_t i = floodfillMapIndex(s, x, y);
+
+  return (s->map[i / 8] & (1 << (i % 8))) != 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Pushes one seed for each run of the target color on row y
+            between x0 and x1
+*/
+/**************************************************************************/
+static void floodfillScanRow(floodfillState_t *s, uint16_t x0, uint16_t x1, uint16_t y)
+{
+  bool inRun = false;
+  uint16_t x;
+
+  for (x = x0; x <= x1; x++)
+  {
+    if (s->surface->getPixel(x, y) == s->target)
+    {
+      if (!inRun)
+      {
+        floodfillPush(s, x, y);
+        inRun = true;
+      }
+    }
+    else
+    {
+      inRun = false;
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Fills spans until the stack is empty
+*/
+/**************************************************************************/
+static void floodfillRun(floodfillState_t *s)
+{
+  const floodfillSurface_t *surface = s->surface;
+  uint16_t x, y, xl, xr;
+  uint32_t i;
+
+  while (s->count)
+  {
+    s->count--;
+    x = s->stack[s->count].x;
+    y = s->stack[s->count].y;
+    if (surface->getPixel(x, y) != s->target)
+    {
+      continue;
+    }
+
+    // Extend the span as far as possible in both directions
+    xl = x;
+    while ((xl > surface->x) && (surface->getPixel(xl - 1, y) == s->target))
+    {
+      xl--;
+    }
+    xr = x;
+    while ((xr + 1 < surface->x + surface->width) && (surface->getPixel(xr + 1, y) == s->target))
+    {
+      xr++;
+    }
+
+    surface->fillSpan(xl, xr, y, s->color);
+    if (s->useMap)
+    {
+      for (i = floodfillMapIndex(s, xl, y); i <= floodfillMapIndex(s, xr, y); i++)
+      {
+        s->map[i / 8] |= 1 << (i % 8);
+      }
+    }
+
+    // Look for new runs directly above and below the span
+    if (y > surface->y)
+    {
+      floodfillScanRow(s, xl, xr, y - 1);
+    }
+    if (y + 1 < surface->y + surface->height)
+    {
+      floodfillScanRow(s, xl, xr, y + 1);
+    }
+  }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Public Methods ------------------------------- */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Replaces the 4-connected area of one color around x/y with
+            a new color, using a scanline fill with a fixed-size span
+            stack so that the RAM required is always the same
+
+    The stack holds FLOODFILL_STACKSIZE seeds.  If a complex shape needs
+    more than this, the seeds that don't fit are dropped and the fill
+    carries on.  Once the stack is empty, the rows and columns where
+    seeds were dropped are rescanned for runs of the original color
+    directly above or below a pixel the fill has changed, and each run
+    found seeds another pass.  This repeats until a pass completes
+    without dropping anything.  The result is slower, but it's the same
+    as a single pass.
+
+    The fill remembers the pixels it has changed in a bitmap of
+    FLOODFILL_MAPSIZE bytes, since pixels that already had the fill
+    color aren't part of the area and mustn't seed it.  If the surface
+    has more pixels than the bitmap can hold, a fill that overflows the
+    stack stops after the first pass and returns
+    ERROR_FLOODFILL_OVERFLOW, leaving part of the area filled.
+
+    @param[in]  surface
+                The surface to fill (position, size and pixel access
+                functions)
+    @param[in]  x
+                Horizontal position of the seed pixel
+    @param[in]  y
+                Vertical position of the seed pixel
+    @param[in]  color
+                The new color
+    @param[out] passes
+                Optional pointer that receives the number of passes
+                required (1 unless the stack overflowed), or NULL
+*/
+/**************************************************************************/
+error_t floodfill(const floodfillSurface_t *surface, uint16_t x, uint16_t y, uint16_t color, uint8_t *passes)
+{
+  floodfillState_t s;
+  uint16_t px, py, x0, x1, y0, y1;
+  uint8_t  passCount = 1;
+  bool     inRun;
+
+  if ((surface == NULL) || (surface->getPixel == NULL) || (surface->fillSpan == NULL) ||
+      (x < surface->x) || (y < surface->y) ||
+      (x >= surface->x + surface->width) || (y >= surface->y + surface->height))
+  {
+    return ERROR_INVALIDPARAMETER;
+  }
+
+  memset(&s, 0, sizeof(floodfillState_t));
+  s.surface = surface;
+  s.target = surface->getPixel(x, y);
+  s.color = color;
+  s.useMap = (uint32_t)surface->width * surface->height <= FLOODFILL_MAPSIZE * 8UL;
+
+  if (s.target != color)
+  {
+    floodfillPush(&s, x, y);
+    floodfillRun(&s);
+
+    if (s.overflow && !s.useMap)
+    {
+      return ERROR_FLOODFILL_OVERFLOW;
+    }
+
+    // Multi-pass fallback if any seeds were dropped
+    while (s.overflow)
+    {
+      s.overflow = false;
+      x0 = s.dropXMin;
+      x1 = s.dropXMax;
+      y0 = s.dropYMin;
+      y1 = s.dropYMax;
+
+      for (py = y0; py <= y1; py++)
+      {
+        inRun = false;
+        for (px = x0; px <= x1; px++)
+        {
+          if (surface->getPixel(px, py) != s.target)
+          {
+            inRun = false;
+            continue;
+          }
+          if (!inRun &&
+              (((py > surface->y) && floodfillFilled(&s, px, py - 1)) ||
+               ((py + 1 < surface->y + surface->height) && floodfillFilled(&s, px, py + 1))))
+          {
+            floodfillPush(&s, px, py);
+            inRun = true;
+          }
+        }
+        floodfillRun(&s);
+      }
+
+      if (passCount < 0xFF)
+      {
+        passCount++;
+      }
+    }
+  }
+
+  if (passes)
+  {
+    *passes = passCount;
+  }
+
+  return ERROR_NONE;
+}
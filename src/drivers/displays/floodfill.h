@@ -0,0 +1,82 @@
+/**************************************************************************/
+/*!
+    @file     floodfill.h
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#ifndef __FLOODFILL_H__
+#define __FLOODFILL_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "bspconfig.h"
+
+/*=========================================================================
+    FLOOD FILL SETTINGS
+    -----------------------------------------------------------------------
+    FLOODFILL_STACKSIZE     The number of seeds the span stack can hold.
+                            Each seed takes 4 bytes of stack space.  If
+                            a shape needs more than this the fill falls
+                            back to extra rescan passes (see floodfill.c)
+    FLOODFILL_MAPSIZE       Bytes of stack used to remember which pixels
+                            the fill has changed, one bit per pixel of
+                            the surface.  The rescan passes need this to
+                            tell filled pixels from ones that already had
+                            the fill color, so on surfaces with more than
+                            FLOODFILL_MAPSIZE * 8 pixels a fill that
+                            overflows the stack stops with an error.
+                            1024 bytes covers the 128x64 SSD1306
+    -----------------------------------------------------------------------*/
+    #define FLOODFILL_STACKSIZE         (64)
+    #define FLOODFILL_MAPSIZE           (1024)
+/*=========================================================================*/
+
+/* Describes a surface that can be read back and filled one span at a time */
+typedef struct
+{
+  uint16_t x;         // Top-left corner of the surface
+  uint16_t y;
+  uint16_t width;
+  uint16_t height;
+  uint16_t (*getPixel)(uint16_t x, uint16_t y);
+  void     (*fillSpan)(uint16_t x0, uint16_t x1, uint16_t y, uint16_t color);
+} floodfillSurface_t;
+
+error_t floodfill ( const floodfillSurface_t *surface, uint16_t x, uint16_t y, uint16_t color, uint8_t *passes );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
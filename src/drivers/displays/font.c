@@ -0,0 +1,540 @@
+/**************************************************************************/
+/*!
+    @file     font.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <string.h>
+
+#include "font.h"
+
+/* Columns drawn for characters missing from a small font */
+static const uint8_t _fontSmallMissing[8] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Private Methods ------------------------------ */
+/*                                                                        */
+/**************************************************************************/
+
+/* Each format provides NextChar, GetGlyph, Advance, Height, Levels and
+   Spacing, named font<Name><Op>, and FONT_FORMATS switches between them */
+
+/**************************************************************************/
+/*!
+    @brief  Bitmap fonts (FONT_INFO, fonts.h)
+
+    Bitmap fonts don't range-check characters, so anything outside the
+    font is drawn as a space (or the font's first character if the font
+    has no space).
+*/
+/**************************************************************************/
+static inline uint16_t fontBitmapFilter(const FONT_INFO *f, uint16_t c)
+{
+  if ((c >= f->startChar) && (c <= f->endChar))
+  {
+    return c;
+  }
+  return ((' ' >= f->startChar) && (' ' <= f->endChar)) ? ' ' : f->startChar;
+}
+
+static inline uint16_t fontBitmapNextChar(const FONT_INFO *f, const char **str)
+{
+  uint16_t c = (uint8_t)**str;
+
+  if (c == 0)
+  {
+    return 0;
+  }
+  (*str)++;
+  return fontBitmapFilter(f, c);
+}
+
+static inline bool fontBitmapGetGlyph(const FONT_INFO *f, uint16_t c, fontGlyph_t *glyph)
+{
+  uint16_t index = fontBitmapFilter(f, c) - f->startChar;
+
+  // some fonts have character descriptors, some are 5 pixels wide
+  if (f->charInfo != NULL)
+  {
+    glyph->width = f->charInfo[index].widthBits;
+    glyph->data = &f->data[f->charInfo[index].offset];
+  }
+  else
+  {
+    glyph->width = 5;
+    glyph->data = &f->data[index * 5];
+  }
+
+  // fonts with trimmed bitmaps only store some of the rows
+  if (f->metrics != NULL)
+  {
+    glyph->yOffset = f->metrics[index].yOffset;
+    glyph->rows = f->metrics[index].height;
+  }
+  else
+  {
+    glyph->yOffset = 0;
+    glyph->rows = f->height;
+  }
+
+  glyph->layout = FONT_LAYOUT_PACKED;
+  glyph->bits = 1;
+  glyph->stride = (glyph->width + 7) / 8;
+  glyph->advance = glyph->width + 1;
+
+  return true;
+}
+
+static inline uint16_t fontBitmapAdvance(const FONT_INFO *f, uint16_t c)
+{
+  uint16_t index = fontBitmapFilter(f, c) - f->startChar;
+
+  return (f->charInfo != NULL ? f->charInfo[index].widthBits : 5) + 1;
+}
+
+static inline uint16_t fontBitmapHeight(const FONT_INFO *f)  { return f->height; }
+static inline uint8_t  fontBitmapLevels(const FONT_INFO *f)  { (void)f; return 1; }
+static inline uint8_t  fontBitmapSpacing(const FONT_INFO *f) { (void)f; return 1; }
+static inline bool     fontBitmapCompressed(const FONT_INFO *f) { (void)f; return false; }
+
+/**************************************************************************/
+/*!
+    @brief  Small fixed-width fonts (struct FONT_DEF, smallfonts.h)
+*/
+/**************************************************************************/
+static inline uint16_t fontSmallNextChar(const struct FONT_DEF *f, const char **str)
+{
+  uint16_t c = (uint8_t)**str;
+
+  (void)f;
+  if (c != 0)
+  {
+    (*str)++;
+  }
+  return c;
+}
+
+// Glyphs use the row below u8Height as well, up to the 8 bits in a column
+static inline uint8_t fontSmallRows(const struct FONT_DEF *f)
+{
+  return f->u8Height < 8 ? f->u8Height + 1 : 8;
+}
+
+static inline bool fontSmallGetGlyph(const struct FONT_DEF *f, uint16_t c, fontGlyph_t *glyph)
+{
+  glyph->layout = FONT_LAYOUT_COLUMNS;
+  glyph->bits = 1;
+  glyph->width = f->u8Width;
+  glyph->advance = f->u8Width + 1;
+  glyph->yOffset = 0;
+
+  if ((c < f->u8FirstChar) || (c > f->u8LastChar))
+  {
+    // Requested character is not available in this font ... send a solid block instead
+    glyph->data = _fontSmallMissing;
+    glyph->width = f->u8Width < sizeof(_fontSmallMissing) ? f->u8Width : sizeof(_fontSmallMissing);
+    glyph->rows = fontSmallRows(f);
+    return false;
+  }
+
+  glyph->data = &f->au8FontTable[(c - f->u8FirstChar) * f->u8Width];
+  glyph->rows = fontSmallRows(f);
+  return true;
+}
+
+static inline uint16_t fontSmallAdvance(const struct FONT_DEF *f, uint16_t c)
+{
+  (void)c;
+  return f->u8Width + 1;
+}
+
+static inline uint16_t fontSmallHeight(const struct FONT_DEF *f)  { return f->u8Height; }
+static inline uint8_t  fontSmallLevels(const struct FONT_DEF *f)  { (void)f; return 1; }
+static inline uint8_t  fontSmallSpacing(const struct FONT_DEF *f) { (void)f; return 1; }
+static inline bool     fontSmallCompressed(const struct FONT_DEF *f) { (void)f; return false; }
+
+#ifdef CFG_BSP_TFTLCD
+/**************************************************************************/
+/*!
+    @brief  Anti-aliased fonts (aafontsFont_t, aafonts.h), decoded as
+            UTF-8
+*/
+/**************************************************************************/
+static inline uint16_t fontAANextChar(const aafontsFont_t *f, const char **str)
+{
+  (void)f;
+  return aafontsUtf8Next(str);
+}
+
+static inline bool fontAAGlyphFromInfo(const aafontsFont_t *f, const aafontsCharInfo_t *charInfo, fontGlyph_t *glyph)
+{
+  glyph->bits = f->fontType == AAFONTS_FONTTYPE_AA2 ? 2 : 4;
+
+  if (charInfo == NULL)
+  {
+    // Character isn't in the font, leave a gap
+    glyph->data = NULL;
+    glyph->width = 0;
+    glyph->advance = f->unknownCharWidth;
+    glyph->rows = 0;
+    return false;
+  }
+
+  glyph->data = charInfo->charData;
+  glyph->width = charInfo->width;
+  glyph->advance = charInfo->width;
+  glyph->stride = charInfo->bytesPerRow;
+  glyph->yOffset = charInfo->yOffset;
+  glyph->rows = charInfo->yOffset < f->fontHeight ? charInfo->height : 0;
+  if (charInfo->yOffset + glyph->rows > f->fontHeight)
+  {
+    glyph->rows = f->fontHeight - charInfo->yOffset;
+  }
+
+  if (f->encoding == AAFONTS_ENCODING_RLE)
+  {
+    glyph->layout = FONT_LAYOUT_RLE;
+    aafontsGlyphReaderInit(&glyph->reader, f, charInfo);
+  }
+  else
+  {
+    glyph->layout = FONT_LAYOUT_PACKED;
+  }
+
+  return true;
+}
+
+static inline bool fontAAGetGlyph(const aafontsFont_t *f, uint16_t c, fontGlyph_t *glyph)
+{
+  return fontAAGlyphFromInfo(f, aafontsGetCharInfo(f, c), glyph);
+}
+
+static inline uint16_t fontAAAdvance(const aafontsFont_t *f, uint16_t c)
+{
+  const aafontsCharInfo_t *charInfo = aafontsGetCharInfo(f, c);
+
+  return charInfo != NULL ? charInfo->width : f->unknownCharWidth;
+}
+
+static inline uint16_t fontAAHeight(const aafontsFont_t *f)  { return f->fontHeight; }
+static inline uint8_t  fontAALevels(const aafontsFont_t *f)  { return f->fontType == AAFONTS_FONTTYPE_AA2 ? 3 : 15; }
+static inline uint8_t  fontAASpacing(const aafontsFont_t *f) { (void)f; return 0; }
+static inline bool     fontAACompressed(const aafontsFont_t *f) { return f->encoding == AAFONTS_ENCODING_RLE; }
+
+/**************************************************************************/
+/*!
+    @brief  Anti-aliased fonts in an asset pack (assetsFont_t, assets.h)
+
+    The glyph tables are looked up in the pack, and each glyph is then
+    drawn like a glyph of a flash font.  Measuring text only reads the
+    glyph metrics, not the pixel data.
+*/
+/**************************************************************************/
+static inline uint16_t fontAssetNextChar(const assetsFont_t *f, const char **str)
+{
+  (void)f;
+  return aafontsUtf8Next(str);
+}
+
+static inline bool fontAssetGetGlyph(const assetsFont_t *f, uint16_t c, fontGlyph_t *glyph)
+{
+  aafontsCharInfo_t charInfo;
+
+  return fontAAGlyphFromInfo(&f->info, assetsGetCharInfo(f, c, &charInfo, true), glyph);
+}
+
+static inline uint16_t fontAssetAdvance(const assetsFont_t *f, uint16_t c)
+{
+  aafontsCharInfo_t charInfo;
+
+  return assetsGetCharInfo(f, c, &charInfo, false) != NULL ? charInfo.width : f->info.unknownCharWidth;
+}
+
+static inline uint16_t fontAssetHeight(const assetsFont_t *f)  { return f->info.fontHeight; }
+static inline uint8_t  fontAssetLevels(const assetsFont_t *f)  { return fontAALevels(&f->info); }
+static inline uint8_t  fontAssetSpacing(const assetsFont_t *f) { (void)f; return 0; }
+static inline bool     fontAssetCompressed(const assetsFont_t *f) { return fontAACompressed(&f->info); }
+#endif
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Public Methods ------------------------------- */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Returns the next character of str and advances past it
+
+    Anti-aliased fonts decode UTF-8, the other formats take one byte
+    per character.
+
+    @param[in]  font
+                The font the string is drawn with
+    @param[in]  str
+                Pointer to the current position in the string, which
+                is left on the NULL terminator at the end
+
+    @return The character, or 0 at the end of the string
+*/
+/**************************************************************************/
+uint16_t fontNextChar(const font_t *font, const char **str)
+{
+  #define FONT_CASE(ENUM, Name, type, member) \
+    case FONT_FORMAT_##ENUM: return font##Name##NextChar(font->data.member, str);
+  switch (font->format)
+  {
+    FONT_FORMATS(FONT_CASE)
+    default: break;
+  }
+  #undef FONT_CASE
+  return 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Looks up a character and prepares its pixels for
+            fontReadGlyph
+
+    @param[in]  font
+                The font to use
+    @param[in]  c
+                The character, as returned by fontNextChar
+    @param[out] glyph
+                The glyph.  Characters that aren't in the font get a
+                blank glyph (no rows) with the width of the gap the
+                format leaves for them.
+
+    @return false if the character isn't in the font
+*/
+/**************************************************************************/
+bool fontGetGlyph(const font_t *font, uint16_t c, fontGlyph_t *glyph)
+{
+  glyph->row = 0;
+  glyph->col = 0;
+
+  #define FONT_CASE(ENUM, Name, type, member) \
+    case FONT_FORMAT_##ENUM: return font##Name##GetGlyph(font->data.member, c, glyph);
+  switch (font->format)
+  {
+    FONT_FORMATS(FONT_CASE)
+    default: break;
+  }
+  #undef FONT_CASE
+
+  memset(glyph, 0, sizeof(fontGlyph_t));
+  return false;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Reads the next pixels of a glyph as levels from 0
+            (background) to fontGetLevels (solid)
+
+    Pixels are returned left to right, one row after the other, and a
+    single call never goes past the end of the current row.
+
+    @param[in]  glyph
+                The glyph set up by fontGetGlyph
+    @param[out] levels
+                Receives one level per pixel
+    @param[in]  count
+                Number of pixels to read
+*/
+/**************************************************************************/
+void fontReadGlyph(fontGlyph_t *glyph, uint8_t *levels, uint8_t count)
+{
+  const uint8_t *p;
+  uint8_t i, shift, mask;
+
+  switch (glyph->layout)
+  {
+    case FONT_LAYOUT_PACKED:
+      p = &glyph->data[glyph->row * glyph->stride + ((glyph->col * glyph->bits) >> 3)];
+      shift = 8 - glyph->bits - ((glyph->col * glyph->bits) & 7);
+      mask = (1 << glyph->bits) - 1;
+      for (i = 0; i < count; i++)
+      {
+        levels[i] = (*p >> shift) & mask;
+        if (shift == 0)
+        {
+          shift = 8 - glyph->bits;
+          p++;
+        }
+        else
+        {
+          shift -= glyph->bits;
+        }
+      }
+      break;
+    case FONT_LAYOUT_COLUMNS:
+      p = &glyph->data[glyph->col];
+      for (i = 0; i < count; i++)
+      {
+        levels[i] = (p[i] >> glyph->row) & 1;
+      }
+      break;
+    #ifdef CFG_BSP_TFTLCD
+    case FONT_LAYOUT_RLE:
+      for (i = 0; i < count; i++)
+      {
+        levels[i] = aafontsGlyphReaderNext(&glyph->reader);
+      }
+      break;
+    #endif
+  }
+
+  glyph->col += count;
+  if (glyph->col >= glyph->width)
+  {
+    glyph->col = 0;
+    glyph->row++;
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the height of the font's character cell in pixels
+*/
+/**************************************************************************/
+uint16_t fontGetHeight(const font_t *font)
+{
+  #define FONT_CASE(ENUM, Name, type, member) \
+    case FONT_FORMAT_##ENUM: return font##Name##Height(font->data.member);
+  switch (font->format)
+  {
+    FONT_FORMATS(FONT_CASE)
+    default: break;
+  }
+  #undef FONT_CASE
+  return 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the highest level fontReadGlyph returns for the
+            font (1 for monochrome fonts, 3 for AA2 and 15 for AA4)
+*/
+/**************************************************************************/
+uint8_t fontGetLevels(const font_t *font)
+{
+  #define FONT_CASE(ENUM, Name, type, member) \
+    case FONT_FORMAT_##ENUM: return font##Name##Levels(font->data.member);
+  switch (font->format)
+  {
+    FONT_FORMATS(FONT_CASE)
+    default: break;
+  }
+  #undef FONT_CASE
+  return 1;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the blank columns included in each character's
+            advance, which aren't part of a string's visible width
+*/
+/**************************************************************************/
+uint8_t fontGetSpacing(const font_t *font)
+{
+  #define FONT_CASE(ENUM, Name, type, member) \
+    case FONT_FORMAT_##ENUM: return font##Name##Spacing(font->data.member);
+  switch (font->format)
+  {
+    FONT_FORMATS(FONT_CASE)
+    default: break;
+  }
+  #undef FONT_CASE
+  return 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns true if the font's glyphs can only be decoded in
+            order, so fontReadGlyph can't skip straight to a pixel
+*/
+/**************************************************************************/
+bool fontIsCompressed(const font_t *font)
+{
+  #define FONT_CASE(ENUM, Name, type, member) \
+    case FONT_FORMAT_##ENUM: return font##Name##Compressed(font->data.member);
+  switch (font->format)
+  {
+    FONT_FORMATS(FONT_CASE)
+    default: break;
+  }
+  #undef FONT_CASE
+  return false;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the horizontal advance of a character in pixels,
+            including the font's spacing
+*/
+/**************************************************************************/
+uint16_t fontGetCharWidth(const font_t *font, uint16_t c)
+{
+  #define FONT_CASE(ENUM, Name, type, member) \
+    case FONT_FORMAT_##ENUM: return font##Name##Advance(font->data.member, c);
+  switch (font->format)
+  {
+    FONT_FORMATS(FONT_CASE)
+    default: break;
+  }
+  #undef FONT_CASE
+  return 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the width in pixels of a string, without the
+            spacing after its last character
+
+    @param[in]  font
+                The font to use
+    @param[in]  str
+                The string to measure
+*/
+/**************************************************************************/
+uint16_t fontGetStringWidth(const font_t *font, const char *str)
+{
+  uint16_t width = 0, c;
+
+  while ((c = fontNextChar(font, &str)) != 0)
+  {
+    width += fontGetCharWidth(font, c);
+  }
+
+  return width > 0 ? width - fontGetSpacing(font) : 0;
+}
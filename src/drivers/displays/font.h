@@ -0,0 +1,149 @@
+/**************************************************************************/
+/*!
+    @file     font.h
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#ifndef __FONT_H__
+#define __FONT_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "bspconfig.h"
+#include "drivers/displays/smallfonts.h"
+#include "drivers/displays/graphic/fonts.h"
+#ifdef CFG_BSP_TFTLCD
+  #include "drivers/displays/graphic/aafonts.h"
+  #include "drivers/displays/assets.h"
+#endif
+
+/*=========================================================================
+    FONT ENGINE SETTINGS
+    -----------------------------------------------------------------------
+    FONT_FORMATS(X)     Every font format the text engine understands,
+                        as X(ENUM, Name, type, member).  The list builds
+                        fontFormat_t, the members of font_t and the
+                        format switches in font.c, so each format's code
+                        is called directly.  Anti-aliased fonts, and
+                        anti-aliased fonts read from an asset pack
+                        (assets.h), need the TFT drawing code and are
+                        only included with CFG_BSP_TFTLCD.
+    FONT_CHUNKSIZE      Pixels decoded at a time while a glyph row is
+                        drawn (bytes of stack in fontrender.h)
+    -----------------------------------------------------------------------*/
+    #ifdef CFG_BSP_TFTLCD
+      #define FONT_FORMATS_AA(X)                    \
+        X(AA,     AA,     aafontsFont_t,   aa)      \
+        X(ASSET,  Asset,  assetsFont_t,    asset)
+    #else
+      #define FONT_FORMATS_AA(X)
+    #endif
+
+    #define FONT_FORMATS(X)                         \
+      X(BITMAP, Bitmap, FONT_INFO,       bitmap)    \
+      X(SMALL,  Small,  struct FONT_DEF, small)     \
+      FONT_FORMATS_AA(X)
+
+    #define FONT_CHUNKSIZE      (32)
+/*=========================================================================*/
+
+#define FONT_ENUM(ENUM, Name, type, member)   FONT_FORMAT_##ENUM,
+typedef enum
+{
+  FONT_FORMATS(FONT_ENUM)
+  FONT_FORMAT_COUNT
+} fontFormat_t;
+#undef FONT_ENUM
+
+/* Any supported font, see the FONT_BITMAP/FONT_SMALL/FONT_AA/FONT_ASSET
+   initialisers */
+#define FONT_MEMBER(ENUM, Name, type, member) const type *member;
+typedef struct
+{
+  fontFormat_t        format;
+  union
+  {
+    FONT_FORMATS(FONT_MEMBER)
+  } data;
+} font_t;
+#undef FONT_MEMBER
+
+#define FONT_BITMAP(f)      { FONT_FORMAT_BITMAP, { .bitmap = (f) } }
+#define FONT_SMALL(f)       { FONT_FORMAT_SMALL, { .small = (f) } }
+#ifdef CFG_BSP_TFTLCD
+  #define FONT_AA(f)        { FONT_FORMAT_AA, { .aa = (f) } }
+  #define FONT_ASSET(f)     { FONT_FORMAT_ASSET, { .asset = (f) } }
+#endif
+
+/* How a glyph's pixels are stored */
+typedef enum
+{
+  FONT_LAYOUT_PACKED = 0,       // Rows of 1, 2 or 4-bit pixels, MSB first
+  FONT_LAYOUT_COLUMNS,          // One byte per column, LSB at the top
+  FONT_LAYOUT_RLE               // AAFONTS_ENCODING_RLE stream
+} fontLayout_t;
+
+/* A glyph looked up by fontGetGlyph, read in row order with fontReadGlyph */
+typedef struct
+{
+  const uint8_t       *data;    // NULL for a blank glyph
+  uint8_t             layout;   // fontLayout_t
+  uint8_t             bits;     // Bits per pixel
+  uint8_t             width;    // Columns of pixel data
+  uint8_t             advance;  // Distance to the next character
+  uint8_t             yOffset;  // First row of the character cell with pixel data
+  uint8_t             rows;     // Rows of pixel data
+  uint8_t             stride;   // Bytes per row (FONT_LAYOUT_PACKED)
+  uint8_t             row;      // Next pixel returned by fontReadGlyph
+  uint8_t             col;
+  #ifdef CFG_BSP_TFTLCD
+  aafontsGlyphReader_t reader;  // FONT_LAYOUT_RLE
+  #endif
+} fontGlyph_t;
+
+uint16_t  fontNextChar        ( const font_t *font, const char **str );
+bool      fontGetGlyph        ( const font_t *font, uint16_t c, fontGlyph_t *glyph );
+void      fontReadGlyph       ( fontGlyph_t *glyph, uint8_t *levels, uint8_t count );
+uint16_t  fontGetHeight       ( const font_t *font );
+uint8_t   fontGetLevels       ( const font_t *font );
+uint8_t   fontGetSpacing      ( const font_t *font );
+bool      fontIsCompressed    ( const font_t *font );
+uint16_t  fontGetCharWidth    ( const font_t *font, uint16_t c );
+uint16_t  fontGetStringWidth  ( const font_t *font, const char *str );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
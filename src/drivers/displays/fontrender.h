@@ -0,0 +1,131 @@
+/**************************************************************************/
+/*!
+    @file     fontrender.h
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+
+/*  Text renderer template
+    ======================
+
+    Each display includes this file once, after defining:
+
+      FONTRENDER_NAME             Prefix of the generated functions
+      FONTRENDER_CONTEXT          Type of the argument passed through to
+                                  FONTRENDER_SPAN (colors, thresholds)
+      FONTRENDER_SPAN(ctx, x, y, len, level)
+                                  Draws len pixels of the same non-zero
+                                  level (see fontGetLevels) from x/y
+
+    to get two static functions drawing with that display's pixel code:
+
+      void     <NAME>Glyph ( ctx, x, y, fontGlyph_t *glyph )
+      uint16_t <NAME>String( ctx, x, y, const font_t *font, const char *str )
+
+    Define FONTRENDER_GLYPHONLY as well if only <NAME>Glyph is needed.
+
+    FONTRENDER_SPAN is expanded inline, and every font format is decoded
+    by fontReadGlyph into runs of equal pixels, so there is no per-pixel
+    function pointer and a single loop serves every format.  There is
+    deliberately no include guard. */
+
+#include "drivers/displays/font.h"
+
+#if !defined FONTRENDER_NAME || !defined FONTRENDER_CONTEXT || !defined FONTRENDER_SPAN
+  #error "Define FONTRENDER_NAME, FONTRENDER_CONTEXT and FONTRENDER_SPAN before including fontrender.h"
+#endif
+
+#define FONTRENDER_PASTE(a, b)    a##b
+#define FONTRENDER_CONCAT(a, b)   FONTRENDER_PASTE(a, b)
+
+/**************************************************************************/
+/*!
+    @brief  Draws a glyph from fontGetGlyph with its cell's top-left
+            corner at x/y, skipping background pixels
+*/
+/**************************************************************************/
+static void FONTRENDER_CONCAT(FONTRENDER_NAME, Glyph)(FONTRENDER_CONTEXT ctx, uint16_t x, uint16_t y, fontGlyph_t *glyph)
+{
+  uint8_t levels[FONT_CHUNKSIZE];
+  uint8_t row, col, count, start, end, level;
+
+  y += glyph->yOffset;
+  for (row = 0; row < glyph->rows; row++)
+  {
+    for (col = 0; col < glyph->width; col += count)
+    {
+      count = glyph->width - col < FONT_CHUNKSIZE ? glyph->width - col : FONT_CHUNKSIZE;
+      fontReadGlyph(glyph, levels, count);
+
+      // Send each run of equal pixels at once
+      for (start = 0; start < count; start = end)
+      {
+        level = levels[start];
+        for (end = start + 1; (end < count) && (levels[end] == level); end++);
+        if (level)
+        {
+          FONTRENDER_SPAN(ctx, x + col + start, y + row, end - start, level);
+        }
+      }
+    }
+  }
+}
+
+#ifndef FONTRENDER_GLYPHONLY
+/**************************************************************************/
+/*!
+    @brief  Draws a string from x/y (top-left), skipping background
+            pixels, and returns the x position after it
+*/
+/**************************************************************************/
+static uint16_t FONTRENDER_CONCAT(FONTRENDER_NAME, String)(FONTRENDER_CONTEXT ctx, uint16_t x, uint16_t y, const font_t *font, const char *str)
+{
+  fontGlyph_t glyph;
+  uint16_t c;
+
+  while ((c = fontNextChar(font, &str)) != 0)
+  {
+    fontGetGlyph(font, c, &glyph);
+    FONTRENDER_CONCAT(FONTRENDER_NAME, Glyph)(ctx, x, y, &glyph);
+    x += glyph.advance;
+  }
+
+  return x;
+}
+#endif
+
+#undef FONTRENDER_CONCAT
+#undef FONTRENDER_PASTE
+#undef FONTRENDER_NAME
+#undef FONTRENDER_CONTEXT
+#undef FONTRENDER_SPAN
+#undef FONTRENDER_GLYPHONLY
@@ -35,8 +35,11 @@
 /**************************************************************************/
 #include "aafonts.h"
 
+#ifdef CFG_BSP_TFTLCD
+
 #include "drivers/displays/graphic/lcd.h"
 #include "drivers/displays/graphic/drawing.h"
+#include "drivers/displays/graphic/aafontscache.h"
 
 // Common color lookup tables for AA2 (4-color anti-aliased) fonts
 const uint16_t COLORTABLE_AA2_WHITEONBLACK[4] = { 0x0000, 0x52AA, 0xAD55, 0xFFFF};
@@ -52,99 +55,6 @@ const uint16_t COLORTABLE_AA4_BLACKONWHITE[16] = { 0xFFFF, 0xE71C, 0xD69A, 0xC61
 /*                                                                        */
 /**************************************************************************/
 
-/**************************************************************************/
-/*!
-    @brief Renders a single AA2 character on the screen
-
-    This text rendering method used a lookup table of pre-calculated
-    colors, and doesn't require any reads from the LCD (not all displays
-    support reading pixels back).  This offers the best performance and
-    high-quality text, but can only be used on solid backgrounds where
-    the bgcolor is known.
-
-    @param[in]  x
-                Top-left x position
-    @param[in]  y
-                Top-left y position
-    @param[in]  height
-                Font height in pixels
-    @param[in]  character
-                Pointer to the aafontsCharInfo_t array with the char data
-    @param[in]  colorTable
-                Pointer to the 4 element color lookup table
-*/
-/**************************************************************************/
-void aafontsDrawCharAA2( uint16_t x, uint16_t y, uint16_t height, aafontsCharInfo_t character, const uint16_t * colorTable)
-{
-  uint16_t w, h, pos;
-  uint8_t color;
-
-  for (h = 0; h < height; h++)
-  {
-    pos = 0;
-    for (w = 0; w < character.width; w++)
-    {
-      color = character.charData[h*character.bytesPerRow + w/4];
-      switch (pos)
-      {
-        case 0:
-          color = (color >> 6) & 0x03;
-          break;
-        case 1:
-          color = (color >> 4) & 0x03;
-          break;
-        case 2:
-          color = (color >> 2) & 0x03;
-          break;
-        case 3:
-          color = color & 0x03;
-          break;
-      }
-      if (color) lcdDrawPixel(x+w, y+h, colorTable[color & 0xF]);
-      pos++;
-      if (pos == 4) pos = 0;
-    }
-  }
-} 
-
-/**************************************************************************/
-/*!
-    @brief Renders a single AA4 character on the screen
-
-    This text rendering method used a lookup table of pre-calculated
-    colors, and doesn't require any reads from the LCD (not all displays
-    support reading pixels back).  This offers the best performance and
-    high-quality text, but can only be used on solid backgrounds where
-    the bgcolor is known.
-
-    @param[in]  x
-                Top-left x position
-    @param[in]  y
-                Top-left y position
-    @param[in]  height
-                Font height in pixels
-    @param[in]  character
-                Pointer to the aafontsCharInfo_t array with the char data
-    @param[in]  colorTable
-                Pointer to the 16 element color lookup table
-*/
-/**************************************************************************/
-void aafontsDrawCharAA4( uint16_t x, uint16_t y, uint16_t height, aafontsCharInfo_t character, const uint16_t * colorTable)
-{
-  uint16_t w, h;
-  uint8_t color;
-
-  for (h = 0; h < height; h++)
-  {
-    for (w = 0; w < character.width; w++)
-    {
-      color = character.charData[h*character.bytesPerRow + w/2];
-      if (!(w % 2)) color = (color >> 4);
-      if (color) lcdDrawPixel(x+w, y+h, colorTable[color & 0xF]);
-    }
-  }
-}
-
 /**************************************************************************/
 /*                                                                        */
 /* ----------------------- Public Methods ------------------------------- */
@@ -155,6 +65,9 @@ void aafontsDrawCharAA4( uint16_t x, uint16_t y, uint16_t height, aafontsCharInf
 /*!
     @brief  Draws a string using the supplied anti-aliased font
 
+    The string is decoded as UTF-8, and characters that aren't in the
+    font are skipped, leaving a gap of font->unknownCharWidth pixels.
+
     @param[in]  x
                 Starting x co-ordinate
     @param[in]  y
@@ -164,7 +77,7 @@ void aafontsDrawCharAA4( uint16_t x, uint16_t y, uint16_t height, aafontsCharInf
     @param[in]  font
                 Pointer to the aafontsFont_t to use when drawing the string
     @param[in]  str
-                The string to render
+                The UTF-8 string to render
 
     @section Example
 
@@ -194,51 +107,184 @@ void aafontsDrawCharAA4( uint16_t x, uint16_t y, uint16_t height, aafontsCharInf
 /**************************************************************************/
 void aafontsDrawString(uint16_t x, uint16_t y, const uint16_t * colorTable, const aafontsFont_t *font, char *str)
 {
-  uint16_t currentX, charWidth, characterToOutput;
-  const aafontsCharInfo_t *charInfo;
+  font_t textFont = FONT_AA(font);
+  fontGlyph_t glyph;
+  uint16_t currentX, characterToOutput;
+  const char *next = str;
+  int8_t cacheTable = -1;
 
   // set current x, y to that of requested
   currentX = x;
 
-  // while not NULL
-  while (*str != '\0')
+  // The glyph cache writes straight to the panel, so skip it when
+  // drawing into a framebuffer
+  if (drawGetFramebuffer() == NULL)
   {
-    // get character to output
-    characterToOutput = *str;
+    cacheTable = aafontsCacheSelectTable(colorTable, font->fontType == AAFONTS_FONTTYPE_AA2 ? 4 : 16);
+  }
 
-    // Check if the character is within the font boundaries
-    if ((characterToOutput > font->lastChar) || (characterToOutput < font->firstChar))
-    {
-      // Character is out of bounds
-      // Insert space instead
-      charWidth = font->unknownCharWidth;
-    }
-    else
+  // decode UTF-8 characters until NULL
+  while ((characterToOutput = aafontsUtf8Next(&next)) != 0)
+  {
+    // Characters that aren't in the font come back as a blank gap
+    if (fontGetGlyph(&textFont, characterToOutput, &glyph))
     {
-      // get char info
-      charInfo = &(font->charTable[characterToOutput - font->firstChar]);    
-      // get width from char info
-      charWidth = charInfo->width;
-      // Send individual characters
-      switch (font->fontType)
+      // Replay the cached glyph, or send individual characters
+      if (!aafontsCacheDrawChar(currentX, y, font, characterToOutput, cacheTable))
       {
-        case AAFONTS_FONTTYPE_AA2:
-          aafontsDrawCharAA2(currentX, y, font->fontHeight, *charInfo, &colorTable[0]);
-          break;
-        case AAFONTS_FONTTYPE_AA4:
-          aafontsDrawCharAA4(currentX, y, font->fontHeight, *charInfo, &colorTable[0]);
-          break;
+        drawGlyph(currentX, y, &glyph, colorTable);
       }
     }
-    
+
     // Adjust x for the next character
-    currentX += charWidth;
-    
-    // next char in string
-    str++;
+    currentX += glyph.advance;
   }
 }
 
+/**************************************************************************/
+/*!
+    @brief  Draws a string using the supplied anti-aliased font, writing
+            every pixel including the background
+
+    aafontsDrawString skips background pixels, so every glyph turns
+    into dozens of single pixel transactions.  The predefined color
+    tables already assume a solid background (colorTable[0]), and in
+    that case it is much cheaper to set a single window around the
+    whole string and stream every pixel in one burst.  The string is
+    clipped to the screen.
+
+    The pixels go straight to the panel, even if a framebuffer was
+    selected with drawSetFramebuffer.
+
+    @param[in]  x
+                Starting x co-ordinate
+    @param[in]  y
+                Starting y co-ordinate
+    @param[in]  colorTable
+                The color lookup table to use for the antialiased
+                pixels, with the background color in colorTable[0]
+    @param[in]  font
+                Pointer to the aafontsFont_t to use when drawing the string
+    @param[in]  str
+                The UTF-8 string to render
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/graphic/aafonts.h"
+    #include "drivers/displays/graphic/aafonts/aa2/DejaVuSansCondensed14_AA2.h"
+
+    uint16_t colorTable[4];
+
+    // White text on a dark blue title bar
+    aafontsCalculateColorTable(0x0010, COLOR_WHITE, colorTable, 4);
+    aafontsDrawStringOpaque(4, 2, colorTable, &DejaVuSansCondensed14_AA2, "Settings");
+
+    @endcode
+*/
+/**************************************************************************/
+void aafontsDrawStringOpaque(uint16_t x, uint16_t y, const uint16_t * colorTable, const aafontsFont_t *font, char *str)
+{
+  aafontsDrawStringRotated(x, y, colorTable, font, str, LCD_ROTATION_0);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws a string using the supplied anti-aliased font, rotated
+            clockwise by 90, 180 or 270 degrees
+
+    The glyph data is walked in rotated order and each character goes
+    out as a single window burst, so this doesn't depend on
+    lcdSetOrientation.  RLE glyphs can only be decoded in row order,
+    so they go out a window per row instead (see drawTextOpaque).  Every pixel of the character cell is written,
+    using colorTable[0] for the background, so the text must be drawn
+    on a solid color matching the color table.
+
+    @param[in]  x
+                Left edge of the rotated string on the screen
+    @param[in]  y
+                Top edge of the rotated string on the screen
+    @param[in]  colorTable
+                The color lookup table to use for the antialiased pixels
+    @param[in]  font
+                Pointer to the aafontsFont_t to use when drawing the string
+    @param[in]  str
+                The UTF-8 string to render
+    @param[in]  rotation
+                LCD_ROTATION_90 reads top to bottom, LCD_ROTATION_270
+                reads bottom to top, and LCD_ROTATION_180 is upside down
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/graphic/aafonts.h"
+    #include "drivers/displays/graphic/aafonts/aa2/DejaVuSansCondensed14_AA2.h"
+
+    lcdFillRGB(COLOR_WHITE);
+
+    // Caption running down the right-hand edge of a landscape layout
+    aafontsDrawStringRotated(300, 10, COLORTABLE_AA2_BLACKONWHITE, &DejaVuSansCondensed14_AA2, "Channel 1", LCD_ROTATION_90);
+
+    @endcode
+*/
+/**************************************************************************/
+void aafontsDrawStringRotated(uint16_t x, uint16_t y, const uint16_t * colorTable, const aafontsFont_t *font, char *str, lcdRotation_t rotation)
+{
+  font_t textFont = FONT_AA(font);
+
+  drawTextOpaque(x, y, &textFont, str, colorTable, rotation);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws a string scaled up by a whole number, skipping the
+            background pixels
+
+    Large digits can be drawn from a small anti-aliased font instead of
+    a dedicated large one.  Without smoothing every font pixel becomes
+    a scale x scale block.  With smoothing the glyphs are interpolated,
+    so the edges stay anti-aliased rather than turning into steps (see
+    drawTextScaled).
+
+    @param[in]  x
+                Starting x co-ordinate
+    @param[in]  y
+                Starting y co-ordinate
+    @param[in]  colorTable
+                The color lookup table to use for the antialiased pixels
+    @param[in]  font
+                Pointer to the aafontsFont_t to use when drawing the string
+    @param[in]  str
+                The UTF-8 string to render
+    @param[in]  scale
+                Scale factor, 1 to DRAW_SCALE_MAX
+    @param[in]  smooth
+                Interpolate the edges rather than drawing blocks
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/graphic/aafonts.h"
+    #include "drivers/displays/graphic/aafonts/aa2/DejaVuSansCondensedBold14_AA2.h"
+
+    lcdFillRGB(COLOR_WHITE);
+
+    // Roughly the size of FontFranklinGothicBold99_Numbers_AA2
+    aafontsDrawStringScaled(10, 20, COLORTABLE_AA2_BLACKONWHITE, &DejaVuSansCondensedBold14_AA2, "88", 7, true);
+
+    @endcode
+*/
+/**************************************************************************/
+void aafontsDrawStringScaled(uint16_t x, uint16_t y, const uint16_t * colorTable, const aafontsFont_t *font, char *str, uint8_t scale, bool smooth)
+{
+  font_t textFont = FONT_AA(font);
+
+  drawTextScaled(x, y, &textFont, str, colorTable, scale, smooth);
+}
+
 /**************************************************************************/
 /*!
     @brief  Draws a string using the supplied anti-aliased font, centering
@@ -253,7 +299,7 @@ void aafontsDrawString(uint16_t x, uint16_t y, const uint16_t * colorTable, cons
     @param[in]  font
                 Pointer to the aafontsFont_t to use when drawing the string
     @param[in]  str
-                The string to render
+                The UTF-8 string to render
 */
 /**************************************************************************/
 void aafontsCenterString(uint16_t x, uint16_t y, const uint16_t * colorTable, const aafontsFont_t *font, char *str)
@@ -274,7 +320,7 @@ void aafontsCenterString(uint16_t x, uint16_t y, const uint16_t * colorTable, co
     @param[in]  font
                 Pointer to aafontsFont_t of the font that will be used
     @param[in]  str
-                The string that will be rendered
+                The UTF-8 string that will be rendered
 
     @section Example
 
@@ -290,30 +336,267 @@ void aafontsCenterString(uint16_t x, uint16_t y, const uint16_t * colorTable, co
 /**************************************************************************/
 uint16_t aafontsGetStringWidth(const aafontsFont_t *font, char *str)
 {
-  uint16_t width = 0;
-  const aafontsCharInfo_t *charInfo;
-  uint32_t currChar;
+  font_t textFont = FONT_AA(font);
+
+  return fontGetStringWidth(&textFont, str);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the glyph for a code point, or NULL if the font
+            doesn't contain it
+
+    Fonts with a range table are searched with a binary search over the
+    ranges, so lookups stay cheap even for fonts that cover several
+    scattered Unicode blocks.
+
+    @param[in]  font
+                Pointer to the aafontsFont_t to search
+    @param[in]  c
+                Unicode code point
+
+    @section Example
+
+    @code
+
+    // Latin-1 supplement and Cyrillic glyphs in one sparse font: 95 + 96
+    // + 64 entries in charTable instead of 0x044F - 0x0020 + 1 = 1072
+    static const aafontsCharRange_t ranges[] =
+    {
+      { 0x0020, 0x007E,   0 },
+      { 0x00A0, 0x00FF,  95 },
+      { 0x0410, 0x044F, 191 }
+    };
+
+    const aafontsFont_t MyFont14_AA2 =
+    {
+      AAFONTS_FONTTYPE_AA2, 14, 4, 10, 8, 11,
+      0x0020, 0x044F,
+      &charTable_MyFont14_AA2[0],
+      &ranges[0], 3
+    };
 
-  // until termination
-  for (currChar = *str; currChar; currChar = *(++str))
+    @endcode
+*/
+/**************************************************************************/
+const aafontsCharInfo_t *aafontsGetCharInfo(const aafontsFont_t *font, uint16_t c)
+{
+  uint16_t lo, hi, mid;
+
+  if ((c < font->firstChar) || (c > font->lastChar))
+    return NULL;
+
+  // Dense table, indexed directly
+  if (font->ranges == NULL)
+    return &(font->charTable[c - font->firstChar]);
+
+  lo = 0;
+  hi = font->rangeCount;
+  while (lo < hi)
   {
-    // Check if the character is within the font boundaries
-    if ((currChar > font->lastChar) || (currChar < font->firstChar))
+    mid = (lo + hi) / 2;
+    if (c < font->ranges[mid].first)
     {
-      // Character is out of bounds
-      width += font->unknownCharWidth;
+      hi = mid;
+    }
+    else if (c > font->ranges[mid].last)
+    {
+      lo = mid + 1;
     }
     else
     {
-      // get char info
-      charInfo = &(font->charTable[currChar - font->firstChar]);
-      // get width from char info
-      width += charInfo->width;
+      return &(font->charTable[font->ranges[mid].index + c - font->ranges[mid].first]);
+    }
+  }
+
+  return NULL;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Decodes the next UTF-8 character in a string and advances the
+            string pointer past it
+
+    Malformed sequences (stray continuation bytes, truncated or overlong
+    sequences, surrogates) and code points beyond U+FFFF, which can't be
+    stored in a font, are returned as U+FFFD so that they are drawn as
+    an unknown character.  The terminating NULL is never skipped.
+
+    @param[in]  str
+                Pointer to the current position in the string
+
+    @return     The code point, or 0 at the end of the string
+*/
+/**************************************************************************/
+uint16_t aafontsUtf8Next(const char **str)
+{
+  const uint8_t *p = (const uint8_t *)*str;
+  uint32_t c, min;
+  uint8_t i, n;
+
+  if (p[0] == 0)
+    return 0;
+
+  if (p[0] < 0x80)
+  {
+    *str += 1;
+    return p[0];
+  }
+  else if ((p[0] & 0xE0) == 0xC0)
+  {
+    c = p[0] & 0x1F;
+    n = 1;
+    min = 0x80;
+  }
+  else if ((p[0] & 0xF0) == 0xE0)
+  {
+    c = p[0] & 0x0F;
+    n = 2;
+    min = 0x800;
+  }
+  else if ((p[0] & 0xF8) == 0xF0)
+  {
+    c = p[0] & 0x07;
+    n = 3;
+    min = 0x10000;
+  }
+  else
+  {
+    *str += 1;
+    return 0xFFFD;
+  }
+
+  for (i = 1; i <= n; i++)
+  {
+    // Stops on the NULL as well as on a missing continuation byte
+    if ((p[i] & 0xC0) != 0x80)
+    {
+      *str += i;
+      return 0xFFFD;
     }
+    c = (c << 6) | (p[i] & 0x3F);
   }
+  *str += n + 1;
 
-  /* return the string width */
-  return width;
+  if ((c < min) || (c > 0xFFFF) || ((c >= 0xD800) && (c <= 0xDFFF)))
+    return 0xFFFD;
+
+  return c;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Starts decoding a glyph with aafontsGlyphReaderNext
+
+    @param[in]  reader
+                The decoder state to initialise
+    @param[in]  font
+                The font the glyph belongs to, or NULL to restart a
+                reader that was already initialised for charInfo
+    @param[in]  charInfo
+                The glyph to decode
+*/
+/**************************************************************************/
+void aafontsGlyphReaderInit(aafontsGlyphReader_t *reader, const aafontsFont_t *font, const aafontsCharInfo_t *charInfo)
+{
+  if (font != NULL)
+  {
+    reader->encoding = font->encoding;
+    reader->bits = font->fontType == AAFONTS_FONTTYPE_AA2 ? 2 : 4;
+  }
+  reader->data = charInfo->charData;
+  reader->row = charInfo->charData;
+  reader->width = charInfo->width;
+  reader->bytesPerRow = charInfo->bytesPerRow;
+  reader->shift = 8;
+  reader->x = 0;
+  reader->count = 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the value (0 for background, up to 3 or 15 for solid
+            foreground) of the next pixel of a glyph, in row order
+
+    Only the charInfo->height rows stored in charData are returned, the
+    first of which is row charInfo->yOffset of the character.
+
+    Raw glyphs store each row as packed 2 or 4-bit pixels (MSB first),
+    padded to bytesPerRow bytes.
+
+    RLE glyphs are a stream of tokens covering width * height pixels
+    in row order, with runs continuing across rows:
+
+    @code
+    0nnnnnnn    n + 1 background pixels (1..128)
+    10nnnnnn    n + 1 solid foreground pixels (1..64)
+    11nnnnnn    n + 1 literal pixels (1..64), packed like a raw row in
+                the following bytes and padded to a whole byte
+    @endcode
+
+    Glyphs are mostly long background and foreground runs with a few
+    shaded pixels along the edges, which go out as literals at the same
+    density as raw data.
+
+    @param[in]  reader
+                Decoder state set up with aafontsGlyphReaderInit
+*/
+/**************************************************************************/
+uint8_t aafontsGlyphReaderNext(aafontsGlyphReader_t *reader)
+{
+  uint8_t token, value;
+
+  if (reader->encoding == AAFONTS_ENCODING_RLE)
+  {
+    if (reader->count == 0)
+    {
+      token = *reader->data++;
+      if (!(token & 0x80))
+      {
+        reader->value = 0;
+        reader->count = token + 1;
+      }
+      else
+      {
+        reader->value = token & 0x40 ? 0xFF : (1 << reader->bits) - 1;
+        reader->count = (token & 0x3F) + 1;
+      }
+    }
+    reader->count--;
+
+    if (reader->value != 0xFF)
+      return reader->value;
+
+    // Literal pixel, moving to the next byte when this one is used up
+    // or at the end of the packet
+    reader->shift -= reader->bits;
+    value = (*reader->data >> reader->shift) & ((1 << reader->bits) - 1);
+    if ((reader->shift == 0) || (reader->count == 0))
+    {
+      reader->data++;
+      reader->shift = 8;
+    }
+    return value;
+  }
+
+  reader->shift -= reader->bits;
+  value = (*reader->data >> reader->shift) & ((1 << reader->bits) - 1);
+  if (reader->shift == 0)
+  {
+    reader->data++;
+    reader->shift = 8;
+  }
+
+  // Skip the padding at the end of the row
+  if (++reader->x == reader->width)
+  {
+    reader->row += reader->bytesPerRow;
+    reader->data = reader->row;
+    reader->shift = 8;
+    reader->x = 0;
+  }
+
+  return value;
 }
 
 /**************************************************************************/
@@ -380,3 +663,5 @@ void aafontsCalculateColorTable(uint16_t bgColor, uint16_t foreColor, uint16_t *
     colorTable[i] = colorsAlphaBlend(bgColor, foreColor, 100-i*stepsize);
   }
 }
+
+#endif
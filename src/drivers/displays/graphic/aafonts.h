@@ -41,6 +41,7 @@ extern "C" {
 #endif
 
 #include "bspconfig.h"
+#include "lcd.h"
 
 typedef enum
 {
@@ -48,13 +49,32 @@ typedef enum
   AAFONTS_FONTTYPE_AA4 = 4              /* AA4 Fonts (16 shades of gray) */
 } aafontsFontType_t;
 
+typedef enum
+{
+  AAFONTS_ENCODING_RAW = 0,             /* Packed pixels, bytesPerRow bytes per row */
+  AAFONTS_ENCODING_RLE = 1              /* Run-length encoded, see aafontsGlyphReaderNext */
+} aafontsEncoding_t;
+
 typedef struct 
 {
   uint8_t width;                        /* Character width in pixels */
   uint8_t bytesPerRow;                  /* Data width in bytes */
+  uint8_t yOffset;                      /* First font row covered by charData */
+  uint8_t height;                       /* Rows in charData, the rest of the character is blank */
   const uint8_t *charData;              /* Pointer to the character data array */
 } aafontsCharInfo_t;
 
+/* A run of consecutive code points stored back to back in charTable.
+   Fonts covering scattered blocks (Latin-1, Cyrillic, symbols, etc.)
+   list one range per block, sorted by code point, so that flash is
+   only spent on glyphs that actually exist. */
+typedef struct
+{
+  uint16_t first;                       /* First code point in the range */
+  uint16_t last;                        /* Last code point in the range */
+  uint16_t index;                       /* charTable index of the first code point */
+} aafontsCharRange_t;
+
 typedef struct aafontsFont_s
 {
   aafontsFontType_t fontType;           /* Anti-aliasing level for the font */
@@ -66,16 +86,42 @@ typedef struct aafontsFont_s
   uint16_t firstChar;                   /* Unicode address of the first character in the char map */
   uint16_t lastChar;                    /* Unicode address of the last character in the char map */
   const aafontsCharInfo_t *charTable;   /* Pointer to the aafontsCharInfo_t array containing the char data */
+  const aafontsCharRange_t *ranges;     /* Sorted code point ranges in charTable, or NULL if charTable is dense (firstChar..lastChar) */
+  uint16_t rangeCount;                  /* Number of entries in ranges */
+  aafontsEncoding_t encoding;           /* How charData is stored */
 } aafontsFont_t;
 
+/* Sequential glyph decoder, returns one pixel value at a time in row
+   order whatever the encoding of the font */
+typedef struct
+{
+  const uint8_t *data;                  /* Current byte of glyph data */
+  const uint8_t *row;                   /* Start of the current row (raw glyphs) */
+  aafontsEncoding_t encoding;
+  uint8_t bits;                         /* Bits per pixel */
+  uint8_t shift;                        /* Bits of *data not yet read */
+  uint8_t width;                        /* Glyph width in pixels */
+  uint8_t bytesPerRow;
+  uint8_t x;                            /* Column of the next pixel (raw glyphs) */
+  uint8_t count;                        /* Pixels left in the current RLE token */
+  uint8_t value;                        /* Value of the current RLE run, or 0xFF for literal pixels */
+} aafontsGlyphReader_t;
+
 extern const uint16_t COLORTABLE_AA2_WHITEONBLACK[4];
 extern const uint16_t COLORTABLE_AA2_BLACKONWHITE[4];
 extern const uint16_t COLORTABLE_AA4_WHITEONBLACK[16];
 extern const uint16_t COLORTABLE_AA4_BLACKONWHITE[16];
 
 void      aafontsDrawString ( uint16_t x, uint16_t y, const uint16_t * colorTable, const aafontsFont_t *font, char *str );
+void      aafontsDrawStringOpaque ( uint16_t x, uint16_t y, const uint16_t * colorTable, const aafontsFont_t *font, char *str );
+void      aafontsDrawStringRotated ( uint16_t x, uint16_t y, const uint16_t * colorTable, const aafontsFont_t *font, char *str, lcdRotation_t rotation );
+void      aafontsDrawStringScaled ( uint16_t x, uint16_t y, const uint16_t * colorTable, const aafontsFont_t *font, char *str, uint8_t scale, bool smooth );
 void      aafontsCenterString ( uint16_t x, uint16_t y, const uint16_t * colorTable, const aafontsFont_t *font, char *str );
 uint16_t  aafontsGetStringWidth ( const aafontsFont_t *font, char *str );
+const aafontsCharInfo_t *aafontsGetCharInfo ( const aafontsFont_t *font, uint16_t c );
+uint16_t  aafontsUtf8Next ( const char **str );
+void      aafontsGlyphReaderInit ( aafontsGlyphReader_t *reader, const aafontsFont_t *font, const aafontsCharInfo_t *charInfo );
+uint8_t   aafontsGlyphReaderNext ( aafontsGlyphReader_t *reader );
 void      aafontsCalculateColorTable ( uint16_t bgColor, uint16_t foreColor, uint16_t *colorTable, size_t tableSize );
 
 #ifdef __cplusplus
@@ -36,60 +36,32 @@
 #include "DejaVuSansMono10_AA2.h"
 
 /* Start of unicode area <Basic Latin> */
-const uint8_t FontDejaVuSansMono10_AA2_0020[ 20] = { /* code 0020, SPACE */
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
-};
-
-const uint8_t FontDejaVuSansMono10_AA2_0021[ 20] = { /* code 0021, EXCLAMATION MARK */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0021[ 14] = { /* code 0021, EXCLAMATION MARK */
   0x08, 0x00,
   0x08, 0x00,
   0x08, 0x00,
   0x08, 0x00,
   0x04, 0x00,
   0x00, 0x00,
-  0x08, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x08, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0022[ 20] = { /* code 0022, QUOTATION MARK */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0022[  4] = { /* code 0022, QUOTATION MARK */
   0x22, 0x00,
-  0x22, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x22, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0023[ 20] = { /* code 0023, NUMBER SIGN */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0023[ 14] = { /* code 0023, NUMBER SIGN */
   0x04, 0x40,
   0x05, 0x40,
   0x7F, 0xC0,
   0x11, 0x00,
   0xFF, 0x80,
   0x11, 0x00,
-  0x15, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x15, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0024[ 20] = { /* code 0024, DOLLAR SIGN */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0024[ 16] = { /* code 0024, DOLLAR SIGN */
   0x08, 0x00,
   0x2F, 0x80,
   0x20, 0x00,
@@ -97,50 +69,35 @@ const uint8_t FontDejaVuSansMono10_AA2_0024[ 20] = { /* code 0024, DOLLAR SIGN *
   0x0B, 0x80,
   0x01, 0x80,
   0x3F, 0x40,
-  0x08, 0x00,
-  0x00, 0x00
+  0x08, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0025[ 20] = { /* code 0025, PERCENT SIGN */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0025[ 14] = { /* code 0025, PERCENT SIGN */
   0x78, 0x00,
   0x88, 0x00,
   0x78, 0xC0,
   0x0A, 0x00,
   0x77, 0xC0,
   0x05, 0x40,
-  0x03, 0xC0,
-  0x00, 0x00,
-  0x00, 0x00
+  0x03, 0xC0
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0026[ 20] = { /* code 0026, AMPERSAND */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0026[ 14] = { /* code 0026, AMPERSAND */
   0x1F, 0x00,
   0x20, 0x00,
   0x14, 0x00,
   0x2C, 0x00,
   0x52, 0x40,
   0x51, 0xC0,
-  0x2E, 0x80,
-  0x00, 0x00,
-  0x00, 0x00
+  0x2E, 0x80
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0027[ 20] = { /* code 0027, APOSTROPHE */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0027[  4] = { /* code 0027, APOSTROPHE */
   0x08, 0x00,
-  0x08, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x08, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0028[ 20] = { /* code 0028, LEFT PARENTHESIS */
+const uint8_t FontDejaVuSansMono10_AA2_0028[ 16] = { /* code 0028, LEFT PARENTHESIS */
   0x02, 0x00,
   0x08, 0x00,
   0x08, 0x00,
@@ -148,12 +105,10 @@ const uint8_t FontDejaVuSansMono10_AA2_0028[ 20] = { /* code 0028, LEFT PARENTHE
   0x08, 0x00,
   0x08, 0x00,
   0x08, 0x00,
-  0x02, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x02, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0029[ 20] = { /* code 0029, RIGHT PARENTHESIS */
+const uint8_t FontDejaVuSansMono10_AA2_0029[ 16] = { /* code 0029, RIGHT PARENTHESIS */
   0x14, 0x00,
   0x08, 0x00,
   0x05, 0x00,
@@ -161,236 +116,157 @@ const uint8_t FontDejaVuSansMono10_AA2_0029[ 20] = { /* code 0029, RIGHT PARENTH
   0x05, 0x00,
   0x05, 0x00,
   0x08, 0x00,
-  0x14, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x14, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_002A[ 20] = { /* code 002A, ASTERISK */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_002A[  8] = { /* code 002A, ASTERISK */
   0x15, 0x80,
   0x1E, 0x00,
   0x1E, 0x00,
-  0x25, 0x80,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x25, 0x80
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_002B[ 20] = { /* code 002B, PLUS SIGN */
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_002B[ 10] = { /* code 002B, PLUS SIGN */
   0x08, 0x00,
   0x08, 0x00,
   0x7F, 0xC0,
   0x08, 0x00,
-  0x08, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x08, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_002C[ 20] = { /* code 002C, COMMA */
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_002C[  6] = { /* code 002C, COMMA */
   0x0C, 0x00,
   0x08, 0x00,
   0x14, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_002D[ 20] = { /* code 002D, HYPHEN-MINUS */
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x1E, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+const uint8_t FontDejaVuSansMono10_AA2_002D[  2] = { /* code 002D, HYPHEN-MINUS */
+  0x1E, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_002E[ 20] = { /* code 002E, FULL STOP */
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x0C, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+const uint8_t FontDejaVuSansMono10_AA2_002E[  2] = { /* code 002E, FULL STOP */
+  0x0C, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_002F[ 20] = { /* code 002F, SOLIDUS */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_002F[ 14] = { /* code 002F, SOLIDUS */
   0x02, 0x00,
   0x02, 0x00,
   0x08, 0x00,
   0x08, 0x00,
   0x14, 0x00,
   0x20, 0x00,
-  0x50, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x50, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0030[ 20] = { /* code 0030, DIGIT ZERO */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0030[ 14] = { /* code 0030, DIGIT ZERO */
   0x2E, 0x00,
   0x22, 0x40,
   0x51, 0x40,
   0x59, 0x40,
   0x51, 0x40,
   0x22, 0x40,
-  0x2E, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x2E, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0031[ 20] = { /* code 0031, DIGIT ONE */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0031[ 14] = { /* code 0031, DIGIT ONE */
   0x3D, 0x00,
   0x05, 0x00,
   0x05, 0x00,
   0x05, 0x00,
   0x05, 0x00,
   0x05, 0x00,
-  0x2F, 0x80,
-  0x00, 0x00,
-  0x00, 0x00
+  0x2F, 0x80
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0032[ 20] = { /* code 0032, DIGIT TWO */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0032[ 14] = { /* code 0032, DIGIT TWO */
   0x2F, 0x00,
   0x01, 0x40,
   0x01, 0x40,
   0x02, 0x00,
   0x08, 0x00,
   0x30, 0x00,
-  0x7F, 0x80,
-  0x00, 0x00,
-  0x00, 0x00
+  0x7F, 0x80
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0033[ 20] = { /* code 0033, DIGIT THREE */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0033[ 14] = { /* code 0033, DIGIT THREE */
   0x2E, 0x00,
   0x51, 0x40,
   0x01, 0x40,
   0x1D, 0x00,
   0x01, 0x40,
   0x41, 0x40,
-  0x3F, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x3F, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0034[ 20] = { /* code 0034, DIGIT FOUR */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0034[ 14] = { /* code 0034, DIGIT FOUR */
   0x06, 0x00,
   0x0A, 0x00,
   0x16, 0x00,
   0x26, 0x00,
   0x12, 0x00,
   0x7F, 0x40,
-  0x02, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x02, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0035[ 20] = { /* code 0035, DIGIT FIVE */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0035[ 14] = { /* code 0035, DIGIT FIVE */
   0x3F, 0x00,
   0x20, 0x00,
   0x20, 0x00,
   0x3F, 0x00,
   0x01, 0x40,
   0x01, 0x40,
-  0x7E, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x7E, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0036[ 20] = { /* code 0036, DIGIT SIX */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0036[ 14] = { /* code 0036, DIGIT SIX */
   0x1F, 0x40,
   0x30, 0x00,
   0x50, 0x00,
   0x6F, 0x00,
   0x61, 0x40,
   0x11, 0x40,
-  0x2F, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x2F, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0037[ 20] = { /* code 0037, DIGIT SEVEN */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0037[ 14] = { /* code 0037, DIGIT SEVEN */
   0xBF, 0x40,
   0x02, 0x00,
   0x02, 0x00,
   0x05, 0x00,
   0x08, 0x00,
   0x08, 0x00,
-  0x24, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x24, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0038[ 20] = { /* code 0038, DIGIT EIGHT */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0038[ 14] = { /* code 0038, DIGIT EIGHT */
   0x2E, 0x00,
   0x21, 0x40,
   0x21, 0x40,
   0x1D, 0x00,
   0x61, 0x40,
   0x51, 0x40,
-  0x3F, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x3F, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0039[ 20] = { /* code 0039, DIGIT NINE */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0039[ 14] = { /* code 0039, DIGIT NINE */
   0x3E, 0x00,
   0x51, 0x40,
   0x51, 0x40,
   0x3F, 0x40,
   0x01, 0x40,
   0x03, 0x00,
-  0x7D, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x7D, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_003A[ 20] = { /* code 003A, COLON */
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_003A[ 10] = { /* code 003A, COLON */
   0x0C, 0x00,
   0x00, 0x00,
   0x00, 0x00,
   0x00, 0x00,
-  0x0C, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x0C, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_003B[ 20] = { /* code 003B, SEMICOLON */
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_003B[ 14] = { /* code 003B, SEMICOLON */
   0x0C, 0x00,
   0x00, 0x00,
   0x00, 0x00,
@@ -400,281 +276,207 @@ const uint8_t FontDejaVuSansMono10_AA2_003B[ 20] = { /* code 003B, SEMICOLON */
   0x14, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_003C[ 20] = { /* code 003C, LESS-THAN SIGN */
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_003C[  8] = { /* code 003C, LESS-THAN SIGN */
   0x01, 0xC0,
   0x3E, 0x00,
   0x78, 0x00,
-  0x03, 0xC0,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x03, 0xC0
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_003D[ 20] = { /* code 003D, EQUALS SIGN */
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0xBF, 0xC0,
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_003D[  6] = { /* code 003D, EQUALS SIGN */
   0xBF, 0xC0,
   0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0xBF, 0xC0
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_003E[ 20] = { /* code 003E, GREATER-THAN SIGN */
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_003E[  8] = { /* code 003E, GREATER-THAN SIGN */
   0x60, 0x00,
   0x0F, 0x80,
   0x07, 0xC0,
-  0x78, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x78, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_003F[ 20] = { /* code 003F, QUESTION MARK */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_003F[ 14] = { /* code 003F, QUESTION MARK */
   0x3F, 0x00,
   0x01, 0x40,
   0x03, 0x00,
   0x08, 0x00,
   0x08, 0x00,
   0x00, 0x00,
-  0x04, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x04, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0040[ 20] = { /* code 0040, COMMERCIAL AT */
-  0x00, 0x00,
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0040[ 14] = { /* code 0040, COMMERCIAL AT */
   0x1F, 0x40,
   0x30, 0x80,
   0x57, 0xC0,
   0x58, 0x80,
   0x57, 0xC0,
   0x30, 0x00,
-  0x0F, 0x40,
-  0x00, 0x00
+  0x0F, 0x40
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0041[ 20] = { /* code 0041, LATIN CAPITAL LETTER A */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0041[ 14] = { /* code 0041, LATIN CAPITAL LETTER A */
   0x0A, 0x00,
   0x0A, 0x00,
   0x09, 0x40,
   0x14, 0x80,
   0x20, 0x80,
   0x3F, 0xC0,
-  0x50, 0x40,
-  0x00, 0x00,
-  0x00, 0x00
+  0x50, 0x40
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0042[ 20] = { /* code 0042, LATIN CAPITAL LETTER B */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0042[ 14] = { /* code 0042, LATIN CAPITAL LETTER B */
   0x7E, 0x00,
   0x52, 0x00,
   0x52, 0x00,
   0x7D, 0x00,
   0x52, 0x40,
   0x51, 0x40,
-  0x7F, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x7F, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0043[ 20] = { /* code 0043, LATIN CAPITAL LETTER C */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0043[ 14] = { /* code 0043, LATIN CAPITAL LETTER C */
   0x1F, 0x40,
   0x20, 0x00,
   0x50, 0x00,
   0x50, 0x00,
   0x50, 0x00,
   0x20, 0x00,
-  0x1F, 0x40,
-  0x00, 0x00,
-  0x00, 0x00
+  0x1F, 0x40
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0044[ 20] = { /* code 0044, LATIN CAPITAL LETTER D */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0044[ 14] = { /* code 0044, LATIN CAPITAL LETTER D */
   0x7D, 0x00,
   0x52, 0x00,
   0x51, 0x40,
   0x51, 0x40,
   0x51, 0x40,
   0x52, 0x00,
-  0x7D, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x7D, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0045[ 20] = { /* code 0045, LATIN CAPITAL LETTER E */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0045[ 14] = { /* code 0045, LATIN CAPITAL LETTER E */
   0x7F, 0x40,
   0x50, 0x00,
   0x50, 0x00,
   0x7F, 0x40,
   0x50, 0x00,
   0x50, 0x00,
-  0x7F, 0x40,
-  0x00, 0x00,
-  0x00, 0x00
+  0x7F, 0x40
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0046[ 20] = { /* code 0046, LATIN CAPITAL LETTER F */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0046[ 14] = { /* code 0046, LATIN CAPITAL LETTER F */
   0xBF, 0x40,
   0x80, 0x00,
   0x80, 0x00,
   0xBF, 0x00,
   0x80, 0x00,
   0x80, 0x00,
-  0x80, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x80, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0047[ 20] = { /* code 0047, LATIN CAPITAL LETTER G */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0047[ 14] = { /* code 0047, LATIN CAPITAL LETTER G */
   0x1F, 0x40,
   0x20, 0x00,
   0x50, 0x00,
   0x57, 0x40,
   0x51, 0x40,
   0x21, 0x40,
-  0x1F, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x1F, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0048[ 20] = { /* code 0048, LATIN CAPITAL LETTER H */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0048[ 14] = { /* code 0048, LATIN CAPITAL LETTER H */
   0x41, 0x40,
   0x41, 0x40,
   0x41, 0x40,
   0x7F, 0x40,
   0x41, 0x40,
   0x41, 0x40,
-  0x41, 0x40,
-  0x00, 0x00,
-  0x00, 0x00
+  0x41, 0x40
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0049[ 20] = { /* code 0049, LATIN CAPITAL LETTER I */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0049[ 14] = { /* code 0049, LATIN CAPITAL LETTER I */
   0x3F, 0x40,
   0x08, 0x00,
   0x08, 0x00,
   0x08, 0x00,
   0x08, 0x00,
   0x08, 0x00,
-  0x3F, 0x40,
-  0x00, 0x00,
-  0x00, 0x00
+  0x3F, 0x40
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_004A[ 20] = { /* code 004A, LATIN CAPITAL LETTER J */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_004A[ 14] = { /* code 004A, LATIN CAPITAL LETTER J */
   0x1F, 0x40,
   0x01, 0x40,
   0x01, 0x40,
   0x01, 0x40,
   0x01, 0x40,
   0x02, 0x00,
-  0x7E, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x7E, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_004B[ 20] = { /* code 004B, LATIN CAPITAL LETTER K */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_004B[ 14] = { /* code 004B, LATIN CAPITAL LETTER K */
   0x41, 0x80,
   0x46, 0x00,
   0x58, 0x00,
   0x78, 0x00,
   0x45, 0x00,
   0x42, 0x00,
-  0x41, 0xC0,
-  0x00, 0x00,
-  0x00, 0x00
+  0x41, 0xC0
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_004C[ 20] = { /* code 004C, LATIN CAPITAL LETTER L */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_004C[ 14] = { /* code 004C, LATIN CAPITAL LETTER L */
   0x40, 0x00,
   0x40, 0x00,
   0x40, 0x00,
   0x40, 0x00,
   0x40, 0x00,
   0x40, 0x00,
-  0x7F, 0x40,
-  0x00, 0x00,
-  0x00, 0x00
+  0x7F, 0x40
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_004D[ 20] = { /* code 004D, LATIN CAPITAL LETTER M */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_004D[ 14] = { /* code 004D, LATIN CAPITAL LETTER M */
   0x60, 0xC0,
   0x61, 0xC0,
   0x55, 0x80,
   0x55, 0x80,
   0x59, 0x80,
   0x50, 0x80,
-  0x50, 0x80,
-  0x00, 0x00,
-  0x00, 0x00
+  0x50, 0x80
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_004E[ 20] = { /* code 004E, LATIN CAPITAL LETTER N */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_004E[ 14] = { /* code 004E, LATIN CAPITAL LETTER N */
   0x61, 0x40,
   0x71, 0x40,
   0x55, 0x40,
   0x55, 0x40,
   0x55, 0x40,
   0x53, 0x40,
-  0x52, 0x40,
-  0x00, 0x00,
-  0x00, 0x00
+  0x52, 0x40
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_004F[ 20] = { /* code 004F, LATIN CAPITAL LETTER O */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_004F[ 14] = { /* code 004F, LATIN CAPITAL LETTER O */
   0x2E, 0x00,
   0x62, 0x40,
   0x51, 0x40,
   0x51, 0x40,
   0x51, 0x40,
   0x62, 0x40,
-  0x2E, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x2E, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0050[ 20] = { /* code 0050, LATIN CAPITAL LETTER P */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0050[ 14] = { /* code 0050, LATIN CAPITAL LETTER P */
   0x7F, 0x00,
   0x51, 0x40,
   0x51, 0x40,
   0x7F, 0x00,
   0x50, 0x00,
   0x50, 0x00,
-  0x50, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x50, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0051[ 20] = { /* code 0051, LATIN CAPITAL LETTER Q */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0051[ 16] = { /* code 0051, LATIN CAPITAL LETTER Q */
   0x2E, 0x00,
   0x62, 0x40,
   0x51, 0x40,
@@ -682,128 +484,100 @@ const uint8_t FontDejaVuSansMono10_AA2_0051[ 20] = { /* code 0051, LATIN CAPITAL
   0x51, 0x40,
   0x62, 0x40,
   0x2E, 0x00,
-  0x02, 0x00,
-  0x00, 0x00
+  0x02, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0052[ 20] = { /* code 0052, LATIN CAPITAL LETTER R */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0052[ 14] = { /* code 0052, LATIN CAPITAL LETTER R */
   0x7F, 0x00,
   0x51, 0x40,
   0x51, 0x40,
   0x7D, 0x00,
   0x52, 0x00,
   0x51, 0x40,
-  0x50, 0x80,
-  0x00, 0x00,
-  0x00, 0x00
+  0x50, 0x80
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0053[ 20] = { /* code 0053, LATIN CAPITAL LETTER S */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0053[ 14] = { /* code 0053, LATIN CAPITAL LETTER S */
   0x2F, 0x00,
   0x50, 0x40,
   0x50, 0x00,
   0x1F, 0x00,
   0x01, 0x40,
   0x41, 0x40,
-  0x2F, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x2F, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0054[ 20] = { /* code 0054, LATIN CAPITAL LETTER T */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0054[ 14] = { /* code 0054, LATIN CAPITAL LETTER T */
   0xBF, 0xC0,
   0x08, 0x00,
   0x08, 0x00,
   0x08, 0x00,
   0x08, 0x00,
   0x08, 0x00,
-  0x08, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x08, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0055[ 20] = { /* code 0055, LATIN CAPITAL LETTER U */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0055[ 14] = { /* code 0055, LATIN CAPITAL LETTER U */
   0x51, 0x40,
   0x51, 0x40,
   0x51, 0x40,
   0x51, 0x40,
   0x51, 0x40,
   0x51, 0x40,
-  0x2E, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x2E, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0056[ 20] = { /* code 0056, LATIN CAPITAL LETTER V */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0056[ 14] = { /* code 0056, LATIN CAPITAL LETTER V */
   0x50, 0x80,
   0x20, 0x80,
   0x20, 0x80,
   0x15, 0x40,
   0x16, 0x00,
   0x0A, 0x00,
-  0x0A, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x0A, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0057[ 20] = { /* code 0057, LATIN CAPITAL LETTER W */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0057[ 14] = { /* code 0057, LATIN CAPITAL LETTER W */
   0x80, 0x40,
   0x80, 0x80,
   0x89, 0x80,
   0x59, 0x80,
   0x66, 0x80,
   0x31, 0x80,
-  0x31, 0x40,
-  0x00, 0x00,
-  0x00, 0x00
+  0x31, 0x40
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0058[ 20] = { /* code 0058, LATIN CAPITAL LETTER X */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0058[ 14] = { /* code 0058, LATIN CAPITAL LETTER X */
   0x20, 0x80,
   0x14, 0x80,
   0x0A, 0x00,
   0x06, 0x00,
   0x0A, 0x40,
   0x20, 0x80,
-  0x60, 0x40,
-  0x00, 0x00,
-  0x00, 0x00
+  0x60, 0x40
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0059[ 20] = { /* code 0059, LATIN CAPITAL LETTER Y */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0059[ 14] = { /* code 0059, LATIN CAPITAL LETTER Y */
   0x90, 0x80,
   0x21, 0x40,
   0x16, 0x00,
   0x0D, 0x00,
   0x08, 0x00,
   0x08, 0x00,
-  0x08, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x08, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_005A[ 20] = { /* code 005A, LATIN CAPITAL LETTER Z */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_005A[ 14] = { /* code 005A, LATIN CAPITAL LETTER Z */
   0x7F, 0x40,
   0x02, 0x00,
   0x05, 0x00,
   0x08, 0x00,
   0x14, 0x00,
   0x20, 0x00,
-  0x7F, 0x40,
-  0x00, 0x00,
-  0x00, 0x00
+  0x7F, 0x40
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_005B[ 20] = { /* code 005B, LEFT SQUARE BRACKET */
+const uint8_t FontDejaVuSansMono10_AA2_005B[ 16] = { /* code 005B, LEFT SQUARE BRACKET */
   0x0F, 0x00,
   0x08, 0x00,
   0x08, 0x00,
@@ -811,25 +585,20 @@ const uint8_t FontDejaVuSansMono10_AA2_005B[ 20] = { /* code 005B, LEFT SQUARE B
   0x08, 0x00,
   0x08, 0x00,
   0x08, 0x00,
-  0x0F, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x0F, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_005C[ 20] = { /* code 005C, REVERSE SOLIDUS */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_005C[ 14] = { /* code 005C, REVERSE SOLIDUS */
   0x50, 0x00,
   0x20, 0x00,
   0x14, 0x00,
   0x08, 0x00,
   0x08, 0x00,
   0x02, 0x00,
-  0x02, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x02, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_005D[ 20] = { /* code 005D, RIGHT SQUARE BRACKET */
+const uint8_t FontDejaVuSansMono10_AA2_005D[ 16] = { /* code 005D, RIGHT SQUARE BRACKET */
   0x1D, 0x00,
   0x05, 0x00,
   0x05, 0x00,
@@ -837,64 +606,32 @@ const uint8_t FontDejaVuSansMono10_AA2_005D[ 20] = { /* code 005D, RIGHT SQUARE
   0x05, 0x00,
   0x05, 0x00,
   0x05, 0x00,
-  0x1D, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x1D, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_005E[ 20] = { /* code 005E, CIRCUMFLEX ACCENT */
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_005E[  4] = { /* code 005E, CIRCUMFLEX ACCENT */
   0x0E, 0x00,
-  0x61, 0xC0,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x61, 0xC0
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_005F[ 20] = { /* code 005F, LOW LINE */
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_005F[  2] = { /* code 005F, LOW LINE */
   0xFF, 0xC0
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0060[ 20] = { /* code 0060, GRAVE ACCENT */
+const uint8_t FontDejaVuSansMono10_AA2_0060[  4] = { /* code 0060, GRAVE ACCENT */
   0x24, 0x00,
-  0x08, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x08, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0061[ 20] = { /* code 0061, LATIN SMALL LETTER A */
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0061[ 10] = { /* code 0061, LATIN SMALL LETTER A */
   0x3F, 0x00,
   0x00, 0x40,
   0x3F, 0x80,
   0x51, 0x80,
-  0x3F, 0x80,
-  0x00, 0x00,
-  0x00, 0x00
+  0x3F, 0x80
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0062[ 20] = { /* code 0062, LATIN SMALL LETTER B */
+const uint8_t FontDejaVuSansMono10_AA2_0062[ 16] = { /* code 0062, LATIN SMALL LETTER B */
   0x50, 0x00,
   0x50, 0x00,
   0x50, 0x00,
@@ -902,25 +639,18 @@ const uint8_t FontDejaVuSansMono10_AA2_0062[ 20] = { /* code 0062, LATIN SMALL L
   0x61, 0x40,
   0x50, 0x80,
   0x61, 0x40,
-  0x7F, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x7F, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0063[ 20] = { /* code 0063, LATIN SMALL LETTER C */
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0063[ 10] = { /* code 0063, LATIN SMALL LETTER C */
   0x1F, 0x40,
   0x20, 0x00,
   0x50, 0x00,
   0x20, 0x00,
-  0x1F, 0x40,
-  0x00, 0x00,
-  0x00, 0x00
+  0x1F, 0x40
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0064[ 20] = { /* code 0064, LATIN SMALL LETTER D */
+const uint8_t FontDejaVuSansMono10_AA2_0064[ 16] = { /* code 0064, LATIN SMALL LETTER D */
   0x00, 0x80,
   0x00, 0x80,
   0x00, 0x80,
@@ -928,25 +658,18 @@ const uint8_t FontDejaVuSansMono10_AA2_0064[ 20] = { /* code 0064, LATIN SMALL L
   0x61, 0x80,
   0x50, 0x80,
   0x61, 0x80,
-  0x2F, 0x80,
-  0x00, 0x00,
-  0x00, 0x00
+  0x2F, 0x80
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0065[ 20] = { /* code 0065, LATIN SMALL LETTER E */
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0065[ 10] = { /* code 0065, LATIN SMALL LETTER E */
   0x2F, 0x00,
   0x21, 0x40,
   0x7F, 0x80,
   0x20, 0x00,
-  0x2F, 0x40,
-  0x00, 0x00,
-  0x00, 0x00
+  0x2F, 0x40
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0066[ 20] = { /* code 0066, LATIN SMALL LETTER F */
+const uint8_t FontDejaVuSansMono10_AA2_0066[ 16] = { /* code 0066, LATIN SMALL LETTER F */
   0x07, 0x80,
   0x04, 0x00,
   0x08, 0x00,
@@ -954,15 +677,10 @@ const uint8_t FontDejaVuSansMono10_AA2_0066[ 20] = { /* code 0066, LATIN SMALL L
   0x08, 0x00,
   0x08, 0x00,
   0x08, 0x00,
-  0x08, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x08, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0067[ 20] = { /* code 0067, LATIN SMALL LETTER G */
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0067[ 14] = { /* code 0067, LATIN SMALL LETTER G */
   0x2E, 0x80,
   0x61, 0x80,
   0x50, 0x80,
@@ -972,7 +690,7 @@ const uint8_t FontDejaVuSansMono10_AA2_0067[ 20] = { /* code 0067, LATIN SMALL L
   0x2F, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0068[ 20] = { /* code 0068, LATIN SMALL LETTER H */
+const uint8_t FontDejaVuSansMono10_AA2_0068[ 16] = { /* code 0068, LATIN SMALL LETTER H */
   0x50, 0x00,
   0x50, 0x00,
   0x50, 0x00,
@@ -980,12 +698,10 @@ const uint8_t FontDejaVuSansMono10_AA2_0068[ 20] = { /* code 0068, LATIN SMALL L
   0x61, 0x40,
   0x50, 0x80,
   0x50, 0x80,
-  0x50, 0x80,
-  0x00, 0x00,
-  0x00, 0x00
+  0x50, 0x80
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0069[ 20] = { /* code 0069, LATIN SMALL LETTER I */
+const uint8_t FontDejaVuSansMono10_AA2_0069[ 16] = { /* code 0069, LATIN SMALL LETTER I */
   0x08, 0x00,
   0x00, 0x00,
   0x00, 0x00,
@@ -993,9 +709,7 @@ const uint8_t FontDejaVuSansMono10_AA2_0069[ 20] = { /* code 0069, LATIN SMALL L
   0x08, 0x00,
   0x08, 0x00,
   0x08, 0x00,
-  0x7F, 0x80,
-  0x00, 0x00,
-  0x00, 0x00
+  0x7F, 0x80
 };
 
 const uint8_t FontDejaVuSansMono10_AA2_006A[ 20] = { /* code 006A, LATIN SMALL LETTER J */
@@ -1011,7 +725,7 @@ const uint8_t FontDejaVuSansMono10_AA2_006A[ 20] = { /* code 006A, LATIN SMALL L
   0x3C, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_006B[ 20] = { /* code 006B, LATIN SMALL LETTER K */
+const uint8_t FontDejaVuSansMono10_AA2_006B[ 16] = { /* code 006B, LATIN SMALL LETTER K */
   0x50, 0x00,
   0x50, 0x00,
   0x50, 0x00,
@@ -1019,12 +733,10 @@ const uint8_t FontDejaVuSansMono10_AA2_006B[ 20] = { /* code 006B, LATIN SMALL L
   0x5C, 0x00,
   0x78, 0x00,
   0x55, 0x00,
-  0x52, 0x40,
-  0x00, 0x00,
-  0x00, 0x00
+  0x52, 0x40
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_006C[ 20] = { /* code 006C, LATIN SMALL LETTER L */
+const uint8_t FontDejaVuSansMono10_AA2_006C[ 16] = { /* code 006C, LATIN SMALL LETTER L */
   0xB8, 0x00,
   0x08, 0x00,
   0x08, 0x00,
@@ -1032,54 +744,34 @@ const uint8_t FontDejaVuSansMono10_AA2_006C[ 20] = { /* code 006C, LATIN SMALL L
   0x08, 0x00,
   0x08, 0x00,
   0x08, 0x00,
-  0x07, 0x40,
-  0x00, 0x00,
-  0x00, 0x00
+  0x07, 0x40
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_006D[ 20] = { /* code 006D, LATIN SMALL LETTER M */
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_006D[ 10] = { /* code 006D, LATIN SMALL LETTER M */
   0x7E, 0xC0,
   0x55, 0x80,
   0x55, 0x80,
   0x55, 0x80,
-  0x55, 0x80,
-  0x00, 0x00,
-  0x00, 0x00
+  0x55, 0x80
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_006E[ 20] = { /* code 006E, LATIN SMALL LETTER N */
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_006E[ 10] = { /* code 006E, LATIN SMALL LETTER N */
   0x6F, 0x00,
   0x61, 0x40,
   0x50, 0x80,
   0x50, 0x80,
-  0x50, 0x80,
-  0x00, 0x00,
-  0x00, 0x00
+  0x50, 0x80
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_006F[ 20] = { /* code 006F, LATIN SMALL LETTER O */
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_006F[ 10] = { /* code 006F, LATIN SMALL LETTER O */
   0x2F, 0x00,
   0x61, 0x40,
   0x50, 0x80,
   0x61, 0x40,
-  0x2F, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x2F, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0070[ 20] = { /* code 0070, LATIN SMALL LETTER P */
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0070[ 14] = { /* code 0070, LATIN SMALL LETTER P */
   0x7F, 0x00,
   0x61, 0x40,
   0x50, 0x80,
@@ -1089,10 +781,7 @@ const uint8_t FontDejaVuSansMono10_AA2_0070[ 20] = { /* code 0070, LATIN SMALL L
   0x50, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0071[ 20] = { /* code 0071, LATIN SMALL LETTER Q */
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0071[ 14] = { /* code 0071, LATIN SMALL LETTER Q */
   0x2E, 0x80,
   0x61, 0x80,
   0x50, 0x80,
@@ -1102,101 +791,64 @@ const uint8_t FontDejaVuSansMono10_AA2_0071[ 20] = { /* code 0071, LATIN SMALL L
   0x00, 0x80
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0072[ 20] = { /* code 0072, LATIN SMALL LETTER R */
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0072[ 10] = { /* code 0072, LATIN SMALL LETTER R */
   0x1B, 0xC0,
   0x18, 0x00,
   0x14, 0x00,
   0x14, 0x00,
-  0x14, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x14, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0073[ 20] = { /* code 0073, LATIN SMALL LETTER S */
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0073[ 10] = { /* code 0073, LATIN SMALL LETTER S */
   0x3F, 0x80,
   0x50, 0x00,
   0x2F, 0x00,
   0x00, 0x80,
-  0x7F, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x7F, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0074[ 20] = { /* code 0074, LATIN SMALL LETTER T */
-  0x00, 0x00,
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0074[ 12] = { /* code 0074, LATIN SMALL LETTER T */
   0x08, 0x00,
   0x7F, 0x40,
   0x08, 0x00,
   0x08, 0x00,
   0x08, 0x00,
-  0x0B, 0x40,
-  0x00, 0x00,
-  0x00, 0x00
+  0x0B, 0x40
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0075[ 20] = { /* code 0075, LATIN SMALL LETTER U */
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0075[ 10] = { /* code 0075, LATIN SMALL LETTER U */
   0x50, 0x80,
   0x50, 0x80,
   0x50, 0x80,
   0x51, 0x80,
-  0x3E, 0x80,
-  0x00, 0x00,
-  0x00, 0x00
+  0x3E, 0x80
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0076[ 20] = { /* code 0076, LATIN SMALL LETTER V */
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0076[ 10] = { /* code 0076, LATIN SMALL LETTER V */
   0x21, 0x40,
   0x12, 0x00,
   0x26, 0x00,
   0x1D, 0x00,
-  0x0C, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x0C, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0077[ 20] = { /* code 0077, LATIN SMALL LETTER W */
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0077[ 10] = { /* code 0077, LATIN SMALL LETTER W */
   0x80, 0x40,
   0x88, 0x80,
   0x59, 0x40,
   0x26, 0x80,
-  0x22, 0x40,
-  0x00, 0x00,
-  0x00, 0x00
+  0x22, 0x40
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0078[ 20] = { /* code 0078, LATIN SMALL LETTER X */
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0078[ 10] = { /* code 0078, LATIN SMALL LETTER X */
   0x20, 0xC0,
   0x0A, 0x00,
   0x05, 0x00,
   0x1A, 0x40,
-  0x20, 0xC0,
-  0x00, 0x00,
-  0x00, 0x00
+  0x20, 0xC0
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_0079[ 20] = { /* code 0079, LATIN SMALL LETTER Y */
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_0079[ 14] = { /* code 0079, LATIN SMALL LETTER Y */
   0x21, 0x40,
   0x22, 0x00,
   0x16, 0x00,
@@ -1206,20 +858,15 @@ const uint8_t FontDejaVuSansMono10_AA2_0079[ 20] = { /* code 0079, LATIN SMALL L
   0x34, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_007A[ 20] = { /* code 007A, LATIN SMALL LETTER Z */
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_007A[ 10] = { /* code 007A, LATIN SMALL LETTER Z */
   0x7F, 0x80,
   0x02, 0x00,
   0x08, 0x00,
   0x24, 0x00,
-  0x7F, 0x80,
-  0x00, 0x00,
-  0x00, 0x00
+  0x7F, 0x80
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_007B[ 20] = { /* code 007B, LEFT CURLY BRACKET */
+const uint8_t FontDejaVuSansMono10_AA2_007B[ 16] = { /* code 007B, LEFT CURLY BRACKET */
   0x07, 0x40,
   0x08, 0x00,
   0x08, 0x00,
@@ -1227,13 +874,10 @@ const uint8_t FontDejaVuSansMono10_AA2_007B[ 20] = { /* code 007B, LEFT CURLY BR
   0x08, 0x00,
   0x08, 0x00,
   0x08, 0x00,
-  0x07, 0x40,
-  0x00, 0x00,
-  0x00, 0x00
+  0x07, 0x40
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_007C[ 20] = { /* code 007C, VERTICAL LINE */
-  0x04, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_007C[ 18] = { /* code 007C, VERTICAL LINE */
   0x04, 0x00,
   0x04, 0x00,
   0x04, 0x00,
@@ -1242,10 +886,10 @@ const uint8_t FontDejaVuSansMono10_AA2_007C[ 20] = { /* code 007C, VERTICAL LINE
   0x04, 0x00,
   0x04, 0x00,
   0x04, 0x00,
-  0x00, 0x00
+  0x04, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_007D[ 20] = { /* code 007D, RIGHT CURLY BRACKET */
+const uint8_t FontDejaVuSansMono10_AA2_007D[ 16] = { /* code 007D, RIGHT CURLY BRACKET */
   0x38, 0x00,
   0x08, 0x00,
   0x04, 0x00,
@@ -1253,121 +897,111 @@ const uint8_t FontDejaVuSansMono10_AA2_007D[ 20] = { /* code 007D, RIGHT CURLY B
   0x09, 0x00,
   0x08, 0x00,
   0x08, 0x00,
-  0x38, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x38, 0x00
 };
 
-const uint8_t FontDejaVuSansMono10_AA2_007E[ 20] = { /* code 007E, TILDE */
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
+const uint8_t FontDejaVuSansMono10_AA2_007E[  4] = { /* code 007E, TILDE */
   0x3C, 0x00,
-  0x03, 0x80,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00,
-  0x00, 0x00
+  0x03, 0x80
 };
 
 const aafontsCharInfo_t charTable_DejaVuSansMono10_AA2[95] = 
 {
-  {   5,   2, FontDejaVuSansMono10_AA2_0020 }, /* code 0020 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0021 }, /* code 0021 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0022 }, /* code 0022 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0023 }, /* code 0023 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0024 }, /* code 0024 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0025 }, /* code 0025 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0026 }, /* code 0026 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0027 }, /* code 0027 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0028 }, /* code 0028 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0029 }, /* code 0029 */
-  {   5,   2, FontDejaVuSansMono10_AA2_002A }, /* code 002A */
-  {   5,   2, FontDejaVuSansMono10_AA2_002B }, /* code 002B */
-  {   5,   2, FontDejaVuSansMono10_AA2_002C }, /* code 002C */
-  {   5,   2, FontDejaVuSansMono10_AA2_002D }, /* code 002D */
-  {   5,   2, FontDejaVuSansMono10_AA2_002E }, /* code 002E */
-  {   5,   2, FontDejaVuSansMono10_AA2_002F }, /* code 002F */
-  {   5,   2, FontDejaVuSansMono10_AA2_0030 }, /* code 0030 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0031 }, /* code 0031 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0032 }, /* code 0032 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0033 }, /* code 0033 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0034 }, /* code 0034 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0035 }, /* code 0035 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0036 }, /* code 0036 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0037 }, /* code 0037 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0038 }, /* code 0038 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0039 }, /* code 0039 */
-  {   5,   2, FontDejaVuSansMono10_AA2_003A }, /* code 003A */
-  {   5,   2, FontDejaVuSansMono10_AA2_003B }, /* code 003B */
-  {   5,   2, FontDejaVuSansMono10_AA2_003C }, /* code 003C */
-  {   5,   2, FontDejaVuSansMono10_AA2_003D }, /* code 003D */
-  {   5,   2, FontDejaVuSansMono10_AA2_003E }, /* code 003E */
-  {   5,   2, FontDejaVuSansMono10_AA2_003F }, /* code 003F */
-  {   5,   2, FontDejaVuSansMono10_AA2_0040 }, /* code 0040 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0041 }, /* code 0041 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0042 }, /* code 0042 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0043 }, /* code 0043 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0044 }, /* code 0044 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0045 }, /* code 0045 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0046 }, /* code 0046 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0047 }, /* code 0047 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0048 }, /* code 0048 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0049 }, /* code 0049 */
-  {   5,   2, FontDejaVuSansMono10_AA2_004A }, /* code 004A */
-  {   5,   2, FontDejaVuSansMono10_AA2_004B }, /* code 004B */
-  {   5,   2, FontDejaVuSansMono10_AA2_004C }, /* code 004C */
-  {   5,   2, FontDejaVuSansMono10_AA2_004D }, /* code 004D */
-  {   5,   2, FontDejaVuSansMono10_AA2_004E }, /* code 004E */
-  {   5,   2, FontDejaVuSansMono10_AA2_004F }, /* code 004F */
-  {   5,   2, FontDejaVuSansMono10_AA2_0050 }, /* code 0050 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0051 }, /* code 0051 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0052 }, /* code 0052 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0053 }, /* code 0053 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0054 }, /* code 0054 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0055 }, /* code 0055 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0056 }, /* code 0056 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0057 }, /* code 0057 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0058 }, /* code 0058 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0059 }, /* code 0059 */
-  {   5,   2, FontDejaVuSansMono10_AA2_005A }, /* code 005A */
-  {   5,   2, FontDejaVuSansMono10_AA2_005B }, /* code 005B */
-  {   5,   2, FontDejaVuSansMono10_AA2_005C }, /* code 005C */
-  {   5,   2, FontDejaVuSansMono10_AA2_005D }, /* code 005D */
-  {   5,   2, FontDejaVuSansMono10_AA2_005E }, /* code 005E */
-  {   5,   2, FontDejaVuSansMono10_AA2_005F }, /* code 005F */
-  {   5,   2, FontDejaVuSansMono10_AA2_0060 }, /* code 0060 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0061 }, /* code 0061 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0062 }, /* code 0062 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0063 }, /* code 0063 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0064 }, /* code 0064 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0065 }, /* code 0065 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0066 }, /* code 0066 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0067 }, /* code 0067 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0068 }, /* code 0068 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0069 }, /* code 0069 */
-  {   5,   2, FontDejaVuSansMono10_AA2_006A }, /* code 006A */
-  {   5,   2, FontDejaVuSansMono10_AA2_006B }, /* code 006B */
-  {   5,   2, FontDejaVuSansMono10_AA2_006C }, /* code 006C */
-  {   5,   2, FontDejaVuSansMono10_AA2_006D }, /* code 006D */
-  {   5,   2, FontDejaVuSansMono10_AA2_006E }, /* code 006E */
-  {   5,   2, FontDejaVuSansMono10_AA2_006F }, /* code 006F */
-  {   5,   2, FontDejaVuSansMono10_AA2_0070 }, /* code 0070 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0071 }, /* code 0071 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0072 }, /* code 0072 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0073 }, /* code 0073 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0074 }, /* code 0074 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0075 }, /* code 0075 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0076 }, /* code 0076 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0077 }, /* code 0077 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0078 }, /* code 0078 */
-  {   5,   2, FontDejaVuSansMono10_AA2_0079 }, /* code 0079 */
-  {   5,   2, FontDejaVuSansMono10_AA2_007A }, /* code 007A */
-  {   5,   2, FontDejaVuSansMono10_AA2_007B }, /* code 007B */
-  {   5,   2, FontDejaVuSansMono10_AA2_007C }, /* code 007C */
-  {   5,   2, FontDejaVuSansMono10_AA2_007D }, /* code 007D */
-  {   5,   2, FontDejaVuSansMono10_AA2_007E }  /* code 007E */
+  {   5,   2,   0,   0, NULL }, /* code 0020 */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_0021 }, /* code 0021 */
+  {   5,   2,   1,   2, FontDejaVuSansMono10_AA2_0022 }, /* code 0022 */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_0023 }, /* code 0023 */
+  {   5,   2,   1,   8, FontDejaVuSansMono10_AA2_0024 }, /* code 0024 */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_0025 }, /* code 0025 */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_0026 }, /* code 0026 */
+  {   5,   2,   1,   2, FontDejaVuSansMono10_AA2_0027 }, /* code 0027 */
+  {   5,   2,   0,   8, FontDejaVuSansMono10_AA2_0028 }, /* code 0028 */
+  {   5,   2,   0,   8, FontDejaVuSansMono10_AA2_0029 }, /* code 0029 */
+  {   5,   2,   1,   4, FontDejaVuSansMono10_AA2_002A }, /* code 002A */
+  {   5,   2,   3,   5, FontDejaVuSansMono10_AA2_002B }, /* code 002B */
+  {   5,   2,   7,   3, FontDejaVuSansMono10_AA2_002C }, /* code 002C */
+  {   5,   2,   5,   1, FontDejaVuSansMono10_AA2_002D }, /* code 002D */
+  {   5,   2,   7,   1, FontDejaVuSansMono10_AA2_002E }, /* code 002E */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_002F }, /* code 002F */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_0030 }, /* code 0030 */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_0031 }, /* code 0031 */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_0032 }, /* code 0032 */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_0033 }, /* code 0033 */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_0034 }, /* code 0034 */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_0035 }, /* code 0035 */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_0036 }, /* code 0036 */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_0037 }, /* code 0037 */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_0038 }, /* code 0038 */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_0039 }, /* code 0039 */
+  {   5,   2,   3,   5, FontDejaVuSansMono10_AA2_003A }, /* code 003A */
+  {   5,   2,   3,   7, FontDejaVuSansMono10_AA2_003B }, /* code 003B */
+  {   5,   2,   3,   4, FontDejaVuSansMono10_AA2_003C }, /* code 003C */
+  {   5,   2,   4,   3, FontDejaVuSansMono10_AA2_003D }, /* code 003D */
+  {   5,   2,   3,   4, FontDejaVuSansMono10_AA2_003E }, /* code 003E */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_003F }, /* code 003F */
+  {   5,   2,   2,   7, FontDejaVuSansMono10_AA2_0040 }, /* code 0040 */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_0041 }, /* code 0041 */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_0042 }, /* code 0042 */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_0043 }, /* code 0043 */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_0044 }, /* code 0044 */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_0045 }, /* code 0045 */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_0046 }, /* code 0046 */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_0047 }, /* code 0047 */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_0048 }, /* code 0048 */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_0049 }, /* code 0049 */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_004A }, /* code 004A */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_004B }, /* code 004B */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_004C }, /* code 004C */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_004D }, /* code 004D */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_004E }, /* code 004E */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_004F }, /* code 004F */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_0050 }, /* code 0050 */
+  {   5,   2,   1,   8, FontDejaVuSansMono10_AA2_0051 }, /* code 0051 */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_0052 }, /* code 0052 */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_0053 }, /* code 0053 */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_0054 }, /* code 0054 */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_0055 }, /* code 0055 */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_0056 }, /* code 0056 */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_0057 }, /* code 0057 */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_0058 }, /* code 0058 */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_0059 }, /* code 0059 */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_005A }, /* code 005A */
+  {   5,   2,   0,   8, FontDejaVuSansMono10_AA2_005B }, /* code 005B */
+  {   5,   2,   1,   7, FontDejaVuSansMono10_AA2_005C }, /* code 005C */
+  {   5,   2,   0,   8, FontDejaVuSansMono10_AA2_005D }, /* code 005D */
+  {   5,   2,   1,   2, FontDejaVuSansMono10_AA2_005E }, /* code 005E */
+  {   5,   2,   9,   1, FontDejaVuSansMono10_AA2_005F }, /* code 005F */
+  {   5,   2,   0,   2, FontDejaVuSansMono10_AA2_0060 }, /* code 0060 */
+  {   5,   2,   3,   5, FontDejaVuSansMono10_AA2_0061 }, /* code 0061 */
+  {   5,   2,   0,   8, FontDejaVuSansMono10_AA2_0062 }, /* code 0062 */
+  {   5,   2,   3,   5, FontDejaVuSansMono10_AA2_0063 }, /* code 0063 */
+  {   5,   2,   0,   8, FontDejaVuSansMono10_AA2_0064 }, /* code 0064 */
+  {   5,   2,   3,   5, FontDejaVuSansMono10_AA2_0065 }, /* code 0065 */
+  {   5,   2,   0,   8, FontDejaVuSansMono10_AA2_0066 }, /* code 0066 */
+  {   5,   2,   3,   7, FontDejaVuSansMono10_AA2_0067 }, /* code 0067 */
+  {   5,   2,   0,   8, FontDejaVuSansMono10_AA2_0068 }, /* code 0068 */
+  {   5,   2,   0,   8, FontDejaVuSansMono10_AA2_0069 }, /* code 0069 */
+  {   5,   2,   0,  10, FontDejaVuSansMono10_AA2_006A }, /* code 006A */
+  {   5,   2,   0,   8, FontDejaVuSansMono10_AA2_006B }, /* code 006B */
+  {   5,   2,   0,   8, FontDejaVuSansMono10_AA2_006C }, /* code 006C */
+  {   5,   2,   3,   5, FontDejaVuSansMono10_AA2_006D }, /* code 006D */
+  {   5,   2,   3,   5, FontDejaVuSansMono10_AA2_006E }, /* code 006E */
+  {   5,   2,   3,   5, FontDejaVuSansMono10_AA2_006F }, /* code 006F */
+  {   5,   2,   3,   7, FontDejaVuSansMono10_AA2_0070 }, /* code 0070 */
+  {   5,   2,   3,   7, FontDejaVuSansMono10_AA2_0071 }, /* code 0071 */
+  {   5,   2,   3,   5, FontDejaVuSansMono10_AA2_0072 }, /* code 0072 */
+  {   5,   2,   3,   5, FontDejaVuSansMono10_AA2_0073 }, /* code 0073 */
+  {   5,   2,   2,   6, FontDejaVuSansMono10_AA2_0074 }, /* code 0074 */
+  {   5,   2,   3,   5, FontDejaVuSansMono10_AA2_0075 }, /* code 0075 */
+  {   5,   2,   3,   5, FontDejaVuSansMono10_AA2_0076 }, /* code 0076 */
+  {   5,   2,   3,   5, FontDejaVuSansMono10_AA2_0077 }, /* code 0077 */
+  {   5,   2,   3,   5, FontDejaVuSansMono10_AA2_0078 }, /* code 0078 */
+  {   5,   2,   3,   7, FontDejaVuSansMono10_AA2_0079 }, /* code 0079 */
+  {   5,   2,   3,   5, FontDejaVuSansMono10_AA2_007A }, /* code 007A */
+  {   5,   2,   0,   8, FontDejaVuSansMono10_AA2_007B }, /* code 007B */
+  {   5,   2,   0,   9, FontDejaVuSansMono10_AA2_007C }, /* code 007C */
+  {   5,   2,   0,   8, FontDejaVuSansMono10_AA2_007D }, /* code 007D */
+  {   5,   2,   4,   2, FontDejaVuSansMono10_AA2_007E }  /* code 007E */
 };
 
 aafontsFont_t DejaVuSansMono10_AA2 = 
@@ -1380,5 +1014,8 @@ aafontsFont_t DejaVuSansMono10_AA2 =
   8,                                            /* Font baseline */
   0x0020,                                       /* Unicode address of first character */
   0x007E,                                       /* Unicode address of last character */
-  &charTable_DejaVuSansMono10_AA2[0]  	    /* Font char data */
+  &charTable_DejaVuSansMono10_AA2[0],           /* Font char data */
+  NULL,                                         /* Sparse character ranges */
+  0,                                            /* Number of character ranges */
+  AAFONTS_ENCODING_RAW                          /* Glyph data encoding */
 };
@@ -1558,101 +1558,101 @@ const uint8_t FontDejaVuSansMono13_AA2_007E[ 26] = { /* code 007E, TILDE */
 
 const aafontsCharInfo_t charTable_DejaVuSansMono13_AA2[95] = 
 {
-  {   7,   2, FontDejaVuSansMono13_AA2_0020 }, /* code 0020 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0021 }, /* code 0021 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0022 }, /* code 0022 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0023 }, /* code 0023 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0024 }, /* code 0024 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0025 }, /* code 0025 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0026 }, /* code 0026 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0027 }, /* code 0027 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0028 }, /* code 0028 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0029 }, /* code 0029 */
-  {   7,   2, FontDejaVuSansMono13_AA2_002A }, /* code 002A */
-  {   7,   2, FontDejaVuSansMono13_AA2_002B }, /* code 002B */
-  {   7,   2, FontDejaVuSansMono13_AA2_002C }, /* code 002C */
-  {   7,   2, FontDejaVuSansMono13_AA2_002D }, /* code 002D */
-  {   7,   2, FontDejaVuSansMono13_AA2_002E }, /* code 002E */
-  {   7,   2, FontDejaVuSansMono13_AA2_002F }, /* code 002F */
-  {   7,   2, FontDejaVuSansMono13_AA2_0030 }, /* code 0030 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0031 }, /* code 0031 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0032 }, /* code 0032 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0033 }, /* code 0033 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0034 }, /* code 0034 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0035 }, /* code 0035 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0036 }, /* code 0036 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0037 }, /* code 0037 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0038 }, /* code 0038 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0039 }, /* code 0039 */
-  {   7,   2, FontDejaVuSansMono13_AA2_003A }, /* code 003A */
-  {   7,   2, FontDejaVuSansMono13_AA2_003B }, /* code 003B */
-  {   7,   2, FontDejaVuSansMono13_AA2_003C }, /* code 003C */
-  {   7,   2, FontDejaVuSansMono13_AA2_003D }, /* code 003D */
-  {   7,   2, FontDejaVuSansMono13_AA2_003E }, /* code 003E */
-  {   7,   2, FontDejaVuSansMono13_AA2_003F }, /* code 003F */
-  {   7,   2, FontDejaVuSansMono13_AA2_0040 }, /* code 0040 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0041 }, /* code 0041 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0042 }, /* code 0042 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0043 }, /* code 0043 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0044 }, /* code 0044 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0045 }, /* code 0045 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0046 }, /* code 0046 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0047 }, /* code 0047 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0048 }, /* code 0048 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0049 }, /* code 0049 */
-  {   7,   2, FontDejaVuSansMono13_AA2_004A }, /* code 004A */
-  {   7,   2, FontDejaVuSansMono13_AA2_004B }, /* code 004B */
-  {   7,   2, FontDejaVuSansMono13_AA2_004C }, /* code 004C */
-  {   7,   2, FontDejaVuSansMono13_AA2_004D }, /* code 004D */
-  {   7,   2, FontDejaVuSansMono13_AA2_004E }, /* code 004E */
-  {   7,   2, FontDejaVuSansMono13_AA2_004F }, /* code 004F */
-  {   7,   2, FontDejaVuSansMono13_AA2_0050 }, /* code 0050 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0051 }, /* code 0051 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0052 }, /* code 0052 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0053 }, /* code 0053 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0054 }, /* code 0054 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0055 }, /* code 0055 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0056 }, /* code 0056 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0057 }, /* code 0057 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0058 }, /* code 0058 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0059 }, /* code 0059 */
-  {   7,   2, FontDejaVuSansMono13_AA2_005A }, /* code 005A */
-  {   7,   2, FontDejaVuSansMono13_AA2_005B }, /* code 005B */
-  {   7,   2, FontDejaVuSansMono13_AA2_005C }, /* code 005C */
-  {   7,   2, FontDejaVuSansMono13_AA2_005D }, /* code 005D */
-  {   7,   2, FontDejaVuSansMono13_AA2_005E }, /* code 005E */
-  {   7,   2, FontDejaVuSansMono13_AA2_005F }, /* code 005F */
-  {   7,   2, FontDejaVuSansMono13_AA2_0060 }, /* code 0060 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0061 }, /* code 0061 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0062 }, /* code 0062 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0063 }, /* code 0063 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0064 }, /* code 0064 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0065 }, /* code 0065 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0066 }, /* code 0066 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0067 }, /* code 0067 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0068 }, /* code 0068 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0069 }, /* code 0069 */
-  {   7,   2, FontDejaVuSansMono13_AA2_006A }, /* code 006A */
-  {   7,   2, FontDejaVuSansMono13_AA2_006B }, /* code 006B */
-  {   7,   2, FontDejaVuSansMono13_AA2_006C }, /* code 006C */
-  {   7,   2, FontDejaVuSansMono13_AA2_006D }, /* code 006D */
-  {   7,   2, FontDejaVuSansMono13_AA2_006E }, /* code 006E */
-  {   7,   2, FontDejaVuSansMono13_AA2_006F }, /* code 006F */
-  {   7,   2, FontDejaVuSansMono13_AA2_0070 }, /* code 0070 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0071 }, /* code 0071 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0072 }, /* code 0072 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0073 }, /* code 0073 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0074 }, /* code 0074 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0075 }, /* code 0075 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0076 }, /* code 0076 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0077 }, /* code 0077 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0078 }, /* code 0078 */
-  {   7,   2, FontDejaVuSansMono13_AA2_0079 }, /* code 0079 */
-  {   7,   2, FontDejaVuSansMono13_AA2_007A }, /* code 007A */
-  {   7,   2, FontDejaVuSansMono13_AA2_007B }, /* code 007B */
-  {   7,   2, FontDejaVuSansMono13_AA2_007C }, /* code 007C */
-  {   7,   2, FontDejaVuSansMono13_AA2_007D }, /* code 007D */
-  {   7,   2, FontDejaVuSansMono13_AA2_007E }  /* code 007E */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0020 }, /* code 0020 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0021 }, /* code 0021 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0022 }, /* code 0022 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0023 }, /* code 0023 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0024 }, /* code 0024 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0025 }, /* code 0025 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0026 }, /* code 0026 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0027 }, /* code 0027 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0028 }, /* code 0028 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0029 }, /* code 0029 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_002A }, /* code 002A */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_002B }, /* code 002B */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_002C }, /* code 002C */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_002D }, /* code 002D */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_002E }, /* code 002E */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_002F }, /* code 002F */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0030 }, /* code 0030 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0031 }, /* code 0031 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0032 }, /* code 0032 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0033 }, /* code 0033 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0034 }, /* code 0034 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0035 }, /* code 0035 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0036 }, /* code 0036 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0037 }, /* code 0037 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0038 }, /* code 0038 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0039 }, /* code 0039 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_003A }, /* code 003A */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_003B }, /* code 003B */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_003C }, /* code 003C */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_003D }, /* code 003D */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_003E }, /* code 003E */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_003F }, /* code 003F */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0040 }, /* code 0040 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0041 }, /* code 0041 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0042 }, /* code 0042 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0043 }, /* code 0043 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0044 }, /* code 0044 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0045 }, /* code 0045 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0046 }, /* code 0046 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0047 }, /* code 0047 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0048 }, /* code 0048 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0049 }, /* code 0049 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_004A }, /* code 004A */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_004B }, /* code 004B */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_004C }, /* code 004C */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_004D }, /* code 004D */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_004E }, /* code 004E */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_004F }, /* code 004F */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0050 }, /* code 0050 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0051 }, /* code 0051 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0052 }, /* code 0052 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0053 }, /* code 0053 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0054 }, /* code 0054 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0055 }, /* code 0055 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0056 }, /* code 0056 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0057 }, /* code 0057 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0058 }, /* code 0058 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0059 }, /* code 0059 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_005A }, /* code 005A */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_005B }, /* code 005B */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_005C }, /* code 005C */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_005D }, /* code 005D */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_005E }, /* code 005E */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_005F }, /* code 005F */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0060 }, /* code 0060 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0061 }, /* code 0061 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0062 }, /* code 0062 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0063 }, /* code 0063 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0064 }, /* code 0064 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0065 }, /* code 0065 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0066 }, /* code 0066 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0067 }, /* code 0067 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0068 }, /* code 0068 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0069 }, /* code 0069 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_006A }, /* code 006A */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_006B }, /* code 006B */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_006C }, /* code 006C */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_006D }, /* code 006D */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_006E }, /* code 006E */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_006F }, /* code 006F */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0070 }, /* code 0070 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0071 }, /* code 0071 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0072 }, /* code 0072 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0073 }, /* code 0073 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0074 }, /* code 0074 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0075 }, /* code 0075 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0076 }, /* code 0076 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0077 }, /* code 0077 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0078 }, /* code 0078 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_0079 }, /* code 0079 */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_007A }, /* code 007A */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_007B }, /* code 007B */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_007C }, /* code 007C */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_007D }, /* code 007D */
+  {   7,   2,   0,  13, FontDejaVuSansMono13_AA2_007E }  /* code 007E */
 };
 
 aafontsFont_t DejaVuSansMono13_AA2 = 
@@ -1665,5 +1665,8 @@ aafontsFont_t DejaVuSansMono13_AA2 =
   10,                                           /* Font baseline */
   0x0020,                                       /* Unicode address of first character */
   0x007E,                                       /* Unicode address of last character */
-  &charTable_DejaVuSansMono13_AA2[0]  	    /* Font char data */
+  &charTable_DejaVuSansMono13_AA2[0],           /* Font char data */
+  NULL,                                         /* Sparse character ranges */
+  0,                                            /* Number of character ranges */
+  AAFONTS_ENCODING_RAW                          /* Glyph data encoding */
 };
@@ -2033,101 +2033,101 @@ const uint8_t FontCalibri18_AA2_007E[ 36] = { /* code 007E, TILDE */
 
 const aafontsCharInfo_t charTable_Calibri18_AA2[95] = 
 {
-  {   3,   1, FontCalibri18_AA2_0020 }, /* code 0020 */
-  {   5,   2, FontCalibri18_AA2_0021 }, /* code 0021 */
-  {   6,   2, FontCalibri18_AA2_0022 }, /* code 0022 */
-  {   7,   2, FontCalibri18_AA2_0023 }, /* code 0023 */
-  {   7,   2, FontCalibri18_AA2_0024 }, /* code 0024 */
-  {  11,   3, FontCalibri18_AA2_0025 }, /* code 0025 */
-  {  10,   3, FontCalibri18_AA2_0026 }, /* code 0026 */
-  {   3,   1, FontCalibri18_AA2_0027 }, /* code 0027 */
-  {   5,   2, FontCalibri18_AA2_0028 }, /* code 0028 */
-  {   5,   2, FontCalibri18_AA2_0029 }, /* code 0029 */
-  {   7,   2, FontCalibri18_AA2_002A }, /* code 002A */
-  {   7,   2, FontCalibri18_AA2_002B }, /* code 002B */
-  {   4,   1, FontCalibri18_AA2_002C }, /* code 002C */
-  {   5,   2, FontCalibri18_AA2_002D }, /* code 002D */
-  {   4,   1, FontCalibri18_AA2_002E }, /* code 002E */
-  {   6,   2, FontCalibri18_AA2_002F }, /* code 002F */
-  {   7,   2, FontCalibri18_AA2_0030 }, /* code 0030 */
-  {   7,   2, FontCalibri18_AA2_0031 }, /* code 0031 */
-  {   7,   2, FontCalibri18_AA2_0032 }, /* code 0032 */
-  {   7,   2, FontCalibri18_AA2_0033 }, /* code 0033 */
-  {   7,   2, FontCalibri18_AA2_0034 }, /* code 0034 */
-  {   7,   2, FontCalibri18_AA2_0035 }, /* code 0035 */
-  {   7,   2, FontCalibri18_AA2_0036 }, /* code 0036 */
-  {   7,   2, FontCalibri18_AA2_0037 }, /* code 0037 */
-  {   7,   2, FontCalibri18_AA2_0038 }, /* code 0038 */
-  {   7,   2, FontCalibri18_AA2_0039 }, /* code 0039 */
-  {   4,   1, FontCalibri18_AA2_003A }, /* code 003A */
-  {   4,   1, FontCalibri18_AA2_003B }, /* code 003B */
-  {   7,   2, FontCalibri18_AA2_003C }, /* code 003C */
-  {   7,   2, FontCalibri18_AA2_003D }, /* code 003D */
-  {   7,   2, FontCalibri18_AA2_003E }, /* code 003E */
-  {   7,   2, FontCalibri18_AA2_003F }, /* code 003F */
-  {  13,   4, FontCalibri18_AA2_0040 }, /* code 0040 */
-  {   9,   3, FontCalibri18_AA2_0041 }, /* code 0041 */
-  {   8,   2, FontCalibri18_AA2_0042 }, /* code 0042 */
-  {   8,   2, FontCalibri18_AA2_0043 }, /* code 0043 */
-  {   9,   3, FontCalibri18_AA2_0044 }, /* code 0044 */
-  {   7,   2, FontCalibri18_AA2_0045 }, /* code 0045 */
-  {   7,   2, FontCalibri18_AA2_0046 }, /* code 0046 */
-  {   9,   3, FontCalibri18_AA2_0047 }, /* code 0047 */
-  {   9,   3, FontCalibri18_AA2_0048 }, /* code 0048 */
-  {   4,   1, FontCalibri18_AA2_0049 }, /* code 0049 */
-  {   5,   2, FontCalibri18_AA2_004A }, /* code 004A */
-  {   8,   2, FontCalibri18_AA2_004B }, /* code 004B */
-  {   6,   2, FontCalibri18_AA2_004C }, /* code 004C */
-  {  12,   3, FontCalibri18_AA2_004D }, /* code 004D */
-  {  10,   3, FontCalibri18_AA2_004E }, /* code 004E */
-  {  10,   3, FontCalibri18_AA2_004F }, /* code 004F */
-  {   8,   2, FontCalibri18_AA2_0050 }, /* code 0050 */
-  {  10,   3, FontCalibri18_AA2_0051 }, /* code 0051 */
-  {   8,   2, FontCalibri18_AA2_0052 }, /* code 0052 */
-  {   7,   2, FontCalibri18_AA2_0053 }, /* code 0053 */
-  {   7,   2, FontCalibri18_AA2_0054 }, /* code 0054 */
-  {   9,   3, FontCalibri18_AA2_0055 }, /* code 0055 */
-  {   9,   3, FontCalibri18_AA2_0056 }, /* code 0056 */
-  {  13,   4, FontCalibri18_AA2_0057 }, /* code 0057 */
-  {   8,   2, FontCalibri18_AA2_0058 }, /* code 0058 */
-  {   7,   2, FontCalibri18_AA2_0059 }, /* code 0059 */
-  {   7,   2, FontCalibri18_AA2_005A }, /* code 005A */
-  {   5,   2, FontCalibri18_AA2_005B }, /* code 005B */
-  {   6,   2, FontCalibri18_AA2_005C }, /* code 005C */
-  {   5,   2, FontCalibri18_AA2_005D }, /* code 005D */
-  {   7,   2, FontCalibri18_AA2_005E }, /* code 005E */
-  {   7,   2, FontCalibri18_AA2_005F }, /* code 005F */
-  {   4,   1, FontCalibri18_AA2_0060 }, /* code 0060 */
-  {   7,   2, FontCalibri18_AA2_0061 }, /* code 0061 */
-  {   8,   2, FontCalibri18_AA2_0062 }, /* code 0062 */
-  {   6,   2, FontCalibri18_AA2_0063 }, /* code 0063 */
-  {   8,   2, FontCalibri18_AA2_0064 }, /* code 0064 */
-  {   8,   2, FontCalibri18_AA2_0065 }, /* code 0065 */
-  {   5,   2, FontCalibri18_AA2_0066 }, /* code 0066 */
-  {   7,   2, FontCalibri18_AA2_0067 }, /* code 0067 */
-  {   8,   2, FontCalibri18_AA2_0068 }, /* code 0068 */
-  {   4,   1, FontCalibri18_AA2_0069 }, /* code 0069 */
-  {   4,   1, FontCalibri18_AA2_006A }, /* code 006A */
-  {   7,   2, FontCalibri18_AA2_006B }, /* code 006B */
-  {   4,   1, FontCalibri18_AA2_006C }, /* code 006C */
-  {  12,   3, FontCalibri18_AA2_006D }, /* code 006D */
-  {   8,   2, FontCalibri18_AA2_006E }, /* code 006E */
-  {   8,   2, FontCalibri18_AA2_006F }, /* code 006F */
-  {   8,   2, FontCalibri18_AA2_0070 }, /* code 0070 */
-  {   8,   2, FontCalibri18_AA2_0071 }, /* code 0071 */
-  {   5,   2, FontCalibri18_AA2_0072 }, /* code 0072 */
-  {   6,   2, FontCalibri18_AA2_0073 }, /* code 0073 */
-  {   5,   2, FontCalibri18_AA2_0074 }, /* code 0074 */
-  {   8,   2, FontCalibri18_AA2_0075 }, /* code 0075 */
-  {   7,   2, FontCalibri18_AA2_0076 }, /* code 0076 */
-  {  11,   3, FontCalibri18_AA2_0077 }, /* code 0077 */
-  {   7,   2, FontCalibri18_AA2_0078 }, /* code 0078 */
-  {   7,   2, FontCalibri18_AA2_0079 }, /* code 0079 */
-  {   6,   2, FontCalibri18_AA2_007A }, /* code 007A */
-  {   5,   2, FontCalibri18_AA2_007B }, /* code 007B */
-  {   7,   2, FontCalibri18_AA2_007C }, /* code 007C */
-  {   5,   2, FontCalibri18_AA2_007D }, /* code 007D */
-  {   7,   2, FontCalibri18_AA2_007E }  /* code 007E */
+  {   3,   1,   0,  18, FontCalibri18_AA2_0020 }, /* code 0020 */
+  {   5,   2,   0,  18, FontCalibri18_AA2_0021 }, /* code 0021 */
+  {   6,   2,   0,  18, FontCalibri18_AA2_0022 }, /* code 0022 */
+  {   7,   2,   0,  18, FontCalibri18_AA2_0023 }, /* code 0023 */
+  {   7,   2,   0,  18, FontCalibri18_AA2_0024 }, /* code 0024 */
+  {  11,   3,   0,  18, FontCalibri18_AA2_0025 }, /* code 0025 */
+  {  10,   3,   0,  18, FontCalibri18_AA2_0026 }, /* code 0026 */
+  {   3,   1,   0,  18, FontCalibri18_AA2_0027 }, /* code 0027 */
+  {   5,   2,   0,  18, FontCalibri18_AA2_0028 }, /* code 0028 */
+  {   5,   2,   0,  18, FontCalibri18_AA2_0029 }, /* code 0029 */
+  {   7,   2,   0,  18, FontCalibri18_AA2_002A }, /* code 002A */
+  {   7,   2,   0,  18, FontCalibri18_AA2_002B }, /* code 002B */
+  {   4,   1,   0,  18, FontCalibri18_AA2_002C }, /* code 002C */
+  {   5,   2,   0,  18, FontCalibri18_AA2_002D }, /* code 002D */
+  {   4,   1,   0,  18, FontCalibri18_AA2_002E }, /* code 002E */
+  {   6,   2,   0,  18, FontCalibri18_AA2_002F }, /* code 002F */
+  {   7,   2,   0,  18, FontCalibri18_AA2_0030 }, /* code 0030 */
+  {   7,   2,   0,  18, FontCalibri18_AA2_0031 }, /* code 0031 */
+  {   7,   2,   0,  18, FontCalibri18_AA2_0032 }, /* code 0032 */
+  {   7,   2,   0,  18, FontCalibri18_AA2_0033 }, /* code 0033 */
+  {   7,   2,   0,  18, FontCalibri18_AA2_0034 }, /* code 0034 */
+  {   7,   2,   0,  18, FontCalibri18_AA2_0035 }, /* code 0035 */
+  {   7,   2,   0,  18, FontCalibri18_AA2_0036 }, /* code 0036 */
+  {   7,   2,   0,  18, FontCalibri18_AA2_0037 }, /* code 0037 */
+  {   7,   2,   0,  18, FontCalibri18_AA2_0038 }, /* code 0038 */
+  {   7,   2,   0,  18, FontCalibri18_AA2_0039 }, /* code 0039 */
+  {   4,   1,   0,  18, FontCalibri18_AA2_003A }, /* code 003A */
+  {   4,   1,   0,  18, FontCalibri18_AA2_003B }, /* code 003B */
+  {   7,   2,   0,  18, FontCalibri18_AA2_003C }, /* code 003C */
+  {   7,   2,   0,  18, FontCalibri18_AA2_003D }, /* code 003D */
+  {   7,   2,   0,  18, FontCalibri18_AA2_003E }, /* code 003E */
+  {   7,   2,   0,  18, FontCalibri18_AA2_003F }, /* code 003F */
+  {  13,   4,   0,  18, FontCalibri18_AA2_0040 }, /* code 0040 */
+  {   9,   3,   0,  18, FontCalibri18_AA2_0041 }, /* code 0041 */
+  {   8,   2,   0,  18, FontCalibri18_AA2_0042 }, /* code 0042 */
+  {   8,   2,   0,  18, FontCalibri18_AA2_0043 }, /* code 0043 */
+  {   9,   3,   0,  18, FontCalibri18_AA2_0044 }, /* code 0044 */
+  {   7,   2,   0,  18, FontCalibri18_AA2_0045 }, /* code 0045 */
+  {   7,   2,   0,  18, FontCalibri18_AA2_0046 }, /* code 0046 */
+  {   9,   3,   0,  18, FontCalibri18_AA2_0047 }, /* code 0047 */
+  {   9,   3,   0,  18, FontCalibri18_AA2_0048 }, /* code 0048 */
+  {   4,   1,   0,  18, FontCalibri18_AA2_0049 }, /* code 0049 */
+  {   5,   2,   0,  18, FontCalibri18_AA2_004A }, /* code 004A */
+  {   8,   2,   0,  18, FontCalibri18_AA2_004B }, /* code 004B */
+  {   6,   2,   0,  18, FontCalibri18_AA2_004C }, /* code 004C */
+  {  12,   3,   0,  18, FontCalibri18_AA2_004D }, /* code 004D */
+  {  10,   3,   0,  18, FontCalibri18_AA2_004E }, /* code 004E */
+  {  10,   3,   0,  18, FontCalibri18_AA2_004F }, /* code 004F */
+  {   8,   2,   0,  18, FontCalibri18_AA2_0050 }, /* code 0050 */
+  {  10,   3,   0,  18, FontCalibri18_AA2_0051 }, /* code 0051 */
+  {   8,   2,   0,  18, FontCalibri18_AA2_0052 }, /* code 0052 */
+  {   7,   2,   0,  18, FontCalibri18_AA2_0053 }, /* code 0053 */
+  {   7,   2,   0,  18, FontCalibri18_AA2_0054 }, /* code 0054 */
+  {   9,   3,   0,  18, FontCalibri18_AA2_0055 }, /* code 0055 */
+  {   9,   3,   0,  18, FontCalibri18_AA2_0056 }, /* code 0056 */
+  {  13,   4,   0,  18, FontCalibri18_AA2_0057 }, /* code 0057 */
+  {   8,   2,   0,  18, FontCalibri18_AA2_0058 }, /* code 0058 */
+  {   7,   2,   0,  18, FontCalibri18_AA2_0059 }, /* code 0059 */
+  {   7,   2,   0,  18, FontCalibri18_AA2_005A }, /* code 005A */
+  {   5,   2,   0,  18, FontCalibri18_AA2_005B }, /* code 005B */
+  {   6,   2,   0,  18, FontCalibri18_AA2_005C }, /* code 005C */
+  {   5,   2,   0,  18, FontCalibri18_AA2_005D }, /* code 005D */
+  {   7,   2,   0,  18, FontCalibri18_AA2_005E }, /* code 005E */
+  {   7,   2,   0,  18, FontCalibri18_AA2_005F }, /* code 005F */
+  {   4,   1,   0,  18, FontCalibri18_AA2_0060 }, /* code 0060 */
+  {   7,   2,   0,  18, FontCalibri18_AA2_0061 }, /* code 0061 */
+  {   8,   2,   0,  18, FontCalibri18_AA2_0062 }, /* code 0062 */
+  {   6,   2,   0,  18, FontCalibri18_AA2_0063 }, /* code 0063 */
+  {   8,   2,   0,  18, FontCalibri18_AA2_0064 }, /* code 0064 */
+  {   8,   2,   0,  18, FontCalibri18_AA2_0065 }, /* code 0065 */
+  {   5,   2,   0,  18, FontCalibri18_AA2_0066 }, /* code 0066 */
+  {   7,   2,   0,  18, FontCalibri18_AA2_0067 }, /* code 0067 */
+  {   8,   2,   0,  18, FontCalibri18_AA2_0068 }, /* code 0068 */
+  {   4,   1,   0,  18, FontCalibri18_AA2_0069 }, /* code 0069 */
+  {   4,   1,   0,  18, FontCalibri18_AA2_006A }, /* code 006A */
+  {   7,   2,   0,  18, FontCalibri18_AA2_006B }, /* code 006B */
+  {   4,   1,   0,  18, FontCalibri18_AA2_006C }, /* code 006C */
+  {  12,   3,   0,  18, FontCalibri18_AA2_006D }, /* code 006D */
+  {   8,   2,   0,  18, FontCalibri18_AA2_006E }, /* code 006E */
+  {   8,   2,   0,  18, FontCalibri18_AA2_006F }, /* code 006F */
+  {   8,   2,   0,  18, FontCalibri18_AA2_0070 }, /* code 0070 */
+  {   8,   2,   0,  18, FontCalibri18_AA2_0071 }, /* code 0071 */
+  {   5,   2,   0,  18, FontCalibri18_AA2_0072 }, /* code 0072 */
+  {   6,   2,   0,  18, FontCalibri18_AA2_0073 }, /* code 0073 */
+  {   5,   2,   0,  18, FontCalibri18_AA2_0074 }, /* code 0074 */
+  {   8,   2,   0,  18, FontCalibri18_AA2_0075 }, /* code 0075 */
+  {   7,   2,   0,  18, FontCalibri18_AA2_0076 }, /* code 0076 */
+  {  11,   3,   0,  18, FontCalibri18_AA2_0077 }, /* code 0077 */
+  {   7,   2,   0,  18, FontCalibri18_AA2_0078 }, /* code 0078 */
+  {   7,   2,   0,  18, FontCalibri18_AA2_0079 }, /* code 0079 */
+  {   6,   2,   0,  18, FontCalibri18_AA2_007A }, /* code 007A */
+  {   5,   2,   0,  18, FontCalibri18_AA2_007B }, /* code 007B */
+  {   7,   2,   0,  18, FontCalibri18_AA2_007C }, /* code 007C */
+  {   5,   2,   0,  18, FontCalibri18_AA2_007D }, /* code 007D */
+  {   7,   2,   0,  18, FontCalibri18_AA2_007E }  /* code 007E */
 };
 
 aafontsFont_t FontCalibri18_AA2 = 
@@ -2140,5 +2140,8 @@ aafontsFont_t FontCalibri18_AA2 =
   14,                                   /* Font baseline */
   0x0020,                               /* Unicode address of first character */
   0x007E,                               /* Unicode address of last character */
-  &charTable_Calibri18_AA2[0]           /* Font char data */
+  &charTable_Calibri18_AA2[0],                  /* Font char data */
+  NULL,                                         /* Sparse character ranges */
+  0,                                            /* Number of character ranges */
+  AAFONTS_ENCODING_RAW                          /* Glyph data encoding */
 };
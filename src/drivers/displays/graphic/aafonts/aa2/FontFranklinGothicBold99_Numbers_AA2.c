@@ -1160,17 +1160,17 @@ const uint8_t FontFranklinGothicBold99_Numbers_AA2_003A[495] = { /* code 003A, C
 
 const aafontsCharInfo_t charTable_FranklinGothicBold99_Numbers_AA2[11] = 
 {
-  {  47,  12, FontFranklinGothicBold99_Numbers_AA2_0030 }, /* code 0030 */
-  {  47,  12, FontFranklinGothicBold99_Numbers_AA2_0031 }, /* code 0031 */
-  {  47,  12, FontFranklinGothicBold99_Numbers_AA2_0032 }, /* code 0032 */
-  {  47,  12, FontFranklinGothicBold99_Numbers_AA2_0033 }, /* code 0033 */
-  {  47,  12, FontFranklinGothicBold99_Numbers_AA2_0034 }, /* code 0034 */
-  {  47,  12, FontFranklinGothicBold99_Numbers_AA2_0035 }, /* code 0035 */
-  {  47,  12, FontFranklinGothicBold99_Numbers_AA2_0036 }, /* code 0036 */
-  {  47,  12, FontFranklinGothicBold99_Numbers_AA2_0037 }, /* code 0037 */
-  {  47,  12, FontFranklinGothicBold99_Numbers_AA2_0038 }, /* code 0038 */
-  {  47,  12, FontFranklinGothicBold99_Numbers_AA2_0039 }, /* code 0039 */
-  {  20,   5, FontFranklinGothicBold99_Numbers_AA2_003A }  /* code 003A */
+  {  47,  12,   0,  99, FontFranklinGothicBold99_Numbers_AA2_0030 }, /* code 0030 */
+  {  47,  12,   0,  99, FontFranklinGothicBold99_Numbers_AA2_0031 }, /* code 0031 */
+  {  47,  12,   0,  99, FontFranklinGothicBold99_Numbers_AA2_0032 }, /* code 0032 */
+  {  47,  12,   0,  99, FontFranklinGothicBold99_Numbers_AA2_0033 }, /* code 0033 */
+  {  47,  12,   0,  99, FontFranklinGothicBold99_Numbers_AA2_0034 }, /* code 0034 */
+  {  47,  12,   0,  99, FontFranklinGothicBold99_Numbers_AA2_0035 }, /* code 0035 */
+  {  47,  12,   0,  99, FontFranklinGothicBold99_Numbers_AA2_0036 }, /* code 0036 */
+  {  47,  12,   0,  99, FontFranklinGothicBold99_Numbers_AA2_0037 }, /* code 0037 */
+  {  47,  12,   0,  99, FontFranklinGothicBold99_Numbers_AA2_0038 }, /* code 0038 */
+  {  47,  12,   0,  99, FontFranklinGothicBold99_Numbers_AA2_0039 }, /* code 0039 */
+  {  20,   5,   0,  99, FontFranklinGothicBold99_Numbers_AA2_003A }  /* code 003A */
 };
 
 aafontsFont_t FontFranklinGothicBold99_Numbers_AA2 = 
@@ -1183,5 +1183,8 @@ aafontsFont_t FontFranklinGothicBold99_Numbers_AA2 =
   76,                                   /* Font baseline */
   0x0030,                               /* Unicode address of first character */
   0x003A,                               /* Unicode address of last character */
-  &charTable_FranklinGothicBold99_Numbers_AA2[0]	/* Font char data */
+  &charTable_FranklinGothicBold99_Numbers_AA2[0], /* Font char data */
+  NULL,                                         /* Sparse character ranges */
+  0,                                            /* Number of character ranges */
+  AAFONTS_ENCODING_RAW                          /* Glyph data encoding */
 };
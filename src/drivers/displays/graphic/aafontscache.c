@@ -0,0 +1,472 @@
+/**************************************************************************/
+/*!
+    @file     aafontscache.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <string.h>
+
+#include "aafontscache.h"
+#include "lcd.h"
+
+/* A cached glyph.  The pixel data is a run list in RGB565, one entry per
+   row: the number of runs, then for each run its x offset, its length
+   and the colors of its pixels.  Only non-zero (inked) pixels are
+   stored, so replaying a glyph touches exactly the same pixels as
+   aafontsDrawString and the background still shows through. */
+typedef struct
+{
+  const aafontsFont_t *font;    // NULL if the slot is free
+  uint16_t            c;        // Character code
+  uint8_t             table;    // Color table slot
+  uint8_t             reserved;
+  uint16_t            offset;   // Start of the run list in the arena (words)
+  uint16_t            words;    // Size of the run list (words)
+  uint32_t            lastUsed;
+} aafontsCacheGlyph_t;
+
+typedef struct
+{
+  uint16_t            colors[16];
+  uint8_t             size;     // 0 if the slot is free
+  uint8_t             reserved[3];
+  uint32_t            lastUsed;
+} aafontsCacheTable_t;
+
+static aafontsCacheGlyph_t  *_aafontsCacheGlyphs = NULL;
+static aafontsCacheTable_t  *_aafontsCacheTables = NULL;
+static uint16_t             *_aafontsCacheArena = NULL;
+static uint16_t             _aafontsCacheArenaWords = 0;
+static uint16_t             _aafontsCacheArenaUsed = 0;
+static uint32_t             _aafontsCacheClock = 0;
+static aafontsCacheStats_t  _aafontsCacheStats;
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Private Methods ------------------------------ */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Removes a glyph and closes the gap it leaves in the arena
+*/
+/**************************************************************************/
+static void aafontsCacheEvict(aafontsCacheGlyph_t *glyph)
+{
+  uint16_t end = glyph->offset + glyph->words;
+  uint8_t i;
+
+  memmove(&_aafontsCacheArena[glyph->offset], &_aafontsCacheArena[end],
+          (_aafontsCacheArenaUsed - end) * sizeof(uint16_t));
+  _aafontsCacheArenaUsed -= glyph->words;
+
+  for (i = 0; i < AAFONTS_CACHE_MAXGLYPHS; i++)
+  {
+    if ((_aafontsCacheGlyphs[i].font != NULL) && (_aafontsCacheGlyphs[i].offset > glyph->offset))
+    {
+      _aafontsCacheGlyphs[i].offset -= glyph->words;
+    }
+  }
+
+  glyph->font = NULL;
+  _aafontsCacheStats.evictions++;
+  _aafontsCacheStats.glyphs--;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the least recently used glyph, or NULL if empty
+*/
+/**************************************************************************/
+static aafontsCacheGlyph_t *aafontsCacheOldest(void)
+{
+  aafontsCacheGlyph_t *oldest = NULL;
+  uint8_t i;
+
+  for (i = 0; i < AAFONTS_CACHE_MAXGLYPHS; i++)
+  {
+    if ((_aafontsCacheGlyphs[i].font != NULL) &&
+        ((oldest == NULL) || (_aafontsCacheGlyphs[i].lastUsed < oldest->lastUsed)))
+    {
+      oldest = &_aafontsCacheGlyphs[i];
+    }
+  }
+
+  return oldest;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Decodes a glyph into a new cache entry, evicting the least
+            recently used glyphs until it fits
+
+    @return The new entry, or NULL if the glyph can't be cached
+*/
+/**************************************************************************/
+static aafontsCacheGlyph_t *aafontsCacheInsert(const aafontsFont_t *font, uint16_t c, int8_t table)
+{
+  const aafontsCharInfo_t *charInfo = aafontsGetCharInfo(font, c);
+  const uint16_t *colors = _aafontsCacheTables[table].colors;
+  aafontsCacheGlyph_t *glyph = NULL;
+  aafontsGlyphReader_t reader;
+  uint32_t words;
+  uint16_t *p, *runs, *len;
+  uint16_t w, h;
+  uint8_t i, v, last;
+  bool stored;
+
+  /* First pass: size of the run list */
+  words = font->fontHeight;
+  aafontsGlyphReaderInit(&reader, font, charInfo);
+  for (h = 0; h < font->fontHeight; h++)
+  {
+    /* Rows outside charData are blank */
+    stored = (h >= charInfo->yOffset) && (h < charInfo->yOffset + charInfo->height);
+    last = 0;
+    for (w = 0; w < charInfo->width; w++)
+    {
+      v = stored ? aafontsGlyphReaderNext(&reader) : 0;
+      if (v)
+      {
+        words += last ? 1 : 3;
+      }
+      last = v;
+    }
+  }
+
+  if (words > _aafontsCacheArenaWords)
+  {
+    return NULL;
+  }
+
+  /* Make room: a free slot and enough space at the end of the arena */
+  for (i = 0; i < AAFONTS_CACHE_MAXGLYPHS; i++)
+  {
+    if (_aafontsCacheGlyphs[i].font == NULL)
+    {
+      glyph = &_aafontsCacheGlyphs[i];
+      break;
+    }
+  }
+  if (glyph == NULL)
+  {
+    glyph = aafontsCacheOldest();
+    aafontsCacheEvict(glyph);
+  }
+  while ((uint32_t)(_aafontsCacheArenaWords - _aafontsCacheArenaUsed) < words)
+  {
+    aafontsCacheEvict(aafontsCacheOldest());
+  }
+
+  glyph->font = font;
+  glyph->c = c;
+  glyph->table = table;
+  glyph->offset = _aafontsCacheArenaUsed;
+  glyph->words = words;
+  _aafontsCacheArenaUsed += words;
+  _aafontsCacheStats.glyphs++;
+
+  /* Second pass: write the run list */
+  p = &_aafontsCacheArena[glyph->offset];
+  aafontsGlyphReaderInit(&reader, NULL, charInfo);
+  for (h = 0; h < font->fontHeight; h++)
+  {
+    stored = (h >= charInfo->yOffset) && (h < charInfo->yOffset + charInfo->height);
+    runs = p++;
+    *runs = 0;
+    len = NULL;
+    for (w = 0; w < charInfo->width; w++)
+    {
+      v = stored ? aafontsGlyphReaderNext(&reader) : 0;
+      if (v == 0)
+      {
+        len = NULL;
+        continue;
+      }
+      if (len == NULL)
+      {
+        (*runs)++;
+        *p++ = w;
+        len = p++;
+        *len = 0;
+      }
+      *p++ = colors[v];
+      (*len)++;
+    }
+  }
+
+  return glyph;
+}
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Public Methods ------------------------------- */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Enables the anti-aliased glyph cache
+
+    Once enabled, aafontsDrawString keeps recently drawn glyphs as
+    pre-expanded RGB565 run lists, keyed by font, character and color
+    table, and replays them with one lcdDrawPixels burst per run instead
+    of decoding the glyph and writing it pixel by pixel.  Glyphs are
+    evicted least recently used first.
+
+    @param[in]  buffer
+                RAM for the cache (4-byte aligned), or NULL to disable
+                the cache
+    @param[in]  size
+                Size of the buffer in bytes.  16 * AAFONTS_CACHE_MAXGLYPHS
+                + 40 * AAFONTS_CACHE_MAXTABLES bytes go to bookkeeping,
+                the rest holds pixel data.
+
+    @return     ERROR_INVALIDPARAMETER if the buffer is too small
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/graphic/aafontscache.h"
+
+    static uint32_t glyphCache[2048 / 4];
+    aafontsCacheStats_t stats;
+
+    aafontsCacheInit(glyphCache, sizeof(glyphCache));
+
+    // ... draw text with aafontsDrawString as usual ...
+
+    aafontsCacheGetStats(&stats);
+    printf("%u hits, %u misses%s", stats.hits, stats.misses, CFG_PRINTF_NEWLINE);
+
+    @endcode
+*/
+/**************************************************************************/
+error_t aafontsCacheInit(void *buffer, uint32_t size)
+{
+  uint32_t overhead = sizeof(aafontsCacheGlyph_t) * AAFONTS_CACHE_MAXGLYPHS +
+                      sizeof(aafontsCacheTable_t) * AAFONTS_CACHE_MAXTABLES;
+
+  _aafontsCacheGlyphs = NULL;
+  _aafontsCacheTables = NULL;
+  _aafontsCacheArena = NULL;
+  _aafontsCacheArenaWords = 0;
+
+  if (buffer == NULL)
+  {
+    return ERROR_NONE;
+  }
+  if (size <= overhead)
+  {
+    return ERROR_INVALIDPARAMETER;
+  }
+
+  _aafontsCacheGlyphs = (aafontsCacheGlyph_t *)buffer;
+  _aafontsCacheTables = (aafontsCacheTable_t *)(_aafontsCacheGlyphs + AAFONTS_CACHE_MAXGLYPHS);
+  _aafontsCacheArena = (uint16_t *)(_aafontsCacheTables + AAFONTS_CACHE_MAXTABLES);
+  size = (size - overhead) / sizeof(uint16_t);
+  _aafontsCacheArenaWords = size > 0x7FFF ? 0x7FFF : size;
+
+  aafontsCacheFlush();
+  aafontsCacheResetStats();
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Drops every cached glyph and color table
+
+    Call this if font data in RAM is modified.
+*/
+/**************************************************************************/
+void aafontsCacheFlush(void)
+{
+  if (_aafontsCacheArena == NULL)
+  {
+    return;
+  }
+
+  memset(_aafontsCacheGlyphs, 0, sizeof(aafontsCacheGlyph_t) * AAFONTS_CACHE_MAXGLYPHS);
+  memset(_aafontsCacheTables, 0, sizeof(aafontsCacheTable_t) * AAFONTS_CACHE_MAXTABLES);
+  _aafontsCacheArenaUsed = 0;
+  _aafontsCacheStats.glyphs = 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the cache counters and current memory use
+*/
+/**************************************************************************/
+void aafontsCacheGetStats(aafontsCacheStats_t *stats)
+{
+  *stats = _aafontsCacheStats;
+  stats->bytesUsed = _aafontsCacheArenaUsed * sizeof(uint16_t);
+  stats->bytesFree = (_aafontsCacheArenaWords - _aafontsCacheArenaUsed) * sizeof(uint16_t);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Clears the hit, miss and eviction counters
+*/
+/**************************************************************************/
+void aafontsCacheResetStats(void)
+{
+  _aafontsCacheStats.hits = 0;
+  _aafontsCacheStats.misses = 0;
+  _aafontsCacheStats.evictions = 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Finds or allocates the cache slot for a color table
+
+    Tables are compared by content, since they are often calculated
+    into a buffer on the stack.  When every slot is taken, the least
+    recently used table is dropped along with its glyphs.
+
+    @return The slot index, or -1 if the cache is disabled
+*/
+/**************************************************************************/
+int8_t aafontsCacheSelectTable(const uint16_t *colorTable, uint8_t tableSize)
+{
+  aafontsCacheTable_t *slot = NULL;
+  uint8_t i;
+
+  if ((_aafontsCacheArena == NULL) || (tableSize > 16))
+  {
+    return -1;
+  }
+
+  _aafontsCacheClock++;
+  for (i = 0; i < AAFONTS_CACHE_MAXTABLES; i++)
+  {
+    if ((_aafontsCacheTables[i].size == tableSize) &&
+        (memcmp(_aafontsCacheTables[i].colors, colorTable, tableSize * sizeof(uint16_t)) == 0))
+    {
+      _aafontsCacheTables[i].lastUsed = _aafontsCacheClock;
+      return i;
+    }
+    if ((slot == NULL) || (_aafontsCacheTables[i].size == 0) ||
+        ((slot->size != 0) && (_aafontsCacheTables[i].lastUsed < slot->lastUsed)))
+    {
+      slot = &_aafontsCacheTables[i];
+    }
+  }
+
+  /* Reuse the free or least recently used slot */
+  for (i = 0; i < AAFONTS_CACHE_MAXGLYPHS; i++)
+  {
+    if ((_aafontsCacheGlyphs[i].font != NULL) && (_aafontsCacheGlyphs[i].table == slot - _aafontsCacheTables))
+    {
+      aafontsCacheEvict(&_aafontsCacheGlyphs[i]);
+    }
+  }
+  memcpy(slot->colors, colorTable, tableSize * sizeof(uint16_t));
+  slot->size = tableSize;
+  slot->lastUsed = _aafontsCacheClock;
+
+  return slot - _aafontsCacheTables;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws a character from the cache, caching it first if needed
+
+    @param[in]  x
+                Top-left x position
+    @param[in]  y
+                Top-left y position
+    @param[in]  font
+                The font
+    @param[in]  c
+                Character code (must be within the font)
+    @param[in]  table
+                Color table slot from aafontsCacheSelectTable
+
+    @return false if the glyph couldn't be cached (the cache is disabled
+            or the glyph is larger than the cache), in which case
+            nothing was drawn
+*/
+/**************************************************************************/
+bool aafontsCacheDrawChar(uint16_t x, uint16_t y, const aafontsFont_t *font, uint16_t c, int8_t table)
+{
+  aafontsCacheGlyph_t *glyph = NULL;
+  uint16_t *p;
+  uint16_t h, runs, len;
+  uint8_t i;
+
+  if (table < 0)
+  {
+    return false;
+  }
+
+  for (i = 0; i < AAFONTS_CACHE_MAXGLYPHS; i++)
+  {
+    if ((_aafontsCacheGlyphs[i].font == font) && (_aafontsCacheGlyphs[i].c == c) && (_aafontsCacheGlyphs[i].table == table))
+    {
+      glyph = &_aafontsCacheGlyphs[i];
+      break;
+    }
+  }
+
+  if (glyph != NULL)
+  {
+    _aafontsCacheStats.hits++;
+  }
+  else
+  {
+    _aafontsCacheStats.misses++;
+    glyph = aafontsCacheInsert(font, c, table);
+    if (glyph == NULL)
+    {
+      return false;
+    }
+  }
+  glyph->lastUsed = ++_aafontsCacheClock;
+
+  /* Replay the run list, one burst per run */
+  p = &_aafontsCacheArena[glyph->offset];
+  for (h = 0; h < font->fontHeight; h++)
+  {
+    for (runs = *p++; runs; runs--)
+    {
+      len = p[1];
+      lcdDrawPixels(x + p[0], y + h, p + 2, len);
+      p += 2 + len;
+    }
+  }
+
+  return true;
+}
@@ -0,0 +1,85 @@
+/**************************************************************************/
+/*!
+    @file     aafontscache.h
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#ifndef __AAFONTSCACHE_H__
+#define __AAFONTSCACHE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "bspconfig.h"
+#include "aafonts.h"
+
+/*=========================================================================
+    AA FONT CACHE SETTINGS
+    -----------------------------------------------------------------------
+    AAFONTS_CACHE_MAXGLYPHS   Maximum number of glyphs kept in the cache.
+                              Each slot takes 16 bytes of the buffer
+                              passed to aafontsCacheInit.
+    AAFONTS_CACHE_MAXTABLES   Number of different color tables that can
+                              be cached at once.  Each takes 40 bytes of
+                              the buffer.  Glyphs are cached per color
+                              table, so this is the number of text
+                              styles that can stay warm at the same time.
+    -----------------------------------------------------------------------*/
+    #define AAFONTS_CACHE_MAXGLYPHS     (32)
+    #define AAFONTS_CACHE_MAXTABLES     (4)
+/*=========================================================================*/
+
+typedef struct
+{
+  uint32_t hits;                // Glyphs replayed from the cache
+  uint32_t misses;              // Glyphs decoded (and cached if they fit)
+  uint32_t evictions;           // Glyphs dropped to make room
+  uint16_t glyphs;              // Glyphs currently cached
+  uint16_t bytesUsed;           // Pixel data bytes currently in use
+  uint16_t bytesFree;           // Pixel data bytes still available
+} aafontsCacheStats_t;
+
+error_t   aafontsCacheInit        ( void *buffer, uint32_t size );
+void      aafontsCacheFlush       ( void );
+void      aafontsCacheGetStats    ( aafontsCacheStats_t *stats );
+void      aafontsCacheResetStats  ( void );
+
+/* Used by aafontsDrawString */
+int8_t    aafontsCacheSelectTable ( const uint16_t *colorTable, uint8_t tableSize );
+bool      aafontsCacheDrawChar    ( uint16_t x, uint16_t y, const aafontsFont_t *font, uint16_t c, int8_t table );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
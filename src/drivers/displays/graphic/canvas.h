@@ -0,0 +1,468 @@
+/**************************************************************************/
+/*!
+    @file     canvas.h
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#ifndef __CANVAS_H__
+#define __CANVAS_H__
+
+/*
+    Header-only C++ drawing front end.  Canvas<Driver, Format> is a
+    stateless class whose members are all static and inline, so each
+    primitive is expanded against the driver traits it's instantiated
+    with: pixel writes become direct driver calls, and when the driver
+    declares a compile-time panel size the clipping compares against
+    constants and folds away wherever the arguments are known.
+
+    This is an alternative to drawing.c for C++ code, not a layer under
+    it.  The library is built as C, so drawing.h keeps its own clipping
+    and fill implementations, which the rest of the code base uses, and
+    this header is only seen by C++ translation units.
+*/
+#ifdef __cplusplus
+
+#include <stdint.h>
+#include <string.h>
+
+#include "lcd.h"
+
+/*=========================================================================
+    CANVAS SETTINGS
+    -----------------------------------------------------------------------
+    CANVAS_CHUNKSIZE    Number of pixels buffered on the stack for each
+                        writePixels burst in fills and blits
+    -----------------------------------------------------------------------*/
+    #define CANVAS_CHUNKSIZE            (32)
+/*=========================================================================*/
+
+/**************************************************************************/
+/*!
+    @brief  Pixel format traits
+
+    A format supplies the stored pixel type and conversions from and to
+    RGB565, which is what the C API and the colors.h constants use.
+*/
+/**************************************************************************/
+struct Rgb565Format
+{
+  typedef uint16_t pixel_t;
+  static inline pixel_t  fromRgb565(uint16_t color) { return color; }
+  static inline uint16_t toRgb565(pixel_t pixel)     { return pixel; }
+};
+
+struct Gray8Format
+{
+  typedef uint8_t pixel_t;
+  static inline pixel_t fromRgb565(uint16_t color)
+  {
+    /* 0.30 R + 0.59 G + 0.11 B on the 8-bit expanded channels */
+    uint32_t r = ((color >> 11) * 527 + 23) >> 6;
+    uint32_t g = (((color >> 5) & 0x3F) * 259 + 33) >> 6;
+    uint32_t b = ((color & 0x1F) * 527 + 23) >> 6;
+    return (pixel_t)((r * 77 + g * 151 + b * 28) >> 8);
+  }
+  static inline uint16_t toRgb565(pixel_t pixel)
+  {
+    return ((pixel & 0xF8) << 8) | ((pixel & 0xFC) << 3) | (pixel >> 3);
+  }
+};
+
+/**************************************************************************/
+/*!
+    @brief  Driver traits for the panel behind lcd.h
+
+    Width and Height are 0, meaning the size is read from the driver at
+    run time (it follows lcdSetOrientation).  Use LcdDriverFixed when
+    the panel size and orientation are known at build time.
+*/
+/**************************************************************************/
+struct LcdDriver
+{
+  typedef Rgb565Format format_t;
+  enum { Width = 0, Height = 0 };
+
+  static inline uint16_t width(void)  { return lcdGetWidth(); }
+  static inline uint16_t height(void) { return lcdGetHeight(); }
+  static inline void setWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+  {
+    lcdSetWindow(x0, y0, x1, y1);
+  }
+  static inline void writePixels(const uint16_t *data, uint32_t len)
+  {
+    /* lcdWritePixels doesn't modify the data, it just isn't declared const */
+    lcdWritePixels(const_cast<uint16_t *>(data), len);
+  }
+  static inline void drawPixel(uint16_t x, uint16_t y, uint16_t color)
+  {
+    lcdDrawPixel(x, y, color);
+  }
+};
+
+template <uint16_t W, uint16_t H>
+struct LcdDriverFixed : LcdDriver
+{
+  enum { Width = W, Height = H };
+};
+
+/**************************************************************************/
+/*!
+    @brief  Driver traits for an in-memory W x H surface
+
+    Useful for off-screen composition and for running drawing code on a
+    host machine, where 'pixels' can be dumped to a file and compared.
+    The window semantics match lcdSetWindow/lcdWritePixels: pixels are
+    written left to right, top to bottom, and wrap within the window.
+*/
+/**************************************************************************/
+template <uint16_t W, uint16_t H, class Format = Rgb565Format>
+struct MemoryDriver
+{
+  typedef Format format_t;
+  typedef typename Format::pixel_t pixel_t;
+  enum { Width = W, Height = H };
+
+  static pixel_t  pixels[W * H];
+  static uint16_t winX0, winX1, curX, curY;
+
+  static inline uint16_t width(void)  { return W; }
+  static inline uint16_t height(void) { return H; }
+  static inline void setWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+  {
+    (void)y1;
+    winX0 = x0;
+    winX1 = x1;
+    curX = x0;
+    curY = y0;
+  }
+  static inline void writePixels(const pixel_t *data, uint32_t len)
+  {
+    while (len--)
+    {
+      pixels[curY * W + curX] = *data++;
+      if (curX++ == winX1)
+      {
+        curX = winX0;
+        curY++;
+      }
+    }
+  }
+  static inline void drawPixel(uint16_t x, uint16_t y, pixel_t color)
+  {
+    pixels[y * W + x] = color;
+  }
+};
+
+template <uint16_t W, uint16_t H, class Format>
+typename Format::pixel_t MemoryDriver<W, H, Format>::pixels[W * H];
+template <uint16_t W, uint16_t H, class Format>
+uint16_t MemoryDriver<W, H, Format>::winX0;
+template <uint16_t W, uint16_t H, class Format>
+uint16_t MemoryDriver<W, H, Format>::winX1;
+template <uint16_t W, uint16_t H, class Format>
+uint16_t MemoryDriver<W, H, Format>::curX;
+template <uint16_t W, uint16_t H, class Format>
+uint16_t MemoryDriver<W, H, Format>::curY;
+
+/**************************************************************************/
+/*!
+    @brief  Compile-time specialized drawing surface
+
+    Coordinates are signed so that shapes can run off any edge; every
+    primitive clips against the surface.  Colors are in the surface's
+    pixel format; use rgb() to convert a colors.h RGB565 constant.
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/graphic/canvas.h"
+    #include "drivers/displays/graphic/colors.h"
+
+    // 240x320 panel in portrait, size known at compile time
+    typedef Canvas< LcdDriverFixed<240, 320> > Screen;
+
+    Screen::fill(COLOR_BLACK);
+    Screen::fillRect(10, 10, 100, 40, COLOR_BLUE);
+    Screen::drawLine(0, 0, 239, 319, COLOR_WHITE);
+    Screen::drawCircle(120, 160, 50, COLOR_YELLOW);
+
+    // The same code against an off-screen grayscale buffer
+    typedef MemoryDriver<64, 64, Gray8Format> Offscreen;
+    typedef Canvas<Offscreen, Gray8Format> Scratch;
+
+    Scratch::fill(Scratch::rgb(COLOR_WHITE));
+
+    @endcode
+*/
+/**************************************************************************/
+template <class Driver, class Format = typename Driver::format_t>
+class Canvas
+{
+  public:
+    typedef typename Format::pixel_t pixel_t;
+
+    static inline uint16_t width(void)
+    {
+      return (Driver::Width != 0) ? (uint16_t)Driver::Width : Driver::width();
+    }
+
+    static inline uint16_t height(void)
+    {
+      return (Driver::Height != 0) ? (uint16_t)Driver::Height : Driver::height();
+    }
+
+    static inline pixel_t rgb(uint16_t color)
+    {
+      return Format::fromRgb565(color);
+    }
+
+    /* A single unsigned compare per axis rejects both negative and
+       too-large coordinates */
+    static inline bool contains(int16_t x, int16_t y)
+    {
+      return ((uint16_t)x < width()) && ((uint16_t)y < height());
+    }
+
+    static inline void drawPixel(int16_t x, int16_t y, pixel_t color)
+    {
+      if (contains(x, y))
+      {
+        Driver::drawPixel(x, y, color);
+      }
+    }
+
+    static void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, pixel_t color)
+    {
+      pixel_t  chunk[CANVAS_CHUNKSIZE];
+      uint32_t remaining;
+      uint16_t i;
+
+      if (!clip(x, y, w, h))
+      {
+        return;
+      }
+
+      for (i = 0; i < CANVAS_CHUNKSIZE; i++)
+      {
+        chunk[i] = color;
+      }
+
+      Driver::setWindow(x, y, x + w - 1, y + h - 1);
+      remaining = (uint32_t)w * h;
+      while (remaining)
+      {
+        uint16_t n = remaining > CANVAS_CHUNKSIZE ? CANVAS_CHUNKSIZE : remaining;
+        Driver::writePixels(chunk, n);
+        remaining -= n;
+      }
+    }
+
+    static inline void fill(pixel_t color)
+    {
+      fillRect(0, 0, width(), height(), color);
+    }
+
+    static inline void drawHLine(int16_t x, int16_t y, int16_t w, pixel_t color)
+    {
+      fillRect(x, y, w, 1, color);
+    }
+
+    static inline void drawVLine(int16_t x, int16_t y, int16_t h, pixel_t color)
+    {
+      fillRect(x, y, 1, h, color);
+    }
+
+    static void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, pixel_t color)
+    {
+      if ((w <= 0) || (h <= 0))
+      {
+        return;
+      }
+      drawHLine(x, y, w, color);
+      drawHLine(x, y + h - 1, w, color);
+      drawVLine(x, y + 1, h - 2, color);
+      drawVLine(x + w - 1, y + 1, h - 2, color);
+    }
+
+    static void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, pixel_t color)
+    {
+      int16_t dx, dy, sx, sy, err, e2;
+
+      /* Axis-aligned lines go out as a single window burst */
+      if (y0 == y1)
+      {
+        drawHLine(x0 < x1 ? x0 : x1, y0, (x0 < x1 ? x1 - x0 : x0 - x1) + 1, color);
+        return;
+      }
+      if (x0 == x1)
+      {
+        drawVLine(x0, y0 < y1 ? y0 : y1, (y0 < y1 ? y1 - y0 : y0 - y1) + 1, color);
+        return;
+      }
+
+      /* Bresenham */
+      dx = x1 > x0 ? x1 - x0 : x0 - x1;
+      dy = y1 > y0 ? y0 - y1 : y1 - y0;
+      sx = x0 < x1 ? 1 : -1;
+      sy = y0 < y1 ? 1 : -1;
+      err = dx + dy;
+      for (;;)
+      {
+        drawPixel(x0, y0, color);
+        if ((x0 == x1) && (y0 == y1))
+        {
+          break;
+        }
+        e2 = 2 * err;
+        if (e2 >= dy)
+        {
+          err += dy;
+          x0 += sx;
+        }
+        if (e2 <= dx)
+        {
+          err += dx;
+          y0 += sy;
+        }
+      }
+    }
+
+    static void drawCircle(int16_t xc, int16_t yc, int16_t r, pixel_t color)
+    {
+      int16_t x = r, y = 0, err = 1 - r;
+
+      while (x >= y)
+      {
+        drawPixel(xc + x, yc + y, color);
+        drawPixel(xc - x, yc + y, color);
+        drawPixel(xc + x, yc - y, color);
+        drawPixel(xc - x, yc - y, color);
+        drawPixel(xc + y, yc + x, color);
+        drawPixel(xc - y, yc + x, color);
+        drawPixel(xc + y, yc - x, color);
+        drawPixel(xc - y, yc - x, color);
+        y++;
+        if (err < 0)
+        {
+          err += 2 * y + 1;
+        }
+        else
+        {
+          x--;
+          err += 2 * (y - x) + 1;
+        }
+      }
+    }
+
+    static void fillCircle(int16_t xc, int16_t yc, int16_t r, pixel_t color)
+    {
+      int16_t x = r, y = 0, err = 1 - r;
+
+      while (x >= y)
+      {
+        drawHLine(xc - x, yc + y, 2 * x + 1, color);
+        drawHLine(xc - x, yc - y, 2 * x + 1, color);
+        drawHLine(xc - y, yc + x, 2 * y + 1, color);
+        drawHLine(xc - y, yc - x, 2 * y + 1, color);
+        y++;
+        if (err < 0)
+        {
+          err += 2 * y + 1;
+        }
+        else
+        {
+          x--;
+          err += 2 * (y - x) + 1;
+        }
+      }
+    }
+
+    /* Copies a w x h block of pixels (row-major, 'w' pixels per row) */
+    static void blit(int16_t x, int16_t y, int16_t w, int16_t h, const pixel_t *src)
+    {
+      int16_t cx = x, cy = y, cw = w, ch = h;
+      int16_t row;
+
+      if (!clip(cx, cy, cw, ch))
+      {
+        return;
+      }
+
+      src += (cy - y) * w + (cx - x);
+      Driver::setWindow(cx, cy, cx + cw - 1, cy + ch - 1);
+      if (cw == w)
+      {
+        /* Rows are contiguous, send the whole block in one go */
+        Driver::writePixels(src, (uint32_t)cw * ch);
+        return;
+      }
+      for (row = 0; row < ch; row++)
+      {
+        Driver::writePixels(src, cw);
+        src += w;
+      }
+    }
+
+  private:
+    /* Clips a rectangle to the surface, returns false if nothing is left */
+    static inline bool clip(int16_t &x, int16_t &y, int16_t &w, int16_t &h)
+    {
+      if (x < 0)
+      {
+        w += x;
+        x = 0;
+      }
+      if (y < 0)
+      {
+        h += y;
+        y = 0;
+      }
+      if ((w <= 0) || (h <= 0) || (x >= width()) || (y >= height()))
+      {
+        return false;
+      }
+      if (w > width() - x)
+      {
+        w = width() - x;
+      }
+      if (h > height() - y)
+      {
+        h = height() - y;
+      }
+      return true;
+    }
+};
+
+#endif
+
+#endif
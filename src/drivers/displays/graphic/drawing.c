@@ -40,6 +40,9 @@
 
 #include "drawing.h"
 
+/* Indexed framebuffer that drawing is redirected to (NULL for the LCD) */
+static fb_t *_drawFramebuffer = NULL;
+
 /**************************************************************************/
 /*                                                                        */
 /* ----------------------- Private Methods ------------------------------ */
@@ -59,51 +62,744 @@ void drawSwap(uint32_t a, uint32_t b)
   b = t;
 }
 
-#if defined CFG_BSP_TFTLCD_INCLUDESMALLFONTS & CFG_BSP_TFTLCD_INCLUDESMALLFONTS == 1
+/* Colors and panel details for the text renderer */
+typedef struct
+{
+  const uint16_t *colorTable;
+  uint16_t       width;
+  uint16_t       height;
+  bool           fastHLine;
+} drawTextContext_t;
+
+/**************************************************************************/
+/*!
+    @brief  Draws len pixels of one glyph level for fontrender.h
+*/
+/**************************************************************************/
+static inline void drawTextSpan(const drawTextContext_t *ctx, uint16_t x, uint16_t y, uint16_t len, uint8_t level)
+{
+  uint16_t color = ctx->colorTable[level];
+
+  // Glyphs left of the screen wrap around to large x values
+  if (x + len > 0xFFFF)
+  {
+    len = 0x10000 - x;
+  }
+
+  if (_drawFramebuffer)
+  {
+    fbDrawHLine(_drawFramebuffer, x, x + len - 1, y, (uint8_t)color);
+    return;
+  }
+
+  if ((x >= ctx->width) || (y >= ctx->height))
+  {
+    return;
+  }
+  if (x + len > ctx->width)
+  {
+    len = ctx->width - x;
+  }
+
+  if ((len > 1) && ctx->fastHLine)
+  {
+    lcdDrawHLine(x, x + len - 1, y, color);
+  }
+  else
+  {
+    while (len--)
+    {
+      lcdDrawPixel(x++, y, color);
+    }
+  }
+}
+
+#define FONTRENDER_NAME       drawTextRender
+#define FONTRENDER_CONTEXT    const drawTextContext_t *
+#define FONTRENDER_SPAN       drawTextSpan
+#include "drivers/displays/fontrender.h"
+
+/**************************************************************************/
+/*!
+    @brief  Sets up the text renderer for the current panel
+*/
+/**************************************************************************/
+static void drawTextInit(drawTextContext_t *ctx, const uint16_t *colorTable)
+{
+  lcdProperties_t properties = lcdGetProperties();
+
+  ctx->colorTable = colorTable;
+  ctx->width = lcdGetWidth();
+  ctx->height = lcdGetHeight();
+  ctx->fastHLine = properties.fastHLine;
+}
+
+/* Scaled text, glyphs are rendered at 0/0 and moved to x/y */
+typedef struct
+{
+  drawTextContext_t text;
+  uint16_t          x;          // Top-left corner of the character cell
+  uint16_t          y;
+  uint8_t           scale;
+} drawTextScaledContext_t;
+
+/**************************************************************************/
+/*!
+    @brief  Draws a run of glyph pixels as a scale x scale block per pixel
+*/
+/**************************************************************************/
+static inline void drawTextScaledSpan(const drawTextScaledContext_t *ctx, uint16_t x, uint16_t y, uint16_t len, uint8_t level)
+{
+  uint8_t i;
+
+  x = ctx->x + x * ctx->scale;
+  y = ctx->y + y * ctx->scale;
+  for (i = 0; i < ctx->scale; i++)
+  {
+    drawTextSpan(&ctx->text, x, y + i, len * ctx->scale, level);
+  }
+}
+
+#define FONTRENDER_NAME       drawTextScaledRender
+#define FONTRENDER_CONTEXT    const drawTextScaledContext_t *
+#define FONTRENDER_SPAN       drawTextScaledSpan
+#define FONTRENDER_GLYPHONLY
+#include "drivers/displays/fontrender.h"
+
+/**************************************************************************/
+/*!
+    @brief  Steps through source pixels for bilinear scaling
+
+    Destination pixel d samples the source at (d + 1/2) / scale - 1/2,
+    which lies between pixel 'index' and the next one, 'frac' / (2 *
+    scale) of the way across.
+*/
+/**************************************************************************/
+static inline void drawSmoothStart(int16_t *index, uint8_t *frac, uint8_t scale)
+{
+  *index = scale > 1 ? -1 : 0;
+  *frac = scale > 1 ? scale + 1 : 0;
+}
+
+static inline bool drawSmoothStep(int16_t *index, uint8_t *frac, uint8_t scale)
+{
+  *frac += 2;
+  if (*frac >= 2 * scale)
+  {
+    *frac -= 2 * scale;
+    (*index)++;
+    return true;
+  }
+  return false;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws an anti-aliased glyph scaled up with bilinear
+            interpolation, so that edges get intermediate levels rather
+            than steps
+
+    Two source rows are kept, padded with a blank pixel at each end, and
+    the glyph is read a row at a time so RLE glyphs work as well.  Edges
+    blend into the row above and below the stored rows, so for trimmed
+    glyphs one blank row is added on each side, within the 'height' of
+    the character cell.
+*/
+/**************************************************************************/
+static void drawGlyphSmooth(const drawTextScaledContext_t *ctx, fontGlyph_t *glyph, uint16_t height)
+{
+  uint8_t rows[2][DRAW_SMOOTH_MAXWIDTH + 2];
+  uint8_t *above = rows[0], *below = rows[1], *swap;
+  uint16_t dx, dy, x, y, start, weight, left, right;
+  uint8_t padTop = glyph->yOffset ? 1 : 0;
+  uint8_t padBottom = glyph->yOffset + glyph->rows < height ? 1 : 0;
+  uint16_t dw = glyph->width * ctx->scale, dh = (padTop + glyph->rows + padBottom) * ctx->scale;
+  uint16_t full = 4 * ctx->scale * ctx->scale;
+  int16_t row, col, loaded = -1;
+  uint16_t n;
+  uint8_t levels = (1 << glyph->bits) - 1;
+  uint8_t steep = ctx->scale > 2 ? ctx->scale / 2 : 1;
+  uint8_t fy, fx, level, last, count;
+  int32_t ramp;
+
+  memset(rows, 0, sizeof(rows));
+  x = ctx->x;
+  y = ctx->y + (glyph->yOffset - padTop) * ctx->scale;
+
+  drawSmoothStart(&row, &fy, ctx->scale);
+  for (dy = 0; dy < dh; dy++)
+  {
+    /* Slide the two row window down to rows 'row' and 'row + 1' */
+    while (loaded < row + 1)
+    {
+      swap = above;
+      above = below;
+      below = swap;
+      loaded++;
+      if ((loaded >= padTop) && (loaded < padTop + glyph->rows))
+      {
+        for (col = 0; col < glyph->width; col += count)
+        {
+          count = glyph->width - col < FONT_CHUNKSIZE ? glyph->width - col : FONT_CHUNKSIZE;
+          fontReadGlyph(glyph, &below[1 + col], count);
+        }
+      }
+      else
+      {
+        memset(below, 0, glyph->width + 2);
+      }
+    }
+
+    /* Interpolate across the row, sending runs of equal levels */
+    drawSmoothStart(&col, &fx, ctx->scale);
+    start = 0;
+    last = 0;
+    for (dx = 0; dx <= dw; dx++)
+    {
+      level = 0;
+      if (dx < dw)
+      {
+        left = above[1 + col] * (2 * ctx->scale - fx) + above[2 + col] * fx;
+        right = below[1 + col] * (2 * ctx->scale - fx) + below[2 + col] * fx;
+        weight = left * (2 * ctx->scale - fy) + right * fy;
+
+        /* Steepen the interpolated edge so it stays about two pixels wide */
+        ramp = ((int32_t)weight * 2 - full * levels) * steep + full * levels;
+        level = ramp <= 0 ? 0 : ramp >= 2 * full * levels ? levels : (ramp + full) / (2 * full);
+        drawSmoothStep(&col, &fx, ctx->scale);
+      }
+      if ((level != last) || (dx == dw))
+      {
+        n = dx - start;
+        if (last && n)
+        {
+          drawTextSpan(&ctx->text, x + start, y + dy, n, last);
+        }
+        start = dx;
+        last = level;
+      }
+    }
+
+    drawSmoothStep(&row, &fy, ctx->scale);
+  }
+}
+
+/* Bezier control points are handled in 1/16 pixel units */
+#define DRAW_BEZIER_FRAC          (4)
+/* Longest run of forward differencing steps (2^5 = 32 segments) before the
+   curve is split in half instead; keeps the scaled values inside int32_t */
+#define DRAW_BEZIER_MAXSTEPSLOG2  (5)
+/* Maximum subdivision depth */
+#define DRAW_BEZIER_MAXDEPTH      (4)
+
+typedef struct
+{
+  int16_t x;                // Current x (pixels)
+  int16_t y0;               // First scanline
+  int16_t y1;               // Scanline after the last one
+  int16_t dx;               // abs(x1 - x0)
+  int16_t dy;               // y1 - y0
+  int16_t sx;               // X step direction
+  int16_t acc;              // Bresenham accumulator
+} drawEdge_t;
+
+typedef struct
+{
+  bool       fill;          // Collect edges rather than drawing lines
+  uint16_t   color;
+  int16_t    lastX;         // Previous vertex (pixels)
+  int16_t    lastY;
+  int16_t    edgeStartX;    // Start of the last edge in the table
+  int16_t    edgeStartY;
+  uint16_t   numEdges;
+} drawPathSink_t;
+
+static drawEdge_t drawPathEdges[DRAW_PATH_MAXEDGES];
+
 /**************************************************************************/
 /*!
-    @brief  Draws a single smallfont character
+    @brief  Adds an edge to the edge table used by drawBezierPathFilled
+
+    Horizontal edges are dropped since they never cross a scanline
+    centre.  If the table is full the previous edge is stretched to the
+    new vertex instead, which keeps the outline closed at the cost of
+    some accuracy.
 */
 /**************************************************************************/
-void drawCharSmall(uint16_t x, uint16_t y, uint16_t color, uint8_t c, struct FONT_DEF font)
+static void drawPathAddEdge(drawPathSink_t *sink, int16_t x0, int16_t y0, int16_t x1, int16_t y1)
 {
-  uint8_t col, column[font.u8Width];
+  drawEdge_t *e;
+  int16_t t;
 
-  // Check if the requested character is available
-  if ((c >= font.u8FirstChar) && (c <= font.u8LastChar))
+  if ((y0 == y1) && (sink->numEdges < DRAW_PATH_MAXEDGES))
   {
-    // Retrieve appropriate columns from font data
-    for (col = 0; col < font.u8Width; col++)
+    return;
+  }
+
+  if (sink->numEdges >= DRAW_PATH_MAXEDGES)
+  {
+    // Replace the last edge with one from its start to the new vertex
+    sink->numEdges--;
+    x0 = sink->edgeStartX;
+    y0 = sink->edgeStartY;
+    if (y0 == y1)
     {
-      column[col] = font.au8FontTable[((c - 32) * font.u8Width) + col];    // Get first column of appropriate character
+      return;
     }
   }
   else
   {
-    // Requested character is not available in this font ... send a space instead
-    for (col = 0; col < font.u8Width; col++)
+    sink->edgeStartX = x0;
+    sink->edgeStartY = y0;
+  }
+
+  // Edges always run downwards
+  if (y0 > y1)
+  {
+    t = x0; x0 = x1; x1 = t;
+    t = y0; y0 = y1; y1 = t;
+  }
+
+  e = &drawPathEdges[sink->numEdges++];
+  e->x = x0;
+  e->y0 = y0;
+  e->y1 = y1;
+  e->dy = y1 - y0;
+  e->dx = x1 > x0 ? x1 - x0 : x0 - x1;
+  e->sx = x1 > x0 ? 1 : -1;
+  e->acc = e->dy >> 1;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Receives the next vertex of a flattened curve (1/16 pixels)
+*/
+/**************************************************************************/
+static void drawPathVertex(drawPathSink_t *sink, int32_t xq, int32_t yq)
+{
+  // Round to the nearest pixel
+  int16_t x = (xq + (1 << (DRAW_BEZIER_FRAC - 1))) >> DRAW_BEZIER_FRAC;
+  int16_t y = (yq + (1 << (DRAW_BEZIER_FRAC - 1))) >> DRAW_BEZIER_FRAC;
+
+  if ((x == sink->lastX) && (y == sink->lastY))
+  {
+    return;
+  }
+
+  if (sink->fill)
+  {
+    drawPathAddEdge(sink, sink->lastX, sink->lastY, x, y);
+  }
+  else if ((x >= 0) && (y >= 0) && (sink->lastX >= 0) && (sink->lastY >= 0))
+  {
+    drawLine(sink->lastX, sink->lastY, x, y, sink->color);
+  }
+
+  sink->lastX = x;
+  sink->lastY = y;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns log2 of the number of line segments needed to keep
+            a curve within half a pixel of its true position, based on
+            the largest second difference of the control points (Wang's
+            formula, using only shifts and compares)
+
+    @param[in]  m
+                Sum of the x and y second differences in 1/16 pixels
+    @param[in]  cubic
+                True for a cubic curve, false for a quadratic one
+*/
+/**************************************************************************/
+static uint8_t drawBezierStepsLog2(int32_t m, bool cubic)
+{
+  uint8_t k = 0;
+
+  // Cubic: N^2 >= 3/4 * M / tol, quadratic: N^2 >= 1/4 * M / tol,
+  // with tol = 8 (half a pixel in 1/16 pixel units)
+  if (cubic)
+    m *= 3;
+  while (((int32_t)1 << (2 * k + 5)) < m)
+  {
+    k++;
+  }
+
+  return k;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Flattens a quadratic curve (1/16 pixel control points)
+            using integer forward differencing, splitting it first if
+            it's too curved for a single run
+*/
+/**************************************************************************/
+static void drawBezierQuadFlatten(drawPathSink_t *sink, int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint8_t depth)
+{
+  int32_t ax, ay, bx, by, fx, fy, d1x, d1y, d2x, d2y;
+  int32_t mx01, my01, mx12, my12, mx, my;
+  uint8_t k, shift;
+  uint16_t i, n;
+
+  ax = x0 - 2 * x1 + x2;
+  ay = y0 - 2 * y1 + y2;
+  k = drawBezierStepsLog2((ax < 0 ? -ax : ax) + (ay < 0 ? -ay : ay), false);
+
+  if ((k > DRAW_BEZIER_MAXSTEPSLOG2) && (depth < DRAW_BEZIER_MAXDEPTH))
+  {
+    // Split at t = 0.5 (de Casteljau) and flatten each half separately
+    mx01 = (x0 + x1) >> 1;  my01 = (y0 + y1) >> 1;
+    mx12 = (x1 + x2) >> 1;  my12 = (y1 + y2) >> 1;
+    mx = (mx01 + mx12) >> 1; my = (my01 + my12) >> 1;
+    drawBezierQuadFlatten(sink, x0, y0, mx01, my01, mx, my, depth + 1);
+    drawBezierQuadFlatten(sink, mx, my, mx12, my12, x2, y2, depth + 1);
+    return;
+  }
+  if (k > DRAW_BEZIER_MAXSTEPSLOG2)
+  {
+    k = DRAW_BEZIER_MAXSTEPSLOG2;
+  }
+
+  // B(t) = a.t^2 + b.t + p0, evaluated at t = i/N with every term scaled
+  // by N^2 so that the differences stay exact integers
+  n = 1 << k;
+  shift = 2 * k;
+  bx = 2 * (x1 - x0);
+  by = 2 * (y1 - y0);
+  fx = x0 << shift;
+  fy = y0 << shift;
+  d1x = ax + (bx << k);
+  d1y = ay + (by << k);
+  d2x = 2 * ax;
+  d2y = 2 * ay;
+
+  for (i = 1; i < n; i++)
+  {
+    fx += d1x;  fy += d1y;
+    d1x += d2x; d1y += d2y;
+    drawPathVertex(sink, fx >> shift, fy >> shift);
+  }
+  drawPathVertex(sink, x2, y2);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Flattens a cubic curve (1/16 pixel control points) using
+            integer forward differencing, splitting it first if it's too
+            curved for a single run
+*/
+/**************************************************************************/
+static void drawBezierCubicFlatten(drawPathSink_t *sink, int32_t x0, int32_t y0, int32_t x1, int32_t y1,
+                                   int32_t x2, int32_t y2, int32_t x3, int32_t y3, uint8_t depth)
+{
+  int32_t ax, ay, bx, by, cx, cy, fx, fy, d1x, d1y, d2x, d2y, d3x, d3y, m, m2;
+  int32_t x01, y01, x12, y12, x23, y23, xa, ya, xb, yb, xm, ym;
+  uint8_t k, shift;
+  uint16_t i, n;
+
+  // Largest second difference of the control polygon
+  m = (x0 - 2 * x1 + x2);
+  m = (m < 0 ? -m : m) + ((y0 - 2 * y1 + y2) < 0 ? -(y0 - 2 * y1 + y2) : (y0 - 2 * y1 + y2));
+  m2 = (x1 - 2 * x2 + x3);
+  m2 = (m2 < 0 ? -m2 : m2) + ((y1 - 2 * y2 + y3) < 0 ? -(y1 - 2 * y2 + y3) : (y1 - 2 * y2 + y3));
+  k = drawBezierStepsLog2(m > m2 ? m : m2, true);
+
+  if ((k > DRAW_BEZIER_MAXSTEPSLOG2) && (depth < DRAW_BEZIER_MAXDEPTH))
+  {
+    // Split at t = 0.5 (de Casteljau) and flatten each half separately
+    x01 = (x0 + x1) >> 1;  y01 = (y0 + y1) >> 1;
+    x12 = (x1 + x2) >> 1;  y12 = (y1 + y2) >> 1;
+    x23 = (x2 + x3) >> 1;  y23 = (y2 + y3) >> 1;
+    xa = (x01 + x12) >> 1; ya = (y01 + y12) >> 1;
+    xb = (x12 + x23) >> 1; yb = (y12 + y23) >> 1;
+    xm = (xa + xb) >> 1;   ym = (ya + yb) >> 1;
+    drawBezierCubicFlatten(sink, x0, y0, x01, y01, xa, ya, xm, ym, depth + 1);
+    drawBezierCubicFlatten(sink, xm, ym, xb, yb, x23, y23, x3, y3, depth + 1);
+    return;
+  }
+  if (k > DRAW_BEZIER_MAXSTEPSLOG2)
+  {
+    k = DRAW_BEZIER_MAXSTEPSLOG2;
+  }
+
+  // B(t) = a.t^3 + b.t^2 + c.t + p0, evaluated at t = i/N with every term
+  // scaled by N^3 so that the differences stay exact integers
+  n = 1 << k;
+  shift = 3 * k;
+  ax = -x0 + 3 * x1 - 3 * x2 + x3;
+  ay = -y0 + 3 * y1 - 3 * y2 + y3;
+  bx = 3 * x0 - 6 * x1 + 3 * x2;
+  by = 3 * y0 - 6 * y1 + 3 * y2;
+  cx = 3 * (x1 - x0);
+  cy = 3 * (y1 - y0);
+  fx = x0 << shift;
+  fy = y0 << shift;
+  d1x = ax + (bx << k) + (cx << (2 * k));
+  d1y = ay + (by << k) + (cy << (2 * k));
+  d2x = 6 * ax + ((2 * bx) << k);
+  d2y = 6 * ay + ((2 * by) << k);
+  d3x = 6 * ax;
+  d3y = 6 * ay;
+
+  for (i = 1; i < n; i++)
+  {
+    fx += d1x;  fy += d1y;
+    d1x += d2x; d1y += d2y;
+    d2x += d3x; d2y += d3y;
+    drawPathVertex(sink, fx >> shift, fy >> shift);
+  }
+  drawPathVertex(sink, x3, y3);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Fills the polygon held in the edge table using the even-odd
+            rule, one horizontal line per span
+
+    Each edge keeps its own Bresenham accumulator, so stepping down one
+    scanline needs no division.
+*/
+/**************************************************************************/
+static void drawPathFillEdges(uint16_t numEdges, uint16_t color)
+{
+  int16_t  xs[DRAW_PATH_MAXEDGES];
+  int16_t  y, yMin, yMax, t;
+  uint16_t i, j, count;
+  drawEdge_t *e;
+
+  if (numEdges < 2)
+  {
+    return;
+  }
+
+  yMin = drawPathEdges[0].y0;
+  yMax = drawPathEdges[0].y1;
+  for (i = 1; i < numEdges; i++)
+  {
+    if (drawPathEdges[i].y0 < yMin) yMin = drawPathEdges[i].y0;
+    if (drawPathEdges[i].y1 > yMax) yMax = drawPathEdges[i].y1;
+  }
+
+  for (y = yMin; y < yMax; y++)
+  {
+    // Collect the crossings on this scanline, sorted by x
+    count = 0;
+    for (i = 0; i < numEdges; i++)
     {
-      column[col] = 0xFF;    // Send solid space
+      e = &drawPathEdges[i];
+      if ((y < e->y0) || (y >= e->y1))
+        continue;
+      for (j = count; (j > 0) && (xs[j - 1] > e->x); j--)
+      {
+        xs[j] = xs[j - 1];
+      }
+      xs[j] = e->x;
+      count++;
+
+      // Step the edge down to the next scanline
+      e->acc += e->dx;
+      while (e->acc >= e->dy)
+      {
+        e->acc -= e->dy;
+        e->x += e->sx;
+      }
+    }
+
+    if (y < 0)
+      continue;
+
+    // Fill between pairs of crossings
+    for (i = 0; i + 1 < count; i += 2)
+    {
+      if (xs[i + 1] < 0)
+        continue;
+      t = xs[i] < 0 ? 0 : xs[i];
+      drawLine(t, y, xs[i + 1], y, color);
     }
   }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws one span for drawFloodFill
+*/
+/**************************************************************************/
+static void drawFloodFillSpan(uint16_t x0, uint16_t x1, uint16_t y, uint16_t color)
+{
+  drawLine(x0, y, x1, y, color);
+}
 
-  // Render each column
-  uint16_t xoffset, yoffset;
-  for (xoffset = 0; xoffset < font.u8Width; xoffset++)
+/**************************************************************************/
+/*!
+    @brief  Reads a pixel back from the selected framebuffer for
+            drawFloodFill
+*/
+/**************************************************************************/
+static uint16_t drawFloodFillGetIndex(uint16_t x, uint16_t y)
+{
+  return fbGetPixel(_drawFramebuffer, x, y);
+}
+
+/* Source for drawIcon16Rotated */
+typedef struct
+{
+  const uint16_t *icon;
+  uint16_t       color;
+  uint16_t       bgColor;
+} drawIconSource_t;
+
+/* Source for drawImageRotated */
+typedef struct
+{
+  const uint16_t *pixels;
+  uint16_t       width;
+} drawImageSource_t;
+
+/**************************************************************************/
+/*!
+    @brief  Pixel fetch functions used by drawIcon16Rotated and
+            drawImageRotated
+*/
+/**************************************************************************/
+static uint16_t drawIconFetch(const void *src, uint16_t sx, uint16_t sy)
+{
+  const drawIconSource_t *s = (const drawIconSource_t *)src;
+  return (s->icon[sy] & (0x8000 >> sx)) ? s->color : s->bgColor;
+}
+
+static uint16_t drawImageFetch(const void *src, uint16_t sx, uint16_t sy)
+{
+  const drawImageSource_t *s = (const drawImageSource_t *)src;
+  return s->pixels[(uint32_t)sy * s->width + sx];
+}
+
+/* Source for drawTextOpaque */
+typedef struct
+{
+  const font_t    *font;
+  const uint16_t  *colorTable;
+  const char      *str;
+  const char      *next;      // Character after the one in glyph
+  uint16_t        start;      // X offset of glyph's cell in the string
+  fontGlyph_t     glyph;
+  uint8_t         levels[FONT_CHUNKSIZE];   // Row chunk (drawTextGlyphRows)
+} drawTextCells_t;
+
+/**************************************************************************/
+/*!
+    @brief  Returns the color of pixel sx/sy in the current character
+            cell
+*/
+/**************************************************************************/
+static uint16_t drawTextGlyphFetch(const void *src, uint16_t sx, uint16_t sy)
+{
+  drawTextCells_t *s = (drawTextCells_t *)src;
+  fontGlyph_t *glyph = &s->glyph;
+  uint8_t level = 0;
+
+  // Rows outside the glyph's pixel data are blank
+  if ((sx >= glyph->width) || (sy < glyph->yOffset) || (sy >= glyph->yOffset + glyph->rows))
+    return s->colorTable[0];
+  sy -= glyph->yOffset;
+
+  if (glyph->layout == FONT_LAYOUT_RLE)
   {
-    for (yoffset = 0; yoffset < (font.u8Height + 1); yoffset++)
+    // Compressed glyphs are only fetched in row order (rotated ones go
+    // through drawTextGlyphRows), so just skip any clipped pixels
+    while ((glyph->row != sy) || (glyph->col != sx))
     {
-      uint8_t bit = 0x00;
-      bit = (column[xoffset] << (8 - (yoffset + 1)));     // Shift current row bit left
-      bit = (bit >> 7);                                   // Shift current row bit right (results in 0x01 for black, and 0x00 for white)
-      if (bit)
+      fontReadGlyph(glyph, &level, 1);
+    }
+  }
+  else
+  {
+    glyph->row = sy;
+    glyph->col = sx;
+  }
+  fontReadGlyph(glyph, &level, 1);
+
+  return s->colorTable[level];
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the color of pixel sx/sy in a rendered string
+
+    Pixels are fetched left to right, so the character is tracked from
+    one call to the next and only rewound at the start of each row.
+*/
+/**************************************************************************/
+static uint16_t drawTextStringFetch(const void *src, uint16_t sx, uint16_t sy)
+{
+  drawTextCells_t *s = (drawTextCells_t *)src;
+
+  if ((s->next == NULL) || (sx < s->start))
+  {
+    s->next = s->str;
+    s->start = 0;
+    fontGetGlyph(s->font, fontNextChar(s->font, &s->next), &s->glyph);
+  }
+
+  // Each cell includes the font's spacing
+  while (sx >= s->start + s->glyph.advance)
+  {
+    s->start += s->glyph.advance;
+    fontGetGlyph(s->font, fontNextChar(s->font, &s->next), &s->glyph);
+  }
+
+  return drawTextGlyphFetch(s, sx - s->start, sy);
+}
+
+static uint16_t drawTextLevelFetch(const void *src, uint16_t sx, uint16_t sy)
+{
+  const drawTextCells_t *s = (const drawTextCells_t *)src;
+  (void)sy;
+  return s->colorTable[s->levels[sx]];
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws a rotated character cell from a compressed glyph
+
+    Compressed glyphs can only be decoded in row order, and fetching
+    one in rotated order would restart the decoder for every column.
+    Instead each row is decoded once, a chunk at a time, and every
+    chunk goes out as its own rotated window.
+*/
+/**************************************************************************/
+static void drawTextGlyphRows(uint16_t x, uint16_t y, uint16_t width, uint16_t height, lcdRotation_t rotation, drawTextCells_t *cells)
+{
+  fontGlyph_t *glyph = &cells->glyph;
+  uint16_t sx, sy, n, count;
+
+  for (sy = 0; sy < height; sy++)
+  {
+    for (sx = 0; sx < width; sx += n)
+    {
+      n = width - sx < FONT_CHUNKSIZE ? width - sx : FONT_CHUNKSIZE;
+      memset(cells->levels, 0, n);
+      if ((sy >= glyph->yOffset) && (sy < glyph->yOffset + glyph->rows) && (sx < glyph->width))
+      {
+        count = glyph->width - sx < n ? glyph->width - sx : n;
+        fontReadGlyph(glyph, cells->levels, count);
+      }
+
+      switch (rotation)
       {
-        drawPixel(x + xoffset, y + yoffset, color);
+        case LCD_ROTATION_90:
+          drawBlitRotated(x + height - 1 - sy, y + sx, n, 1, rotation, drawTextLevelFetch, cells);
+          break;
+        case LCD_ROTATION_180:
+          drawBlitRotated(x + width - sx - n, y + height - 1 - sy, n, 1, rotation, drawTextLevelFetch, cells);
+          break;
+        default:
+          drawBlitRotated(x + sy, y + width - sx - n, n, 1, rotation, drawTextLevelFetch, cells);
+          break;
       }
     }
   }
 }
-#endif
 
 /**************************************************************************/
 /*                                                                        */
@@ -125,7 +821,11 @@ void drawCharSmall(uint16_t x, uint16_t y, uint16_t color, uint8_t c, struct FON
 /**************************************************************************/
 void drawPixel(uint16_t x, uint16_t y, uint16_t color)
 {
-  if ((x < lcdGetWidth()) && (y < lcdGetHeight()))
+  if (_drawFramebuffer)
+  {
+    fbSetPixel(_drawFramebuffer, x, y, (uint8_t)color);
+  }
+  else if ((x < lcdGetWidth()) && (y < lcdGetHeight()))
   {
     lcdDrawPixel(x, y, color);
   }
@@ -141,9 +841,110 @@ void drawPixel(uint16_t x, uint16_t y, uint16_t color)
 /**************************************************************************/
 void drawFill(uint16_t color)
 {
+  if (_drawFramebuffer)
+  {
+    fbFill(_drawFramebuffer, (uint8_t)color);
+    return;
+  }
+
   lcdFillRGB(color);
 }
 
+/**************************************************************************/
+/*!
+    @brief  Redirects drawing to an indexed-color framebuffer
+
+    While a framebuffer is selected, the color passed to the drawing
+    functions (and to fontsDrawString or aafontsDrawString through the
+    color table) is used as a palette index instead of an RGB565 color.
+    Nothing is sent to the display until fbFlush is called.  Functions
+    that write a window straight to the panel (drawBlitRotated and the
+    rotated text and bitmap functions, jpeg and tilemap rendering)
+    always draw on the display.
+
+    @param[in]  fb
+                The framebuffer to draw into, or NULL to draw on the
+                display again
+*/
+/**************************************************************************/
+void drawSetFramebuffer(fb_t *fb)
+{
+  _drawFramebuffer = fb;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the framebuffer selected with drawSetFramebuffer, or
+            NULL if drawing goes to the display
+*/
+/**************************************************************************/
+fb_t *drawGetFramebuffer(void)
+{
+  return _drawFramebuffer;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Selects the panel that drawing is rendered to
+
+    Every drawing, font, image and tilemap function renders to the
+    selected panel, and its width, height and capabilities are used for
+    clipping.  The panel handle is owned by the caller and must stay
+    valid while it is selected.  Each driver provides a handle for the
+    panel on the pins in its header (st7735Panel, etc.), which is
+    selected by default.  When only one LCD driver is configured the
+    driver is still called directly, with the selected panel's state.
+
+    The selection is shared by all of the drawing code and isn't
+    reentrant.  Don't draw from an ISR (or anything else that can
+    preempt the main loop) while the main loop may be drawing, since
+    the two would switch the target under each other.  Code that draws
+    on a particular panel, such as a render queue job, should select it
+    every time it runs rather than rely on an earlier selection.
+
+    @param[in]  panel
+                The panel to draw on
+
+    @section Example
+
+    @code
+
+    // Main HX8347G TFT plus two ST7735 status panels, the second
+    // one sharing the ST7735 bus with its chip select on pin 0.20
+    st7735_t   auxState = ST7735_PANEL(20);
+    lcdPanel_t aux      = { &st7735Driver, &auxState };
+
+    drawSetTarget(&hx8347gPanel);
+    lcdInit();
+    fontsDrawString(10, 10, COLOR_WHITE, &dejaVuSans9ptFontInfo, "Main");
+
+    drawSetTarget(&st7735Panel);
+    lcdInit();
+    drawSetTarget(&aux);
+    lcdInit();
+    fontsDrawString(2, 2, COLOR_YELLOW, &dejaVuSans9ptFontInfo, "Aux");
+
+    @endcode
+*/
+/**************************************************************************/
+void drawSetTarget(lcdPanel_t *panel)
+{
+  if (panel)
+  {
+    lcdTarget = panel;
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the panel selected with drawSetTarget
+*/
+/**************************************************************************/
+lcdPanel_t *drawGetTarget(void)
+{
+  return lcdTarget;
+}
+
 /**************************************************************************/
 /*!
     @brief  Draws a simple color test pattern
@@ -154,6 +955,270 @@ void drawTestPattern(void)
   lcdTest();
 }
 
+/**************************************************************************/
+/*!
+    @brief  Draws a string in any font format, skipping the background
+            pixels
+
+    Every format goes through the same renderer (fontrender.h), which
+    sends each run of equal pixels in a glyph row as a single line.
+
+    @param[in]  x
+                Starting x co-ordinate
+    @param[in]  y
+                Starting y co-ordinate (top of the character cell)
+    @param[in]  font
+                The font to use (see FONT_BITMAP, FONT_SMALL, FONT_AA)
+    @param[in]  str
+                The string to render, decoded as UTF-8 with
+                anti-aliased fonts
+    @param[in]  colorTable
+                Color for each glyph level: colorTable[1] for
+                monochrome fonts, colorTable[1..3] or [1..15] for
+                anti-aliased fonts
+
+    @return The x position following the string
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/graphic/fonts/dejavusans9.h"
+
+    const font_t font = FONT_BITMAP(&dejaVuSans9ptFontInfo);
+    const uint16_t colors[2] = { COLOR_BLACK, COLOR_WHITE };
+
+    drawText(10, 10, &font, "Hello", colors);
+
+    @endcode
+*/
+/**************************************************************************/
+uint16_t drawText(uint16_t x, uint16_t y, const font_t *font, const char *str, const uint16_t *colorTable)
+{
+  drawTextContext_t ctx;
+
+  drawTextInit(&ctx, colorTable);
+  return drawTextRenderString(&ctx, x, y, font, str);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws a single glyph from fontGetGlyph, skipping the
+            background pixels
+
+    @param[in]  x
+                Left edge of the character cell
+    @param[in]  y
+                Top edge of the character cell
+    @param[in]  glyph
+                The glyph, which is consumed by drawing it
+    @param[in]  colorTable
+                Color for each glyph level, as for drawText
+*/
+/**************************************************************************/
+void drawGlyph(uint16_t x, uint16_t y, fontGlyph_t *glyph, const uint16_t *colorTable)
+{
+  drawTextContext_t ctx;
+
+  drawTextInit(&ctx, colorTable);
+  drawTextRenderGlyph(&ctx, x, y, glyph);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws a string scaled up by a whole number, skipping the
+            background pixels
+
+    Each run of equal pixels in a glyph row becomes a block scale
+    pixels high, sent as scale horizontal lines, so large digits don't
+    need a large font.  With smooth set, anti-aliased glyphs up to
+    DRAW_SMOOTH_MAXWIDTH pixels wide are scaled with bilinear
+    interpolation instead, which turns the staircase along curved and
+    diagonal edges into a gradient.  Monochrome fonts are always drawn
+    as blocks.
+
+    @param[in]  x
+                Starting x co-ordinate
+    @param[in]  y
+                Starting y co-ordinate (top of the character cell)
+    @param[in]  font
+                The font to use
+    @param[in]  str
+                The string to render
+    @param[in]  colorTable
+                Color for each glyph level, as for drawText
+    @param[in]  scale
+                Scale factor, 1 to DRAW_SCALE_MAX
+    @param[in]  smooth
+                Interpolate the edges of anti-aliased glyphs
+
+    @return The x position following the string, which is
+            fontGetStringWidth * scale further on (plus the scaled
+            spacing after the last character)
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/graphic/aafonts/aa2/DejaVuSansCondensedBold14_AA2.h"
+
+    const font_t font = FONT_AA(&DejaVuSansCondensedBold14_AA2);
+
+    // 56 pixel high digits from a 14 pixel font
+    drawTextScaled(10, 40, &font, "12:45", COLORTABLE_AA2_BLACKONWHITE, 4, true);
+
+    @endcode
+*/
+/**************************************************************************/
+uint16_t drawTextScaled(uint16_t x, uint16_t y, const font_t *font, const char *str, const uint16_t *colorTable, uint8_t scale, bool smooth)
+{
+  drawTextScaledContext_t ctx;
+  fontGlyph_t glyph;
+  uint16_t c;
+
+  if (scale == 0)
+  {
+    return x;
+  }
+  if (scale > DRAW_SCALE_MAX)
+  {
+    scale = DRAW_SCALE_MAX;
+  }
+
+  drawTextInit(&ctx.text, colorTable);
+  ctx.scale = scale;
+  ctx.y = y;
+  while ((c = fontNextChar(font, &str)) != 0)
+  {
+    fontGetGlyph(font, c, &glyph);
+    ctx.x = x;
+    if (smooth && (fontGetLevels(font) > 1) && (glyph.width <= DRAW_SMOOTH_MAXWIDTH))
+    {
+      drawGlyphSmooth(&ctx, &glyph, fontGetHeight(font));
+    }
+    else
+    {
+      drawTextScaledRenderGlyph(&ctx, 0, 0, &glyph);
+    }
+    x += glyph.advance * scale;
+  }
+
+  return x;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws a string on a solid background, optionally rotated
+            clockwise by 90, 180 or 270 degrees
+
+    Every pixel of the character cells is written, including the
+    spacing between characters, so there's one window per string (or
+    per character when rotated, or when the font is compressed and can
+    only be decoded in order) instead of one transaction per pixel.
+    The glyph data is walked in rotated order, so this doesn't depend
+    on lcdSetOrientation.  Rotated compressed glyphs are decoded a row
+    at a time instead, and each row goes out as its own window.  The string is clipped to the screen, and
+    the pixels go straight to the panel even if a framebuffer was
+    selected with drawSetFramebuffer.
+
+    @param[in]  x
+                Left edge of the (rotated) string on the screen
+    @param[in]  y
+                Top edge of the (rotated) string on the screen
+    @param[in]  font
+                The font to use
+    @param[in]  str
+                The string to render
+    @param[in]  colorTable
+                Color for each glyph level as for drawText, with the
+                background color in colorTable[0]
+    @param[in]  rotation
+                LCD_ROTATION_90 reads top to bottom, LCD_ROTATION_270
+                reads bottom to top, and LCD_ROTATION_180 is upside down
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/graphic/fonts/dejavusans9.h"
+
+    const font_t font = FONT_BITMAP(&dejaVuSans9ptFontInfo);
+    const uint16_t colors[2] = { COLOR_WHITE, COLOR_BLACK };
+
+    // Y axis label, reading bottom to top along the left edge
+    drawTextOpaque(0, 40, &font, "Temperature", colors, LCD_ROTATION_270);
+
+    @endcode
+*/
+/**************************************************************************/
+void drawTextOpaque(uint16_t x, uint16_t y, const font_t *font, const char *str, const uint16_t *colorTable, lcdRotation_t rotation)
+{
+  drawTextCells_t cells;
+  uint16_t total, height, offset, cellWidth, cellX, cellY, c;
+  bool compressed = fontIsCompressed(font);
+
+  total = fontGetStringWidth(font, str);
+  height = fontGetHeight(font);
+
+  cells.font = font;
+  cells.colorTable = colorTable;
+  cells.str = str;
+  cells.next = NULL;
+  cells.start = 0;
+
+  if ((rotation == LCD_ROTATION_0) && !compressed)
+  {
+    drawBlitRotated(x, y, total, height, rotation, drawTextStringFetch, &cells);
+    return;
+  }
+
+  offset = 0;
+  c = fontNextChar(font, &str);
+  while (c != 0)
+  {
+    fontGetGlyph(font, c, &cells.glyph);
+    cellWidth = cells.glyph.advance;
+
+    // The spacing after the last character isn't part of the string
+    c = fontNextChar(font, &str);
+    if (c == 0)
+    {
+      cellWidth -= fontGetSpacing(font);
+    }
+
+    switch (rotation)
+    {
+      case LCD_ROTATION_90:
+        cellX = x;
+        cellY = y + offset;
+        break;
+      case LCD_ROTATION_180:
+        cellX = x + total - offset - cellWidth;
+        cellY = y;
+        break;
+      case LCD_ROTATION_270:
+        cellX = x;
+        cellY = y + total - offset - cellWidth;
+        break;
+      default:
+        cellX = x + offset;
+        cellY = y;
+        break;
+    }
+
+    if (compressed && (rotation != LCD_ROTATION_0))
+    {
+      drawTextGlyphRows(cellX, cellY, cellWidth, height, rotation, &cells);
+    }
+    else
+    {
+      drawBlitRotated(cellX, cellY, cellWidth, height, rotation, drawTextGlyphFetch, &cells);
+    }
+
+    offset += cellWidth;
+  }
+}
+
 #if defined CFG_BSP_TFTLCD_INCLUDESMALLFONTS & CFG_BSP_TFTLCD_INCLUDESMALLFONTS == 1
 /**************************************************************************/
 /*!
@@ -184,11 +1249,48 @@ void drawTestPattern(void)
 /**************************************************************************/
 void drawStringSmall(uint16_t x, uint16_t y, uint16_t color, char* text, struct FONT_DEF font)
 {
-  uint8_t l;
-  for (l = 0; l < strlen(text); l++)
-  {
-    drawCharSmall(x + (l * (font.u8Width + 1)), y, color, text[l], font);
-  }
+  const font_t smallFont = FONT_SMALL(&font);
+  const uint16_t colorTable[2] = { color, color };
+
+  drawText(x, y, &smallFont, text, colorTable);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws a string using a smallfont, scaled up by a whole
+            number (see drawTextScaled)
+
+    @param[in]  x
+                Starting x co-ordinate
+    @param[in]  y
+                Starting y co-ordinate
+    @param[in]  color
+                Color to use when rendering the font
+    @param[in]  text
+                The string to render
+    @param[in]  font
+                Pointer to the FONT_DEF to use when drawing the string
+    @param[in]  scale
+                Scale factor, 1 to DRAW_SCALE_MAX
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/smallfonts.h"
+
+    // 5x8 digits drawn 4x as large
+    drawStringSmallScaled(10, 10, COLOR_WHITE, "12:45", Font_System5x8, 4);
+
+    @endcode
+*/
+/**************************************************************************/
+void drawStringSmallScaled(uint16_t x, uint16_t y, uint16_t color, char* text, struct FONT_DEF font, uint8_t scale)
+{
+  const font_t smallFont = FONT_SMALL(&font);
+  const uint16_t colorTable[2] = { color, color };
+
+  drawTextScaled(x, y, &smallFont, text, colorTable, scale, false);
 }
 #endif
 
@@ -254,6 +1356,17 @@ void drawLineDotted ( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16
   y0 = y0 > 65000 ? 0 : y0;
   y1 = y1 > 65000 ? 0 : y1;
 
+  // Solid horizontal and vertical lines are written straight into the
+  // framebuffer
+  if (_drawFramebuffer && (empty == 0) && ((y0 == y1) || (x0 == x1)))
+  {
+    if (y0 == y1)
+      fbDrawHLine(_drawFramebuffer, x0, x1, y0, (uint8_t)color);
+    else
+      fbDrawVLine(_drawFramebuffer, x0, y0, y1, (uint8_t)color);
+    return;
+  }
+
   // Check if we can use the optimised horizontal line method
   if ((y0 == y1) && (empty == 0) && properties.fastHLine)
   {
@@ -1164,6 +2277,253 @@ void drawTriangleFilled ( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, ui
   }
 }
 
+/**************************************************************************/
+/*!
+    @brief  Draws a quadratic Bezier curve
+
+    The curve is flattened into line segments with integer forward
+    differencing.  The number of segments is picked from the curvature
+    of the control polygon, and strongly curved shapes are split in half
+    first, so gentle curves only cost a handful of lines.  No floating
+    point or division is used.
+
+    @param[in]  x0
+                Starting x co-ordinate
+    @param[in]  y0
+                Starting y co-ordinate
+    @param[in]  x1
+                Control point x co-ordinate
+    @param[in]  y1
+                Control point y co-ordinate
+    @param[in]  x2
+                Ending x co-ordinate
+    @param[in]  y2
+                Ending y co-ordinate
+    @param[in]  color
+                Color used when drawing
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/graphic/drawing.h"
+
+    // Draw a simple arch
+    drawBezierQuad(20, 200, 120, 20, 220, 200, COLOR_WHITE);
+
+    @endcode
+*/
+/**************************************************************************/
+void drawBezierQuad ( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color )
+{
+  drawPathSink_t sink = { false, color, x0, y0, 0, 0, 0 };
+
+  drawBezierQuadFlatten(&sink, (int32_t)x0 << DRAW_BEZIER_FRAC, (int32_t)y0 << DRAW_BEZIER_FRAC,
+                               (int32_t)x1 << DRAW_BEZIER_FRAC, (int32_t)y1 << DRAW_BEZIER_FRAC,
+                               (int32_t)x2 << DRAW_BEZIER_FRAC, (int32_t)y2 << DRAW_BEZIER_FRAC, 0);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws a cubic Bezier curve
+
+    See drawBezierQuad for details on how the curve is flattened.
+
+    @param[in]  x0
+                Starting x co-ordinate
+    @param[in]  y0
+                Starting y co-ordinate
+    @param[in]  x1
+                First control point x co-ordinate
+    @param[in]  y1
+                First control point y co-ordinate
+    @param[in]  x2
+                Second control point x co-ordinate
+    @param[in]  y2
+                Second control point y co-ordinate
+    @param[in]  x3
+                Ending x co-ordinate
+    @param[in]  y3
+                Ending y co-ordinate
+    @param[in]  color
+                Color used when drawing
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/graphic/drawing.h"
+
+    // Draw an 'S' shaped curve
+    drawBezierCubic(20, 160, 20, 40, 220, 280, 220, 160, COLOR_YELLOW);
+
+    @endcode
+*/
+/**************************************************************************/
+void drawBezierCubic ( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, uint16_t color )
+{
+  drawPathSink_t sink = { false, color, x0, y0, 0, 0, 0 };
+
+  drawBezierCubicFlatten(&sink, (int32_t)x0 << DRAW_BEZIER_FRAC, (int32_t)y0 << DRAW_BEZIER_FRAC,
+                                (int32_t)x1 << DRAW_BEZIER_FRAC, (int32_t)y1 << DRAW_BEZIER_FRAC,
+                                (int32_t)x2 << DRAW_BEZIER_FRAC, (int32_t)y2 << DRAW_BEZIER_FRAC,
+                                (int32_t)x3 << DRAW_BEZIER_FRAC, (int32_t)y3 << DRAW_BEZIER_FRAC, 0);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws the outline of, or fills, a closed path made of
+            straight lines or Bezier curves
+
+    The path starts at points[0].  Each following segment uses 'order'
+    more points: the end point of a line (order 1), the control point
+    and end point of a quadratic curve (order 2), or both control points
+    and the end point of a cubic curve (order 3).  The path is closed
+    with a straight line back to points[0] if needed.
+
+    When filling, the outline is flattened into an edge table of up to
+    DRAW_PATH_MAXEDGES edges and filled with the even-odd rule, one
+    horizontal line per span.
+
+    @param[in]  points
+                The start point followed by the points for each segment
+    @param[in]  count
+                The total number of points (1 + order * segments)
+    @param[in]  order
+                1 for lines, 2 for quadratic curves, 3 for cubic curves
+    @param[in]  fill
+                True to fill the path, false to draw the outline
+    @param[in]  color
+                Color used when drawing
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/graphic/drawing.h"
+
+    // A filled 'leaf' made of two cubic curves
+    drawPoint_t leaf[] = { { 40, 160 },
+                           { 60, 40 }, { 180, 40 }, { 200, 160 },
+                           { 180, 280 }, { 60, 280 }, { 40, 160 } };
+    drawBezierPath(leaf, 7, 3, true, COLOR_GREEN);
+
+    @endcode
+*/
+/**************************************************************************/
+void drawBezierPath ( const drawPoint_t *points, uint16_t count, uint8_t order, bool fill, uint16_t color )
+{
+  drawPathSink_t sink;
+  const drawPoint_t *p;
+  uint16_t i;
+
+  if ((points == NULL) || (order < 1) || (order > 3) || (count < 1 + order))
+  {
+    return;
+  }
+
+  sink.fill = fill;
+  sink.color = color;
+  sink.lastX = points[0].x;
+  sink.lastY = points[0].y;
+  sink.edgeStartX = sink.lastX;
+  sink.edgeStartY = sink.lastY;
+  sink.numEdges = 0;
+
+  #define DRAW_Q(v) ((int32_t)(v) << DRAW_BEZIER_FRAC)
+  for (i = 0; i + order < count; i += order)
+  {
+    p = &points[i];
+    switch (order)
+    {
+      case 1:
+        drawPathVertex(&sink, DRAW_Q(p[1].x), DRAW_Q(p[1].y));
+        break;
+      case 2:
+        drawBezierQuadFlatten(&sink, DRAW_Q(p[0].x), DRAW_Q(p[0].y), DRAW_Q(p[1].x), DRAW_Q(p[1].y),
+                                     DRAW_Q(p[2].x), DRAW_Q(p[2].y), 0);
+        break;
+      default:
+        drawBezierCubicFlatten(&sink, DRAW_Q(p[0].x), DRAW_Q(p[0].y), DRAW_Q(p[1].x), DRAW_Q(p[1].y),
+                                      DRAW_Q(p[2].x), DRAW_Q(p[2].y), DRAW_Q(p[3].x), DRAW_Q(p[3].y), 0);
+        break;
+    }
+  }
+
+  // Close the path
+  drawPathVertex(&sink, DRAW_Q(points[0].x), DRAW_Q(points[0].y));
+  #undef DRAW_Q
+
+  if (fill)
+  {
+    drawPathFillEdges(sink.numEdges, color);
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Fills the 4-connected area of one color around x/y with a
+            new color
+
+    This requires a display driver that can read pixels back from the
+    panel (lcdGetProperties().readPixel), or a framebuffer selected with
+    drawSetFramebuffer.  The fill uses a fixed-size
+    span stack (FLOODFILL_STACKSIZE seeds in floodfill.h), so the RAM
+    required doesn't depend on the shape being filled.  Very complex
+    shapes take several passes, as long as the panel or framebuffer
+    fits in FLOODFILL_MAPSIZE.  Otherwise they stop part way and return
+    ERROR_FLOODFILL_OVERFLOW.
+
+    @param[in]  x
+                Horizontal position of the seed pixel
+    @param[in]  y
+                Vertical position of the seed pixel
+    @param[in]  color
+                The new color
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/graphic/drawing.h"
+
+    // Draw an outline and fill the inside of it
+    drawCircle(120, 160, 50, COLOR_WHITE);
+    drawFloodFill(120, 160, COLOR_BLUE);
+
+    @endcode
+*/
+/**************************************************************************/
+error_t drawFloodFill ( uint16_t x, uint16_t y, uint16_t color )
+{
+  floodfillSurface_t surface;
+
+  surface.fillSpan = drawFloodFillSpan;
+
+  if (_drawFramebuffer)
+  {
+    surface.x = _drawFramebuffer->x;
+    surface.y = _drawFramebuffer->y;
+    surface.width = _drawFramebuffer->width;
+    surface.height = _drawFramebuffer->height;
+    surface.getPixel = drawFloodFillGetIndex;
+    return floodfill(&surface, x, y, color, NULL);
+  }
+
+  if (!lcdGetProperties().readPixel)
+  {
+    return ERROR_DISPLAY_READBACKUNSUPPORTED;
+  }
+
+  surface.x = 0;
+  surface.y = 0;
+  surface.width = lcdGetWidth();
+  surface.height = lcdGetHeight();
+  surface.getPixel = lcdGetPixel;
+
+  return floodfill(&surface, x, y, color, NULL);
+}
+
 /**************************************************************************/
 /*!
     @brief  Renders a 16x16 monochrome icon using the supplied uint16_t
@@ -1217,3 +2577,314 @@ void drawIcon16(uint16_t x, uint16_t y, uint16_t color, uint16_t icon[])
     if (icon[i] & (0X0001)) drawPixel(x+15, y+i, color);
   }
 }
+
+/**************************************************************************/
+/*!
+    @brief  Copies a width x height source image to the screen, rotated
+            clockwise in 90 degree steps
+
+    The source is walked in rotated order so that the destination can
+    be filled left to right and top to bottom, which means the whole
+    image goes out as a single window burst (lcdSetWindow and
+    lcdWritePixels) rather than as individual pixels.  The rotated
+    image is clipped to the screen.
+
+    This is the common back end for the rotated text and bitmap
+    renderers.  The source can be in any format, since pixels are read
+    through the fetch function.
+
+    @param[in]  x
+                Left edge of the rotated image on the screen
+    @param[in]  y
+                Top edge of the rotated image on the screen
+    @param[in]  width
+                Width of the unrotated source image in pixels
+    @param[in]  height
+                Height of the unrotated source image in pixels
+    @param[in]  rotation
+                Clockwise rotation.  At 90 and 270 degrees the image
+                covers height x width pixels on the screen.
+    @param[in]  fetch
+                Returns the RGB565 color of a source pixel
+    @param[in]  src
+                Passed to fetch
+*/
+/**************************************************************************/
+void drawBlitRotated(uint16_t x, uint16_t y, uint16_t width, uint16_t height, lcdRotation_t rotation, drawPixelFetch_t fetch, const void *src)
+{
+  uint16_t buffer[32];
+  uint16_t dw, dh, cw, ch, dx, dy, sx, sy;
+  uint8_t  n = 0;
+
+  if ((width == 0) || (height == 0) || (fetch == NULL))
+    return;
+
+  /* Size of the rotated image on the screen */
+  if ((rotation == LCD_ROTATION_90) || (rotation == LCD_ROTATION_270))
+  {
+    dw = height;
+    dh = width;
+  }
+  else
+  {
+    dw = width;
+    dh = height;
+  }
+
+  /* Clip to the screen */
+  if ((x >= lcdGetWidth()) || (y >= lcdGetHeight()))
+    return;
+  cw = dw > lcdGetWidth() - x ? lcdGetWidth() - x : dw;
+  ch = dh > lcdGetHeight() - y ? lcdGetHeight() - y : dh;
+
+  lcdSetWindow(x, y, x + cw - 1, y + ch - 1);
+
+  for (dy = 0; dy < ch; dy++)
+  {
+    for (dx = 0; dx < cw; dx++)
+    {
+      /* Map the screen position back to the source image */
+      switch (rotation)
+      {
+        case LCD_ROTATION_90:
+          sx = dy;
+          sy = height - 1 - dx;
+          break;
+        case LCD_ROTATION_180:
+          sx = width - 1 - dx;
+          sy = height - 1 - dy;
+          break;
+        case LCD_ROTATION_270:
+          sx = width - 1 - dy;
+          sy = dx;
+          break;
+        default:
+          sx = dx;
+          sy = dy;
+          break;
+      }
+      buffer[n++] = fetch(src, sx, sy);
+      if (n == sizeof(buffer) / sizeof(buffer[0]))
+      {
+        lcdWritePixels(buffer, n);
+        n = 0;
+      }
+    }
+  }
+
+  if (n)
+  {
+    lcdWritePixels(buffer, n);
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Renders a rotated 16x16 monochrome icon on a solid background
+
+    Unlike drawIcon16, the whole 16x16 cell is written (clear bits use
+    bgColor), which allows the icon to be sent as a single window burst.
+
+    @param[in]  x
+                The horizontal location of the top-left corner
+    @param[in]  y
+                The vertical location of the top-left corner
+    @param[in]  color
+                The RGB565 color for set bits
+    @param[in]  bgColor
+                The RGB565 color for clear bits
+    @param[in]  icon
+                The uint16_t array containing the 16x16 image data
+    @param[in]  rotation
+                Clockwise rotation
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/graphic/drawing.h"
+    #include "drivers/displays/icons16.h"
+
+    // Tag icon on its side, on a white background
+    drawIcon16Rotated(132, 202, COLOR_BLUE, COLOR_WHITE, icons16_tag, LCD_ROTATION_90);
+
+    @endcode
+*/
+/**************************************************************************/
+void drawIcon16Rotated(uint16_t x, uint16_t y, uint16_t color, uint16_t bgColor, const uint16_t icon[], lcdRotation_t rotation)
+{
+  drawIconSource_t src;
+
+  src.icon = icon;
+  src.color = color;
+  src.bgColor = bgColor;
+  drawBlitRotated(x, y, 16, 16, rotation, drawIconFetch, &src);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Renders a rotated RGB565 image
+
+    @param[in]  x
+                Left edge of the rotated image on the screen
+    @param[in]  y
+                Top edge of the rotated image on the screen
+    @param[in]  width
+                Width of the unrotated image in pixels
+    @param[in]  height
+                Height of the unrotated image in pixels
+    @param[in]  pixels
+                The image data, one RGB565 value per pixel, row by row
+    @param[in]  rotation
+                Clockwise rotation
+*/
+/**************************************************************************/
+void drawImageRotated(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint16_t *pixels, lcdRotation_t rotation)
+{
+  drawImageSource_t src;
+
+  if (pixels == NULL)
+    return;
+
+  src.pixels = pixels;
+  src.width = width;
+  drawBlitRotated(x, y, width, height, rotation, drawImageFetch, &src);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Renders an RGB565 image scaled up by a whole number
+
+    Each run of equal pixels in a source row is drawn as one block, a
+    line at a time, so flat areas of icons and digits stay cheap at
+    large sizes.  The image is clipped to the screen, and goes into the
+    framebuffer if one was selected with drawSetFramebuffer.
+
+    @param[in]  x
+                Left edge of the scaled image
+    @param[in]  y
+                Top edge of the scaled image
+    @param[in]  width
+                Width of the source image in pixels
+    @param[in]  height
+                Height of the source image in pixels
+    @param[in]  pixels
+                The image data, one RGB565 value per pixel, row by row
+    @param[in]  scale
+                Scale factor, 1 to DRAW_SCALE_MAX
+*/
+/**************************************************************************/
+void drawImageScaled(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint16_t *pixels, uint8_t scale)
+{
+  drawTextContext_t ctx;
+  const uint16_t *row;
+  uint16_t sx, sy, start;
+  uint8_t i;
+
+  if ((pixels == NULL) || (scale == 0))
+    return;
+  if (scale > DRAW_SCALE_MAX)
+    scale = DRAW_SCALE_MAX;
+
+  drawTextInit(&ctx, NULL);
+  for (sy = 0; sy < height; sy++)
+  {
+    row = &pixels[(uint32_t)sy * width];
+    for (start = 0; start < width; start = sx)
+    {
+      for (sx = start + 1; (sx < width) && (row[sx] == row[start]); sx++);
+
+      /* The run's first pixel doubles as a one entry color table */
+      ctx.colorTable = &row[start];
+      for (i = 0; i < scale; i++)
+      {
+        drawTextSpan(&ctx, x + start * scale, y + sy * scale + i, (sx - start) * scale, 0);
+      }
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Renders a QR code symbol, including the quiet zone
+
+    Each module is drawn as a scale x scale square.  The background and
+    quiet zone are cleared with a single filled rectangle, and dark
+    modules are then drawn as horizontal runs, so that each run of
+    adjacent dark modules on a row is a single rectangle fill rather
+    than one fill per module.
+
+    @param[in]  x
+                The horizontal location of the top-left corner of the
+                quiet zone
+    @param[in]  y
+                The vertical location of the top-left corner of the
+                quiet zone
+    @param[in]  qr
+                Pointer to a qrcode_t populated by qrcodeEncode
+    @param[in]  scale
+                The size of a single module in pixels (1 or more)
+    @param[in]  fgColor
+                The RGB565 color to use for dark modules
+    @param[in]  bgColor
+                The RGB565 color to use for light modules and the
+                quiet zone
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/graphic/drawing.h"
+    #include "drivers/displays/qrcode.h"
+
+    static qrcode_t qr;
+    uint8_t work[QRCODE_BUFFER_LEN_MAX];
+    char *url = "http://www.microbuilder.eu";
+
+    if (!qrcodeEncode(&qr, (uint8_t *)url, strlen(url), QRCODE_ECC_LOW, work))
+    {
+      drawQRCode(20, 20, &qr, 4, COLOR_BLACK, COLOR_WHITE);
+    }
+
+    @endcode
+*/
+/**************************************************************************/
+void drawQRCode(uint16_t x, uint16_t y, const qrcode_t *qr, uint8_t scale, uint16_t fgColor, uint16_t bgColor)
+{
+  uint16_t total, left, top;
+  uint8_t  row, col, start;
+
+  if ((qr == NULL) || (scale == 0))
+  {
+    return;
+  }
+
+  // Clear the symbol area and the quiet zone in one go
+  total = (qr->size + QRCODE_QUIETZONE * 2) * scale;
+  drawRectangleFilled(x, y, x + total - 1, y + total - 1, bgColor);
+
+  left = x + QRCODE_QUIETZONE * scale;
+  top = y + QRCODE_QUIETZONE * scale;
+  for (row = 0; row < qr->size; row++)
+  {
+    col = 0;
+    while (col < qr->size)
+    {
+      // Skip light modules
+      if (!qrcodeGetModule(qr, col, row))
+      {
+        col++;
+        continue;
+      }
+      // Find the end of this run of dark modules and render it at once
+      start = col;
+      while ((col < qr->size) && qrcodeGetModule(qr, col, row))
+      {
+        col++;
+      }
+      drawRectangleFilled(left + start * scale, top + row * scale,
+                          left + col * scale - 1, top + (row + 1) * scale - 1,
+                          fgColor);
+    }
+  }
+}
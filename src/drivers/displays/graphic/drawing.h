@@ -44,6 +44,9 @@ extern "C" {
 #include "lcd.h"
 #include "colors.h"
 #include "theme.h"
+#include "drivers/displays/qrcode.h"
+#include "drivers/displays/floodfill.h"
+#include "framebuffer.h"
 
 #if CFG_BSP_TFTLCD_USEAAFONTS
   #include "aafonts.h"
@@ -55,6 +58,8 @@ extern "C" {
   #include "drivers/displays/smallfonts.h"
 #endif
 
+#include "drivers/displays/font.h"
+
 typedef enum
 {
   DRAW_CORNERS_NONE        = 0x00,
@@ -69,6 +74,25 @@ typedef enum
   DRAW_CORNERS_RIGHT       = 0x0A  // 0x02 + 0x08
 } drawCorners_t;
 
+/* Maximum number of edges in a filled path (drawBezierPath) */
+#define DRAW_PATH_MAXEDGES (64)
+
+/* Largest scale factor for drawTextScaled and drawImageScaled */
+#define DRAW_SCALE_MAX (8)
+
+/* Widest glyph (in font pixels) drawTextScaled smooths, wider glyphs are
+   drawn as blocks.  Costs 2 bytes of stack per pixel */
+#define DRAW_SMOOTH_MAXWIDTH (64)
+
+typedef struct
+{
+  uint16_t x;
+  uint16_t y;
+} drawPoint_t;
+
+/* Returns the RGB565 color of pixel sx/sy in an unrotated source image */
+typedef uint16_t (*drawPixelFetch_t)(const void *src, uint16_t sx, uint16_t sy);
+
 typedef enum
 {
   DRAW_DIRECTION_LEFT,
@@ -80,6 +104,10 @@ typedef enum
 void      drawTestPattern      ( void );
 void      drawPixel            ( uint16_t x, uint16_t y, uint16_t color );
 void      drawFill             ( uint16_t color );
+void      drawSetFramebuffer   ( fb_t *fb );
+fb_t     *drawGetFramebuffer   ( void );
+void      drawSetTarget        ( lcdPanel_t *panel );
+lcdPanel_t *drawGetTarget      ( void );
 void      drawLine             ( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color );
 void      drawLineDotted       ( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t space, uint16_t solid, uint16_t color );
 void      drawCircle           ( uint16_t xCenter, uint16_t yCenter, uint16_t radius, uint16_t color );
@@ -94,10 +122,24 @@ void      drawRoundedRectangleFilled ( uint16_t x0, uint16_t y0, uint16_t x1, ui
 void      drawGradient         ( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t startColor, uint16_t endColor );
 void      drawTriangle         ( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color );
 void      drawTriangleFilled   ( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color );
+void      drawBezierQuad       ( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color );
+void      drawBezierCubic      ( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, uint16_t color );
+void      drawBezierPath       ( const drawPoint_t *points, uint16_t count, uint8_t order, bool fill, uint16_t color );
+error_t   drawFloodFill        ( uint16_t x, uint16_t y, uint16_t color );
 void      drawIcon16           ( uint16_t x, uint16_t y, uint16_t color, uint16_t icon[] );
+void      drawIcon16Rotated    ( uint16_t x, uint16_t y, uint16_t color, uint16_t bgColor, const uint16_t icon[], lcdRotation_t rotation );
+void      drawImageRotated     ( uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint16_t *pixels, lcdRotation_t rotation );
+void      drawBlitRotated      ( uint16_t x, uint16_t y, uint16_t width, uint16_t height, lcdRotation_t rotation, drawPixelFetch_t fetch, const void *src );
+void      drawQRCode           ( uint16_t x, uint16_t y, const qrcode_t *qr, uint8_t scale, uint16_t fgColor, uint16_t bgColor );
+uint16_t  drawText             ( uint16_t x, uint16_t y, const font_t *font, const char *str, const uint16_t *colorTable );
+void      drawGlyph            ( uint16_t x, uint16_t y, fontGlyph_t *glyph, const uint16_t *colorTable );
+uint16_t  drawTextScaled       ( uint16_t x, uint16_t y, const font_t *font, const char *str, const uint16_t *colorTable, uint8_t scale, bool smooth );
+void      drawTextOpaque       ( uint16_t x, uint16_t y, const font_t *font, const char *str, const uint16_t *colorTable, lcdRotation_t rotation );
+void      drawImageScaled      ( uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint16_t *pixels, uint8_t scale );
 
 #if CFG_BSP_TFTLCD_INCLUDESMALLFONTS
 void      drawStringSmall      ( uint16_t x, uint16_t y, uint16_t color, char* text, struct FONT_DEF font );
+void      drawStringSmallScaled( uint16_t x, uint16_t y, uint16_t color, char* text, struct FONT_DEF font, uint8_t scale );
 #endif
 
 #ifdef __cplusplus
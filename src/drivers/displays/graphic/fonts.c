@@ -46,50 +46,6 @@
 /*                                                                        */
 /**************************************************************************/
 
-/**************************************************************************/
-/*!
-    @brief  Draws a single bitmap character
-*/
-/**************************************************************************/
-void fontsDrawCharBitmap(const uint16_t xPixel, const uint16_t yPixel, uint16_t color, const char *glyph, uint8_t cols, uint8_t rows)
-{
-  uint16_t currentY, currentX, indexIntoGlyph;
-  uint16_t _row, _col, _colPages;
-
-  // set initial current y
-  currentY = yPixel;
-  currentX = xPixel;
-
-  // Figure out how many columns worth of data we have
-  if (cols % 8)
-    _colPages = cols / 8 + 1;
-  else
-    _colPages = cols / 8;
-
-  for (_row = 0; _row < rows; _row++)
-  {
-    for (_col = 0; _col < _colPages; _col++)
-    {
-      if (_row == 0)
-        indexIntoGlyph = _col;
-      else
-        indexIntoGlyph = (_row * _colPages) + _col;
-
-      currentY = yPixel + _row;
-      currentX = xPixel + (_col*8);
-      // send the data byte
-      if (glyph[indexIntoGlyph] & (0X80)) drawPixel(currentX, currentY, color);
-      if (glyph[indexIntoGlyph] & (0X40)) drawPixel(currentX+1, currentY, color);
-      if (glyph[indexIntoGlyph] & (0X20)) drawPixel(currentX+2, currentY, color);
-      if (glyph[indexIntoGlyph] & (0X10)) drawPixel(currentX+3, currentY, color);
-      if (glyph[indexIntoGlyph] & (0X08)) drawPixel(currentX+4, currentY, color);
-      if (glyph[indexIntoGlyph] & (0X04)) drawPixel(currentX+5, currentY, color);
-      if (glyph[indexIntoGlyph] & (0X02)) drawPixel(currentX+6, currentY, color);
-      if (glyph[indexIntoGlyph] & (0X01)) drawPixel(currentX+7, currentY, color);
-    }
-  }
-}
-
 /**************************************************************************/
 /*                                                                        */
 /* ----------------------- Public Methods ------------------------------- */
@@ -125,54 +81,142 @@ void fontsDrawCharBitmap(const uint16_t xPixel, const uint16_t yPixel, uint16_t
 /**************************************************************************/
 void fontsDrawString(uint16_t x, uint16_t y, uint16_t color, const FONT_INFO *fontInfo, char *str)
 {
-  uint16_t currentX, charWidth, characterToOutput;
-  const FONT_CHAR_INFO *charInfo;
-  uint16_t charOffset;
-
-  // set current x, y to that of requested
-  currentX = x;
-
-  // while not NULL
-  while (*str != '\0')
-  {
-    // get character to output
-    characterToOutput = *str;
-    
-    // get char info
-    charInfo = fontInfo->charInfo;
-    
-    // some fonts have character descriptors, some don't
-    if (charInfo != NULL)
-    {
-      // get correct char offset
-      charInfo += (characterToOutput - fontInfo->startChar);
-      
-      // get width from char info
-      charWidth = charInfo->widthBits;
-      
-      // get offset from char info
-      charOffset = charInfo->offset;
-    }        
-    else
-    {
-      // if no char info, char width is always 5
-      charWidth = 5;
-      
-      // char offset - assume 5 * letter offset
-      charOffset = (characterToOutput - fontInfo->startChar) * 5;
-    }        
-    
-    // Send individual characters
-    // We need to manually calculate width in pages since this is screwy with variable width fonts
-    //uint8_t heightPages = charWidth % 8 ? charWidth / 8 : charWidth / 8 + 1;
-    fontsDrawCharBitmap(currentX, y, color, (const char *)(&fontInfo->data[charOffset]), charWidth, fontInfo->height);
+  font_t   font = FONT_BITMAP(fontInfo);
+  uint16_t colorTable[2] = { color, color };
 
-    // next char X
-    currentX += charWidth + 1;
-    
-    // next char
-    str++;
-  }
+  drawText(x, y, &font, str, colorTable);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws a string on a solid background, writing every pixel
+
+    fontsDrawString only writes the set pixels of each glyph, one
+    lcdDrawPixel transaction at a time.  When the background color is
+    known it is much cheaper to set a single window around the whole
+    string and stream every pixel, including the background and the
+    blank column between characters, in one burst.  The string is
+    clipped to the screen.
+
+    The pixels go straight to the panel, even if a framebuffer was
+    selected with drawSetFramebuffer.
+
+    @param[in]  x
+                Starting x co-ordinate
+    @param[in]  y
+                Starting y co-ordinate
+    @param[in]  color
+                Color to use when rendering the font
+    @param[in]  bgColor
+                Background color of the string
+    @param[in]  fontInfo
+                Pointer to the FONT_INFO to use when drawing the string
+    @param[in]  str
+                The string to render
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/graphic/fonts/dejavusans9.h"
+
+    // Refresh a status line without clearing it first
+    fontsDrawStringOpaque(0, 90, COLOR_BLACK, COLOR_WHITE, &dejaVuSans9ptFontInfo, "Battery: 87%");
+
+    @endcode
+*/
+/**************************************************************************/
+void fontsDrawStringOpaque(uint16_t x, uint16_t y, uint16_t color, uint16_t bgColor, const FONT_INFO *fontInfo, char *str)
+{
+  fontsDrawStringRotated(x, y, color, bgColor, fontInfo, str, LCD_ROTATION_0);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws a string rotated clockwise by 90, 180 or 270 degrees,
+            for vertical axis labels and rotated captions
+
+    The glyph data is walked in rotated order, and each character cell
+    (including the blank column between characters) goes out as a
+    single window burst, so this doesn't depend on lcdSetOrientation.
+    Since the whole cell is written, the text is drawn on a solid
+    bgColor background.
+
+    @param[in]  x
+                Left edge of the rotated string on the screen
+    @param[in]  y
+                Top edge of the rotated string on the screen
+    @param[in]  color
+                Color to use when rendering the font
+    @param[in]  bgColor
+                Background color of the character cells
+    @param[in]  fontInfo
+                Pointer to the FONT_INFO to use when drawing the string
+    @param[in]  str
+                The string to render
+    @param[in]  rotation
+                LCD_ROTATION_90 reads top to bottom, LCD_ROTATION_270
+                reads bottom to top, and LCD_ROTATION_180 is upside down
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/graphic/fonts/dejavusans9.h"
+
+    // Y axis label, reading bottom to top along the left edge
+    fontsDrawStringRotated(0, 40, COLOR_BLACK, COLOR_WHITE, &dejaVuSans9ptFontInfo, "Temperature", LCD_ROTATION_270);
+
+    @endcode
+*/
+/**************************************************************************/
+void fontsDrawStringRotated(uint16_t x, uint16_t y, uint16_t color, uint16_t bgColor, const FONT_INFO *fontInfo, char *str, lcdRotation_t rotation)
+{
+  font_t   font = FONT_BITMAP(fontInfo);
+  uint16_t colorTable[2] = { bgColor, color };
+
+  drawTextOpaque(x, y, &font, str, colorTable, rotation);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws a string scaled up by a whole number
+
+    Each pixel of the font becomes a scale x scale block, drawn a run
+    at a time (see drawTextScaled), so large numerals can be drawn from
+    a small font without any extra flash.
+
+    @param[in]  x
+                Starting x co-ordinate
+    @param[in]  y
+                Starting y co-ordinate
+    @param[in]  color
+                Color to use when rendering the font
+    @param[in]  fontInfo
+                Pointer to the FONT_INFO to use when drawing the string
+    @param[in]  str
+                The string to render
+    @param[in]  scale
+                Scale factor, 1 to DRAW_SCALE_MAX
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/graphic/fonts/dejavusansbold9.h"
+
+    // 3x size, the string is 3 * fontsGetStringWidth pixels wide
+    fontsDrawStringScaled(0, 40, COLOR_BLACK, &dejaVuSansBold9ptFontInfo, "21.5", 3);
+
+    @endcode
+*/
+/**************************************************************************/
+void fontsDrawStringScaled(uint16_t x, uint16_t y, uint16_t color, const FONT_INFO *fontInfo, char *str, uint8_t scale)
+{
+  font_t   font = FONT_BITMAP(fontInfo);
+  uint16_t colorTable[2] = { color, color };
+
+  drawTextScaled(x, y, &font, str, colorTable, scale, false);
 }
 
 /**************************************************************************/
@@ -196,24 +240,7 @@ void fontsDrawString(uint16_t x, uint16_t y, uint16_t color, const FONT_INFO *fo
 /**************************************************************************/
 uint16_t fontsGetStringWidth(const FONT_INFO *fontInfo, char *str)
 {
-  uint16_t width = 0;
-  uint32_t currChar;
-  uint32_t startChar = fontInfo->startChar;
-
-  // until termination
-  for (currChar = *str; currChar; currChar = *(++str))
-  {
-    // if char info exists for the font, use width from there
-    if (fontInfo->charInfo != NULL)
-    {
-      width += fontInfo->charInfo[currChar - startChar].widthBits + 1;
-    }
-    else
-    {
-      width += 5 + 1;
-    }
-  }
-
-  /* return the width */
-  return width > 0 ? width - 1 : width;
+  font_t font = FONT_BITMAP(fontInfo);
+
+  return fontGetStringWidth(&font, str);
 }
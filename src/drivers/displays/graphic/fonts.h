@@ -41,6 +41,7 @@ extern "C" {
 #endif
 
 #include "bspconfig.h"
+#include "lcd.h"
 
 /**************************************************************************/
 /*! 
@@ -53,6 +54,18 @@ typedef struct
   const uint16_t offset;                // offset of the character's bitmap, in bytes, into the the FONT_INFO's data array
 } FONT_CHAR_INFO;	
 
+/**************************************************************************/
+/*! 
+    @brief Describes which rows of a character its bitmap covers, for
+           fonts with blank rows trimmed from the bitmaps
+*/
+/**************************************************************************/
+typedef struct
+{
+  const uint8_t yOffset;                // first row of the character covered by the bitmap
+  const uint8_t height;                 // rows in the bitmap, the rest of the character is blank
+} FONT_CHAR_METRICS;
+
 /**************************************************************************/
 /*! 
     @brief Describes a single font
@@ -65,9 +78,13 @@ typedef struct
   const uint8_t           endChar;      // the last character in the font (e.g. in charInfo and data)
   const FONT_CHAR_INFO*	  charInfo;     // pointer to array of char information
   const uint8_t*          data;         // pointer to generated array of character visual representation
+  const FONT_CHAR_METRICS* metrics;     // rows covered by each bitmap, or NULL if every bitmap is 'height' rows
 } FONT_INFO;
 
 void      fontsDrawString      ( uint16_t x, uint16_t y, uint16_t color, const FONT_INFO *fontInfo, char *str );
+void      fontsDrawStringOpaque ( uint16_t x, uint16_t y, uint16_t color, uint16_t bgColor, const FONT_INFO *fontInfo, char *str );
+void      fontsDrawStringRotated ( uint16_t x, uint16_t y, uint16_t color, uint16_t bgColor, const FONT_INFO *fontInfo, char *str, lcdRotation_t rotation );
+void      fontsDrawStringScaled ( uint16_t x, uint16_t y, uint16_t color, const FONT_INFO *fontInfo, char *str, uint8_t scale );
 uint16_t  fontsGetStringWidth  ( const FONT_INFO *fontInfo, char *str ); 
 
 #ifdef __cplusplus
@@ -7,23 +7,7 @@
 /* Character bitmaps for DejaVu Sans 9pt */
 const uint8_t dejaVuSans9ptBitmaps[] = 
 {
-	/* @0 ' ' (5 pixels wide) */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-
-	/* @13 '!' (1 pixels wide) */
-	0x00, /*          */
+	/* @0 '!' (1 pixels wide) */
 	0x80, /* #        */
 	0x80, /* #        */
 	0x80, /* #        */
@@ -33,28 +17,13 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x00, /*          */
 	0x80, /* #        */
 	0x80, /* #        */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @26 '"' (3 pixels wide) */
-	0x00, /*          */
+	/* @9 '"' (3 pixels wide) */
 	0xA0, /* # #      */
 	0xA0, /* # #      */
 	0xA0, /* # #      */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @39 '#' (8 pixels wide) */
-	0x00, /*          */
-	0x00, /*          */
+	/* @12 '#' (8 pixels wide) */
 	0x12, /*    #  #  */
 	0x14, /*    # #   */
 	0x7F, /*  ####### */
@@ -63,12 +32,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0xFE, /* #######  */
 	0x28, /*   # #    */
 	0x48, /*  #  #    */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @52 '$' (5 pixels wide) */
-	0x00, /*          */
+	/* @20 '$' (5 pixels wide) */
 	0x20, /*   #      */
 	0x70, /*  ###     */
 	0xA8, /* # # #    */
@@ -80,10 +45,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x70, /*  ###     */
 	0x20, /*   #      */
 	0x20, /*   #      */
-	0x00, /*          */
 
-	/* @65 '%' (10 pixels wide) */
-	0x00, 0x00, /*                  */
+	/* @31 '%' (10 pixels wide) */
 	0x61, 0x00, /*  ##    #         */
 	0x92, 0x00, /* #  #  #          */
 	0x92, 0x00, /* #  #  #          */
@@ -93,12 +56,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x12, 0x40, /*    #  #  #       */
 	0x12, 0x40, /*    #  #  #       */
 	0x21, 0x80, /*   #    ##        */
-	0x00, 0x00, /*                  */
-	0x00, 0x00, /*                  */
-	0x00, 0x00, /*                  */
 
-	/* @91 '&' (8 pixels wide) */
-	0x00, /*          */
+	/* @49 '&' (8 pixels wide) */
 	0x30, /*   ##     */
 	0x48, /*  #  #    */
 	0x40, /*  #       */
@@ -108,26 +67,13 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x86, /* #    ##  */
 	0xC4, /* ##   #   */
 	0x7B, /*  #### ## */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @104 ''' (1 pixels wide) */
-	0x00, /*          */
+	/* @58 ''' (1 pixels wide) */
 	0x80, /* #        */
 	0x80, /* #        */
 	0x80, /* #        */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @117 '(' (3 pixels wide) */
+	/* @61 '(' (3 pixels wide) */
 	0x60, /*  ##      */
 	0x40, /*  #       */
 	0x40, /*  #       */
@@ -139,10 +85,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x40, /*  #       */
 	0x40, /*  #       */
 	0x60, /*  ##      */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @130 ')' (3 pixels wide) */
+	/* @72 ')' (3 pixels wide) */
 	0xC0, /* ##       */
 	0x40, /*  #       */
 	0x40, /*  #       */
@@ -154,28 +98,16 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x40, /*  #       */
 	0x40, /*  #       */
 	0xC0, /* ##       */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @143 '*' (5 pixels wide) */
-	0x00, /*          */
+	/* @83 '*' (5 pixels wide) */
 	0x20, /*   #      */
 	0xA8, /* # # #    */
 	0x70, /*  ###     */
 	0x70, /*  ###     */
 	0xA8, /* # # #    */
 	0x20, /*   #      */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @156 '+' (7 pixels wide) */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
+	/* @89 '+' (7 pixels wide) */
 	0x10, /*    #     */
 	0x10, /*    #     */
 	0x10, /*    #     */
@@ -183,57 +115,20 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x10, /*    #     */
 	0x10, /*    #     */
 	0x10, /*    #     */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @169 ',' (1 pixels wide) */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
+	/* @96 ',' (1 pixels wide) */
 	0x80, /* #        */
 	0x80, /* #        */
 	0x80, /* #        */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @182 '-' (3 pixels wide) */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
+	/* @99 '-' (3 pixels wide) */
 	0xE0, /* ###      */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @195 '.' (1 pixels wide) */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
+	/* @100 '.' (1 pixels wide) */
 	0x80, /* #        */
 	0x80, /* #        */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @208 '/' (4 pixels wide) */
-	0x00, /*          */
+	/* @102 '/' (4 pixels wide) */
 	0x10, /*    #     */
 	0x10, /*    #     */
 	0x20, /*   #      */
@@ -244,11 +139,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x40, /*  #       */
 	0x80, /* #        */
 	0x80, /* #        */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @221 '0' (6 pixels wide) */
-	0x00, /*          */
+	/* @112 '0' (6 pixels wide) */
 	0x78, /*  ####    */
 	0x48, /*  #  #    */
 	0x84, /* #    #   */
@@ -258,12 +150,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x84, /* #    #   */
 	0x48, /*  #  #    */
 	0x78, /*  ####    */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @234 '1' (5 pixels wide) */
-	0x00, /*          */
+	/* @121 '1' (5 pixels wide) */
 	0xE0, /* ###      */
 	0x20, /*   #      */
 	0x20, /*   #      */
@@ -273,12 +161,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x20, /*   #      */
 	0x20, /*   #      */
 	0xF8, /* #####    */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @247 '2' (6 pixels wide) */
-	0x00, /*          */
+	/* @130 '2' (6 pixels wide) */
 	0x78, /*  ####    */
 	0x8C, /* #   ##   */
 	0x04, /*      #   */
@@ -288,12 +172,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x20, /*   #      */
 	0x40, /*  #       */
 	0xFC, /* ######   */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @260 '3' (6 pixels wide) */
-	0x00, /*          */
+	/* @139 '3' (6 pixels wide) */
 	0x78, /*  ####    */
 	0x84, /* #    #   */
 	0x04, /*      #   */
@@ -303,12 +183,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x04, /*      #   */
 	0x84, /* #    #   */
 	0x78, /*  ####    */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @273 '4' (6 pixels wide) */
-	0x00, /*          */
+	/* @148 '4' (6 pixels wide) */
 	0x18, /*    ##    */
 	0x18, /*    ##    */
 	0x28, /*   # #    */
@@ -318,12 +194,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0xFC, /* ######   */
 	0x08, /*     #    */
 	0x08, /*     #    */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @286 '5' (6 pixels wide) */
-	0x00, /*          */
+	/* @157 '5' (6 pixels wide) */
 	0xF8, /* #####    */
 	0x80, /* #        */
 	0x80, /* #        */
@@ -333,12 +205,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x04, /*      #   */
 	0x8C, /* #   ##   */
 	0x78, /*  ####    */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @299 '6' (6 pixels wide) */
-	0x00, /*          */
+	/* @166 '6' (6 pixels wide) */
 	0x38, /*   ###    */
 	0x44, /*  #   #   */
 	0x80, /* #        */
@@ -348,12 +216,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x84, /* #    #   */
 	0x4C, /*  #  ##   */
 	0x78, /*  ####    */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @312 '7' (6 pixels wide) */
-	0x00, /*          */
+	/* @175 '7' (6 pixels wide) */
 	0xFC, /* ######   */
 	0x04, /*      #   */
 	0x08, /*     #    */
@@ -363,12 +227,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x20, /*   #      */
 	0x20, /*   #      */
 	0x40, /*  #       */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @325 '8' (6 pixels wide) */
-	0x00, /*          */
+	/* @184 '8' (6 pixels wide) */
 	0x78, /*  ####    */
 	0x84, /* #    #   */
 	0x84, /* #    #   */
@@ -378,12 +238,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x84, /* #    #   */
 	0x84, /* #    #   */
 	0x78, /*  ####    */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @338 '9' (6 pixels wide) */
-	0x00, /*          */
+	/* @193 '9' (6 pixels wide) */
 	0x78, /*  ####    */
 	0xC8, /* ##  #    */
 	0x84, /* #    #   */
@@ -393,30 +249,16 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x04, /*      #   */
 	0x88, /* #   #    */
 	0x70, /*  ###     */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @351 ':' (1 pixels wide) */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
+	/* @202 ':' (1 pixels wide) */
 	0x80, /* #        */
 	0x80, /* #        */
 	0x00, /*          */
 	0x00, /*          */
 	0x80, /* #        */
 	0x80, /* #        */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @364 ';' (1 pixels wide) */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
+	/* @208 ';' (1 pixels wide) */
 	0x80, /* #        */
 	0x80, /* #        */
 	0x00, /*          */
@@ -424,56 +266,29 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x80, /* #        */
 	0x80, /* #        */
 	0x80, /* #        */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @377 '<' (8 pixels wide) */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
+	/* @215 '<' (8 pixels wide) */
 	0x03, /*       ## */
 	0x1E, /*    ####  */
 	0xE0, /* ###      */
 	0xE0, /* ###      */
 	0x1E, /*    ####  */
 	0x03, /*       ## */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @390 '=' (8 pixels wide) */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
+	/* @221 '=' (8 pixels wide) */
 	0xFF, /* ######## */
 	0x00, /*          */
 	0xFF, /* ######## */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @403 '>' (8 pixels wide) */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
+	/* @224 '>' (8 pixels wide) */
 	0xC0, /* ##       */
 	0x78, /*  ####    */
 	0x07, /*      ### */
 	0x07, /*      ### */
 	0x78, /*  ####    */
 	0xC0, /* ##       */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @416 '?' (5 pixels wide) */
-	0x00, /*          */
+	/* @230 '?' (5 pixels wide) */
 	0x70, /*  ###     */
 	0x88, /* #   #    */
 	0x08, /*     #    */
@@ -483,12 +298,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x00, /*          */
 	0x20, /*   #      */
 	0x20, /*   #      */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @429 '@' (11 pixels wide) */
-	0x00, 0x00, /*                  */
+	/* @239 '@' (11 pixels wide) */
 	0x1F, 0x00, /*    #####         */
 	0x20, 0xC0, /*   #     ##       */
 	0x40, 0x40, /*  #       #       */
@@ -500,10 +311,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x40, 0x00, /*  #               */
 	0x20, 0x80, /*   #     #        */
 	0x1F, 0x00, /*    #####         */
-	0x00, 0x00, /*                  */
 
-	/* @455 'A' (8 pixels wide) */
-	0x00, /*          */
+	/* @261 'A' (8 pixels wide) */
 	0x18, /*    ##    */
 	0x18, /*    ##    */
 	0x24, /*   #  #   */
@@ -513,12 +322,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x7E, /*  ######  */
 	0x42, /*  #    #  */
 	0x81, /* #      # */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @468 'B' (6 pixels wide) */
-	0x00, /*          */
+	/* @270 'B' (6 pixels wide) */
 	0xF8, /* #####    */
 	0x84, /* #    #   */
 	0x84, /* #    #   */
@@ -528,12 +333,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x84, /* #    #   */
 	0x84, /* #    #   */
 	0xF8, /* #####    */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @481 'C' (6 pixels wide) */
-	0x00, /*          */
+	/* @279 'C' (6 pixels wide) */
 	0x38, /*   ###    */
 	0x44, /*  #   #   */
 	0x80, /* #        */
@@ -543,12 +344,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x80, /* #        */
 	0x44, /*  #   #   */
 	0x38, /*   ###    */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @494 'D' (7 pixels wide) */
-	0x00, /*          */
+	/* @288 'D' (7 pixels wide) */
 	0xF8, /* #####    */
 	0x84, /* #    #   */
 	0x82, /* #     #  */
@@ -558,12 +355,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x82, /* #     #  */
 	0x84, /* #    #   */
 	0xF8, /* #####    */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @507 'E' (6 pixels wide) */
-	0x00, /*          */
+	/* @297 'E' (6 pixels wide) */
 	0xFC, /* ######   */
 	0x80, /* #        */
 	0x80, /* #        */
@@ -573,12 +366,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x80, /* #        */
 	0x80, /* #        */
 	0xFC, /* ######   */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @520 'F' (5 pixels wide) */
-	0x00, /*          */
+	/* @306 'F' (5 pixels wide) */
 	0xF8, /* #####    */
 	0x80, /* #        */
 	0x80, /* #        */
@@ -588,12 +377,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x80, /* #        */
 	0x80, /* #        */
 	0x80, /* #        */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @533 'G' (7 pixels wide) */
-	0x00, /*          */
+	/* @315 'G' (7 pixels wide) */
 	0x3C, /*   ####   */
 	0x42, /*  #    #  */
 	0x80, /* #        */
@@ -603,12 +388,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x82, /* #     #  */
 	0x42, /*  #    #  */
 	0x3C, /*   ####   */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @546 'H' (7 pixels wide) */
-	0x00, /*          */
+	/* @324 'H' (7 pixels wide) */
 	0x82, /* #     #  */
 	0x82, /* #     #  */
 	0x82, /* #     #  */
@@ -618,12 +399,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x82, /* #     #  */
 	0x82, /* #     #  */
 	0x82, /* #     #  */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @559 'I' (1 pixels wide) */
-	0x00, /*          */
+	/* @333 'I' (1 pixels wide) */
 	0x80, /* #        */
 	0x80, /* #        */
 	0x80, /* #        */
@@ -633,12 +410,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x80, /* #        */
 	0x80, /* #        */
 	0x80, /* #        */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @572 'J' (3 pixels wide) */
-	0x00, /*          */
+	/* @342 'J' (3 pixels wide) */
 	0x20, /*   #      */
 	0x20, /*   #      */
 	0x20, /*   #      */
@@ -650,10 +423,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x20, /*   #      */
 	0x20, /*   #      */
 	0xC0, /* ##       */
-	0x00, /*          */
 
-	/* @585 'K' (6 pixels wide) */
-	0x00, /*          */
+	/* @353 'K' (6 pixels wide) */
 	0x84, /* #    #   */
 	0x88, /* #   #    */
 	0x90, /* #  #     */
@@ -663,12 +434,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x90, /* #  #     */
 	0x88, /* #   #    */
 	0x84, /* #    #   */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @598 'L' (5 pixels wide) */
-	0x00, /*          */
+	/* @362 'L' (5 pixels wide) */
 	0x80, /* #        */
 	0x80, /* #        */
 	0x80, /* #        */
@@ -678,12 +445,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x80, /* #        */
 	0x80, /* #        */
 	0xF8, /* #####    */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @611 'M' (8 pixels wide) */
-	0x00, /*          */
+	/* @371 'M' (8 pixels wide) */
 	0x81, /* #      # */
 	0xC3, /* ##    ## */
 	0xC3, /* ##    ## */
@@ -693,12 +456,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x99, /* #  ##  # */
 	0x81, /* #      # */
 	0x81, /* #      # */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @624 'N' (7 pixels wide) */
-	0x00, /*          */
+	/* @380 'N' (7 pixels wide) */
 	0xC2, /* ##    #  */
 	0xC2, /* ##    #  */
 	0xA2, /* # #   #  */
@@ -708,12 +467,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x8A, /* #   # #  */
 	0x86, /* #    ##  */
 	0x86, /* #    ##  */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @637 'O' (7 pixels wide) */
-	0x00, /*          */
+	/* @389 'O' (7 pixels wide) */
 	0x38, /*   ###    */
 	0x44, /*  #   #   */
 	0x82, /* #     #  */
@@ -723,12 +478,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x82, /* #     #  */
 	0x44, /*  #   #   */
 	0x38, /*   ###    */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @650 'P' (6 pixels wide) */
-	0x00, /*          */
+	/* @398 'P' (6 pixels wide) */
 	0xF8, /* #####    */
 	0x84, /* #    #   */
 	0x84, /* #    #   */
@@ -738,12 +489,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x80, /* #        */
 	0x80, /* #        */
 	0x80, /* #        */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @663 'Q' (7 pixels wide) */
-	0x00, /*          */
+	/* @407 'Q' (7 pixels wide) */
 	0x38, /*   ###    */
 	0x44, /*  #   #   */
 	0x82, /* #     #  */
@@ -755,10 +502,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x38, /*   ###    */
 	0x08, /*     #    */
 	0x04, /*      #   */
-	0x00, /*          */
 
-	/* @676 'R' (7 pixels wide) */
-	0x00, /*          */
+	/* @418 'R' (7 pixels wide) */
 	0xF8, /* #####    */
 	0x84, /* #    #   */
 	0x84, /* #    #   */
@@ -768,12 +513,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x84, /* #    #   */
 	0x84, /* #    #   */
 	0x82, /* #     #  */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @689 'S' (6 pixels wide) */
-	0x00, /*          */
+	/* @427 'S' (6 pixels wide) */
 	0x78, /*  ####    */
 	0x84, /* #    #   */
 	0x80, /* #        */
@@ -783,12 +524,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x04, /*      #   */
 	0x84, /* #    #   */
 	0x78, /*  ####    */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @702 'T' (7 pixels wide) */
-	0x00, /*          */
+	/* @436 'T' (7 pixels wide) */
 	0xFE, /* #######  */
 	0x10, /*    #     */
 	0x10, /*    #     */
@@ -798,12 +535,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x10, /*    #     */
 	0x10, /*    #     */
 	0x10, /*    #     */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @715 'U' (7 pixels wide) */
-	0x00, /*          */
+	/* @445 'U' (7 pixels wide) */
 	0x82, /* #     #  */
 	0x82, /* #     #  */
 	0x82, /* #     #  */
@@ -813,12 +546,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x82, /* #     #  */
 	0xC6, /* ##   ##  */
 	0x7C, /*  #####   */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @728 'V' (8 pixels wide) */
-	0x00, /*          */
+	/* @454 'V' (8 pixels wide) */
 	0x81, /* #      # */
 	0x81, /* #      # */
 	0x42, /*  #    #  */
@@ -828,12 +557,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x24, /*   #  #   */
 	0x18, /*    ##    */
 	0x18, /*    ##    */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @741 'W' (11 pixels wide) */
-	0x00, 0x00, /*                  */
+	/* @463 'W' (11 pixels wide) */
 	0x84, 0x20, /* #    #    #      */
 	0x44, 0x40, /*  #   #   #       */
 	0x44, 0x40, /*  #   #   #       */
@@ -843,12 +568,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x2A, 0x80, /*   # # # #        */
 	0x11, 0x00, /*    #   #         */
 	0x11, 0x00, /*    #   #         */
-	0x00, 0x00, /*                  */
-	0x00, 0x00, /*                  */
-	0x00, 0x00, /*                  */
 
-	/* @767 'X' (7 pixels wide) */
-	0x00, /*          */
+	/* @481 'X' (7 pixels wide) */
 	0xC6, /* ##   ##  */
 	0x44, /*  #   #   */
 	0x28, /*   # #    */
@@ -858,12 +579,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x28, /*   # #    */
 	0x44, /*  #   #   */
 	0x82, /* #     #  */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @780 'Y' (7 pixels wide) */
-	0x00, /*          */
+	/* @490 'Y' (7 pixels wide) */
 	0x82, /* #     #  */
 	0x44, /*  #   #   */
 	0x44, /*  #   #   */
@@ -873,12 +590,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x10, /*    #     */
 	0x10, /*    #     */
 	0x10, /*    #     */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @793 'Z' (7 pixels wide) */
-	0x00, /*          */
+	/* @499 'Z' (7 pixels wide) */
 	0xFE, /* #######  */
 	0x02, /*       #  */
 	0x04, /*      #   */
@@ -888,12 +601,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x40, /*  #       */
 	0x80, /* #        */
 	0xFE, /* #######  */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @806 '[' (2 pixels wide) */
-	0x00, /*          */
+	/* @508 '[' (2 pixels wide) */
 	0xC0, /* ##       */
 	0x80, /* #        */
 	0x80, /* #        */
@@ -905,10 +614,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x80, /* #        */
 	0x80, /* #        */
 	0xC0, /* ##       */
-	0x00, /*          */
 
-	/* @819 '\' (4 pixels wide) */
-	0x00, /*          */
+	/* @519 '\' (4 pixels wide) */
 	0x80, /* #        */
 	0x80, /* #        */
 	0x40, /*  #       */
@@ -919,11 +626,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x20, /*   #      */
 	0x10, /*    #     */
 	0x10, /*    #     */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @832 ']' (2 pixels wide) */
-	0x00, /*          */
+	/* @529 ']' (2 pixels wide) */
 	0xC0, /* ##       */
 	0x40, /*  #       */
 	0x40, /*  #       */
@@ -935,57 +639,20 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x40, /*  #       */
 	0x40, /*  #       */
 	0xC0, /* ##       */
-	0x00, /*          */
 
-	/* @845 '^' (6 pixels wide) */
-	0x00, /*          */
+	/* @540 '^' (6 pixels wide) */
 	0x30, /*   ##     */
 	0x48, /*  #  #    */
 	0x84, /* #    #   */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @858 '_' (6 pixels wide) */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
+	/* @543 '_' (6 pixels wide) */
 	0xFC, /* ######   */
 
-	/* @871 '`' (2 pixels wide) */
+	/* @544 '`' (2 pixels wide) */
 	0x80, /* #        */
 	0x40, /*  #       */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @884 'a' (6 pixels wide) */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
+	/* @546 'a' (6 pixels wide) */
 	0x78, /*  ####    */
 	0x84, /* #    #   */
 	0x04, /*      #   */
@@ -993,11 +660,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x84, /* #    #   */
 	0x8C, /* #   ##   */
 	0x74, /*  ### #   */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @897 'b' (6 pixels wide) */
+	/* @553 'b' (6 pixels wide) */
 	0x80, /* #        */
 	0x80, /* #        */
 	0x80, /* #        */
@@ -1008,14 +672,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x84, /* #    #   */
 	0xCC, /* ##  ##   */
 	0xF8, /* #####    */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @910 'c' (5 pixels wide) */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
+	/* @563 'c' (5 pixels wide) */
 	0x70, /*  ###     */
 	0xC8, /* ##  #    */
 	0x80, /* #        */
@@ -1023,11 +681,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x80, /* #        */
 	0xC8, /* ##  #    */
 	0x70, /*  ###     */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @923 'd' (6 pixels wide) */
+	/* @570 'd' (6 pixels wide) */
 	0x04, /*      #   */
 	0x04, /*      #   */
 	0x04, /*      #   */
@@ -1038,14 +693,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x84, /* #    #   */
 	0xCC, /* ##  ##   */
 	0x7C, /*  #####   */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @936 'e' (6 pixels wide) */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
+	/* @580 'e' (6 pixels wide) */
 	0x78, /*  ####    */
 	0xCC, /* ##  ##   */
 	0x84, /* #    #   */
@@ -1053,11 +702,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x80, /* #        */
 	0xC4, /* ##   #   */
 	0x38, /*   ###    */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @949 'f' (4 pixels wide) */
+	/* @587 'f' (4 pixels wide) */
 	0x30, /*   ##     */
 	0x40, /*  #       */
 	0x40, /*  #       */
@@ -1068,14 +714,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x40, /*  #       */
 	0x40, /*  #       */
 	0x40, /*  #       */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @962 'g' (6 pixels wide) */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
+	/* @597 'g' (6 pixels wide) */
 	0x7C, /*  #####   */
 	0xCC, /* ##  ##   */
 	0x84, /* #    #   */
@@ -1087,7 +727,7 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x4C, /*  #  ##   */
 	0x38, /*   ###    */
 
-	/* @975 'h' (6 pixels wide) */
+	/* @607 'h' (6 pixels wide) */
 	0x80, /* #        */
 	0x80, /* #        */
 	0x80, /* #        */
@@ -1098,12 +738,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x84, /* #    #   */
 	0x84, /* #    #   */
 	0x84, /* #    #   */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @988 'i' (1 pixels wide) */
-	0x00, /*          */
+	/* @617 'i' (1 pixels wide) */
 	0x80, /* #        */
 	0x00, /*          */
 	0x80, /* #        */
@@ -1113,12 +749,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x80, /* #        */
 	0x80, /* #        */
 	0x80, /* #        */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @1001 'j' (2 pixels wide) */
-	0x00, /*          */
+	/* @626 'j' (2 pixels wide) */
 	0x40, /*  #       */
 	0x00, /*          */
 	0x40, /*  #       */
@@ -1132,7 +764,7 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x40, /*  #       */
 	0xC0, /* ##       */
 
-	/* @1014 'k' (5 pixels wide) */
+	/* @638 'k' (5 pixels wide) */
 	0x80, /* #        */
 	0x80, /* #        */
 	0x80, /* #        */
@@ -1143,11 +775,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0xA0, /* # #      */
 	0x90, /* #  #     */
 	0x88, /* #   #    */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @1027 'l' (1 pixels wide) */
+	/* @648 'l' (1 pixels wide) */
 	0x80, /* #        */
 	0x80, /* #        */
 	0x80, /* #        */
@@ -1158,14 +787,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x80, /* #        */
 	0x80, /* #        */
 	0x80, /* #        */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @1040 'm' (9 pixels wide) */
-	0x00, 0x00, /*                  */
-	0x00, 0x00, /*                  */
-	0x00, 0x00, /*                  */
+	/* @658 'm' (9 pixels wide) */
 	0xF7, 0x00, /* #### ###         */
 	0x88, 0x80, /* #   #   #        */
 	0x88, 0x80, /* #   #   #        */
@@ -1173,14 +796,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x88, 0x80, /* #   #   #        */
 	0x88, 0x80, /* #   #   #        */
 	0x88, 0x80, /* #   #   #        */
-	0x00, 0x00, /*                  */
-	0x00, 0x00, /*                  */
-	0x00, 0x00, /*                  */
 
-	/* @1066 'n' (6 pixels wide) */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
+	/* @672 'n' (6 pixels wide) */
 	0xB8, /* # ###    */
 	0xC4, /* ##   #   */
 	0x84, /* #    #   */
@@ -1188,14 +805,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x84, /* #    #   */
 	0x84, /* #    #   */
 	0x84, /* #    #   */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @1079 'o' (6 pixels wide) */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
+	/* @679 'o' (6 pixels wide) */
 	0x78, /*  ####    */
 	0xCC, /* ##  ##   */
 	0x84, /* #    #   */
@@ -1203,14 +814,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x84, /* #    #   */
 	0xCC, /* ##  ##   */
 	0x78, /*  ####    */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @1092 'p' (6 pixels wide) */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
+	/* @686 'p' (6 pixels wide) */
 	0xF8, /* #####    */
 	0xCC, /* ##  ##   */
 	0x84, /* #    #   */
@@ -1222,10 +827,7 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x80, /* #        */
 	0x80, /* #        */
 
-	/* @1105 'q' (6 pixels wide) */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
+	/* @696 'q' (6 pixels wide) */
 	0x7C, /*  #####   */
 	0xCC, /* ##  ##   */
 	0x84, /* #    #   */
@@ -1237,10 +839,7 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x04, /*      #   */
 	0x04, /*      #   */
 
-	/* @1118 'r' (4 pixels wide) */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
+	/* @706 'r' (4 pixels wide) */
 	0xB0, /* # ##     */
 	0xC0, /* ##       */
 	0x80, /* #        */
@@ -1248,14 +847,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x80, /* #        */
 	0x80, /* #        */
 	0x80, /* #        */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @1131 's' (5 pixels wide) */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
+	/* @713 's' (5 pixels wide) */
 	0x70, /*  ###     */
 	0x88, /* #   #    */
 	0x80, /* #        */
@@ -1263,12 +856,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x08, /*     #    */
 	0x88, /* #   #    */
 	0x70, /*  ###     */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @1144 't' (4 pixels wide) */
-	0x00, /*          */
+	/* @720 't' (4 pixels wide) */
 	0x40, /*  #       */
 	0x40, /*  #       */
 	0xF0, /* ####     */
@@ -1278,14 +867,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x40, /*  #       */
 	0x40, /*  #       */
 	0x70, /*  ###     */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @1157 'u' (6 pixels wide) */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
+	/* @729 'u' (6 pixels wide) */
 	0x84, /* #    #   */
 	0x84, /* #    #   */
 	0x84, /* #    #   */
@@ -1293,14 +876,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x84, /* #    #   */
 	0x8C, /* #   ##   */
 	0x74, /*  ### #   */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @1170 'v' (6 pixels wide) */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
+	/* @736 'v' (6 pixels wide) */
 	0x84, /* #    #   */
 	0x84, /* #    #   */
 	0x48, /*  #  #    */
@@ -1308,14 +885,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x48, /*  #  #    */
 	0x30, /*   ##     */
 	0x30, /*   ##     */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @1183 'w' (9 pixels wide) */
-	0x00, 0x00, /*                  */
-	0x00, 0x00, /*                  */
-	0x00, 0x00, /*                  */
+	/* @743 'w' (9 pixels wide) */
 	0x88, 0x80, /* #   #   #        */
 	0x88, 0x80, /* #   #   #        */
 	0x55, 0x00, /*  # # # #         */
@@ -1323,14 +894,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x55, 0x00, /*  # # # #         */
 	0x22, 0x00, /*   #   #          */
 	0x22, 0x00, /*   #   #          */
-	0x00, 0x00, /*                  */
-	0x00, 0x00, /*                  */
-	0x00, 0x00, /*                  */
 
-	/* @1209 'x' (6 pixels wide) */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
+	/* @757 'x' (6 pixels wide) */
 	0x84, /* #    #   */
 	0x48, /*  #  #    */
 	0x48, /*  #  #    */
@@ -1338,14 +903,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x48, /*  #  #    */
 	0x48, /*  #  #    */
 	0x84, /* #    #   */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @1222 'y' (6 pixels wide) */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
+	/* @764 'y' (6 pixels wide) */
 	0x84, /* #    #   */
 	0x84, /* #    #   */
 	0x48, /*  #  #    */
@@ -1357,10 +916,7 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x20, /*   #      */
 	0xC0, /* ##       */
 
-	/* @1235 'z' (5 pixels wide) */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
+	/* @774 'z' (5 pixels wide) */
 	0xF8, /* #####    */
 	0x08, /*     #    */
 	0x10, /*    #     */
@@ -1368,12 +924,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x40, /*  #       */
 	0x80, /* #        */
 	0xF8, /* #####    */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
 
-	/* @1248 '{' (5 pixels wide) */
-	0x00, /*          */
+	/* @781 '{' (5 pixels wide) */
 	0x38, /*   ###    */
 	0x20, /*   #      */
 	0x20, /*   #      */
@@ -1385,10 +937,8 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x20, /*   #      */
 	0x20, /*   #      */
 	0x38, /*   ###    */
-	0x00, /*          */
 
-	/* @1261 '|' (1 pixels wide) */
-	0x00, /*          */
+	/* @792 '|' (1 pixels wide) */
 	0x80, /* #        */
 	0x80, /* #        */
 	0x80, /* #        */
@@ -1402,8 +952,7 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x80, /* #        */
 	0x80, /* #        */
 
-	/* @1274 '}' (5 pixels wide) */
-	0x00, /*          */
+	/* @804 '}' (5 pixels wide) */
 	0xE0, /* ###      */
 	0x20, /*   #      */
 	0x20, /*   #      */
@@ -1415,123 +964,214 @@ const uint8_t dejaVuSans9ptBitmaps[] =
 	0x20, /*   #      */
 	0x20, /*   #      */
 	0xE0, /* ###      */
-	0x00, /*          */
 
-	/* @1287 '~' (8 pixels wide) */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
+	/* @815 '~' (8 pixels wide) */
 	0x71, /*  ###   # */
 	0x8E, /* #   ###  */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
-	0x00, /*          */
+
 };
 
 /* Character descriptors for DejaVu Sans 9pt */
 /* { [Char width in bits], [Offset into dejaVuSans9ptCharBitmaps in bytes] } */
 const FONT_CHAR_INFO dejaVuSans9ptDescriptors[] = 
 {
-	{5, 0}, 		/*   */ 
-	{1, 13}, 		/* ! */ 
-	{3, 26}, 		/* " */ 
-	{8, 39}, 		/* # */ 
-	{5, 52}, 		/* $ */ 
-	{10, 65}, 		/* % */ 
-	{8, 91}, 		/* & */ 
-	{1, 104}, 		/* ' */ 
-	{3, 117}, 		/* ( */ 
-	{3, 130}, 		/* ) */ 
-	{5, 143}, 		/* * */ 
-	{7, 156}, 		/* + */ 
-	{1, 169}, 		/* , */ 
-	{3, 182}, 		/* - */ 
-	{1, 195}, 		/* . */ 
-	{4, 208}, 		/* / */ 
-	{6, 221}, 		/* 0 */ 
-	{5, 234}, 		/* 1 */ 
-	{6, 247}, 		/* 2 */ 
-	{6, 260}, 		/* 3 */ 
-	{6, 273}, 		/* 4 */ 
-	{6, 286}, 		/* 5 */ 
-	{6, 299}, 		/* 6 */ 
-	{6, 312}, 		/* 7 */ 
-	{6, 325}, 		/* 8 */ 
-	{6, 338}, 		/* 9 */ 
-	{1, 351}, 		/* : */ 
-	{1, 364}, 		/* ; */ 
-	{8, 377}, 		/* < */ 
-	{8, 390}, 		/* = */ 
-	{8, 403}, 		/* > */ 
-	{5, 416}, 		/* ? */ 
-	{11, 429}, 		/* @ */ 
-	{8, 455}, 		/* A */ 
-	{6, 468}, 		/* B */ 
-	{6, 481}, 		/* C */ 
-	{7, 494}, 		/* D */ 
-	{6, 507}, 		/* E */ 
-	{5, 520}, 		/* F */ 
-	{7, 533}, 		/* G */ 
-	{7, 546}, 		/* H */ 
-	{1, 559}, 		/* I */ 
-	{3, 572}, 		/* J */ 
-	{6, 585}, 		/* K */ 
-	{5, 598}, 		/* L */ 
-	{8, 611}, 		/* M */ 
-	{7, 624}, 		/* N */ 
-	{7, 637}, 		/* O */ 
-	{6, 650}, 		/* P */ 
-	{7, 663}, 		/* Q */ 
-	{7, 676}, 		/* R */ 
-	{6, 689}, 		/* S */ 
-	{7, 702}, 		/* T */ 
-	{7, 715}, 		/* U */ 
-	{8, 728}, 		/* V */ 
-	{11, 741}, 		/* W */ 
-	{7, 767}, 		/* X */ 
-	{7, 780}, 		/* Y */ 
-	{7, 793}, 		/* Z */ 
-	{2, 806}, 		/* [ */ 
-	{4, 819}, 		/* \ */ 
-	{2, 832}, 		/* ] */ 
-	{6, 845}, 		/* ^ */ 
-	{6, 858}, 		/* _ */ 
-	{2, 871}, 		/* ` */ 
-	{6, 884}, 		/* a */ 
-	{6, 897}, 		/* b */ 
-	{5, 910}, 		/* c */ 
-	{6, 923}, 		/* d */ 
-	{6, 936}, 		/* e */ 
-	{4, 949}, 		/* f */ 
-	{6, 962}, 		/* g */ 
-	{6, 975}, 		/* h */ 
-	{1, 988}, 		/* i */ 
-	{2, 1001}, 		/* j */ 
-	{5, 1014}, 		/* k */ 
-	{1, 1027}, 		/* l */ 
-	{9, 1040}, 		/* m */ 
-	{6, 1066}, 		/* n */ 
-	{6, 1079}, 		/* o */ 
-	{6, 1092}, 		/* p */ 
-	{6, 1105}, 		/* q */ 
-	{4, 1118}, 		/* r */ 
-	{5, 1131}, 		/* s */ 
-	{4, 1144}, 		/* t */ 
-	{6, 1157}, 		/* u */ 
-	{6, 1170}, 		/* v */ 
-	{9, 1183}, 		/* w */ 
-	{6, 1209}, 		/* x */ 
-	{6, 1222}, 		/* y */ 
-	{5, 1235}, 		/* z */ 
-	{5, 1248}, 		/* { */ 
-	{1, 1261}, 		/* | */ 
-	{5, 1274}, 		/* } */ 
-	{8, 1287}, 		/* ~ */ 
+	{5, 0}, 		/*   */
+	{1, 0}, 		/* ! */
+	{3, 9}, 		/* " */
+	{8, 12}, 		/* # */
+	{5, 20}, 		/* $ */
+	{10, 31}, 		/* % */
+	{8, 49}, 		/* & */
+	{1, 58}, 		/* ' */
+	{3, 61}, 		/* ( */
+	{3, 72}, 		/* ) */
+	{5, 83}, 		/* * */
+	{7, 89}, 		/* + */
+	{1, 96}, 		/* , */
+	{3, 99}, 		/* - */
+	{1, 100}, 		/* . */
+	{4, 102}, 		/* / */
+	{6, 112}, 		/* 0 */
+	{5, 121}, 		/* 1 */
+	{6, 130}, 		/* 2 */
+	{6, 139}, 		/* 3 */
+	{6, 148}, 		/* 4 */
+	{6, 157}, 		/* 5 */
+	{6, 166}, 		/* 6 */
+	{6, 175}, 		/* 7 */
+	{6, 184}, 		/* 8 */
+	{6, 193}, 		/* 9 */
+	{1, 202}, 		/* : */
+	{1, 208}, 		/* ; */
+	{8, 215}, 		/* < */
+	{8, 221}, 		/* = */
+	{8, 224}, 		/* > */
+	{5, 230}, 		/* ? */
+	{11, 239}, 		/* @ */
+	{8, 261}, 		/* A */
+	{6, 270}, 		/* B */
+	{6, 279}, 		/* C */
+	{7, 288}, 		/* D */
+	{6, 297}, 		/* E */
+	{5, 306}, 		/* F */
+	{7, 315}, 		/* G */
+	{7, 324}, 		/* H */
+	{1, 333}, 		/* I */
+	{3, 342}, 		/* J */
+	{6, 353}, 		/* K */
+	{5, 362}, 		/* L */
+	{8, 371}, 		/* M */
+	{7, 380}, 		/* N */
+	{7, 389}, 		/* O */
+	{6, 398}, 		/* P */
+	{7, 407}, 		/* Q */
+	{7, 418}, 		/* R */
+	{6, 427}, 		/* S */
+	{7, 436}, 		/* T */
+	{7, 445}, 		/* U */
+	{8, 454}, 		/* V */
+	{11, 463}, 		/* W */
+	{7, 481}, 		/* X */
+	{7, 490}, 		/* Y */
+	{7, 499}, 		/* Z */
+	{2, 508}, 		/* [ */
+	{4, 519}, 		/* \ */
+	{2, 529}, 		/* ] */
+	{6, 540}, 		/* ^ */
+	{6, 543}, 		/* _ */
+	{2, 544}, 		/* ` */
+	{6, 546}, 		/* a */
+	{6, 553}, 		/* b */
+	{5, 563}, 		/* c */
+	{6, 570}, 		/* d */
+	{6, 580}, 		/* e */
+	{4, 587}, 		/* f */
+	{6, 597}, 		/* g */
+	{6, 607}, 		/* h */
+	{1, 617}, 		/* i */
+	{2, 626}, 		/* j */
+	{5, 638}, 		/* k */
+	{1, 648}, 		/* l */
+	{9, 658}, 		/* m */
+	{6, 672}, 		/* n */
+	{6, 679}, 		/* o */
+	{6, 686}, 		/* p */
+	{6, 696}, 		/* q */
+	{4, 706}, 		/* r */
+	{5, 713}, 		/* s */
+	{4, 720}, 		/* t */
+	{6, 729}, 		/* u */
+	{6, 736}, 		/* v */
+	{9, 743}, 		/* w */
+	{6, 757}, 		/* x */
+	{6, 764}, 		/* y */
+	{5, 774}, 		/* z */
+	{5, 781}, 		/* { */
+	{1, 792}, 		/* | */
+	{5, 804}, 		/* } */
+	{8, 815}, 		/* ~ */
+};
+
+
+/* Rows covered by each bitmap for DejaVu Sans 9pt */
+/* { [First row], [Rows in the bitmap] } */
+const FONT_CHAR_METRICS dejaVuSans9ptMetrics[] = 
+{
+	{0, 0}, 		/*   */
+	{1, 9}, 		/* ! */
+	{1, 3}, 		/* " */
+	{2, 8}, 		/* # */
+	{1, 11}, 		/* $ */
+	{1, 9}, 		/* % */
+	{1, 9}, 		/* & */
+	{1, 3}, 		/* ' */
+	{0, 11}, 		/* ( */
+	{0, 11}, 		/* ) */
+	{1, 6}, 		/* * */
+	{3, 7}, 		/* + */
+	{8, 3}, 		/* , */
+	{6, 1}, 		/* - */
+	{8, 2}, 		/* . */
+	{1, 10}, 		/* / */
+	{1, 9}, 		/* 0 */
+	{1, 9}, 		/* 1 */
+	{1, 9}, 		/* 2 */
+	{1, 9}, 		/* 3 */
+	{1, 9}, 		/* 4 */
+	{1, 9}, 		/* 5 */
+	{1, 9}, 		/* 6 */
+	{1, 9}, 		/* 7 */
+	{1, 9}, 		/* 8 */
+	{1, 9}, 		/* 9 */
+	{4, 6}, 		/* : */
+	{4, 7}, 		/* ; */
+	{3, 6}, 		/* < */
+	{5, 3}, 		/* = */
+	{3, 6}, 		/* > */
+	{1, 9}, 		/* ? */
+	{1, 11}, 		/* @ */
+	{1, 9}, 		/* A */
+	{1, 9}, 		/* B */
+	{1, 9}, 		/* C */
+	{1, 9}, 		/* D */
+	{1, 9}, 		/* E */
+	{1, 9}, 		/* F */
+	{1, 9}, 		/* G */
+	{1, 9}, 		/* H */
+	{1, 9}, 		/* I */
+	{1, 11}, 		/* J */
+	{1, 9}, 		/* K */
+	{1, 9}, 		/* L */
+	{1, 9}, 		/* M */
+	{1, 9}, 		/* N */
+	{1, 9}, 		/* O */
+	{1, 9}, 		/* P */
+	{1, 11}, 		/* Q */
+	{1, 9}, 		/* R */
+	{1, 9}, 		/* S */
+	{1, 9}, 		/* T */
+	{1, 9}, 		/* U */
+	{1, 9}, 		/* V */
+	{1, 9}, 		/* W */
+	{1, 9}, 		/* X */
+	{1, 9}, 		/* Y */
+	{1, 9}, 		/* Z */
+	{1, 11}, 		/* [ */
+	{1, 10}, 		/* \ */
+	{1, 11}, 		/* ] */
+	{1, 3}, 		/* ^ */
+	{12, 1}, 		/* _ */
+	{0, 2}, 		/* ` */
+	{3, 7}, 		/* a */
+	{0, 10}, 		/* b */
+	{3, 7}, 		/* c */
+	{0, 10}, 		/* d */
+	{3, 7}, 		/* e */
+	{0, 10}, 		/* f */
+	{3, 10}, 		/* g */
+	{0, 10}, 		/* h */
+	{1, 9}, 		/* i */
+	{1, 12}, 		/* j */
+	{0, 10}, 		/* k */
+	{0, 10}, 		/* l */
+	{3, 7}, 		/* m */
+	{3, 7}, 		/* n */
+	{3, 7}, 		/* o */
+	{3, 10}, 		/* p */
+	{3, 10}, 		/* q */
+	{3, 7}, 		/* r */
+	{3, 7}, 		/* s */
+	{1, 9}, 		/* t */
+	{3, 7}, 		/* u */
+	{3, 7}, 		/* v */
+	{3, 7}, 		/* w */
+	{3, 7}, 		/* x */
+	{3, 10}, 		/* y */
+	{3, 7}, 		/* z */
+	{1, 11}, 		/* { */
+	{1, 12}, 		/* | */
+	{1, 11}, 		/* } */
+	{5, 2}, 		/* ~ */
 };
 
 /* Font information for DejaVu Sans 9pt */
@@ -1542,4 +1182,5 @@ const FONT_INFO dejaVuSans9ptFontInfo =
 	'~', /*  End character */
 	dejaVuSans9ptDescriptors, /*  Character descriptor array */
 	dejaVuSans9ptBitmaps, /*  Character bitmap array */
+	dejaVuSans9ptMetrics, /*  Character metrics array */
 };
@@ -1542,4 +1542,5 @@ const FONT_INFO dejaVuSansBold9ptFontInfo =
 	'~', /*  End character */
 	dejaVuSansBold9ptDescriptors, /*  Character descriptor array */
 	dejaVuSansBold9ptBitmaps, /*  Character bitmap array */
+	NULL, /*  Character metrics array */
 };
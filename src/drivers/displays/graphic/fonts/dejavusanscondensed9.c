@@ -1542,4 +1542,5 @@ const FONT_INFO dejaVuSansCondensed9ptFontInfo =
 	'~', /*  End character */
 	dejaVuSansCondensed9ptDescriptors, /*  Character descriptor array */
 	dejaVuSansCondensed9ptBitmaps, /*  Character bitmap array */
+	NULL, /*  Character metrics array */
 };
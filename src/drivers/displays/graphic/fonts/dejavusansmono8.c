@@ -1447,4 +1447,5 @@ const FONT_INFO dejaVuSansMono8ptFontInfo =
 	'~', /*  End character */
 	dejaVuSansMono8ptDescriptors, /*  Character descriptor array */
 	dejaVuSansMono8ptBitmaps, /*  Character bitmap array */
+	NULL, /*  Character metrics array */
 };
@@ -1447,4 +1447,5 @@ const FONT_INFO dejaVuSansMonoBold8ptFontInfo =
 	'~', /*  End character */
 	dejaVuSansMonoBold8ptDescriptors, /*  Character descriptor array */
 	dejaVuSansMonoBold8ptBitmaps, /*  Character bitmap array */
+	NULL, /*  Character metrics array */
 };
@@ -1162,4 +1162,5 @@ const FONT_INFO bitstreamVeraSansMono11ptFontInfo =
 	'~', /*  End character */
 	bitstreamVeraSansMono11ptCharDescriptors, /*  Character decriptor array */
 	bitstreamVeraSansMono11ptCharBitmaps, /*  Character bitmap array */
+	NULL, /*  Character metrics array */
 };
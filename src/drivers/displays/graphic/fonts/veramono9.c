@@ -1067,4 +1067,5 @@ const FONT_INFO bitstreamVeraSansMono9ptFontInfo =
 	'~', /*  End character */
 	bitstreamVeraSansMono9ptCharDescriptors, /*  Character decriptor array */
 	bitstreamVeraSansMono9ptCharBitmaps, /*  Character bitmap array */
+	NULL, /*  Character metrics array */
 };
@@ -1162,4 +1162,5 @@ const FONT_INFO bitstreamVeraSansMonoBold11ptFontInfo =
 	'~', /*  End character */
 	bitstreamVeraSansMonoBold11ptCharDescriptors, /*  Character decriptor array */
 	bitstreamVeraSansMonoBold11ptCharBitmaps, /*  Character bitmap array */
+	NULL, /*  Character metrics array */
 };
@@ -1067,4 +1067,5 @@ const FONT_INFO bitstreamVeraSansMonoBold9ptFontInfo =
 	'~', /*  End character */
 	bitstreamVeraSansMonoBold9ptCharDescriptors, /*  Character decriptor array */
 	bitstreamVeraSansMonoBold9ptCharBitmaps, /*  Character bitmap array */
+	NULL, /*  Character metrics array */
 };
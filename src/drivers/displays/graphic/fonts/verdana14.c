@@ -2112,4 +2112,5 @@ const FONT_INFO verdana14ptFontInfo =
 	'~', /*  End character */
 	verdana14ptDescriptors, /*  Character descriptor array */
 	verdana14ptBitmaps, /*  Character bitmap array */
+	NULL, /*  Character metrics array */
 };
@@ -1447,4 +1447,5 @@ const FONT_INFO verdana9ptFontInfo =
 	'~', /*  End character */
 	verdana9ptDescriptors, /*  Character descriptor array */
 	verdana9ptBitmaps, /*  Character bitmap array */
+	NULL, /*  Character metrics array */
 };
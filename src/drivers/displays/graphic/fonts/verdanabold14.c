@@ -2207,4 +2207,5 @@ const FONT_INFO verdanabold14ptFontInfo =
 	'~', /*  End character */
 	verdanabold14ptDescriptors, /*  Character descriptor array */
 	verdanabold14ptBitmaps, /*  Character bitmap array */
+	NULL, /*  Character metrics array */
 };
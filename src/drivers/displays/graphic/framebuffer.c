@@ -0,0 +1,371 @@
+/**************************************************************************/
+/*!
+    @file     framebuffer.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <string.h>
+
+#include "framebuffer.h"
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Private Methods ------------------------------ */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Flags a framebuffer row (0-based) as needing a flush
+*/
+/**************************************************************************/
+static inline void fbDirtyRow(fb_t *fb, uint16_t row)
+{
+  fb->dirty[row >> 3] |= (1 << (row & 7));
+}
+
+/**************************************************************************/
+/*!
+    @brief  Writes one index at a framebuffer position (0-based, no
+            bounds check)
+*/
+/**************************************************************************/
+static inline void fbPut(fb_t *fb, uint16_t col, uint16_t row, uint8_t index)
+{
+  uint8_t *p;
+
+  if (fb->bpp == FB_BPP_8)
+  {
+    fb->pixels[(uint32_t)row * fb->stride + col] = index;
+  }
+  else
+  {
+    p = &fb->pixels[(uint32_t)row * fb->stride + (col >> 1)];
+    *p = (col & 1) ? ((*p & 0xF0) | (index & 0x0F)) : ((*p & 0x0F) | (index << 4));
+  }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Public Methods ------------------------------- */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Initialises an indexed-color framebuffer covering part (or
+            all) of the screen
+
+    All coordinates passed to the other fb functions are screen
+    coordinates.  Anything outside the framebuffer is ignored.  The
+    buffer is cleared to index 0 and every row is marked dirty.
+
+    @param[in]  fb
+                The framebuffer
+    @param[in]  bpp
+                FB_BPP_4 (16 colors) or FB_BPP_8 (256 colors)
+    @param[in]  x, y
+                Position of the top-left corner on the screen
+    @param[in]  width, height
+                Size in pixels (width must be <= FB_MAX_LINEWIDTH)
+    @param[in]  pixels
+                FB_BUFFER_LEN(bpp, width, height) bytes
+    @param[in]  dirty
+                FB_DIRTY_LEN(height) bytes
+    @param[in]  clut
+                FB_CLUT_LEN(bpp) RGB565 colors
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/graphic/drawing.h"
+    #include "drivers/displays/graphic/framebuffer.h"
+
+    // 4bpp 128x160 framebuffer: 10 KB of pixels instead of 40 KB
+    static uint8_t  fbPixels[FB_BUFFER_LEN(4, 128, 160)];
+    static uint8_t  fbDirty[FB_DIRTY_LEN(160)];
+    static uint16_t fbClut[FB_CLUT_LEN(4)] = { COLOR_BLACK, COLOR_WHITE, COLOR_BLUE };
+    fb_t fb;
+
+    fbInit(&fb, FB_BPP_4, 0, 0, 128, 160, fbPixels, fbDirty, fbClut);
+
+    // Draw with palette indices instead of RGB565 colors
+    drawSetFramebuffer(&fb);
+    drawRectangleFilled(10, 10, 100, 40, 2);
+    drawCircle(64, 100, 30, 1);
+    drawSetFramebuffer(NULL);
+
+    fbFlush(&fb);
+
+    // Switch theme without redrawing anything
+    uint16_t dark[3] = { COLOR_WHITE, COLOR_BLACK, COLOR_RED };
+    fbSetPalette(&fb, 0, 3, dark);
+    fbFlush(&fb);
+
+    @endcode
+*/
+/**************************************************************************/
+error_t fbInit(fb_t *fb, fbBpp_t bpp, uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t *pixels, uint8_t *dirty, uint16_t *clut)
+{
+  if ((fb == NULL) || (pixels == NULL) || (dirty == NULL) || (clut == NULL) ||
+      ((bpp != FB_BPP_4) && (bpp != FB_BPP_8)) ||
+      (width == 0) || (height == 0) || (width > FB_MAX_LINEWIDTH))
+  {
+    return ERROR_INVALIDPARAMETER;
+  }
+
+  fb->pixels = pixels;
+  fb->dirty = dirty;
+  fb->clut = clut;
+  fb->x = x;
+  fb->y = y;
+  fb->width = width;
+  fb->height = height;
+  fb->bpp = bpp;
+  fb->stride = (width * bpp + 7) / 8;
+
+  memset(pixels, 0, FB_BUFFER_LEN(bpp, width, height));
+  fbMarkDirty(fb);
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Sets a single pixel to the specified palette index
+*/
+/**************************************************************************/
+void fbSetPixel(fb_t *fb, uint16_t x, uint16_t y, uint8_t index)
+{
+  if ((x < fb->x) || (y < fb->y) || (x >= fb->x + fb->width) || (y >= fb->y + fb->height))
+    return;
+
+  fbPut(fb, x - fb->x, y - fb->y, index);
+  fbDirtyRow(fb, y - fb->y);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the palette index of a single pixel (0 if outside the
+            framebuffer)
+*/
+/**************************************************************************/
+uint8_t fbGetPixel(fb_t *fb, uint16_t x, uint16_t y)
+{
+  uint8_t data;
+
+  if ((x < fb->x) || (y < fb->y) || (x >= fb->x + fb->width) || (y >= fb->y + fb->height))
+    return 0;
+
+  x -= fb->x;
+  y -= fb->y;
+  data = fb->pixels[(uint32_t)y * fb->stride + (fb->bpp == FB_BPP_8 ? x : x >> 1)];
+  if (fb->bpp == FB_BPP_4)
+  {
+    data = (x & 1) ? (data & 0x0F) : (data >> 4);
+  }
+
+  return data;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws a horizontal line, clipped to the framebuffer
+*/
+/**************************************************************************/
+void fbDrawHLine(fb_t *fb, uint16_t x0, uint16_t x1, uint16_t y, uint8_t index)
+{
+  uint16_t t, col, last;
+
+  if (x1 < x0)
+  {
+    t = x0;
+    x0 = x1;
+    x1 = t;
+  }
+
+  if ((y < fb->y) || (y >= fb->y + fb->height) || (x1 < fb->x) || (x0 >= fb->x + fb->width))
+    return;
+
+  col = x0 < fb->x ? 0 : x0 - fb->x;
+  last = x1 >= fb->x + fb->width ? fb->width - 1 : x1 - fb->x;
+  y -= fb->y;
+
+  if (fb->bpp == FB_BPP_8)
+  {
+    memset(&fb->pixels[(uint32_t)y * fb->stride + col], index, last - col + 1);
+  }
+  else
+  {
+    for (; col <= last; col++)
+    {
+      fbPut(fb, col, y, index);
+    }
+  }
+
+  fbDirtyRow(fb, y);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws a vertical line, clipped to the framebuffer
+*/
+/**************************************************************************/
+void fbDrawVLine(fb_t *fb, uint16_t x, uint16_t y0, uint16_t y1, uint8_t index)
+{
+  uint16_t t, row, last;
+
+  if (y1 < y0)
+  {
+    t = y0;
+    y0 = y1;
+    y1 = t;
+  }
+
+  if ((x < fb->x) || (x >= fb->x + fb->width) || (y1 < fb->y) || (y0 >= fb->y + fb->height))
+    return;
+
+  row = y0 < fb->y ? 0 : y0 - fb->y;
+  last = y1 >= fb->y + fb->height ? fb->height - 1 : y1 - fb->y;
+  x -= fb->x;
+
+  for (; row <= last; row++)
+  {
+    fbPut(fb, x, row, index);
+    fbDirtyRow(fb, row);
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Fills the whole framebuffer with one palette index
+*/
+/**************************************************************************/
+void fbFill(fb_t *fb, uint8_t index)
+{
+  if (fb->bpp == FB_BPP_4)
+  {
+    index = (index & 0x0F) | (index << 4);
+  }
+  memset(fb->pixels, index, (uint32_t)fb->stride * fb->height);
+  fbMarkDirty(fb);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Changes palette entries, for palette animation or theme
+            switching without re-rasterizing
+
+    Every row is marked dirty, so the next fbFlush repaints the whole
+    framebuffer with the new colors.
+
+    @param[in]  fb
+                The framebuffer
+    @param[in]  first
+                First palette index to change
+    @param[in]  count
+                Number of entries to change
+    @param[in]  colors
+                The new RGB565 colors
+*/
+/**************************************************************************/
+void fbSetPalette(fb_t *fb, uint16_t first, uint16_t count, const uint16_t *colors)
+{
+  if (first >= FB_CLUT_LEN(fb->bpp))
+    return;
+  if (count > FB_CLUT_LEN(fb->bpp) - first)
+    count = FB_CLUT_LEN(fb->bpp) - first;
+
+  memcpy(&fb->clut[first], colors, count * sizeof(uint16_t));
+  fbMarkDirty(fb);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Marks every row as needing a flush
+*/
+/**************************************************************************/
+void fbMarkDirty(fb_t *fb)
+{
+  memset(fb->dirty, 0xFF, FB_DIRTY_LEN(fb->height));
+}
+
+/**************************************************************************/
+/*!
+    @brief  Sends the dirty rows to the display
+
+    Each dirty row is expanded through the CLUT into RGB565 and written
+    with a single lcdDrawPixels call.  Clean rows are skipped.
+*/
+/**************************************************************************/
+void fbFlush(fb_t *fb)
+{
+  uint16_t line[FB_MAX_LINEWIDTH];
+  const uint8_t *src;
+  uint16_t row, col;
+
+  for (row = 0; row < fb->height; row++)
+  {
+    if (!(fb->dirty[row >> 3] & (1 << (row & 7))))
+    {
+      /* Skip 8 clean rows at a time */
+      if (((row & 7) == 0) && (fb->dirty[row >> 3] == 0))
+        row += 7;
+      continue;
+    }
+
+    src = &fb->pixels[(uint32_t)row * fb->stride];
+    if (fb->bpp == FB_BPP_8)
+    {
+      for (col = 0; col < fb->width; col++)
+      {
+        line[col] = fb->clut[src[col]];
+      }
+    }
+    else
+    {
+      for (col = 0; col + 1 < fb->width; col += 2)
+      {
+        line[col] = fb->clut[*src >> 4];
+        line[col + 1] = fb->clut[*src++ & 0x0F];
+      }
+      if (col < fb->width)
+      {
+        line[col] = fb->clut[*src >> 4];
+      }
+    }
+
+    lcdDrawPixels(fb->x, fb->y + row, line, fb->width);
+    fb->dirty[row >> 3] &= ~(1 << (row & 7));
+  }
+}
@@ -0,0 +1,94 @@
+/**************************************************************************/
+/*!
+    @file     framebuffer.h
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#ifndef __FRAMEBUFFER_H__
+#define __FRAMEBUFFER_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "bspconfig.h"
+#include "lcd.h"
+
+/*=========================================================================
+    FRAMEBUFFER SETTINGS
+    -----------------------------------------------------------------------
+    FB_MAX_LINEWIDTH    The widest framebuffer that can be flushed, in
+                        pixels.  Each pixel costs 2 bytes of stack space
+                        for the expanded RGB565 row during fbFlush.
+    -----------------------------------------------------------------------*/
+    #define FB_MAX_LINEWIDTH            (240)
+/*=========================================================================*/
+
+typedef enum
+{
+  FB_BPP_4 = 4,                 // 16 colors, two pixels per byte (left pixel in the upper nibble)
+  FB_BPP_8 = 8                  // 256 colors, one pixel per byte
+} fbBpp_t;
+
+/* Buffer sizes in bytes, for static allocation */
+#define FB_BUFFER_LEN(bpp, w, h)        ((uint32_t)((((w) * (bpp)) + 7) / 8) * (h))
+#define FB_DIRTY_LEN(h)                 (((h) + 7) / 8)
+#define FB_CLUT_LEN(bpp)                (1 << (bpp))
+
+typedef struct
+{
+  uint8_t   *pixels;            // FB_BUFFER_LEN bytes of palette indices
+  uint8_t   *dirty;             // FB_DIRTY_LEN bytes, one bit per row
+  uint16_t  *clut;              // FB_CLUT_LEN RGB565 colors
+  uint16_t  x;                  // Position of the framebuffer on the screen
+  uint16_t  y;
+  uint16_t  width;
+  uint16_t  height;
+  uint16_t  stride;             // Bytes per row
+  fbBpp_t   bpp;
+} fb_t;
+
+error_t fbInit       ( fb_t *fb, fbBpp_t bpp, uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t *pixels, uint8_t *dirty, uint16_t *clut );
+void    fbSetPixel   ( fb_t *fb, uint16_t x, uint16_t y, uint8_t index );
+uint8_t fbGetPixel   ( fb_t *fb, uint16_t x, uint16_t y );
+void    fbDrawHLine  ( fb_t *fb, uint16_t x0, uint16_t x1, uint16_t y, uint8_t index );
+void    fbDrawVLine  ( fb_t *fb, uint16_t x, uint16_t y0, uint16_t y1, uint8_t index );
+void    fbFill       ( fb_t *fb, uint8_t index );
+void    fbSetPalette ( fb_t *fb, uint16_t first, uint16_t count, const uint16_t *colors );
+void    fbMarkDirty  ( fb_t *fb );
+void    fbFlush      ( fb_t *fb );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
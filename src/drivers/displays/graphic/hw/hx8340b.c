@@ -47,17 +47,17 @@
 #include "core/delay/delay.h"
 #include "core/gpio/gpio.h"
 
-static lcdOrientation_t lcdOrientation = LCD_ORIENTATION_PORTRAIT;
-static lcdProperties_t hx8340bProperties = { 176, 220, false, false, false, true, true };
+// State of the panel on HX8340B_CS_PIN (see hx8340bPanel)
+static hx8340b_t hx8340bDefault = HX8340B_PANEL(HX8340B_CS_PIN);
 
 /*************************************************/
 /* Private Methods                               */
 /*************************************************/
 
 /*************************************************/
-void hx8340bWriteCmd(uint8_t command)
+void hx8340bWriteCmd(hx8340b_t *lcd, uint8_t command)
 {
-  CLR_CS;
+  CLR_CS(lcd);
 
   CLR_SDI;
   CLR_SCL;
@@ -81,13 +81,13 @@ void hx8340bWriteCmd(uint8_t command)
     command <<= 1;
     SET_SCL;
   }
-  SET_CS;
+  SET_CS(lcd);
 }
 
 /*************************************************/
-void hx8340bWriteData(uint8_t data)
+void hx8340bWriteData(hx8340b_t *lcd, uint8_t data)
 {
-  CLR_CS;
+  CLR_CS(lcd);
 
   SET_SDI;
   CLR_SCL;
@@ -111,137 +111,137 @@ void hx8340bWriteData(uint8_t data)
     data <<= 1;
     SET_SCL;
   }
-  SET_CS;
+  SET_CS(lcd);
 }
 
 /*************************************************/
-void hx8340bWriteData16(uint16_t data)
+void hx8340bWriteData16(hx8340b_t *lcd, uint16_t data)
 {
-  hx8340bWriteData((data>>8) & 0xFF);
-  hx8340bWriteData(data & 0xFF);
+  hx8340bWriteData(lcd, (data>>8) & 0xFF);
+  hx8340bWriteData(lcd, data & 0xFF);
 }
 
 /*************************************************/
-void hx8340bWriteRegister(uint8_t reg, uint8_t value)
+void hx8340bWriteRegister(hx8340b_t *lcd, uint8_t reg, uint8_t value)
 {
-  hx8340bWriteCmd(reg);
-  hx8340bWriteCmd(value);
+  hx8340bWriteCmd(lcd, reg);
+  hx8340bWriteCmd(lcd, value);
 }
 
 /*************************************************/
-void hx8340bInitDisplay(void)
+void hx8340bInitDisplay(hx8340b_t *lcd)
 {
-  hx8340bWriteCmd(HX8340B_N_SETEXTCMD);
-  hx8340bWriteData(0xFF);
-  hx8340bWriteData(0x83);
-  hx8340bWriteData(0x40);
+  hx8340bWriteCmd(lcd, HX8340B_N_SETEXTCMD);
+  hx8340bWriteData(lcd, 0xFF);
+  hx8340bWriteData(lcd, 0x83);
+  hx8340bWriteData(lcd, 0x40);
 
-  hx8340bWriteCmd(HX8340B_N_SPLOUT);
+  hx8340bWriteCmd(lcd, HX8340B_N_SPLOUT);
   delay(100);
 
-  hx8340bWriteCmd(0xCA);                  // Undocumented register?
-  hx8340bWriteData(0x70);
-  hx8340bWriteData(0x00);
-  hx8340bWriteData(0xD9);
-  hx8340bWriteData(0x01);
-  hx8340bWriteData(0x11);
-
-  hx8340bWriteCmd(0xC9);                  // Undocumented register?
-  hx8340bWriteData(0x90);
-  hx8340bWriteData(0x49);
-  hx8340bWriteData(0x10);
-  hx8340bWriteData(0x28);
-  hx8340bWriteData(0x28);
-  hx8340bWriteData(0x10);
-  hx8340bWriteData(0x00);
-  hx8340bWriteData(0x06);
+  hx8340bWriteCmd(lcd, 0xCA);                  // Undocumented register?
+  hx8340bWriteData(lcd, 0x70);
+  hx8340bWriteData(lcd, 0x00);
+  hx8340bWriteData(lcd, 0xD9);
+  hx8340bWriteData(lcd, 0x01);
+  hx8340bWriteData(lcd, 0x11);
+
+  hx8340bWriteCmd(lcd, 0xC9);                  // Undocumented register?
+  hx8340bWriteData(lcd, 0x90);
+  hx8340bWriteData(lcd, 0x49);
+  hx8340bWriteData(lcd, 0x10);
+  hx8340bWriteData(lcd, 0x28);
+  hx8340bWriteData(lcd, 0x28);
+  hx8340bWriteData(lcd, 0x10);
+  hx8340bWriteData(lcd, 0x00);
+  hx8340bWriteData(lcd, 0x06);
   delay(20);
 
-  hx8340bWriteCmd(HX8340B_N_SETGAMMAP);
-  hx8340bWriteData(0x60);
-  hx8340bWriteData(0x71);
-  hx8340bWriteData(0x01);
-  hx8340bWriteData(0x0E);
-  hx8340bWriteData(0x05);
-  hx8340bWriteData(0x02);
-  hx8340bWriteData(0x09);
-  hx8340bWriteData(0x31);
-  hx8340bWriteData(0x0A);
-
-  hx8340bWriteCmd(HX8340B_N_SETGAMMAN);
-  hx8340bWriteData(0x67);
-  hx8340bWriteData(0x30);
-  hx8340bWriteData(0x61);
-  hx8340bWriteData(0x17);
-  hx8340bWriteData(0x48);
-  hx8340bWriteData(0x07);
-  hx8340bWriteData(0x05);
-  hx8340bWriteData(0x33);
+  hx8340bWriteCmd(lcd, HX8340B_N_SETGAMMAP);
+  hx8340bWriteData(lcd, 0x60);
+  hx8340bWriteData(lcd, 0x71);
+  hx8340bWriteData(lcd, 0x01);
+  hx8340bWriteData(lcd, 0x0E);
+  hx8340bWriteData(lcd, 0x05);
+  hx8340bWriteData(lcd, 0x02);
+  hx8340bWriteData(lcd, 0x09);
+  hx8340bWriteData(lcd, 0x31);
+  hx8340bWriteData(lcd, 0x0A);
+
+  hx8340bWriteCmd(lcd, HX8340B_N_SETGAMMAN);
+  hx8340bWriteData(lcd, 0x67);
+  hx8340bWriteData(lcd, 0x30);
+  hx8340bWriteData(lcd, 0x61);
+  hx8340bWriteData(lcd, 0x17);
+  hx8340bWriteData(lcd, 0x48);
+  hx8340bWriteData(lcd, 0x07);
+  hx8340bWriteData(lcd, 0x05);
+  hx8340bWriteData(lcd, 0x33);
   delay(10);
 
-  hx8340bWriteCmd(HX8340B_N_SETPWCTR5);
-  hx8340bWriteData(0x35);
-  hx8340bWriteData(0x20);
-  hx8340bWriteData(0x45);
+  hx8340bWriteCmd(lcd, HX8340B_N_SETPWCTR5);
+  hx8340bWriteData(lcd, 0x35);
+  hx8340bWriteData(lcd, 0x20);
+  hx8340bWriteData(lcd, 0x45);
 
-  hx8340bWriteCmd(HX8340B_N_SETPWCTR4);
-  hx8340bWriteData(0x33);
-  hx8340bWriteData(0x25);
-  hx8340bWriteData(0x4c);
+  hx8340bWriteCmd(lcd, HX8340B_N_SETPWCTR4);
+  hx8340bWriteData(lcd, 0x33);
+  hx8340bWriteData(lcd, 0x25);
+  hx8340bWriteData(lcd, 0x4c);
   delay(10);
 
-  hx8340bWriteCmd(HX8340B_N_COLMOD);      // Color Mode
-  hx8340bWriteData(0x05);                 // 0x05 = 16bpp, 0x06 = 18bpp
+  hx8340bWriteCmd(lcd, HX8340B_N_COLMOD);      // Color Mode
+  hx8340bWriteData(lcd, 0x05);                 // 0x05 = 16bpp, 0x06 = 18bpp
 
-  hx8340bWriteCmd(HX8340B_N_DISPON);
+  hx8340bWriteCmd(lcd, HX8340B_N_DISPON);
   delay(10);
 
-  hx8340bWriteCmd(HX8340B_N_CASET);
-  hx8340bWriteData(0x00);
-  hx8340bWriteData(0x00);
-  hx8340bWriteData(0x00);
-  hx8340bWriteData(0xaf);                 // 175
+  hx8340bWriteCmd(lcd, HX8340B_N_CASET);
+  hx8340bWriteData(lcd, 0x00);
+  hx8340bWriteData(lcd, 0x00);
+  hx8340bWriteData(lcd, 0x00);
+  hx8340bWriteData(lcd, 0xaf);                 // 175
 
-  hx8340bWriteCmd(HX8340B_N_PASET);
-  hx8340bWriteData(0x00);
-  hx8340bWriteData(0x00);
-  hx8340bWriteData(0x00);
-  hx8340bWriteData(0xdb);                // 219
+  hx8340bWriteCmd(lcd, HX8340B_N_PASET);
+  hx8340bWriteData(lcd, 0x00);
+  hx8340bWriteData(lcd, 0x00);
+  hx8340bWriteData(lcd, 0x00);
+  hx8340bWriteData(lcd, 0xdb);                // 219
 
-  hx8340bWriteCmd(HX8340B_N_RAMWR);
+  hx8340bWriteCmd(lcd, HX8340B_N_RAMWR);
 }
 
 /*************************************************/
-void hx8340bHome(void)
+void hx8340bHome(hx8340b_t *lcd)
 {
-   hx8340bWriteCmd(HX8340B_N_CASET);
-   hx8340bWriteData(0x00);
-   hx8340bWriteData(0x00);
-   hx8340bWriteData(0x00);
-   hx8340bWriteData(0xaf);
-   hx8340bWriteCmd(HX8340B_N_PASET);
-   hx8340bWriteData(0x00);
-   hx8340bWriteData(0x00);
-   hx8340bWriteData(0x00);
-   hx8340bWriteData(0xdb);
+   hx8340bWriteCmd(lcd, HX8340B_N_CASET);
+   hx8340bWriteData(lcd, 0x00);
+   hx8340bWriteData(lcd, 0x00);
+   hx8340bWriteData(lcd, 0x00);
+   hx8340bWriteData(lcd, 0xaf);
+   hx8340bWriteCmd(lcd, HX8340B_N_PASET);
+   hx8340bWriteData(lcd, 0x00);
+   hx8340bWriteData(lcd, 0x00);
+   hx8340bWriteData(lcd, 0x00);
+   hx8340bWriteData(lcd, 0xdb);
 }
 
 /*************************************************/
-static inline void hx8340bSetPosition(uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1)
+static inline void hx8340bSetPosition(hx8340b_t *lcd, uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1)
 {
-  hx8340bWriteCmd(HX8340B_N_CASET);
-  hx8340bWriteData(x0>>8);
-  hx8340bWriteData(x0);
-  hx8340bWriteData(x1>>8);
-  hx8340bWriteData(x1);
-
-  hx8340bWriteCmd(HX8340B_N_PASET);
-  hx8340bWriteData(y0>>8);
-  hx8340bWriteData(y0);
-  hx8340bWriteData(y1>>8);
-  hx8340bWriteData(y1);
-
-  hx8340bWriteCmd(HX8340B_N_RAMWR);
+  hx8340bWriteCmd(lcd, HX8340B_N_CASET);
+  hx8340bWriteData(lcd, x0>>8);
+  hx8340bWriteData(lcd, x0);
+  hx8340bWriteData(lcd, x1>>8);
+  hx8340bWriteData(lcd, x1);
+
+  hx8340bWriteCmd(lcd, HX8340B_N_PASET);
+  hx8340bWriteData(lcd, y0>>8);
+  hx8340bWriteData(lcd, y0);
+  hx8340bWriteData(lcd, y1>>8);
+  hx8340bWriteData(lcd, y1);
+
+  hx8340bWriteCmd(lcd, HX8340B_N_RAMWR);
 }
 
 /*************************************************/
@@ -249,12 +249,14 @@ static inline void hx8340bSetPosition(uint32_t x0, uint32_t y0, uint32_t x1, uin
 /*************************************************/
 
 /*************************************************/
-void lcdInit(void)
+void hx8340bInit(void *ctx)
 {
+  hx8340b_t *lcd = (hx8340b_t *)ctx;
+
   // Set control pins to output
   LPC_GPIO->DIR[HX8340B_PORT] |=  (1 << HX8340B_SDI_PIN);
   LPC_GPIO->DIR[HX8340B_PORT] |=  (1 << HX8340B_SCL_PIN);
-  LPC_GPIO->DIR[HX8340B_PORT] |=  (1 << HX8340B_CS_PIN);
+  LPC_GPIO->DIR[HX8340B_PORT] |=  lcd->csMask;
   LPC_GPIO->DIR[HX8340B_PORT] |=  (1 << HX8340B_BL_PIN);
   #ifdef HX8340B_USERESET
   LPC_GPIO->DIR[HX8340B_PORT] |=  (1 << HX8340B_RES_PIN);
@@ -263,14 +265,14 @@ void lcdInit(void)
   // Set pins low by default (except reset)
   CLR_SDI;
   CLR_SCL;
-  CLR_CS;
+  CLR_CS(lcd);
   CLR_BL;
   #ifdef HX8340B_USERESET
     SET_RES;
   #endif
 
   // Turn backlight on
-  lcdBacklight(TRUE);
+  hx8340bBacklight(lcd, TRUE);
 
   // Reset display
   #ifdef HX8340B_USERESET
@@ -283,15 +285,17 @@ void lcdInit(void)
   #endif
 
   // Run LCD init sequence
-  hx8340bInitDisplay();
+  hx8340bInitDisplay(lcd);
 
   // Fill black
-  lcdFillRGB(COLOR_BLACK);
+  hx8340bFillRGB(lcd, COLOR_BLACK);
 }
 
 /*************************************************/
-void lcdBacklight(bool state)
+void hx8340bBacklight(void *ctx, bool state)
 {
+  (void)ctx;
+
   // Set the backlight
   // Note: Depending on the type of transistor used
   // to control the backlight, you made need to invert
@@ -305,29 +309,35 @@ void lcdBacklight(bool state)
 }
 
 /*************************************************/
-void lcdTest(void)
+void hx8340bTest(void *ctx)
 {
-  lcdFillRGB(COLOR_GREEN);
+  hx8340b_t *lcd = (hx8340b_t *)ctx;
+
+  hx8340bFillRGB(lcd, COLOR_GREEN);
 }
 
 /*************************************************/
-void lcdFillRGB(uint16_t color)
+void hx8340bFillRGB(void *ctx, uint16_t color)
 {
+  hx8340b_t *lcd = (hx8340b_t *)ctx;
+
   uint8_t i,j;
   for (i=0;i<220;i++)
   {
     for (j=0;j<176;j++)
     {
-      hx8340bWriteData16(color);
+      hx8340bWriteData16(lcd, color);
     }
   }
 }
 
 /*************************************************/
-void lcdDrawPixel(uint16_t x, uint16_t y, uint16_t color)
+void hx8340bDrawPixel(void *ctx, uint16_t x, uint16_t y, uint16_t color)
 {
-  hx8340bSetPosition(x, y, x+1, y+1);
-  hx8340bWriteData16(color);
+  hx8340b_t *lcd = (hx8340b_t *)ctx;
+
+  hx8340bSetPosition(lcd, x, y, x+1, y+1);
+  hx8340bWriteData16(lcd, color);
 }
 
 /**************************************************************************/
@@ -336,20 +346,59 @@ void lcdDrawPixel(uint16_t x, uint16_t y, uint16_t color)
             faster than addressing each pixel individually)
 */
 /**************************************************************************/
-void lcdDrawPixels(uint16_t x, uint16_t y, uint16_t *data, uint32_t len)
+void hx8340bDrawPixels(void *ctx, uint16_t x, uint16_t y, uint16_t *data, uint32_t len)
+{
+  hx8340b_t *lcd = (hx8340b_t *)ctx;
+
+  if ((x >= hx8340bGetWidth(lcd)) || (y >= hx8340bGetHeight(lcd)) || (len == 0)) return;
+
+  // Clip to the end of the row
+  if (x + len > hx8340bGetWidth(lcd))
+  {
+    len = hx8340bGetWidth(lcd) - x;
+  }
+
+  hx8340bSetPosition(lcd, x, y, x + len - 1, y);
+  hx8340bWritePixels(lcd, data, len);
+}
+
+/**************************************************************************/
+/*! 
+    @brief  Sets the window that subsequent calls to hx8340bWritePixels
+            will fill, left to right and top to bottom
+
+    Rendering a block of pixels this way only sends the address once,
+    rather than once per row or once per pixel.
+*/
+/**************************************************************************/
+void hx8340bSetWindow(void *ctx, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+  hx8340b_t *lcd = (hx8340b_t *)ctx;
+
+  // hx8340bSetPosition also starts the RAM write
+  hx8340bSetPosition(lcd, x0, y0, x1, y1);
+}
+
+/**************************************************************************/
+/*! 
+    @brief  Streams RGB565 pixels into the window set by hx8340bSetWindow
+*/
+/**************************************************************************/
+void hx8340bWritePixels(void *ctx, uint16_t *data, uint32_t len)
 {
-  // ToDo: Optimise this function ... currently only a placeholder
-  uint32_t i = 0;
-  do
+  hx8340b_t *lcd = (hx8340b_t *)ctx;
+
+  while (len--)
   {
-    lcdDrawPixel(x+i, y, data[i]);
-    i++;
-  } while (i<len);
+    hx8340bWriteData16(lcd, *data++);
+  }
 }
 
 /*************************************************/
-void lcdDrawHLine(uint16_t x0, uint16_t x1, uint16_t y, uint16_t color)
+void hx8340bDrawHLine(void *ctx, uint16_t x0, uint16_t x1, uint16_t y, uint16_t color)
 {
+  hx8340b_t *lcd = (hx8340b_t *)ctx;
+
   // Allows for slightly better performance than setting individual pixels
   uint16_t x, pixels;
 
@@ -362,25 +411,27 @@ void lcdDrawHLine(uint16_t x0, uint16_t x1, uint16_t y, uint16_t color)
   }
 
   // Check limits
-  if (x1 >= lcdGetWidth())
+  if (x1 >= hx8340bGetWidth(lcd))
   {
-    x1 = lcdGetWidth() - 1;
+    x1 = hx8340bGetWidth(lcd) - 1;
   }
-  if (x0 >= lcdGetWidth())
+  if (x0 >= hx8340bGetWidth(lcd))
   {
-    x0 = lcdGetWidth() - 1;
+    x0 = hx8340bGetWidth(lcd) - 1;
   }
 
-  hx8340bSetPosition(x0, y, x1, y+1);
+  hx8340bSetPosition(lcd, x0, y, x1, y+1);
   for (pixels = 0; pixels < x1 - x0 + 1; pixels++)
   {
-    hx8340bWriteData16(color);
+    hx8340bWriteData16(lcd, color);
   }
 }
 
 /*************************************************/
-void lcdDrawVLine(uint16_t x, uint16_t y0, uint16_t y1, uint16_t color)
+void hx8340bDrawVLine(void *ctx, uint16_t x, uint16_t y0, uint16_t y1, uint16_t color)
 {
+  hx8340b_t *lcd = (hx8340b_t *)ctx;
+
   // Allows for slightly better performance than setting individual pixels
   uint16_t y, pixels;
 
@@ -393,69 +444,106 @@ void lcdDrawVLine(uint16_t x, uint16_t y0, uint16_t y1, uint16_t color)
   }
 
   // Check limits
-  if (y1 >= lcdGetHeight())
+  if (y1 >= hx8340bGetHeight(lcd))
   {
-    y1 = lcdGetHeight() - 1;
+    y1 = hx8340bGetHeight(lcd) - 1;
   }
-  if (y0 >= lcdGetHeight())
+  if (y0 >= hx8340bGetHeight(lcd))
   {
-    y0 = lcdGetHeight() - 1;
+    y0 = hx8340bGetHeight(lcd) - 1;
   }
 
   for (pixels = 0; pixels < y1 - y0 + 1; pixels++)
   {
-    hx8340bSetPosition(x, y0+pixels, x+1, y0+pixels+1);
-    hx8340bWriteData16(color);
+    hx8340bSetPosition(lcd, x, y0+pixels, x+1, y0+pixels+1);
+    hx8340bWriteData16(lcd, color);
   }
 }
 
 /*************************************************/
-uint16_t lcdGetPixel(uint16_t x, uint16_t y)
+uint16_t hx8340bGetPixel(void *ctx, uint16_t x, uint16_t y)
 {
+  (void)ctx;
+
   // ToDo
   return 0;
 }
 
 /*************************************************/
-void lcdSetOrientation(lcdOrientation_t orientation)
+void hx8340bSetOrientation(void *ctx, lcdOrientation_t orientation)
 {
+  (void)ctx;
+
   // ToDo
 }
 
 /*************************************************/
-lcdOrientation_t lcdGetOrientation(void)
+lcdOrientation_t hx8340bGetOrientation(void *ctx)
 {
-  return lcdOrientation;
+  hx8340b_t *lcd = (hx8340b_t *)ctx;
+  return lcd->orientation;
 }
 
 /*************************************************/
-uint16_t lcdGetWidth(void)
+uint16_t hx8340bGetWidth(void *ctx)
 {
-  return hx8340bProperties.width;
+  hx8340b_t *lcd = (hx8340b_t *)ctx;
+  return lcd->properties.width;
 }
 
 /*************************************************/
-uint16_t lcdGetHeight(void)
+uint16_t hx8340bGetHeight(void *ctx)
 {
-  return hx8340bProperties.height;
+  hx8340b_t *lcd = (hx8340b_t *)ctx;
+  return lcd->properties.height;
 }
 
 /*************************************************/
-void lcdScroll(int16_t pixels, uint16_t fillColor)
+void hx8340bScroll(void *ctx, int16_t pixels, uint16_t fillColor)
 {
+  (void)ctx;
+
   // ToDo
 }
 
 /*************************************************/
-uint16_t lcdGetControllerID(void)
+uint16_t hx8340bGetControllerID(void *ctx)
 {
+  (void)ctx;
   return 0x8340;
 }
 
 /*************************************************/
-lcdProperties_t lcdGetProperties(void)
+lcdProperties_t hx8340bGetProperties(void *ctx)
 {
-  return hx8340bProperties;
+  hx8340b_t *lcd = (hx8340b_t *)ctx;
+  return lcd->properties;
 }
 
+/*************************************************/
+const lcdDriver_t hx8340bDriver =
+{
+  .init             = hx8340bInit,
+  .test             = hx8340bTest,
+  .getPixel         = hx8340bGetPixel,
+  .fillRGB          = hx8340bFillRGB,
+  .drawPixel        = hx8340bDrawPixel,
+  .drawPixels       = hx8340bDrawPixels,
+  .setWindow        = hx8340bSetWindow,
+  .writePixels      = hx8340bWritePixels,
+  .drawHLine        = hx8340bDrawHLine,
+  .drawVLine        = hx8340bDrawVLine,
+  .backlight        = hx8340bBacklight,
+  .scroll           = hx8340bScroll,
+  .getWidth         = hx8340bGetWidth,
+  .getHeight        = hx8340bGetHeight,
+  .setOrientation   = hx8340bSetOrientation,
+  .getOrientation   = hx8340bGetOrientation,
+  .getControllerID  = hx8340bGetControllerID,
+  .getProperties    = hx8340bGetProperties
+};
+
+/*************************************************/
+lcdPanel_t hx8340bPanel = { &hx8340bDriver, &hx8340bDefault };
+
 #endif
@@ -83,8 +83,8 @@ extern "C" {
 #define SET_SDI     do { LPC_GPIO->SET[HX8340B_PORT] = (1 << HX8340B_SDI_PIN); } while(0)
 #define CLR_SCL     do { LPC_GPIO->CLR[HX8340B_PORT] = (1 << HX8340B_SCL_PIN); } while(0)
 #define SET_SCL     do { LPC_GPIO->SET[HX8340B_PORT] = (1 << HX8340B_SCL_PIN); } while(0)
-#define CLR_CS      do { LPC_GPIO->CLR[HX8340B_PORT] = (1 << HX8340B_CS_PIN); } while(0)
-#define SET_CS      do { LPC_GPIO->SET[HX8340B_PORT] = (1 << HX8340B_CS_PIN); } while(0)
+#define CLR_CS(lcd) do { LPC_GPIO->CLR[HX8340B_PORT] = (lcd)->csMask; } while(0)
+#define SET_CS(lcd) do { LPC_GPIO->SET[HX8340B_PORT] = (lcd)->csMask; } while(0)
 #define CLR_BL      do { LPC_GPIO->CLR[HX8340B_PORT] = (1 << HX8340B_BL_PIN); } while(0)
 #define SET_BL      do { LPC_GPIO->SET[HX8340B_PORT] = (1 << HX8340B_BL_PIN); } while(0)
 #ifdef HX8340B_USERESET
@@ -150,6 +150,41 @@ extern "C" {
 #define HX8340B_N_SETGAMMAP               (0xC2)
 #define HX8340B_N_SETGAMMAN               (0xC3)
 
+// State of one HX8340B panel.  Panels share the SDI, SCL, backlight and
+// reset pins above, and each one has its own chip select pin on
+// HX8340B_PORT.
+typedef struct
+{
+  uint32_t          csMask;       // Chip select pin mask on HX8340B_PORT
+  lcdOrientation_t  orientation;
+  lcdProperties_t   properties;
+} hx8340b_t;
+
+// Initialiser for an hx8340b_t with its chip select on HX8340B_PORT.csPin
+#define HX8340B_PANEL(csPin)  { (1 << (csPin)), LCD_ORIENTATION_PORTRAIT, \
+                                { 176, 220, false, false, false, true, true, false } }
+
+// lcd.h entry points implemented by this driver (see lcdDriver_t), which
+// take the panel's hx8340b_t as ctx
+void     hx8340bInit(void *ctx);
+void     hx8340bTest(void *ctx);
+uint16_t hx8340bGetPixel(void *ctx, uint16_t x, uint16_t y);
+void     hx8340bFillRGB(void *ctx, uint16_t color);
+void     hx8340bDrawPixel(void *ctx, uint16_t x, uint16_t y, uint16_t color);
+void     hx8340bDrawPixels(void *ctx, uint16_t x, uint16_t y, uint16_t *data, uint32_t len);
+void     hx8340bSetWindow(void *ctx, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+void     hx8340bWritePixels(void *ctx, uint16_t *data, uint32_t len);
+void     hx8340bDrawHLine(void *ctx, uint16_t x0, uint16_t x1, uint16_t y, uint16_t color);
+void     hx8340bDrawVLine(void *ctx, uint16_t x, uint16_t y0, uint16_t y1, uint16_t color);
+void     hx8340bBacklight(void *ctx, bool state);
+void     hx8340bScroll(void *ctx, int16_t pixels, uint16_t fillColor);
+uint16_t hx8340bGetWidth(void *ctx);
+uint16_t hx8340bGetHeight(void *ctx);
+void     hx8340bSetOrientation(void *ctx, lcdOrientation_t orientation);
+lcdOrientation_t hx8340bGetOrientation(void *ctx);
+uint16_t hx8340bGetControllerID(void *ctx);
+lcdProperties_t  hx8340bGetProperties(void *ctx);
+
 #ifdef __cplusplus
 }
 #endif 
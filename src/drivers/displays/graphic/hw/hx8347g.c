@@ -47,16 +47,8 @@
 #include "core/gpio/gpio.h"
 // #include "drivers/displays/graphic/touchscreen.h"
 
-static volatile lcdOrientation_t lcdOrientation = LCD_ORIENTATION_PORTRAIT;
-
-// Screen/Driver Properties
-static lcdProperties_t hx8347gProperties = {  240,      // Screen width
-                                              320,      // Screen height
-                                              true,     // Has touchscreen?
-                                              false,    // Allows orientation changes?
-                                              false,    // Supports HW scrolling?
-                                              true,     // Driver includes fast horizontal line function?
-                                              false };  // Driver includes fast vertical line function?
+// State of the panel on HX8347G_CS_PIN (see hx8347gPanel)
+static hx8347g_t hx8347gDefault = HX8347G_PANEL(HX8347G_CS_PIN);
 
 // Initialisation sequence (Ugly here but saves a bit of code space handled like this)
 static const uint8_t HX8347G_InitSequence[] = {
@@ -125,10 +117,10 @@ void hx8347gDelay(unsigned int t)
     @brief  Sends an 8-bit command + 8-bits data
 */
 /**************************************************************************/
-void hx8347gWriteRegister(uint8_t command, uint8_t data)
+void hx8347gWriteRegister(hx8347g_t *lcd, uint8_t command, uint8_t data)
 {
   // Write command
-  CLR_CS_CD_SET_RD_WR;
+  CLR_CS_CD_SET_RD_WR(lcd);
   // This won't work since it will only set the 1 bits and leave 0's as is
   LPC_GPIO->SET[HX8347G_DATA_PORT] = (command & 0xFF) << HX8347G_DATA_OFFSET;
   CLR_WR;
@@ -136,7 +128,7 @@ void hx8347gWriteRegister(uint8_t command, uint8_t data)
 
   // Write data
   SET_CD;
-  // CLR_CS_SET_CD_RD_WR;
+  // CLR_CS_SET_CD_RD_WR(lcd);
   // This won't work since it will only set the 1 bits and leave 0's as is
   LPC_GPIO->SET[HX8347G_DATA_PORT] = (data & 0xFF) << HX8347G_DATA_OFFSET;
   CLR_WR;
@@ -148,10 +140,10 @@ void hx8347gWriteRegister(uint8_t command, uint8_t data)
     @brief  Sends an 8-bit command
 */
 /**************************************************************************/
-void hx8347gWriteCommand(const uint8_t command)
+void hx8347gWriteCommand(hx8347g_t *lcd, const uint8_t command)
 {
   // Send command
-  CLR_CS_CD_SET_RD_WR;
+  CLR_CS_CD_SET_RD_WR(lcd);
   // This won't work since it will only set the 1 bits and leave 0's as is
   LPC_GPIO->SET[HX8347G_DATA_PORT] = (command & 0xFF) << HX8347G_DATA_OFFSET;
   CLR_WR;
@@ -163,10 +155,10 @@ void hx8347gWriteCommand(const uint8_t command)
     @brief  Sends 16-bits of data
 */
 /**************************************************************************/
-void hx8347gWriteData(const uint16_t data)
+void hx8347gWriteData(hx8347g_t *lcd, const uint16_t data)
 {
   // Send data
-  CLR_CS_SET_CD_RD_WR;
+  CLR_CS_SET_CD_RD_WR(lcd);
   // This won't work since it will only set the 1 bits and leave 0's as is
   LPC_GPIO->SET[HX8347G_DATA_PORT] = (data >> 8) << HX8347G_DATA_OFFSET;
   CLR_WR;
@@ -177,17 +169,36 @@ void hx8347gWriteData(const uint16_t data)
   SET_WR;
 }
 
+/**************************************************************************/
+/*! 
+    @brief  Reads one byte from the data bus (the bus must already be
+            set to input)
+*/
+/**************************************************************************/
+static uint8_t hx8347gReadBus(void)
+{
+  uint8_t d;
+
+  CLR_RD;
+  hx8347gDelay(10);
+  // PIN holds the level of the data lines, SET only the output latch
+  d = (LPC_GPIO->PIN[HX8347G_DATA_PORT] & HX8347G_DATA_MASK) >> HX8347G_DATA_OFFSET;
+  SET_RD;
+
+  return d;
+}
+
 /**************************************************************************/
 /*! 
     @brief  Reads the results from an 8-bit command
 */
 /**************************************************************************/
-uint16_t hx8347gReadRegister(uint8_t command)
+uint16_t hx8347gReadRegister(hx8347g_t *lcd, uint8_t command)
 {
   uint16_t d = 0;
 
   // Send command
-  CLR_CS_CD_SET_RD_WR;
+  CLR_CS_CD_SET_RD_WR(lcd);
   // This won't work since it will only set the 1 bits and leave 0's as is
   LPC_GPIO->SET[HX8347G_DATA_PORT] = (command & 0xFF) << HX8347G_DATA_OFFSET;
   CLR_WR;
@@ -198,12 +209,8 @@ uint16_t hx8347gReadRegister(uint8_t command)
 
   // Read results
   SET_CD_RD_WR;  
-  CLR_RD;
-  hx8347gDelay(10);
-  // This won't work since it will only set the 1 bits and leave 0's as is
-  d = (((LPC_GPIO->SET[HX8347G_DATA_PORT]) & HX8347G_DATA_MASK) >> HX8347G_DATA_OFFSET);
-  SET_RD;
-  SET_CS;
+  d = hx8347gReadBus();
+  SET_CS(lcd);
 
   // Set pins to output
   HX8347G_GPIO2DATA_SETOUTPUT;
@@ -214,32 +221,24 @@ uint16_t hx8347gReadRegister(uint8_t command)
 /**************************************************************************/
 /*! 
     @brief  Reads 16-bits of data from the current pixel location
+
+    The first read after the GRAM address is set only returns the old
+    contents of the read latch (DS section 4.1, p.29), so it is
+    discarded.
 */
 /**************************************************************************/
-uint16_t hx8347gReadData(void)
+uint16_t hx8347gReadData(hx8347g_t *lcd)
 {
   uint8_t high, low;
-  high = low = 0;
 
-  CLR_CS_SET_CD_RD_WR;
+  CLR_CS_SET_CD_RD_WR(lcd);
 
   // Set pins to input
   HX8347G_GPIO2DATA_SETINPUT;
-  CLR_RD;
-  hx8347gDelay(10);
-  // This won't work since it will only set the 1 bits and leave 0's as is
-  high = ((LPC_GPIO->SET[HX8347G_DATA_PORT]) & HX8347G_DATA_MASK);
-  high >>= HX8347G_DATA_OFFSET;
-  printf("high: 0x%02X\r\n", high);
-  SET_RD;
-  CLR_RD;
-  hx8347gDelay(10);
-  // This won't work since it will only set the 1 bits and leave 0's as is
-  low = ((LPC_GPIO->SET[HX8347G_DATA_PORT]) & HX8347G_DATA_MASK);
-  low >>= HX8347G_DATA_OFFSET;
-  printf("low: 0x%02X\r\n", low);
-  SET_RD;
-  SET_CS;
+  (void)hx8347gReadBus();
+  high = hx8347gReadBus();
+  low = hx8347gReadBus();
+  SET_CS(lcd);
   HX8347G_GPIO2DATA_SETOUTPUT;
 
   return (uint16_t)((high << 8) | (low));
@@ -250,12 +249,23 @@ uint16_t hx8347gReadData(void)
     @brief  Sets the cursor to the specified X/Y position
 */
 /**************************************************************************/
-void hx8347gSetCursor(const uint16_t x, const uint16_t y)
+void hx8347gSetCursor(hx8347g_t *lcd, const uint16_t x, const uint16_t y)
 {
-  hx8347gWriteRegister(HX8347G_CMD_COLADDRSTART2, x>>8);
-  hx8347gWriteRegister(HX8347G_CMD_COLADDRSTART1, x);
-  hx8347gWriteRegister(HX8347G_CMD_ROWADDRSTART2, y>>8);
-  hx8347gWriteRegister(HX8347G_CMD_ROWADDRSTART1, y);
+  // Restore the full-screen window if hx8347gSetWindow narrowed it, since the
+  // cursor would otherwise wrap inside the old window
+  if (lcd->windowActive)
+  {
+    lcd->windowActive = false;
+    hx8347gWriteRegister(lcd, HX8347G_CMD_COLADDREND2, (hx8347gGetWidth(lcd) - 1) >> 8);
+    hx8347gWriteRegister(lcd, HX8347G_CMD_COLADDREND1, hx8347gGetWidth(lcd) - 1);
+    hx8347gWriteRegister(lcd, HX8347G_CMD_ROWADDREND2, (hx8347gGetHeight(lcd) - 1) >> 8);
+    hx8347gWriteRegister(lcd, HX8347G_CMD_ROWADDREND1, hx8347gGetHeight(lcd) - 1);
+  }
+
+  hx8347gWriteRegister(lcd, HX8347G_CMD_COLADDRSTART2, x>>8);
+  hx8347gWriteRegister(lcd, HX8347G_CMD_COLADDRSTART1, x);
+  hx8347gWriteRegister(lcd, HX8347G_CMD_ROWADDRSTART2, y>>8);
+  hx8347gWriteRegister(lcd, HX8347G_CMD_ROWADDRSTART1, y);
 }
 
 /**************************************************************************/
@@ -263,7 +273,7 @@ void hx8347gSetCursor(const uint16_t x, const uint16_t y)
     @brief  Sends the initialisation sequence to the display controller
 */
 /**************************************************************************/
-void hx8347gInitDisplay(void)
+void hx8347gInitDisplay(hx8347g_t *lcd)
 {
   uint8_t i, a, d;
 
@@ -272,7 +282,7 @@ void hx8347gInitDisplay(void)
     
   SET_RD;
   SET_WR;
-  SET_CS;
+  SET_CS(lcd);
   SET_CD;
 
   // Reset display
@@ -293,7 +303,7 @@ void hx8347gInitDisplay(void)
     } 
     else 
     {
-      hx8347gWriteRegister(a, d);
+      hx8347gWriteRegister(lcd, a, d);
     }
   }
 }
@@ -303,9 +313,17 @@ void hx8347gInitDisplay(void)
     @brief  Sets the window confines
 */
 /**************************************************************************/
-void hx8347gSetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+void hx8347gSetAddrWindow(hx8347g_t *lcd, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
 {
-  // ToDo
+  hx8347gWriteRegister(lcd, HX8347G_CMD_COLADDRSTART2, x0>>8);
+  hx8347gWriteRegister(lcd, HX8347G_CMD_COLADDRSTART1, x0);
+  hx8347gWriteRegister(lcd, HX8347G_CMD_COLADDREND2, x1>>8);
+  hx8347gWriteRegister(lcd, HX8347G_CMD_COLADDREND1, x1);
+  hx8347gWriteRegister(lcd, HX8347G_CMD_ROWADDRSTART2, y0>>8);
+  hx8347gWriteRegister(lcd, HX8347G_CMD_ROWADDRSTART1, y0);
+  hx8347gWriteRegister(lcd, HX8347G_CMD_ROWADDREND2, y1>>8);
+  hx8347gWriteRegister(lcd, HX8347G_CMD_ROWADDREND1, y1);
+  lcd->windowActive = true;
 }
 
 /*************************************************/
@@ -317,10 +335,12 @@ void hx8347gSetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
     @brief  Configures any pins or HW and initialises the LCD controller
 */
 /**************************************************************************/
-void lcdInit(void)
+void hx8347gInit(void *ctx)
 {
+  hx8347g_t *lcd = (hx8347g_t *)ctx;
+
   // Set control line pins to output
-  LPC_GPIO->DIR[HX8347G_CONTROL_PORT] |=  (1 << HX8347G_CS_PIN);
+  LPC_GPIO->DIR[HX8347G_CONTROL_PORT] |=  lcd->csMask;
   LPC_GPIO->DIR[HX8347G_CONTROL_PORT] |=  (1 << HX8347G_CD_PIN);
   LPC_GPIO->DIR[HX8347G_CONTROL_PORT] |=  (1 << HX8347G_WR_PIN);
   LPC_GPIO->DIR[HX8347G_CONTROL_PORT] |=  (1 << HX8347G_RD_PIN);
@@ -330,7 +350,7 @@ void lcdInit(void)
 
   // Set backlight pin to output and turn it on
   LPC_GPIO->DIR[HX8347G_BL_PORT] |=  (1 << HX8347G_BL_PIN);
-  lcdBacklight(TRUE);
+  hx8347gBacklight(lcd, TRUE);
 
   // Set reset pin to output
   LPC_GPIO->DIR[HX8347G_RES_PORT] |=  (1 << HX8347G_RES_PIN);
@@ -340,15 +360,15 @@ void lcdInit(void)
   SET_RESET;
 
   // Initialize the display
-  hx8347gInitDisplay();
+  hx8347gInitDisplay(lcd);
 
   delay(50);
 
   // Set lcd to default orientation
-  // lcdSetOrientation(lcdOrientation);
+  // hx8347gSetOrientation(lcd, lcd->orientation);
 
   // Fill screen
-  lcdFillRGB(COLOR_BLUE);
+  hx8347gFillRGB(lcd, COLOR_BLUE);
   
   // Initialise the touch screen (and calibrate if necessary)
   // tsInit();
@@ -359,8 +379,10 @@ void lcdInit(void)
     @brief  Enables or disables the LCD backlight
 */
 /**************************************************************************/
-void lcdBacklight(bool state)
+void hx8347gBacklight(void *ctx, bool state)
 {
+  (void)ctx;
+
   // Set the backlight
   if (state)
   {
@@ -377,8 +399,9 @@ void lcdBacklight(bool state)
     @brief  Renders a simple test pattern on the LCD
 */
 /**************************************************************************/
-void lcdTest(void)
+void hx8347gTest(void *ctx)
 {
+  (void)ctx;
 }
 
 /**************************************************************************/
@@ -386,18 +409,20 @@ void lcdTest(void)
     @brief  Fills the LCD with the specified 16-bit color
 */
 /**************************************************************************/
-void lcdFillRGB(uint16_t color)
+void hx8347gFillRGB(void *ctx, uint16_t color)
 {
+  hx8347g_t *lcd = (hx8347g_t *)ctx;
+
   uint32_t i;
-  i = lcdGetWidth() * lcdGetHeight();
+  i = hx8347gGetWidth(lcd) * hx8347gGetHeight(lcd);
 
-  hx8347gSetCursor(0,0);
-  hx8347gWriteCommand(HX8347G_CMD_SRAMWRITECONTROL);
+  hx8347gSetCursor(lcd, 0,0);
+  hx8347gWriteCommand(lcd, HX8347G_CMD_SRAMWRITECONTROL);
 
   // Fill screen
   while (i--) 
   {
-    hx8347gWriteData(color);
+    hx8347gWriteData(lcd, color);
   }
 }
 
@@ -406,13 +431,15 @@ void lcdFillRGB(uint16_t color)
     @brief  Draws a single pixel at the specified X/Y location
 */
 /**************************************************************************/
-void lcdDrawPixel(uint16_t x, uint16_t y, uint16_t color)
+void hx8347gDrawPixel(void *ctx, uint16_t x, uint16_t y, uint16_t color)
 {
-  if ((x >= lcdGetWidth()) || (y >= lcdGetHeight())) return;
+  hx8347g_t *lcd = (hx8347g_t *)ctx;
+
+  if ((x >= hx8347gGetWidth(lcd)) || (y >= hx8347gGetHeight(lcd))) return;
 
-  hx8347gSetCursor(x,y);
-  hx8347gWriteCommand(HX8347G_CMD_SRAMWRITECONTROL);
-  hx8347gWriteData(color);
+  hx8347gSetCursor(lcd, x,y);
+  hx8347gWriteCommand(lcd, HX8347G_CMD_SRAMWRITECONTROL);
+  hx8347gWriteData(lcd, color);
 }
 
 /**************************************************************************/
@@ -421,8 +448,56 @@ void lcdDrawPixel(uint16_t x, uint16_t y, uint16_t color)
             faster than addressing each pixel individually)
 */
 /**************************************************************************/
-void lcdDrawPixels(uint16_t x, uint16_t y, uint16_t *data, uint32_t len)
+void hx8347gDrawPixels(void *ctx, uint16_t x, uint16_t y, uint16_t *data, uint32_t len)
+{
+  hx8347g_t *lcd = (hx8347g_t *)ctx;
+
+  if ((x >= hx8347gGetWidth(lcd)) || (y >= hx8347gGetHeight(lcd)) || (len == 0)) return;
+
+  // Clip to the end of the row
+  if (x + len > hx8347gGetWidth(lcd))
+  {
+    len = hx8347gGetWidth(lcd) - x;
+  }
+
+  hx8347gSetCursor(lcd, x, y);
+  hx8347gWriteCommand(lcd, HX8347G_CMD_SRAMWRITECONTROL);
+  while (len--)
+  {
+    hx8347gWriteData(lcd, *data++);
+  }
+}
+
+/**************************************************************************/
+/*! 
+    @brief  Sets the window that subsequent calls to hx8347gWritePixels
+            will fill, left to right and top to bottom
+
+    Rendering a block of pixels this way only sends the address once,
+    rather than once per row or once per pixel.
+*/
+/**************************************************************************/
+void hx8347gSetWindow(void *ctx, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+  hx8347g_t *lcd = (hx8347g_t *)ctx;
+
+  hx8347gSetAddrWindow(lcd, x0, y0, x1, y1);
+  hx8347gWriteCommand(lcd, HX8347G_CMD_SRAMWRITECONTROL);
+}
+
+/**************************************************************************/
+/*! 
+    @brief  Streams RGB565 pixels into the window set by hx8347gSetWindow
+*/
+/**************************************************************************/
+void hx8347gWritePixels(void *ctx, uint16_t *data, uint32_t len)
 {
+  hx8347g_t *lcd = (hx8347g_t *)ctx;
+
+  while (len--)
+  {
+    hx8347gWriteData(lcd, *data++);
+  }
 }
 
 /**************************************************************************/
@@ -431,8 +506,10 @@ void lcdDrawPixels(uint16_t x, uint16_t y, uint16_t *data, uint32_t len)
             setting individual pixels
 */
 /**************************************************************************/
-void lcdDrawHLine(uint16_t x0, uint16_t x1, uint16_t y, uint16_t color)
+void hx8347gDrawHLine(void *ctx, uint16_t x0, uint16_t x1, uint16_t y, uint16_t color)
 {
+  hx8347g_t *lcd = (hx8347g_t *)ctx;
+
   // Allows for slightly better performance than setting individual pixels
   uint16_t x, pixels;
 
@@ -445,21 +522,21 @@ void lcdDrawHLine(uint16_t x0, uint16_t x1, uint16_t y, uint16_t color)
   }
 
   // Check limits
-  if (x1 >= lcdGetWidth())
+  if (x1 >= hx8347gGetWidth(lcd))
   {
-    x1 = lcdGetWidth() - 1;
+    x1 = hx8347gGetWidth(lcd) - 1;
   }
-  if (x0 >= lcdGetWidth())
+  if (x0 >= hx8347gGetWidth(lcd))
   {
-    x0 = lcdGetWidth() - 1;
+    x0 = hx8347gGetWidth(lcd) - 1;
   }
 
-  hx8347gSetCursor(x0, y);
-  hx8347gWriteCommand(HX8347G_CMD_SRAMWRITECONTROL);
+  hx8347gSetCursor(lcd, x0, y);
+  hx8347gWriteCommand(lcd, HX8347G_CMD_SRAMWRITECONTROL);
   // Draw line
   for (pixels = 0; pixels < x1 - x0 + 1; pixels++)
   {
-    hx8347gWriteData(color);
+    hx8347gWriteData(lcd, color);
   }
 }
 
@@ -469,8 +546,9 @@ void lcdDrawHLine(uint16_t x0, uint16_t x1, uint16_t y, uint16_t color)
             setting individual pixels
 */
 /**************************************************************************/
-void lcdDrawVLine(uint16_t x, uint16_t y0, uint16_t y1, uint16_t color)
+void hx8347gDrawVLine(void *ctx, uint16_t x, uint16_t y0, uint16_t y1, uint16_t color)
 {
+  (void)ctx;
 }
 
 /**************************************************************************/
@@ -478,21 +556,23 @@ void lcdDrawVLine(uint16_t x, uint16_t y0, uint16_t y1, uint16_t color)
     @brief  Gets the 16-bit color of the pixel at the specified location
 */
 /**************************************************************************/
-uint16_t lcdGetPixel(uint16_t x, uint16_t y)
+uint16_t hx8347gGetPixel(void *ctx, uint16_t x, uint16_t y)
 {
+  hx8347g_t *lcd = (hx8347g_t *)ctx;
+
   /*  The first byte of data apparently has to be ignored (DS section 4.1, p.29):  
       Furthermore, there are two 18-bit bus control registers used to temporarily store the
       data written to or read from the GRAM. When the data is written into the GRAM from
       the MPU, it is first written into the write-data latch and then automatically written into
       the GRAM by internal operation. Data is read through the read-data latch when
       reading from the GRAM. Therefore, the first read data operation is invalid and the
-      following read data operations are valid. */
+      following read data operations are valid.  hx8347gReadData skips it. */
 
-  if ((x >= hx8347gProperties.width) || (y >= hx8347gProperties.height)) return 0;
+  if ((x >= lcd->properties.width) || (y >= lcd->properties.height)) return 0;
 
-  hx8347gSetCursor(x,y);
-  hx8347gWriteCommand(HX8347G_CMD_SRAMWRITECONTROL);
-  return hx8347gReadData();
+  hx8347gSetCursor(lcd, x,y);
+  hx8347gWriteCommand(lcd, HX8347G_CMD_SRAMWRITECONTROL);
+  return hx8347gReadData(lcd);
 }
 
 /**************************************************************************/
@@ -500,8 +580,9 @@ uint16_t lcdGetPixel(uint16_t x, uint16_t y)
     @brief  Sets the LCD orientation to horizontal and vertical
 */
 /**************************************************************************/
-void lcdSetOrientation(lcdOrientation_t orientation)
+void hx8347gSetOrientation(void *ctx, lcdOrientation_t orientation)
 {
+  (void)ctx;
 }
 
 /**************************************************************************/
@@ -509,8 +590,10 @@ void lcdSetOrientation(lcdOrientation_t orientation)
     @brief  Gets the current screen orientation (horizontal or vertical)
 */
 /**************************************************************************/
-lcdOrientation_t lcdGetOrientation(void)
+lcdOrientation_t hx8347gGetOrientation(void *ctx)
 {
+  hx8347g_t *lcd = (hx8347g_t *)ctx;
+  return lcd->orientation;
 }
 
 /**************************************************************************/
@@ -519,9 +602,10 @@ lcdOrientation_t lcdGetOrientation(void)
             on the current screen orientation)
 */
 /**************************************************************************/
-uint16_t lcdGetWidth(void)
+uint16_t hx8347gGetWidth(void *ctx)
 {
-    return hx8347gProperties.width;
+    hx8347g_t *lcd = (hx8347g_t *)ctx;
+    return lcd->properties.width;
 }
 
 /**************************************************************************/
@@ -530,9 +614,10 @@ uint16_t lcdGetWidth(void)
             on the current screen orientation)
 */
 /**************************************************************************/
-uint16_t lcdGetHeight(void)
+uint16_t hx8347gGetHeight(void *ctx)
 {
-    return hx8347gProperties.height;
+    hx8347g_t *lcd = (hx8347g_t *)ctx;
+    return lcd->properties.height;
 }
 
 /**************************************************************************/
@@ -541,8 +626,9 @@ uint16_t lcdGetHeight(void)
             specified number of pixels using a HW optimised routine
 */
 /**************************************************************************/
-void lcdScroll(int16_t pixels, uint16_t fillColor)
+void hx8347gScroll(void *ctx, int16_t pixels, uint16_t fillColor)
 {
+  (void)ctx;
 }
 
 /**************************************************************************/
@@ -550,8 +636,9 @@ void lcdScroll(int16_t pixels, uint16_t fillColor)
     @brief  Gets the controller's 16-bit (4 hexdigit) ID
 */
 /**************************************************************************/
-uint16_t lcdGetControllerID(void)
+uint16_t hx8347gGetControllerID(void *ctx)
 {
+    (void)ctx;
     return 0x8347;
 }
 
@@ -561,9 +648,44 @@ uint16_t lcdGetControllerID(void)
             generic capabilities and dimensions
 */
 /**************************************************************************/
-lcdProperties_t lcdGetProperties(void)
+lcdProperties_t hx8347gGetProperties(void *ctx)
 {
-    return hx8347gProperties;
+    hx8347g_t *lcd = (hx8347g_t *)ctx;
+    return lcd->properties;
 }
 
+/**************************************************************************/
+/*!
+    @brief  Operations table shared by every HX8347G panel
+*/
+/**************************************************************************/
+const lcdDriver_t hx8347gDriver =
+{
+  .init             = hx8347gInit,
+  .test             = hx8347gTest,
+  .getPixel         = hx8347gGetPixel,
+  .fillRGB          = hx8347gFillRGB,
+  .drawPixel        = hx8347gDrawPixel,
+  .drawPixels       = hx8347gDrawPixels,
+  .setWindow        = hx8347gSetWindow,
+  .writePixels      = hx8347gWritePixels,
+  .drawHLine        = hx8347gDrawHLine,
+  .drawVLine        = hx8347gDrawVLine,
+  .backlight        = hx8347gBacklight,
+  .scroll           = hx8347gScroll,
+  .getWidth         = hx8347gGetWidth,
+  .getHeight        = hx8347gGetHeight,
+  .setOrientation   = hx8347gSetOrientation,
+  .getOrientation   = hx8347gGetOrientation,
+  .getControllerID  = hx8347gGetControllerID,
+  .getProperties    = hx8347gGetProperties
+};
+
+/**************************************************************************/
+/*!
+    @brief  Handle for the panel on HX8347G_CS_PIN
+*/
+/**************************************************************************/
+lcdPanel_t hx8347gPanel = { &hx8347gDriver, &hx8347gDefault };
+
 #endif
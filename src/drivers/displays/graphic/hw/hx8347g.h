@@ -57,11 +57,13 @@ extern "C" {
 #define HX8347G_RD_PIN                (16)
 
 // Combined pin definitions for optimisation purposes.
-#define HX8347G_CS_CD_PINS            ((1<<HX8347G_CS_PIN) + (1<<HX8347G_CD_PIN))
+// The CS pin comes from the panel's hx8347g_t, since every panel on the
+// bus has its own chip select.
+#define HX8347G_CS_CD_PINS(lcd)       ((lcd)->csMask | (1<<HX8347G_CD_PIN))
 #define HX8347G_RD_WR_PINS            ((1<<HX8347G_RD_PIN) + (1<<HX8347G_WR_PIN))
-#define HX8347G_WR_CS_PINS            ((1<<HX8347G_WR_PIN) + (1<<HX8347G_CS_PIN))
+#define HX8347G_WR_CS_PINS(lcd)       ((lcd)->csMask | (1<<HX8347G_WR_PIN))
 #define HX8347G_CD_RD_WR_PINS         ((1<<HX8347G_CD_PIN) + (1<<HX8347G_RD_PIN) + (1<<HX8347G_WR_PIN))
-#define HX8347G_CS_CD_RD_WR_PINS      ((1<<HX8347G_CS_PIN) + (1<<HX8347G_CD_PIN) + (1<<HX8347G_RD_PIN) + (1<<HX8347G_WR_PIN))
+#define HX8347G_CS_CD_RD_WR_PINS(lcd) ((lcd)->csMask | HX8347G_CD_RD_WR_PINS)
 
 // Data bus (data pins must be consecutive and on the same port)
 #define HX8347G_DATA_PORT             (1)
@@ -84,8 +86,8 @@ extern "C" {
 // NOPs required since the bit-banding is too fast for some HX8347Gs to handle :(
 #define CLR_CD                        do { LPC_GPIO->CLR[HX8347G_CONTROL_PORT] = (1 << HX8347G_CD_PIN); } while(0)
 #define SET_CD                        do { LPC_GPIO->SET[HX8347G_CONTROL_PORT] = (1 << HX8347G_CD_PIN); } while(0)
-#define CLR_CS                        do { LPC_GPIO->CLR[HX8347G_CONTROL_PORT] = (1 << HX8347G_CS_PIN); } while(0)
-#define SET_CS                        do { LPC_GPIO->SET[HX8347G_CONTROL_PORT] = (1 << HX8347G_CS_PIN); } while(0)
+#define CLR_CS(lcd)                   do { LPC_GPIO->CLR[HX8347G_CONTROL_PORT] = (lcd)->csMask; } while(0)
+#define SET_CS(lcd)                   do { LPC_GPIO->SET[HX8347G_CONTROL_PORT] = (lcd)->csMask; } while(0)
 #define CLR_WR                        do { LPC_GPIO->CLR[HX8347G_CONTROL_PORT] = (1 << HX8347G_WR_PIN); } while(0)
 #define SET_WR                        do { LPC_GPIO->SET[HX8347G_CONTROL_PORT] = (1 << HX8347G_WR_PIN); } while(0)
 #define CLR_RD                        do { LPC_GPIO->CLR[HX8347G_CONTROL_PORT] = (1 << HX8347G_RD_PIN); } while(0)
@@ -97,12 +99,12 @@ extern "C" {
 
 // These 'combined' macros are defined to improve code performance by
 // reducing the number of instructions in heavily used functions
-#define CLR_CS_CD                     do { LPC_GPIO->CLR[HX8347G_CONTROL_PORT] = (HX8347G_CS_CD_PINS); } while(0)
+#define CLR_CS_CD(lcd)                do { LPC_GPIO->CLR[HX8347G_CONTROL_PORT] = HX8347G_CS_CD_PINS(lcd); } while(0)
 #define SET_RD_WR                     do { LPC_GPIO->SET[HX8347G_CONTROL_PORT] = (HX8347G_RD_WR_PINS); } while(0)
-#define SET_WR_CS                     do { LPC_GPIO->SET[HX8347G_CONTROL_PORT] = (HX8347G_WR_CS_PINS); } while(0)
+#define SET_WR_CS(lcd)                do { LPC_GPIO->SET[HX8347G_CONTROL_PORT] = HX8347G_WR_CS_PINS(lcd); } while(0)
 #define SET_CD_RD_WR                  do { LPC_GPIO->SET[HX8347G_CONTROL_PORT] = (HX8347G_CD_RD_WR_PINS); } while(0)
-#define CLR_CS_CD_SET_RD_WR           do { LPC_GPIO->CLR[HX8347G_CONTROL_PORT] = (HX8347G_CS_CD_PINS); LPC_GPIO->SET[HX8347G_CONTROL_PORT] = (HX8347G_RD_WR_PINS); } while(0)
-#define CLR_CS_SET_CD_RD_WR           do { LPC_GPIO->CLR[HX8347G_CONTROL_PORT] = (HX8347G_CS_PIN); LPC_GPIO->SET[HX8347G_CONTROL_PORT] = (HX8347G_CD_RD_WR_PINS); } while(0)
+#define CLR_CS_CD_SET_RD_WR(lcd)      do { LPC_GPIO->CLR[HX8347G_CONTROL_PORT] = HX8347G_CS_CD_PINS(lcd); LPC_GPIO->SET[HX8347G_CONTROL_PORT] = (HX8347G_RD_WR_PINS); } while(0)
+#define CLR_CS_SET_CD_RD_WR(lcd)      do { LPC_GPIO->CLR[HX8347G_CONTROL_PORT] = (lcd)->csMask; LPC_GPIO->SET[HX8347G_CONTROL_PORT] = (HX8347G_CD_RD_WR_PINS); } while(0)
 
 // Used to indicate a delay in the init sequence
 #define HX8347G_INIT_DELAY                      (0xF8)  // 0xFF is already used
@@ -180,6 +182,52 @@ extern "C" {
 #define HX8347G_CMD_SOURCEOP_CONTROLIDLE        (0xE9)
 #define HX8347G_CMD_PAGESELECT                  (0xFF)
 
+// State of one HX8347G panel.  Panels share the data bus, the CD, WR
+// and RD lines and the backlight and reset pins above, and each one has
+// its own chip select pin on HX8347G_CONTROL_PORT.  Since the reset is
+// shared, call lcdInit on every panel before drawing on any of them.
+typedef struct
+{
+  uint32_t          csMask;       // Chip select pin mask on HX8347G_CONTROL_PORT
+  lcdOrientation_t  orientation;
+  lcdProperties_t   properties;
+  bool              windowActive; // hx8347gSetWindow narrowed the GRAM window
+} hx8347g_t;
+
+// Initialiser for an hx8347g_t with its chip select on
+// HX8347G_CONTROL_PORT.csPin
+#define HX8347G_PANEL(csPin)  { (1 << (csPin)), LCD_ORIENTATION_PORTRAIT,                 \
+                                {  240,       /* Screen width */                          \
+                                   320,       /* Screen height */                         \
+                                   true,      /* Has touchscreen? */                      \
+                                   false,     /* Allows orientation changes? */           \
+                                   false,     /* Supports HW scrolling? */                \
+                                   true,      /* Driver includes fast horizontal line? */ \
+                                   false,     /* Driver includes fast vertical line? */   \
+                                   true },    /* hx8347gGetPixel reads the panel? */      \
+                                false }
+
+// lcd.h entry points implemented by this driver (see lcdDriver_t), which
+// take the panel's hx8347g_t as ctx
+void     hx8347gInit(void *ctx);
+void     hx8347gTest(void *ctx);
+uint16_t hx8347gGetPixel(void *ctx, uint16_t x, uint16_t y);
+void     hx8347gFillRGB(void *ctx, uint16_t color);
+void     hx8347gDrawPixel(void *ctx, uint16_t x, uint16_t y, uint16_t color);
+void     hx8347gDrawPixels(void *ctx, uint16_t x, uint16_t y, uint16_t *data, uint32_t len);
+void     hx8347gSetWindow(void *ctx, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+void     hx8347gWritePixels(void *ctx, uint16_t *data, uint32_t len);
+void     hx8347gDrawHLine(void *ctx, uint16_t x0, uint16_t x1, uint16_t y, uint16_t color);
+void     hx8347gDrawVLine(void *ctx, uint16_t x, uint16_t y0, uint16_t y1, uint16_t color);
+void     hx8347gBacklight(void *ctx, bool state);
+void     hx8347gScroll(void *ctx, int16_t pixels, uint16_t fillColor);
+uint16_t hx8347gGetWidth(void *ctx);
+uint16_t hx8347gGetHeight(void *ctx);
+void     hx8347gSetOrientation(void *ctx, lcdOrientation_t orientation);
+lcdOrientation_t hx8347gGetOrientation(void *ctx);
+uint16_t hx8347gGetControllerID(void *ctx);
+lcdProperties_t  hx8347gGetProperties(void *ctx);
+
 #ifdef __cplusplus
 }
 #endif 
@@ -47,17 +47,17 @@
 #include "core/delay/delay.h"
 #include "core/gpio/gpio.h"
 
-static lcdOrientation_t lcdOrientation = LCD_ORIENTATION_PORTRAIT;
-static lcdProperties_t st7735Properties = { ST7735_PANEL_WIDTH, ST7735_PANEL_HEIGHT, false, true, false, true, true };
+// State of the panel on ST7735_CS_PIN (see st7735Panel)
+static st7735_t st7735Default = ST7735_PANEL(ST7735_CS_PIN);
 
 /*************************************************/
 /* Private Methods                               */
 /*************************************************/
 
 /*************************************************/
-void st7735WriteCmd(uint8_t command) 
+void st7735WriteCmd(st7735_t *lcd, uint8_t command) 
 {
-  CLR_CS;
+  CLR_CS(lcd);
   CLR_RS;
   uint8_t i = 0;
   for (i=0; i<8; i++) 
@@ -74,13 +74,13 @@ void st7735WriteCmd(uint8_t command)
     command <<= 1; 
     SET_SCL;
   } 
-  SET_CS; 
+  SET_CS(lcd); 
 }
 
 /*************************************************/
-void st7735WriteData(uint8_t data)
+void st7735WriteData(st7735_t *lcd, uint8_t data)
 {
-  CLR_CS;
+  CLR_CS(lcd);
   SET_RS; 
   uint8_t i = 0;
   for (i=0; i<8; i++) 
@@ -97,367 +97,367 @@ void st7735WriteData(uint8_t data)
     data <<= 1; 
     SET_SCL;    
   } 
-  SET_CS;
+  SET_CS(lcd);
 }
 
 /*************************************************/
-void st7735SetAddrWindowB(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
+void st7735SetAddrWindowB(st7735_t *lcd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
 {
-  st7735WriteCmd(ST7735_CASET);   // column addr set
-  st7735WriteData(0x00);
-  st7735WriteData(x0+2);          // XSTART 
-  st7735WriteData(0x00);
-  st7735WriteData(x1+2);          // XEND
-
-  st7735WriteCmd(ST7735_RASET);   // row addr set
-  st7735WriteData(0x00);
-  st7735WriteData(y0+1);          // YSTART
-  st7735WriteData(0x00);
-  st7735WriteData(y1+1);          // YEND
+  st7735WriteCmd(lcd, ST7735_CASET);   // column addr set
+  st7735WriteData(lcd, 0x00);
+  st7735WriteData(lcd, x0+2);          // XSTART 
+  st7735WriteData(lcd, 0x00);
+  st7735WriteData(lcd, x1+2);          // XEND
+
+  st7735WriteCmd(lcd, ST7735_RASET);   // row addr set
+  st7735WriteData(lcd, 0x00);
+  st7735WriteData(lcd, y0+1);          // YSTART
+  st7735WriteData(lcd, 0x00);
+  st7735WriteData(lcd, y1+1);          // YEND
 }
 
 /*************************************************/
-void st7735SetAddrWindow(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
+void st7735SetAddrWindow(st7735_t *lcd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
 {
-  st7735WriteCmd(ST7735_CASET);   // column addr set
-  st7735WriteData(0x00);
-  st7735WriteData(x0);          // XSTART
-  st7735WriteData(0x00);
-  st7735WriteData(x1);          // XEND
-
-  st7735WriteCmd(ST7735_RASET);   // row addr set
-  st7735WriteData(0x00);
-  st7735WriteData(y0);          // YSTART
-  st7735WriteData(0x00);
-  st7735WriteData(y1);          // YEND
+  st7735WriteCmd(lcd, ST7735_CASET);   // column addr set
+  st7735WriteData(lcd, 0x00);
+  st7735WriteData(lcd, x0);          // XSTART
+  st7735WriteData(lcd, 0x00);
+  st7735WriteData(lcd, x1);          // XEND
+
+  st7735WriteCmd(lcd, ST7735_RASET);   // row addr set
+  st7735WriteData(lcd, 0x00);
+  st7735WriteData(lcd, y0);          // YSTART
+  st7735WriteData(lcd, 0x00);
+  st7735WriteData(lcd, y1);          // YEND
 }
 
 /*************************************************/
 // https://github.com/adafruit/Adafruit-ST7735-Library/blob/master/Adafruit_ST7735.cpp
-void st7735InitDisplayB(void)
+void st7735InitDisplayB(st7735_t *lcd)
 {
-  st7735WriteCmd(ST7735_SWRESET); // software reset
+  st7735WriteCmd(lcd, ST7735_SWRESET); // software reset
   delay(50);
-  st7735WriteCmd(ST7735_SLPOUT);  // out of sleep mode
+  st7735WriteCmd(lcd, ST7735_SLPOUT);  // out of sleep mode
   delay(500);
   
-  st7735WriteCmd(ST7735_COLMOD);  // set color mode
-  st7735WriteData(0x05);          // 16-bit color
+  st7735WriteCmd(lcd, ST7735_COLMOD);  // set color mode
+  st7735WriteData(lcd, 0x05);          // 16-bit color
   delay(10);
   
-  st7735WriteCmd(ST7735_FRMCTR1); // frame rate control
-  st7735WriteData(0x00);          // fastest refresh
-  st7735WriteData(0x06);          // 6 lines front porch
-  st7735WriteData(0x03);          // 3 lines backporch
+  st7735WriteCmd(lcd, ST7735_FRMCTR1); // frame rate control
+  st7735WriteData(lcd, 0x00);          // fastest refresh
+  st7735WriteData(lcd, 0x06);          // 6 lines front porch
+  st7735WriteData(lcd, 0x03);          // 3 lines backporch
   delay(10);
   
-  st7735WriteCmd(ST7735_MADCTL);  // memory access control (directions)
-  st7735WriteData(0x08);          // row address/col address, bottom to top refresh, BGR, right to left refresh
+  st7735WriteCmd(lcd, ST7735_MADCTL);  // memory access control (directions)
+  st7735WriteData(lcd, 0x08);          // row address/col address, bottom to top refresh, BGR, right to left refresh
   
-  st7735WriteCmd(ST7735_DISSET5); // display settings #5
-  st7735WriteData(0x15);          // 1 clock cycle nonoverlap, 2 cycle gate rise, 3 cycle oscil. equalize
-  st7735WriteData(0x02);          // fix on VTL
+  st7735WriteCmd(lcd, ST7735_DISSET5); // display settings #5
+  st7735WriteData(lcd, 0x15);          // 1 clock cycle nonoverlap, 2 cycle gate rise, 3 cycle oscil. equalize
+  st7735WriteData(lcd, 0x02);          // fix on VTL
  
-  st7735WriteCmd(ST7735_INVCTR);  // display inversion control
-  st7735WriteData(0x0);           // line inversion
+  st7735WriteCmd(lcd, ST7735_INVCTR);  // display inversion control
+  st7735WriteData(lcd, 0x0);           // line inversion
  
-  st7735WriteCmd(ST7735_PWCTR1);  // power control
-  st7735WriteData(0x02);          // GVDD = 4.7V 
-  st7735WriteData(0x70);          // 1.0uA
+  st7735WriteCmd(lcd, ST7735_PWCTR1);  // power control
+  st7735WriteData(lcd, 0x02);          // GVDD = 4.7V 
+  st7735WriteData(lcd, 0x70);          // 1.0uA
   delay(10);
-  st7735WriteCmd(ST7735_PWCTR2);  // power control
-  st7735WriteData(0x05);          // VGH = 14.7V, VGL = -7.35V 
-  st7735WriteCmd(ST7735_PWCTR3);  // power control
-  st7735WriteData(0x01);          // Opamp current small 
-  st7735WriteData(0x02);          // Boost frequency
+  st7735WriteCmd(lcd, ST7735_PWCTR2);  // power control
+  st7735WriteData(lcd, 0x05);          // VGH = 14.7V, VGL = -7.35V 
+  st7735WriteCmd(lcd, ST7735_PWCTR3);  // power control
+  st7735WriteData(lcd, 0x01);          // Opamp current small 
+  st7735WriteData(lcd, 0x02);          // Boost frequency
   
   
-  st7735WriteCmd(ST7735_VMCTR1);  // power control
-  st7735WriteData(0x3C);          // VCOMH = 4V
-  st7735WriteData(0x38);          // VCOML = -1.1V
+  st7735WriteCmd(lcd, ST7735_VMCTR1);  // power control
+  st7735WriteData(lcd, 0x3C);          // VCOMH = 4V
+  st7735WriteData(lcd, 0x38);          // VCOML = -1.1V
   delay(10);
   
-  st7735WriteCmd(ST7735_PWCTR6);  // power control
-  st7735WriteData(0x11); 
-  st7735WriteData(0x15);
+  st7735WriteCmd(lcd, ST7735_PWCTR6);  // power control
+  st7735WriteData(lcd, 0x11); 
+  st7735WriteData(lcd, 0x15);
   
-  st7735WriteCmd(ST7735_GMCTRP1);
-  st7735WriteData(0x09);
-  st7735WriteData(0x16);
-  st7735WriteData(0x09);
-  st7735WriteData(0x20);
-  st7735WriteData(0x21);
-  st7735WriteData(0x1B);
-  st7735WriteData(0x13);
-  st7735WriteData(0x19);
-  st7735WriteData(0x17);
-  st7735WriteData(0x15);
-  st7735WriteData(0x1E);
-  st7735WriteData(0x2B);
-  st7735WriteData(0x04);
-  st7735WriteData(0x05);
-  st7735WriteData(0x02);
-  st7735WriteData(0x0E);
-  st7735WriteCmd(ST7735_GMCTRN1);
-  st7735WriteData(0x0B); 
-  st7735WriteData(0x14); 
-  st7735WriteData(0x08); 
-  st7735WriteData(0x1E); 
-  st7735WriteData(0x22); 
-  st7735WriteData(0x1D); 
-  st7735WriteData(0x18); 
-  st7735WriteData(0x1E); 
-  st7735WriteData(0x1B); 
-  st7735WriteData(0x1A); 
-  st7735WriteData(0x24); 
-  st7735WriteData(0x2B); 
-  st7735WriteData(0x06); 
-  st7735WriteData(0x06); 
-  st7735WriteData(0x02); 
-  st7735WriteData(0x0F); 
+  st7735WriteCmd(lcd, ST7735_GMCTRP1);
+  st7735WriteData(lcd, 0x09);
+  st7735WriteData(lcd, 0x16);
+  st7735WriteData(lcd, 0x09);
+  st7735WriteData(lcd, 0x20);
+  st7735WriteData(lcd, 0x21);
+  st7735WriteData(lcd, 0x1B);
+  st7735WriteData(lcd, 0x13);
+  st7735WriteData(lcd, 0x19);
+  st7735WriteData(lcd, 0x17);
+  st7735WriteData(lcd, 0x15);
+  st7735WriteData(lcd, 0x1E);
+  st7735WriteData(lcd, 0x2B);
+  st7735WriteData(lcd, 0x04);
+  st7735WriteData(lcd, 0x05);
+  st7735WriteData(lcd, 0x02);
+  st7735WriteData(lcd, 0x0E);
+  st7735WriteCmd(lcd, ST7735_GMCTRN1);
+  st7735WriteData(lcd, 0x0B); 
+  st7735WriteData(lcd, 0x14); 
+  st7735WriteData(lcd, 0x08); 
+  st7735WriteData(lcd, 0x1E); 
+  st7735WriteData(lcd, 0x22); 
+  st7735WriteData(lcd, 0x1D); 
+  st7735WriteData(lcd, 0x18); 
+  st7735WriteData(lcd, 0x1E); 
+  st7735WriteData(lcd, 0x1B); 
+  st7735WriteData(lcd, 0x1A); 
+  st7735WriteData(lcd, 0x24); 
+  st7735WriteData(lcd, 0x2B); 
+  st7735WriteData(lcd, 0x06); 
+  st7735WriteData(lcd, 0x06); 
+  st7735WriteData(lcd, 0x02); 
+  st7735WriteData(lcd, 0x0F); 
   delay(10);
   
-  st7735WriteCmd(ST7735_CASET);   // column addr set
-  st7735WriteData(0x00);
-  st7735WriteData(0x02);          // XSTART = 2
-  st7735WriteData(0x00);
-  st7735WriteData(0x81);          // XEND = 129
-
-  st7735WriteCmd(ST7735_RASET);   // row addr set
-  st7735WriteData(0x00);
-  st7735WriteData(0x02);          // XSTART = 1
-  st7735WriteData(0x00);
-  st7735WriteData(0x81);          // XEND = 160
-
-  st7735WriteCmd(ST7735_NORON);   // normal display on
+  st7735WriteCmd(lcd, ST7735_CASET);   // column addr set
+  st7735WriteData(lcd, 0x00);
+  st7735WriteData(lcd, 0x02);          // XSTART = 2
+  st7735WriteData(lcd, 0x00);
+  st7735WriteData(lcd, 0x81);          // XEND = 129
+
+  st7735WriteCmd(lcd, ST7735_RASET);   // row addr set
+  st7735WriteData(lcd, 0x00);
+  st7735WriteData(lcd, 0x02);          // XSTART = 1
+  st7735WriteData(lcd, 0x00);
+  st7735WriteData(lcd, 0x81);          // XEND = 160
+
+  st7735WriteCmd(lcd, ST7735_NORON);   // normal display on
   delay(10);
   
-  st7735WriteCmd(ST7735_DISPON);
+  st7735WriteCmd(lcd, ST7735_DISPON);
   delay(500);
 }
 
 /*************************************************/
-void st7735InitDisplayR(void)
+void st7735InitDisplayR(st7735_t *lcd)
 {
-  st7735WriteCmd(ST7735_SWRESET); // software reset
+  st7735WriteCmd(lcd, ST7735_SWRESET); // software reset
   delay(150);
-  st7735WriteCmd(ST7735_SLPOUT);  // out of sleep mode
+  st7735WriteCmd(lcd, ST7735_SLPOUT);  // out of sleep mode
   delay(500);
 
-  st7735WriteCmd(ST7735_FRMCTR1); // frame rate control
-  st7735WriteData(0x01);          // fastest refresh
-  st7735WriteData(0x2C);          // 6 lines front porch
-  st7735WriteData(0x2D);          // 3 lines backporch
-
-  st7735WriteCmd(ST7735_FRMCTR2); // frame rate control
-  st7735WriteData(0x01);          // fastest refresh
-  st7735WriteData(0x2C);          // 6 lines front porch
-  st7735WriteData(0x2D);          // 3 lines backporch
-
-  st7735WriteCmd(ST7735_FRMCTR3); // frame rate control
-  st7735WriteData(0x01);          // fastest refresh
-  st7735WriteData(0x2C);          // 6 lines front porch
-  st7735WriteData(0x2D);          // 3 lines backporch
-  st7735WriteData(0x01);          // fastest refresh
-  st7735WriteData(0x2C);          // 6 lines front porch
-  st7735WriteData(0x2D);          // 3 lines backporch
-
-  st7735WriteCmd(ST7735_INVCTR);  // display inversion control
-  st7735WriteData(0x07);           // line inversion
-
-  st7735WriteCmd(ST7735_PWCTR1);  // power control
-  st7735WriteData(0xA2);          // GVDD = 4.7V
-  st7735WriteData(0x02);          // 1.0uA
-  st7735WriteData(0x84);          // 1.0uA
-  st7735WriteCmd(ST7735_PWCTR2);  // power control
-  st7735WriteData(0xC5);          // VGH = 14.7V, VGL = -7.35V
-  st7735WriteCmd(ST7735_PWCTR3);  // power control
-  st7735WriteData(0x0A);          // Opamp current small
-  st7735WriteData(0x00);          // Boost frequency
-  st7735WriteCmd(ST7735_PWCTR4);  // power control
-  st7735WriteData(0x8A);
-  st7735WriteData(0x2A);
-  st7735WriteCmd(ST7735_PWCTR5);  // power control
-  st7735WriteData(0x8A);
-  st7735WriteData(0xEE);
-
-  st7735WriteCmd(ST7735_VMCTR1);  // power control
-  st7735WriteData(0x0E);          // VCOMH = 4V
-
-  st7735WriteCmd(ST7735_INVOFF);
-
-  st7735WriteCmd(ST7735_MADCTL);  // memory access control (directions)
-//  st7735WriteData(0xC8);          // row address/col address, bottom to top refresh, BGR, right to left refresh
-  st7735WriteData(0xC0);          // row address/col address, bottom to top refresh, RGB, right to left refresh
-
-  st7735WriteCmd(ST7735_COLMOD);  // set color mode
-  st7735WriteData(0x05);          // 16-bit color
+  st7735WriteCmd(lcd, ST7735_FRMCTR1); // frame rate control
+  st7735WriteData(lcd, 0x01);          // fastest refresh
+  st7735WriteData(lcd, 0x2C);          // 6 lines front porch
+  st7735WriteData(lcd, 0x2D);          // 3 lines backporch
+
+  st7735WriteCmd(lcd, ST7735_FRMCTR2); // frame rate control
+  st7735WriteData(lcd, 0x01);          // fastest refresh
+  st7735WriteData(lcd, 0x2C);          // 6 lines front porch
+  st7735WriteData(lcd, 0x2D);          // 3 lines backporch
+
+  st7735WriteCmd(lcd, ST7735_FRMCTR3); // frame rate control
+  st7735WriteData(lcd, 0x01);          // fastest refresh
+  st7735WriteData(lcd, 0x2C);          // 6 lines front porch
+  st7735WriteData(lcd, 0x2D);          // 3 lines backporch
+  st7735WriteData(lcd, 0x01);          // fastest refresh
+  st7735WriteData(lcd, 0x2C);          // 6 lines front porch
+  st7735WriteData(lcd, 0x2D);          // 3 lines backporch
+
+  st7735WriteCmd(lcd, ST7735_INVCTR);  // display inversion control
+  st7735WriteData(lcd, 0x07);           // line inversion
+
+  st7735WriteCmd(lcd, ST7735_PWCTR1);  // power control
+  st7735WriteData(lcd, 0xA2);          // GVDD = 4.7V
+  st7735WriteData(lcd, 0x02);          // 1.0uA
+  st7735WriteData(lcd, 0x84);          // 1.0uA
+  st7735WriteCmd(lcd, ST7735_PWCTR2);  // power control
+  st7735WriteData(lcd, 0xC5);          // VGH = 14.7V, VGL = -7.35V
+  st7735WriteCmd(lcd, ST7735_PWCTR3);  // power control
+  st7735WriteData(lcd, 0x0A);          // Opamp current small
+  st7735WriteData(lcd, 0x00);          // Boost frequency
+  st7735WriteCmd(lcd, ST7735_PWCTR4);  // power control
+  st7735WriteData(lcd, 0x8A);
+  st7735WriteData(lcd, 0x2A);
+  st7735WriteCmd(lcd, ST7735_PWCTR5);  // power control
+  st7735WriteData(lcd, 0x8A);
+  st7735WriteData(lcd, 0xEE);
+
+  st7735WriteCmd(lcd, ST7735_VMCTR1);  // power control
+  st7735WriteData(lcd, 0x0E);          // VCOMH = 4V
+
+  st7735WriteCmd(lcd, ST7735_INVOFF);
+
+  st7735WriteCmd(lcd, ST7735_MADCTL);  // memory access control (directions)
+//  st7735WriteData(lcd, 0xC8);          // row address/col address, bottom to top refresh, BGR, right to left refresh
+  st7735WriteData(lcd, 0xC0);          // row address/col address, bottom to top refresh, RGB, right to left refresh
+
+  st7735WriteCmd(lcd, ST7735_COLMOD);  // set color mode
+  st7735WriteData(lcd, 0x05);          // 16-bit color
 
 //============= RED ======================
-  st7735WriteCmd(ST7735_CASET);   // column addr set
-  st7735WriteData(0x00);
-  st7735WriteData(0x00);          // XSTART = 0
-  st7735WriteData(0x00);
-  st7735WriteData(0x7F);          // XEND = 127
-
-  st7735WriteCmd(ST7735_RASET);   // row addr set
-  st7735WriteData(0x00);
-  st7735WriteData(0x00);          // YSTART = 0
-  st7735WriteData(0x00);
-  st7735WriteData(0x9F);          // YEND = 159
+  st7735WriteCmd(lcd, ST7735_CASET);   // column addr set
+  st7735WriteData(lcd, 0x00);
+  st7735WriteData(lcd, 0x00);          // XSTART = 0
+  st7735WriteData(lcd, 0x00);
+  st7735WriteData(lcd, 0x7F);          // XEND = 127
+
+  st7735WriteCmd(lcd, ST7735_RASET);   // row addr set
+  st7735WriteData(lcd, 0x00);
+  st7735WriteData(lcd, 0x00);          // YSTART = 0
+  st7735WriteData(lcd, 0x00);
+  st7735WriteData(lcd, 0x9F);          // YEND = 159
 //========================================
 
-  st7735WriteCmd(ST7735_GMCTRP1);
-  st7735WriteData(0x02);
-  st7735WriteData(0x1C);
-  st7735WriteData(0x07);
-  st7735WriteData(0x12);
-  st7735WriteData(0x37);
-  st7735WriteData(0x32);
-  st7735WriteData(0x29);
-  st7735WriteData(0x2D);
-  st7735WriteData(0x29);
-  st7735WriteData(0x25);
-  st7735WriteData(0x2B);
-  st7735WriteData(0x39);
-  st7735WriteData(0x00);
-  st7735WriteData(0x01);
-  st7735WriteData(0x03);
-  st7735WriteData(0x10);
-  st7735WriteCmd(ST7735_GMCTRN1);
-  st7735WriteData(0x03);
-  st7735WriteData(0x1D);
-  st7735WriteData(0x07);
-  st7735WriteData(0x06);
-  st7735WriteData(0x2E);
-  st7735WriteData(0x2C);
-  st7735WriteData(0x29);
-  st7735WriteData(0x2D);
-  st7735WriteData(0x2E);
-  st7735WriteData(0x2E);
-  st7735WriteData(0x37);
-  st7735WriteData(0x3F);
-  st7735WriteData(0x00);
-  st7735WriteData(0x00);
-  st7735WriteData(0x02);
-  st7735WriteData(0x10);
-
-  st7735WriteCmd(ST7735_NORON);   // normal display on
+  st7735WriteCmd(lcd, ST7735_GMCTRP1);
+  st7735WriteData(lcd, 0x02);
+  st7735WriteData(lcd, 0x1C);
+  st7735WriteData(lcd, 0x07);
+  st7735WriteData(lcd, 0x12);
+  st7735WriteData(lcd, 0x37);
+  st7735WriteData(lcd, 0x32);
+  st7735WriteData(lcd, 0x29);
+  st7735WriteData(lcd, 0x2D);
+  st7735WriteData(lcd, 0x29);
+  st7735WriteData(lcd, 0x25);
+  st7735WriteData(lcd, 0x2B);
+  st7735WriteData(lcd, 0x39);
+  st7735WriteData(lcd, 0x00);
+  st7735WriteData(lcd, 0x01);
+  st7735WriteData(lcd, 0x03);
+  st7735WriteData(lcd, 0x10);
+  st7735WriteCmd(lcd, ST7735_GMCTRN1);
+  st7735WriteData(lcd, 0x03);
+  st7735WriteData(lcd, 0x1D);
+  st7735WriteData(lcd, 0x07);
+  st7735WriteData(lcd, 0x06);
+  st7735WriteData(lcd, 0x2E);
+  st7735WriteData(lcd, 0x2C);
+  st7735WriteData(lcd, 0x29);
+  st7735WriteData(lcd, 0x2D);
+  st7735WriteData(lcd, 0x2E);
+  st7735WriteData(lcd, 0x2E);
+  st7735WriteData(lcd, 0x37);
+  st7735WriteData(lcd, 0x3F);
+  st7735WriteData(lcd, 0x00);
+  st7735WriteData(lcd, 0x00);
+  st7735WriteData(lcd, 0x02);
+  st7735WriteData(lcd, 0x10);
+
+  st7735WriteCmd(lcd, ST7735_NORON);   // normal display on
   delay(10);
 
-  st7735WriteCmd(ST7735_DISPON);
+  st7735WriteCmd(lcd, ST7735_DISPON);
   delay(500);
 }
 
 /*************************************************/
-void st7735InitDisplayG(void)
+void st7735InitDisplayG(st7735_t *lcd)
 {
-	  st7735WriteCmd(ST7735_SWRESET); // software reset
+	  st7735WriteCmd(lcd, ST7735_SWRESET); // software reset
 	  delay(150);
-	  st7735WriteCmd(ST7735_SLPOUT);  // out of sleep mode
+	  st7735WriteCmd(lcd, ST7735_SLPOUT);  // out of sleep mode
 	  delay(500);
 
-	  st7735WriteCmd(ST7735_FRMCTR1); // frame rate control
-	  st7735WriteData(0x01);          // fastest refresh
-	  st7735WriteData(0x2C);          // 6 lines front porch
-	  st7735WriteData(0x2D);          // 3 lines backporch
-
-	  st7735WriteCmd(ST7735_FRMCTR2); // frame rate control
-	  st7735WriteData(0x01);          // fastest refresh
-	  st7735WriteData(0x2C);          // 6 lines front porch
-	  st7735WriteData(0x2D);          // 3 lines backporch
-
-	  st7735WriteCmd(ST7735_FRMCTR3); // frame rate control
-	  st7735WriteData(0x01);          // fastest refresh
-	  st7735WriteData(0x2C);          // 6 lines front porch
-	  st7735WriteData(0x2D);          // 3 lines backporch
-	  st7735WriteData(0x01);          // fastest refresh
-	  st7735WriteData(0x2C);          // 6 lines front porch
-	  st7735WriteData(0x2D);          // 3 lines backporch
-
-	  st7735WriteCmd(ST7735_INVCTR);  // display inversion control
-	  st7735WriteData(0x07);           // line inversion
-
-	  st7735WriteCmd(ST7735_PWCTR1);  // power control
-	  st7735WriteData(0xA2);          // GVDD = 4.7V
-	  st7735WriteData(0x02);          // 1.0uA
-	  st7735WriteData(0x84);          // 1.0uA
-	  st7735WriteCmd(ST7735_PWCTR2);  // power control
-	  st7735WriteData(0xC5);          // VGH = 14.7V, VGL = -7.35V
-	  st7735WriteCmd(ST7735_PWCTR3);  // power control
-	  st7735WriteData(0x0A);          // Opamp current small
-	  st7735WriteData(0x00);          // Boost frequency
-	  st7735WriteCmd(ST7735_PWCTR4);  // power control
-	  st7735WriteData(0x8A);
-	  st7735WriteData(0x2A);
-	  st7735WriteCmd(ST7735_PWCTR5);  // power control
-	  st7735WriteData(0x8A);
-	  st7735WriteData(0xEE);
-
-	  st7735WriteCmd(ST7735_VMCTR1);  // power control
-	  st7735WriteData(0x0E);          // VCOMH = 4V
-
-	  st7735WriteCmd(ST7735_INVOFF);
-
-	  st7735WriteCmd(ST7735_MADCTL);  // memory access control (directions)
-	  st7735WriteData(0xC8);          // row address/col address, bottom to top refresh, BGR, right to left refresh
-
-	  st7735WriteCmd(ST7735_COLMOD);  // set color mode
-	  st7735WriteData(0x05);          // 16-bit color
+	  st7735WriteCmd(lcd, ST7735_FRMCTR1); // frame rate control
+	  st7735WriteData(lcd, 0x01);          // fastest refresh
+	  st7735WriteData(lcd, 0x2C);          // 6 lines front porch
+	  st7735WriteData(lcd, 0x2D);          // 3 lines backporch
+
+	  st7735WriteCmd(lcd, ST7735_FRMCTR2); // frame rate control
+	  st7735WriteData(lcd, 0x01);          // fastest refresh
+	  st7735WriteData(lcd, 0x2C);          // 6 lines front porch
+	  st7735WriteData(lcd, 0x2D);          // 3 lines backporch
+
+	  st7735WriteCmd(lcd, ST7735_FRMCTR3); // frame rate control
+	  st7735WriteData(lcd, 0x01);          // fastest refresh
+	  st7735WriteData(lcd, 0x2C);          // 6 lines front porch
+	  st7735WriteData(lcd, 0x2D);          // 3 lines backporch
+	  st7735WriteData(lcd, 0x01);          // fastest refresh
+	  st7735WriteData(lcd, 0x2C);          // 6 lines front porch
+	  st7735WriteData(lcd, 0x2D);          // 3 lines backporch
+
+	  st7735WriteCmd(lcd, ST7735_INVCTR);  // display inversion control
+	  st7735WriteData(lcd, 0x07);           // line inversion
+
+	  st7735WriteCmd(lcd, ST7735_PWCTR1);  // power control
+	  st7735WriteData(lcd, 0xA2);          // GVDD = 4.7V
+	  st7735WriteData(lcd, 0x02);          // 1.0uA
+	  st7735WriteData(lcd, 0x84);          // 1.0uA
+	  st7735WriteCmd(lcd, ST7735_PWCTR2);  // power control
+	  st7735WriteData(lcd, 0xC5);          // VGH = 14.7V, VGL = -7.35V
+	  st7735WriteCmd(lcd, ST7735_PWCTR3);  // power control
+	  st7735WriteData(lcd, 0x0A);          // Opamp current small
+	  st7735WriteData(lcd, 0x00);          // Boost frequency
+	  st7735WriteCmd(lcd, ST7735_PWCTR4);  // power control
+	  st7735WriteData(lcd, 0x8A);
+	  st7735WriteData(lcd, 0x2A);
+	  st7735WriteCmd(lcd, ST7735_PWCTR5);  // power control
+	  st7735WriteData(lcd, 0x8A);
+	  st7735WriteData(lcd, 0xEE);
+
+	  st7735WriteCmd(lcd, ST7735_VMCTR1);  // power control
+	  st7735WriteData(lcd, 0x0E);          // VCOMH = 4V
+
+	  st7735WriteCmd(lcd, ST7735_INVOFF);
+
+	  st7735WriteCmd(lcd, ST7735_MADCTL);  // memory access control (directions)
+	  st7735WriteData(lcd, 0xC8);          // row address/col address, bottom to top refresh, BGR, right to left refresh
+
+	  st7735WriteCmd(lcd, ST7735_COLMOD);  // set color mode
+	  st7735WriteData(lcd, 0x05);          // 16-bit color
 
 	//============= GREEN ====================
-	  st7735WriteCmd(ST7735_CASET);   // column addr set
-	  st7735WriteData(0x00);
-	  st7735WriteData(0x02);          // XSTART = 2
-	  st7735WriteData(0x00);
-	  st7735WriteData(0x7F+0X02);          // XEND = 129
-
-	  st7735WriteCmd(ST7735_RASET);   // row addr set
-	  st7735WriteData(0x00);
-	  st7735WriteData(0x01);          // XSTART = 1
-	  st7735WriteData(0x00);
-	  st7735WriteData(0x9F+0X01);          // XEND = 160
+	  st7735WriteCmd(lcd, ST7735_CASET);   // column addr set
+	  st7735WriteData(lcd, 0x00);
+	  st7735WriteData(lcd, 0x02);          // XSTART = 2
+	  st7735WriteData(lcd, 0x00);
+	  st7735WriteData(lcd, 0x7F+0X02);          // XEND = 129
+
+	  st7735WriteCmd(lcd, ST7735_RASET);   // row addr set
+	  st7735WriteData(lcd, 0x00);
+	  st7735WriteData(lcd, 0x01);          // XSTART = 1
+	  st7735WriteData(lcd, 0x00);
+	  st7735WriteData(lcd, 0x9F+0X01);          // XEND = 160
 	//========================================
 
-	  st7735WriteCmd(ST7735_GMCTRP1);
-	  st7735WriteData(0x02);
-	  st7735WriteData(0x1C);
-	  st7735WriteData(0x07);
-	  st7735WriteData(0x12);
-	  st7735WriteData(0x37);
-	  st7735WriteData(0x32);
-	  st7735WriteData(0x29);
-	  st7735WriteData(0x2D);
-	  st7735WriteData(0x29);
-	  st7735WriteData(0x25);
-	  st7735WriteData(0x2B);
-	  st7735WriteData(0x39);
-	  st7735WriteData(0x00);
-	  st7735WriteData(0x01);
-	  st7735WriteData(0x03);
-	  st7735WriteData(0x10);
-	  st7735WriteCmd(ST7735_GMCTRN1);
-	  st7735WriteData(0x03);
-	  st7735WriteData(0x1D);
-	  st7735WriteData(0x07);
-	  st7735WriteData(0x06);
-	  st7735WriteData(0x2E);
-	  st7735WriteData(0x2C);
-	  st7735WriteData(0x29);
-	  st7735WriteData(0x2D);
-	  st7735WriteData(0x2E);
-	  st7735WriteData(0x2E);
-	  st7735WriteData(0x37);
-	  st7735WriteData(0x3F);
-	  st7735WriteData(0x00);
-	  st7735WriteData(0x00);
-	  st7735WriteData(0x02);
-	  st7735WriteData(0x10);
-
-	  st7735WriteCmd(ST7735_NORON);   // normal display on
+	  st7735WriteCmd(lcd, ST7735_GMCTRP1);
+	  st7735WriteData(lcd, 0x02);
+	  st7735WriteData(lcd, 0x1C);
+	  st7735WriteData(lcd, 0x07);
+	  st7735WriteData(lcd, 0x12);
+	  st7735WriteData(lcd, 0x37);
+	  st7735WriteData(lcd, 0x32);
+	  st7735WriteData(lcd, 0x29);
+	  st7735WriteData(lcd, 0x2D);
+	  st7735WriteData(lcd, 0x29);
+	  st7735WriteData(lcd, 0x25);
+	  st7735WriteData(lcd, 0x2B);
+	  st7735WriteData(lcd, 0x39);
+	  st7735WriteData(lcd, 0x00);
+	  st7735WriteData(lcd, 0x01);
+	  st7735WriteData(lcd, 0x03);
+	  st7735WriteData(lcd, 0x10);
+	  st7735WriteCmd(lcd, ST7735_GMCTRN1);
+	  st7735WriteData(lcd, 0x03);
+	  st7735WriteData(lcd, 0x1D);
+	  st7735WriteData(lcd, 0x07);
+	  st7735WriteData(lcd, 0x06);
+	  st7735WriteData(lcd, 0x2E);
+	  st7735WriteData(lcd, 0x2C);
+	  st7735WriteData(lcd, 0x29);
+	  st7735WriteData(lcd, 0x2D);
+	  st7735WriteData(lcd, 0x2E);
+	  st7735WriteData(lcd, 0x2E);
+	  st7735WriteData(lcd, 0x37);
+	  st7735WriteData(lcd, 0x3F);
+	  st7735WriteData(lcd, 0x00);
+	  st7735WriteData(lcd, 0x00);
+	  st7735WriteData(lcd, 0x02);
+	  st7735WriteData(lcd, 0x10);
+
+	  st7735WriteCmd(lcd, ST7735_NORON);   // normal display on
 	  delay(10);
 
-	  st7735WriteCmd(ST7735_DISPON);
+	  st7735WriteCmd(lcd, ST7735_DISPON);
 	  delay(500);
 }
 
@@ -466,13 +466,15 @@ void st7735InitDisplayG(void)
 /*************************************************/
 
 /*************************************************/
-void lcdInit(void)
+void st7735Init(void *ctx)
 {
+  st7735_t *lcd = (st7735_t *)ctx;
+
   // Set control pins to output
   gpioSetDir(ST7735_DATA_PORT, ST7735_RS_PIN, 1);
   gpioSetDir(ST7735_DATA_PORT, ST7735_SDA_PIN, 1);
   gpioSetDir(ST7735_DATA_PORT, ST7735_SCL_PIN, 1);
-  gpioSetDir(ST7735_DATA_PORT, ST7735_CS_PIN, 1);
+  LPC_GPIO->DIR[ST7735_DATA_PORT] |= lcd->csMask;
 
   gpioSetDir(ST7735_CTRL_PORT, ST7735_BL_PIN, 1);
 #ifdef ST7735_USERESET
@@ -483,14 +485,14 @@ void lcdInit(void)
   CLR_RS;
   CLR_SDA;
   CLR_SCL;
-  CLR_CS;
+  CLR_CS(lcd);
   CLR_BL;
 #ifdef ST7735_USERESET
   SET_RES;
 #endif
 
   // Turn backlight on
-  lcdBacklight(TRUE);
+  st7735Backlight(lcd, TRUE);
 
   // Reset display
 #ifdef ST7735_USERESET
@@ -504,20 +506,22 @@ void lcdInit(void)
 #endif
 
   // Run LCD init sequence
-//  st7735InitDisplayB();
-  st7735InitDisplayR();
-//  st7735InitDisplayG();
+//  st7735InitDisplayB(lcd);
+  st7735InitDisplayR(lcd);
+//  st7735InitDisplayG(lcd);
 
-  lcdSetOrientation(LCD_ORIENTATION_PORTRAIT);
+  st7735SetOrientation(lcd, LCD_ORIENTATION_PORTRAIT);
 
   // Fill black
-  lcdFillRGB(COLOR_BLACK);
-//  lcdFillRGB(ST7735_GREEN);
+  st7735FillRGB(lcd, COLOR_BLACK);
+//  st7735FillRGB(lcd, ST7735_GREEN);
 }
 
 /*************************************************/
-void lcdBacklight(bool state)
+void st7735Backlight(void *ctx, bool state)
 {
+  (void)ctx;
+
   // Set the backlight
   // Note: Depending on the type of transistor used
   // to control the backlight, you made need to invert
@@ -531,39 +535,45 @@ void lcdBacklight(bool state)
 }
 
 /*************************************************/
-void lcdTest(void)
+void st7735Test(void *ctx)
 {
+  st7735_t *lcd = (st7735_t *)ctx;
+
   uint8_t i = 0;
   for (i = 0; i < 100; i++)
   {
-    lcdDrawPixel(i, i, 0xFFFF);
+    st7735DrawPixel(lcd, i, i, 0xFFFF);
   }
 }
 
 /*************************************************/
-void lcdFillRGB(uint16_t color)
+void st7735FillRGB(void *ctx, uint16_t color)
 {
+  st7735_t *lcd = (st7735_t *)ctx;
+
   uint8_t x, y;
-  st7735SetAddrWindow(0, 0, lcdGetWidth() - 1, lcdGetHeight() - 1);
-  st7735WriteCmd(ST7735_RAMWR);  // write to RAM
-  for (x=0; x < lcdGetWidth(); x++) 
+  st7735SetAddrWindow(lcd, 0, 0, st7735GetWidth(lcd) - 1, st7735GetHeight(lcd) - 1);
+  st7735WriteCmd(lcd, ST7735_RAMWR);  // write to RAM
+  for (x=0; x < st7735GetWidth(lcd); x++) 
   {
-    for (y=0; y < lcdGetHeight(); y++) 
+    for (y=0; y < st7735GetHeight(lcd); y++) 
     {
-      st7735WriteData(color >> 8);    
-      st7735WriteData(color);    
+      st7735WriteData(lcd, color >> 8);    
+      st7735WriteData(lcd, color);    
     }
   }
-  st7735WriteCmd(ST7735_NOP);
+  st7735WriteCmd(lcd, ST7735_NOP);
 }
 
 /*************************************************/
-void lcdDrawPixel(uint16_t x, uint16_t y, uint16_t color)
+void st7735DrawPixel(void *ctx, uint16_t x, uint16_t y, uint16_t color)
 {
-  st7735SetAddrWindow(x,y,x+1,y+1);
-  st7735WriteCmd(ST7735_RAMWR);  // write to RAM
-  st7735WriteData(color >> 8);  
-  st7735WriteData(color);
+  st7735_t *lcd = (st7735_t *)ctx;
+
+  st7735SetAddrWindow(lcd, x,y,x+1,y+1);
+  st7735WriteCmd(lcd, ST7735_RAMWR);  // write to RAM
+  st7735WriteData(lcd, color >> 8);  
+  st7735WriteData(lcd, color);
 }
 
 /**************************************************************************/
@@ -572,20 +582,60 @@ void lcdDrawPixel(uint16_t x, uint16_t y, uint16_t color)
             faster than addressing each pixel individually)
 */
 /**************************************************************************/
-void lcdDrawPixels(uint16_t x, uint16_t y, uint16_t *data, uint32_t len)
+void st7735DrawPixels(void *ctx, uint16_t x, uint16_t y, uint16_t *data, uint32_t len)
+{
+  st7735_t *lcd = (st7735_t *)ctx;
+
+  if ((x >= st7735GetWidth(lcd)) || (y >= st7735GetHeight(lcd)) || (len == 0)) return;
+
+  // Clip to the end of the row
+  if (x + len > st7735GetWidth(lcd))
+  {
+    len = st7735GetWidth(lcd) - x;
+  }
+
+  st7735SetWindow(lcd, x, y, x + len - 1, y);
+  st7735WritePixels(lcd, data, len);
+}
+
+/**************************************************************************/
+/*! 
+    @brief  Sets the window that subsequent calls to st7735WritePixels
+            will fill, left to right and top to bottom
+
+    Rendering a block of pixels this way only sends the address once,
+    rather than once per row or once per pixel.
+*/
+/**************************************************************************/
+void st7735SetWindow(void *ctx, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+  st7735_t *lcd = (st7735_t *)ctx;
+
+  st7735SetAddrWindow(lcd, x0, y0, x1, y1);
+  st7735WriteCmd(lcd, ST7735_RAMWR);  // write to RAM
+}
+
+/**************************************************************************/
+/*! 
+    @brief  Streams RGB565 pixels into the window set by st7735SetWindow
+*/
+/**************************************************************************/
+void st7735WritePixels(void *ctx, uint16_t *data, uint32_t len)
 {
-  // ToDo: Optimise this function ... currently only a placeholder
-  uint32_t i = 0;
-  do
+  st7735_t *lcd = (st7735_t *)ctx;
+
+  while (len--)
   {
-    lcdDrawPixel(x+i, y, data[i]);
-    i++;
-  } while (i<len);
+    st7735WriteData(lcd, *data >> 8);
+    st7735WriteData(lcd, *data++);
+  }
 }
 
 /*************************************************/
-void lcdDrawHLine(uint16_t x0, uint16_t x1, uint16_t y, uint16_t color)
+void st7735DrawHLine(void *ctx, uint16_t x0, uint16_t x1, uint16_t y, uint16_t color)
 {
+  st7735_t *lcd = (st7735_t *)ctx;
+
   // Allows for slightly better performance than setting individual pixels
   uint16_t x, pixels;
 
@@ -598,28 +648,30 @@ void lcdDrawHLine(uint16_t x0, uint16_t x1, uint16_t y, uint16_t color)
   }
 
   // Check limits
-  if (x1 >= lcdGetWidth())
+  if (x1 >= st7735GetWidth(lcd))
   {
-    x1 = lcdGetWidth() - 1;
+    x1 = st7735GetWidth(lcd) - 1;
   }
-  if (x0 >= lcdGetWidth())
+  if (x0 >= st7735GetWidth(lcd))
   {
-    x0 = lcdGetWidth() - 1;
+    x0 = st7735GetWidth(lcd) - 1;
   }
 
-  st7735SetAddrWindow(x0, y, lcdGetWidth(), y + 1);
-  st7735WriteCmd(ST7735_RAMWR);  // write to RAM
+  st7735SetAddrWindow(lcd, x0, y, st7735GetWidth(lcd), y + 1);
+  st7735WriteCmd(lcd, ST7735_RAMWR);  // write to RAM
   for (pixels = 0; pixels < x1 - x0 + 1; pixels++)
   {
-    st7735WriteData(color >> 8);  
-    st7735WriteData(color);
+    st7735WriteData(lcd, color >> 8);  
+    st7735WriteData(lcd, color);
   }
-  st7735WriteCmd(ST7735_NOP);
+  st7735WriteCmd(lcd, ST7735_NOP);
 }
 
 /*************************************************/
-void lcdDrawVLine(uint16_t x, uint16_t y0, uint16_t y1, uint16_t color)
+void st7735DrawVLine(void *ctx, uint16_t x, uint16_t y0, uint16_t y1, uint16_t color)
 {
+  st7735_t *lcd = (st7735_t *)ctx;
+
   // Allows for slightly better performance than setting individual pixels
   uint16_t y, pixels;
 
@@ -632,91 +684,130 @@ void lcdDrawVLine(uint16_t x, uint16_t y0, uint16_t y1, uint16_t color)
   }
 
   // Check limits
-  if (y1 >= lcdGetHeight())
+  if (y1 >= st7735GetHeight(lcd))
   {
-    y1 = lcdGetHeight() - 1;
+    y1 = st7735GetHeight(lcd) - 1;
   }
-  if (y0 >= lcdGetHeight())
+  if (y0 >= st7735GetHeight(lcd))
   {
-    y0 = lcdGetHeight() - 1;
+    y0 = st7735GetHeight(lcd) - 1;
   }
 
-  st7735SetAddrWindow(x, y0, x, lcdGetHeight());
-  st7735WriteCmd(ST7735_RAMWR);  // write to RAM
+  st7735SetAddrWindow(lcd, x, y0, x, st7735GetHeight(lcd));
+  st7735WriteCmd(lcd, ST7735_RAMWR);  // write to RAM
   for (pixels = 0; pixels < y1 - y0 + 1; pixels++)
   {
-    st7735WriteData(color >> 8);  
-    st7735WriteData(color);
+    st7735WriteData(lcd, color >> 8);  
+    st7735WriteData(lcd, color);
   }
-  st7735WriteCmd(ST7735_NOP);
+  st7735WriteCmd(lcd, ST7735_NOP);
 }
 
 /*************************************************/
-uint16_t lcdGetPixel(uint16_t x, uint16_t y)
+uint16_t st7735GetPixel(void *ctx, uint16_t x, uint16_t y)
 {
+  (void)ctx;
+
   // ToDo
   return 0;
 }
 
 /*************************************************/
-void lcdSetOrientation(lcdOrientation_t orientation)
+void st7735SetOrientation(void *ctx, lcdOrientation_t orientation)
 {
+  st7735_t *lcd = (st7735_t *)ctx;
+
   if(orientation == LCD_ORIENTATION_PORTRAIT)
   {
-	  st7735WriteCmd(ST7735_MADCTL);  // Memory Data Access Control
-	  st7735WriteData(0x00);          // 000 - Normal
+	  st7735WriteCmd(lcd, ST7735_MADCTL);  // Memory Data Access Control
+	  st7735WriteData(lcd, 0x00);          // 000 - Normal
 	                                  // 0 - Vertical refresh top to bottom
 	                                  // 0 - RGB order
 	                                  // 0 - Horizontal refresh left to right
-	  st7735Properties.width = ST7735_PANEL_WIDTH;
-	  st7735Properties.height = ST7735_PANEL_HEIGHT;
+	  lcd->properties.width = ST7735_PANEL_WIDTH;
+	  lcd->properties.height = ST7735_PANEL_HEIGHT;
+	  lcd->orientation = orientation;
   }
   else if (orientation == LCD_ORIENTATION_LANDSCAPE)
   {
-	  st7735WriteCmd(ST7735_MADCTL);  // Memory Data Access Control
-	  st7735WriteData(0xA0);          // 101 - X-Y Exchange, Y-Mirror
+	  st7735WriteCmd(lcd, ST7735_MADCTL);  // Memory Data Access Control
+	  st7735WriteData(lcd, 0xA0);          // 101 - X-Y Exchange, Y-Mirror
 	                                  // 0 - Vertical refresh top to bottom
 	                                  // 0 - RGB order
 	                                  // 0 - Horizontal refresh left to right
-	  st7735Properties.width = ST7735_PANEL_HEIGHT;
-	  st7735Properties.height = ST7735_PANEL_WIDTH;
+	  lcd->properties.width = ST7735_PANEL_HEIGHT;
+	  lcd->properties.height = ST7735_PANEL_WIDTH;
+	  lcd->orientation = orientation;
   }
 }
 
 /*************************************************/
-lcdOrientation_t lcdGetOrientation(void)
+lcdOrientation_t st7735GetOrientation(void *ctx)
 {
-  return lcdOrientation;
+  st7735_t *lcd = (st7735_t *)ctx;
+  return lcd->orientation;
 }
 
 /*************************************************/
-uint16_t lcdGetWidth(void)
+uint16_t st7735GetWidth(void *ctx)
 {
-  return st7735Properties.width;
+  st7735_t *lcd = (st7735_t *)ctx;
+  return lcd->properties.width;
 }
 
 /*************************************************/
-uint16_t lcdGetHeight(void)
+uint16_t st7735GetHeight(void *ctx)
 {
-  return st7735Properties.height;
+  st7735_t *lcd = (st7735_t *)ctx;
+  return lcd->properties.height;
 }
 
 /*************************************************/
-void lcdScroll(int16_t pixels, uint16_t fillColor)
+void st7735Scroll(void *ctx, int16_t pixels, uint16_t fillColor)
 {
+  (void)ctx;
+
   // ToDo
 }
 
 /*************************************************/
-uint16_t lcdGetControllerID(void)
+uint16_t st7735GetControllerID(void *ctx)
 {
+  (void)ctx;
   return 0x7735;
 }
 
 /*************************************************/
-lcdProperties_t lcdGetProperties(void)
+lcdProperties_t st7735GetProperties(void *ctx)
 {
-  return st7735Properties;
+  st7735_t *lcd = (st7735_t *)ctx;
+  return lcd->properties;
 }
 
+/*************************************************/
+const lcdDriver_t st7735Driver =
+{
+  .init             = st7735Init,
+  .test             = st7735Test,
+  .getPixel         = st7735GetPixel,
+  .fillRGB          = st7735FillRGB,
+  .drawPixel        = st7735DrawPixel,
+  .drawPixels       = st7735DrawPixels,
+  .setWindow        = st7735SetWindow,
+  .writePixels      = st7735WritePixels,
+  .drawHLine        = st7735DrawHLine,
+  .drawVLine        = st7735DrawVLine,
+  .backlight        = st7735Backlight,
+  .scroll           = st7735Scroll,
+  .getWidth         = st7735GetWidth,
+  .getHeight        = st7735GetHeight,
+  .setOrientation   = st7735SetOrientation,
+  .getOrientation   = st7735GetOrientation,
+  .getControllerID  = st7735GetControllerID,
+  .getProperties    = st7735GetProperties
+};
+
+/*************************************************/
+lcdPanel_t st7735Panel = { &st7735Driver, &st7735Default };
+
 #endif
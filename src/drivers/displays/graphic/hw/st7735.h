@@ -89,8 +89,8 @@
 #define SET_SDA     do { LPC_GPIO->SET[ST7735_DATA_PORT] = (1 << ST7735_SDA_PIN); } while(0)
 #define CLR_SCL     do { LPC_GPIO->CLR[ST7735_DATA_PORT] = (1 << ST7735_SCL_PIN); } while(0)
 #define SET_SCL     do { LPC_GPIO->SET[ST7735_DATA_PORT] = (1 << ST7735_SCL_PIN); } while(0)
-#define CLR_CS      do { LPC_GPIO->CLR[ST7735_DATA_PORT] = (1 << ST7735_CS_PIN); } while(0)
-#define SET_CS      do { LPC_GPIO->SET[ST7735_DATA_PORT] = (1 << ST7735_CS_PIN); } while(0)
+#define CLR_CS(lcd) do { LPC_GPIO->CLR[ST7735_DATA_PORT] = (lcd)->csMask; } while(0)
+#define SET_CS(lcd) do { LPC_GPIO->SET[ST7735_DATA_PORT] = (lcd)->csMask; } while(0)
 
 #define CLR_BL      do { LPC_GPIO->CLR[ST7735_CTRL_PORT] = (1 << ST7735_BL_PIN); } while(0)
 #define SET_BL      do { LPC_GPIO->SET[ST7735_CTRL_PORT] = (1 << ST7735_BL_PIN); } while(0)
@@ -168,5 +168,40 @@
 #define ST7735_YELLOW    0xFFE0
 #define ST7735_WHITE     0xFFFF
 
+// State of one ST7735 panel.  Panels share the RS, SDA, SCL, backlight
+// and reset pins above, and each one has its own chip select pin on
+// ST7735_DATA_PORT.  Since the reset is shared, call lcdInit on every
+// panel before drawing on any of them.
+typedef struct
+{
+  uint32_t          csMask;       // Chip select pin mask on ST7735_DATA_PORT
+  lcdOrientation_t  orientation;
+  lcdProperties_t   properties;   // Width and height follow the orientation
+} st7735_t;
+
+// Initialiser for an st7735_t with its chip select on ST7735_DATA_PORT.csPin
+#define ST7735_PANEL(csPin)   { (1 << (csPin)), LCD_ORIENTATION_PORTRAIT, \
+                                { ST7735_PANEL_WIDTH, ST7735_PANEL_HEIGHT, false, true, false, true, true, false } }
+
+// lcd.h entry points implemented by this driver (see lcdDriver_t), which
+// take the panel's st7735_t as ctx
+void     st7735Init(void *ctx);
+void     st7735Test(void *ctx);
+uint16_t st7735GetPixel(void *ctx, uint16_t x, uint16_t y);
+void     st7735FillRGB(void *ctx, uint16_t color);
+void     st7735DrawPixel(void *ctx, uint16_t x, uint16_t y, uint16_t color);
+void     st7735DrawPixels(void *ctx, uint16_t x, uint16_t y, uint16_t *data, uint32_t len);
+void     st7735SetWindow(void *ctx, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+void     st7735WritePixels(void *ctx, uint16_t *data, uint32_t len);
+void     st7735DrawHLine(void *ctx, uint16_t x0, uint16_t x1, uint16_t y, uint16_t color);
+void     st7735DrawVLine(void *ctx, uint16_t x, uint16_t y0, uint16_t y1, uint16_t color);
+void     st7735Backlight(void *ctx, bool state);
+void     st7735Scroll(void *ctx, int16_t pixels, uint16_t fillColor);
+uint16_t st7735GetWidth(void *ctx);
+uint16_t st7735GetHeight(void *ctx);
+void     st7735SetOrientation(void *ctx, lcdOrientation_t orientation);
+lcdOrientation_t st7735GetOrientation(void *ctx);
+uint16_t st7735GetControllerID(void *ctx);
+lcdProperties_t  st7735GetProperties(void *ctx);
 
 #endif
@@ -0,0 +1,1086 @@
+/**************************************************************************/
+/*!
+    @file     jpeg.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <string.h>
+
+#include "jpeg.h"
+#include "colors.h"
+
+#ifdef CFG_BSP_SDCARD
+  #include "drivers/storage/fatfs/ff.h"
+#endif
+
+/* JPEG markers */
+#define JPEG_MARKER_SOF0      (0xC0)
+#define JPEG_MARKER_SOF1      (0xC1)
+#define JPEG_MARKER_DHT       (0xC4)
+#define JPEG_MARKER_RST0      (0xD0)
+#define JPEG_MARKER_SOI       (0xD8)
+#define JPEG_MARKER_EOI       (0xD9)
+#define JPEG_MARKER_SOS       (0xDA)
+#define JPEG_MARKER_DQT       (0xDB)
+#define JPEG_MARKER_DRI       (0xDD)
+
+/* Integer IDCT constants (13-bit fixed point) */
+#define JPEG_CONST_BITS       (13)
+#define JPEG_PASS1_BITS       (2)
+#define JPEG_FIX_0_298631336  (2446)
+#define JPEG_FIX_0_390180644  (3196)
+#define JPEG_FIX_0_541196100  (4433)
+#define JPEG_FIX_0_765366865  (6270)
+#define JPEG_FIX_0_899976223  (7373)
+#define JPEG_FIX_1_175875602  (9633)
+#define JPEG_FIX_1_501321110  (12299)
+#define JPEG_FIX_1_847759065  (15137)
+#define JPEG_FIX_1_961570560  (16069)
+#define JPEG_FIX_2_053119869  (16819)
+#define JPEG_FIX_2_562915447  (20995)
+#define JPEG_FIX_3_072711026  (25172)
+#define JPEG_DESCALE(x, n)    (((x) + (1L << ((n) - 1))) >> (n))
+
+/* Zig-zag order to natural order */
+static const uint8_t jpegZigZag[64] =
+{
+   0,  1,  8, 16,  9,  2,  3, 10, 17, 24, 32, 25, 18, 11,  4,  5,
+  12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13,  6,  7, 14, 21, 28,
+  35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+  58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63
+};
+
+/* State for jpegDrawBuffer */
+typedef struct
+{
+  const uint8_t *data;
+  uint32_t      len;
+} jpegMemorySource_t;
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Private Methods ------------------------------ */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Reads a single byte from the input
+*/
+/**************************************************************************/
+static error_t jpegReadByte(jpegDecoder_t *jd, uint8_t *b)
+{
+  if (jd->inPos >= jd->inLen)
+  {
+    jd->inLen = jd->input(jd->param, jd->inBuf, JPEG_INPUTBUFFER_LEN);
+    jd->inPos = 0;
+    if (jd->inLen == 0)
+    {
+      return ERROR_JPEG_ENDOFDATA;
+    }
+  }
+
+  *b = jd->inBuf[jd->inPos++];
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Reads a big-endian 16-bit value from the input
+*/
+/**************************************************************************/
+static error_t jpegReadWord(jpegDecoder_t *jd, uint16_t *w)
+{
+  uint8_t hi, lo;
+
+  ASSERT_STATUS(jpegReadByte(jd, &hi));
+  ASSERT_STATUS(jpegReadByte(jd, &lo));
+  *w = (hi << 8) | lo;
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Discards len bytes of input
+*/
+/**************************************************************************/
+static error_t jpegSkip(jpegDecoder_t *jd, uint16_t len)
+{
+  uint8_t b;
+
+  while (len--)
+  {
+    ASSERT_STATUS(jpegReadByte(jd, &b));
+  }
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Parses a DQT segment (one or more 8-bit quantization tables)
+*/
+/**************************************************************************/
+static error_t jpegParseDQT(jpegDecoder_t *jd, uint16_t len)
+{
+  uint8_t pq, i;
+
+  while (len >= 65)
+  {
+    ASSERT_STATUS(jpegReadByte(jd, &pq));
+    if (pq >> 4)
+    {
+      /* 16-bit tables are only used with 12-bit samples */
+      return ERROR_JPEG_UNSUPPORTED;
+    }
+    if ((pq & 0x0F) > 3)
+    {
+      return ERROR_JPEG_INVALIDFORMAT;
+    }
+    for (i = 0; i < 64; i++)
+    {
+      ASSERT_STATUS(jpegReadByte(jd, &jd->quant[pq & 0x0F][jpegZigZag[i]]));
+    }
+    len -= 65;
+  }
+
+  return len ? ERROR_JPEG_INVALIDFORMAT : ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Parses a DHT segment and builds the canonical code tables
+*/
+/**************************************************************************/
+static error_t jpegParseDHT(jpegDecoder_t *jd, uint16_t len)
+{
+  uint8_t  tc, counts[16], i, total;
+  uint16_t code;
+  jpegHuffTable_t *t;
+
+  while (len >= 17)
+  {
+    ASSERT_STATUS(jpegReadByte(jd, &tc));
+    if (((tc >> 4) > 1) || ((tc & 0x0F) > 1))
+    {
+      return ERROR_JPEG_UNSUPPORTED;
+    }
+    t = &jd->huff[((tc >> 4) << 1) | (tc & 0x0F)];
+
+    total = 0;
+    for (i = 0; i < 16; i++)
+    {
+      ASSERT_STATUS(jpegReadByte(jd, &counts[i]));
+      if (total + counts[i] > sizeof(t->vals))
+      {
+        return ERROR_JPEG_INVALIDFORMAT;
+      }
+      total += counts[i];
+    }
+    if (len < 17 + total)
+    {
+      return ERROR_JPEG_INVALIDFORMAT;
+    }
+    for (i = 0; i < total; i++)
+    {
+      ASSERT_STATUS(jpegReadByte(jd, &t->vals[i]));
+    }
+
+    /* Canonical codes: each length starts where the previous one left
+       off, shifted left by one bit */
+    code = 0;
+    total = 0;
+    for (i = 0; i < 16; i++)
+    {
+      t->valptr[i] = total;
+      t->mincode[i] = code;
+      code += counts[i];
+      total += counts[i];
+      t->maxcode[i] = code;
+      code <<= 1;
+    }
+
+    len -= 17 + total;
+  }
+
+  return len ? ERROR_JPEG_INVALIDFORMAT : ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Parses a baseline SOF segment
+*/
+/**************************************************************************/
+static error_t jpegParseSOF(jpegDecoder_t *jd, uint16_t len)
+{
+  uint8_t precision, i, hv;
+  jpegComponent_t *c;
+
+  ASSERT_STATUS(jpegReadByte(jd, &precision));
+  ASSERT_STATUS(jpegReadWord(jd, &jd->height));
+  ASSERT_STATUS(jpegReadWord(jd, &jd->width));
+  ASSERT_STATUS(jpegReadByte(jd, &jd->numComponents));
+
+  if ((precision != 8) || (jd->width == 0) || (jd->height == 0) ||
+      ((jd->numComponents != 1) && (jd->numComponents != 3)))
+  {
+    return ERROR_JPEG_UNSUPPORTED;
+  }
+  if (len != 6 + jd->numComponents * 3)
+  {
+    return ERROR_JPEG_INVALIDFORMAT;
+  }
+
+  for (i = 0; i < jd->numComponents; i++)
+  {
+    c = &jd->comp[i];
+    ASSERT_STATUS(jpegReadByte(jd, &c->id));
+    ASSERT_STATUS(jpegReadByte(jd, &hv));
+    ASSERT_STATUS(jpegReadByte(jd, &c->tq));
+    c->h = hv >> 4;
+    c->v = hv & 0x0F;
+    if (c->tq > 3)
+    {
+      return ERROR_JPEG_INVALIDFORMAT;
+    }
+  }
+
+  if (jd->numComponents == 1)
+  {
+    /* Single component scans are never interleaved */
+    jd->comp[0].h = jd->comp[0].v = 1;
+  }
+  else
+  {
+    /* Luma can be 1x1, 2x1, 1x2 or 2x2 with 1x1 chroma */
+    if ((jd->comp[0].h < 1) || (jd->comp[0].h > 2) ||
+        (jd->comp[0].v < 1) || (jd->comp[0].v > 2) ||
+        (jd->comp[1].h != 1) || (jd->comp[1].v != 1) ||
+        (jd->comp[2].h != 1) || (jd->comp[2].v != 1))
+    {
+      return ERROR_JPEG_UNSUPPORTED;
+    }
+  }
+
+  jd->mcuWidth = jd->comp[0].h * 8;
+  jd->mcuHeight = jd->comp[0].v * 8;
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Parses the SOS segment (component to table mapping)
+*/
+/**************************************************************************/
+static error_t jpegParseSOS(jpegDecoder_t *jd, uint16_t len)
+{
+  uint8_t n, i, j, id, tables;
+
+  ASSERT_STATUS(jpegReadByte(jd, &n));
+  if (n != jd->numComponents)
+  {
+    /* Non-interleaved colour scans are a progressive-style layout */
+    return ERROR_JPEG_UNSUPPORTED;
+  }
+  if (len != 4 + n * 2)
+  {
+    return ERROR_JPEG_INVALIDFORMAT;
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    ASSERT_STATUS(jpegReadByte(jd, &id));
+    ASSERT_STATUS(jpegReadByte(jd, &tables));
+    for (j = 0; j < jd->numComponents; j++)
+    {
+      if (jd->comp[j].id == id)
+        break;
+    }
+    if ((j != i) || ((tables >> 4) > 1) || ((tables & 0x0F) > 1))
+    {
+      return ERROR_JPEG_INVALIDFORMAT;
+    }
+    jd->comp[j].td = tables >> 4;
+    jd->comp[j].ta = tables & 0x0F;
+    jd->comp[j].dcPred = 0;
+  }
+
+  /* Spectral selection and successive approximation (fixed for baseline) */
+  return jpegSkip(jd, 3);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Tops up the bit buffer so that it holds at least 25 bits,
+            handling byte stuffing and markers in the entropy-coded data
+*/
+/**************************************************************************/
+static void jpegFillBits(jpegDecoder_t *jd)
+{
+  uint8_t b, b2;
+
+  while (jd->bitCnt <= 24)
+  {
+    b = 0;
+    if (!jd->marker)
+    {
+      if (jpegReadByte(jd, &b))
+      {
+        /* Treat a truncated file as a final EOI */
+        jd->marker = JPEG_MARKER_EOI;
+        b = 0;
+      }
+      else if (b == 0xFF)
+      {
+        do
+        {
+          if (jpegReadByte(jd, &b2))
+          {
+            b2 = JPEG_MARKER_EOI;
+          }
+        } while (b2 == 0xFF);
+
+        if (b2 != 0)
+        {
+          /* Real marker: stop consuming data and pad with zero bits */
+          jd->marker = b2;
+          b = 0;
+        }
+      }
+    }
+    jd->bitBuf |= (uint32_t)b << (24 - jd->bitCnt);
+    jd->bitCnt += 8;
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Removes n (1..16) bits from the bit buffer
+*/
+/**************************************************************************/
+static uint16_t jpegGetBits(jpegDecoder_t *jd, uint8_t n)
+{
+  uint16_t v;
+
+  if (jd->bitCnt < n)
+  {
+    jpegFillBits(jd);
+  }
+  v = jd->bitBuf >> (32 - n);
+  jd->bitBuf <<= n;
+  jd->bitCnt -= n;
+
+  return v;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Decodes one Huffman symbol, returning -1 for an invalid code
+*/
+/**************************************************************************/
+static int16_t jpegDecodeHuffman(jpegDecoder_t *jd, const jpegHuffTable_t *t)
+{
+  uint16_t code;
+  uint8_t  len;
+
+  if (jd->bitCnt < 16)
+  {
+    jpegFillBits(jd);
+  }
+
+  /* Walk the code lengths, peeking at the top bits of the buffer */
+  for (len = 0; len < 16; len++)
+  {
+    code = jd->bitBuf >> (31 - len);
+    if (code < t->maxcode[len])
+    {
+      jd->bitBuf <<= len + 1;
+      jd->bitCnt -= len + 1;
+      return t->vals[t->valptr[len] + code - t->mincode[len]];
+    }
+  }
+
+  return -1;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Reads an s-bit magnitude category value and sign-extends it
+*/
+/**************************************************************************/
+static int16_t jpegReceiveExtend(jpegDecoder_t *jd, uint8_t s)
+{
+  int16_t v;
+
+  if (s == 0)
+  {
+    return 0;
+  }
+
+  v = jpegGetBits(jd, s);
+  if (v < (1 << (s - 1)))
+  {
+    v -= (1 << s) - 1;
+  }
+
+  return v;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Decodes and dequantizes one 8x8 block into jd->block
+
+    @param[in]  dcOnly
+                If true the AC coefficients are parsed but discarded,
+                and only jd->block[0] is valid
+*/
+/**************************************************************************/
+static error_t jpegDecodeBlock(jpegDecoder_t *jd, jpegComponent_t *c, bool dcOnly)
+{
+  const uint8_t *q = jd->quant[c->tq];
+  int16_t sym;
+  uint8_t k, run, size;
+
+  /* DC coefficient (difference from the previous block) */
+  sym = jpegDecodeHuffman(jd, &jd->huff[c->td]);
+  if ((sym < 0) || (sym > 11))
+  {
+    return ERROR_JPEG_INVALIDFORMAT;
+  }
+  c->dcPred += jpegReceiveExtend(jd, sym);
+
+  if (!dcOnly)
+  {
+    memset(jd->block, 0, sizeof(jd->block));
+  }
+  jd->block[0] = c->dcPred * q[0];
+
+  /* AC coefficients */
+  for (k = 1; k < 64; k++)
+  {
+    sym = jpegDecodeHuffman(jd, &jd->huff[2 + c->ta]);
+    if (sym < 0)
+    {
+      return ERROR_JPEG_INVALIDFORMAT;
+    }
+    run = sym >> 4;
+    size = sym & 0x0F;
+    if (size == 0)
+    {
+      if (run != 15)
+      {
+        break;      /* End of block */
+      }
+      k += 15;      /* ZRL: 16 zeros */
+      continue;
+    }
+    k += run;
+    if (k > 63)
+    {
+      return ERROR_JPEG_INVALIDFORMAT;
+    }
+    if (dcOnly)
+    {
+      jpegGetBits(jd, size);
+    }
+    else
+    {
+      jd->block[jpegZigZag[k]] = jpegReceiveExtend(jd, size) * q[jpegZigZag[k]];
+    }
+  }
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Clamps an IDCT output value to 0..255
+*/
+/**************************************************************************/
+static inline uint8_t jpegClamp(int32_t v)
+{
+  return v < 0 ? 0 : (v > 255 ? 255 : v);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Integer inverse DCT of jd->block (Loeffler-Ligtenberg-
+            Moschytz, 13-bit constants), writing level-shifted samples
+
+    @param[out] out
+                Top-left sample of the 8x8 destination area
+    @param[in]  stride
+                Width of the destination buffer in samples
+*/
+/**************************************************************************/
+static void jpegIDCT(int16_t *block, uint8_t *out, uint8_t stride)
+{
+  int32_t tmp0, tmp1, tmp2, tmp3, tmp10, tmp11, tmp12, tmp13;
+  int32_t z1, z2, z3, z4, z5;
+  int32_t ws[64];
+  int32_t *w;
+  int16_t *in;
+  uint8_t i;
+
+  /* Pass 1: columns, results scaled up by 2^PASS1_BITS */
+  for (i = 0, in = block, w = ws; i < 8; i++, in++, w++)
+  {
+    if (!in[8] && !in[16] && !in[24] && !in[32] && !in[40] && !in[48] && !in[56])
+    {
+      /* AC terms all zero, which is very common */
+      w[0] = w[8] = w[16] = w[24] = w[32] = w[40] = w[48] = w[56] = in[0] * (1 << JPEG_PASS1_BITS);
+      continue;
+    }
+
+    /* Even part */
+    z2 = in[16];
+    z3 = in[48];
+    z1 = (z2 + z3) * JPEG_FIX_0_541196100;
+    tmp2 = z1 - z3 * JPEG_FIX_1_847759065;
+    tmp3 = z1 + z2 * JPEG_FIX_0_765366865;
+    tmp0 = (in[0] + in[32]) * (1 << JPEG_CONST_BITS);
+    tmp1 = (in[0] - in[32]) * (1 << JPEG_CONST_BITS);
+    tmp10 = tmp0 + tmp3;
+    tmp13 = tmp0 - tmp3;
+    tmp11 = tmp1 + tmp2;
+    tmp12 = tmp1 - tmp2;
+
+    /* Odd part */
+    tmp0 = in[56];
+    tmp1 = in[40];
+    tmp2 = in[24];
+    tmp3 = in[8];
+    z1 = tmp0 + tmp3;
+    z2 = tmp1 + tmp2;
+    z3 = tmp0 + tmp2;
+    z4 = tmp1 + tmp3;
+    z5 = (z3 + z4) * JPEG_FIX_1_175875602;
+    tmp0 *= JPEG_FIX_0_298631336;
+    tmp1 *= JPEG_FIX_2_053119869;
+    tmp2 *= JPEG_FIX_3_072711026;
+    tmp3 *= JPEG_FIX_1_501321110;
+    z1 *= -JPEG_FIX_0_899976223;
+    z2 *= -JPEG_FIX_2_562915447;
+    z3 = z3 * -JPEG_FIX_1_961570560 + z5;
+    z4 = z4 * -JPEG_FIX_0_390180644 + z5;
+    tmp0 += z1 + z3;
+    tmp1 += z2 + z4;
+    tmp2 += z2 + z3;
+    tmp3 += z1 + z4;
+
+    w[0]  = JPEG_DESCALE(tmp10 + tmp3, JPEG_CONST_BITS - JPEG_PASS1_BITS);
+    w[56] = JPEG_DESCALE(tmp10 - tmp3, JPEG_CONST_BITS - JPEG_PASS1_BITS);
+    w[8]  = JPEG_DESCALE(tmp11 + tmp2, JPEG_CONST_BITS - JPEG_PASS1_BITS);
+    w[48] = JPEG_DESCALE(tmp11 - tmp2, JPEG_CONST_BITS - JPEG_PASS1_BITS);
+    w[16] = JPEG_DESCALE(tmp12 + tmp1, JPEG_CONST_BITS - JPEG_PASS1_BITS);
+    w[40] = JPEG_DESCALE(tmp12 - tmp1, JPEG_CONST_BITS - JPEG_PASS1_BITS);
+    w[24] = JPEG_DESCALE(tmp13 + tmp0, JPEG_CONST_BITS - JPEG_PASS1_BITS);
+    w[32] = JPEG_DESCALE(tmp13 - tmp0, JPEG_CONST_BITS - JPEG_PASS1_BITS);
+  }
+
+  /* Pass 2: rows, removing the PASS1_BITS and the 8x scale factor */
+  for (i = 0, w = ws; i < 8; i++, w += 8, out += stride)
+  {
+    z2 = w[2];
+    z3 = w[6];
+    z1 = (z2 + z3) * JPEG_FIX_0_541196100;
+    tmp2 = z1 - z3 * JPEG_FIX_1_847759065;
+    tmp3 = z1 + z2 * JPEG_FIX_0_765366865;
+    tmp0 = (w[0] + w[4]) * (1 << JPEG_CONST_BITS);
+    tmp1 = (w[0] - w[4]) * (1 << JPEG_CONST_BITS);
+    tmp10 = tmp0 + tmp3;
+    tmp13 = tmp0 - tmp3;
+    tmp11 = tmp1 + tmp2;
+    tmp12 = tmp1 - tmp2;
+
+    tmp0 = w[7];
+    tmp1 = w[5];
+    tmp2 = w[3];
+    tmp3 = w[1];
+    z1 = tmp0 + tmp3;
+    z2 = tmp1 + tmp2;
+    z3 = tmp0 + tmp2;
+    z4 = tmp1 + tmp3;
+    z5 = (z3 + z4) * JPEG_FIX_1_175875602;
+    tmp0 *= JPEG_FIX_0_298631336;
+    tmp1 *= JPEG_FIX_2_053119869;
+    tmp2 *= JPEG_FIX_3_072711026;
+    tmp3 *= JPEG_FIX_1_501321110;
+    z1 *= -JPEG_FIX_0_899976223;
+    z2 *= -JPEG_FIX_2_562915447;
+    z3 = z3 * -JPEG_FIX_1_961570560 + z5;
+    z4 = z4 * -JPEG_FIX_0_390180644 + z5;
+    tmp0 += z1 + z3;
+    tmp1 += z2 + z4;
+    tmp2 += z2 + z3;
+    tmp3 += z1 + z4;
+
+    #define JPEG_OUT(v) jpegClamp(JPEG_DESCALE((v), JPEG_CONST_BITS + JPEG_PASS1_BITS + 3) + 128)
+    out[0] = JPEG_OUT(tmp10 + tmp3);
+    out[7] = JPEG_OUT(tmp10 - tmp3);
+    out[1] = JPEG_OUT(tmp11 + tmp2);
+    out[6] = JPEG_OUT(tmp11 - tmp2);
+    out[2] = JPEG_OUT(tmp12 + tmp1);
+    out[5] = JPEG_OUT(tmp12 - tmp1);
+    out[3] = JPEG_OUT(tmp13 + tmp0);
+    out[4] = JPEG_OUT(tmp13 - tmp0);
+    #undef JPEG_OUT
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Converts the decoded MCU to RGB565 (downscaling if required)
+            and renders it with a single window write
+*/
+/**************************************************************************/
+static void jpegOutputMCU(jpegDecoder_t *jd, uint16_t mx, uint16_t my, uint16_t x, uint16_t y, jpegScale_t scale)
+{
+  uint8_t  box = 1 << scale;
+  uint8_t  outW = jd->mcuWidth >> scale;
+  uint8_t  outH = jd->mcuHeight >> scale;
+  uint16_t imgW = (jd->width + box - 1) >> scale;
+  uint16_t imgH = (jd->height + box - 1) >> scale;
+  uint16_t px = x + mx * outW;
+  uint16_t py = y + my * outH;
+  uint16_t *p = jd->pixels;
+  uint8_t  w, h, ox, oy, sx, sy, i, j, cb, cr, c;
+  uint16_t sum;
+  int16_t  r, g, b;
+
+  /* Clip to the image and to the screen */
+  w = (mx + 1) * outW > imgW ? imgW - mx * outW : outW;
+  h = (my + 1) * outH > imgH ? imgH - my * outH : outH;
+  if ((px >= lcdGetWidth()) || (py >= lcdGetHeight()))
+  {
+    return;
+  }
+  if (px + w > lcdGetWidth()) w = lcdGetWidth() - px;
+  if (py + h > lcdGetHeight()) h = lcdGetHeight() - py;
+
+  for (oy = 0; oy < h; oy++)
+  {
+    for (ox = 0; ox < w; ox++)
+    {
+      sx = ox << scale;
+      sy = oy << scale;
+
+      /* Luma: the block DC value at 1/8, otherwise the box average */
+      if (scale == JPEG_SCALE_1_8)
+      {
+        c = jd->mcuY[sy * jd->mcuWidth + sx];
+      }
+      else
+      {
+        sum = 0;
+        for (j = 0; j < box; j++)
+        {
+          for (i = 0; i < box; i++)
+          {
+            sum += jd->mcuY[(sy + j) * jd->mcuWidth + sx + i];
+          }
+        }
+        c = sum >> (scale * 2);
+      }
+
+      if (jd->numComponents == 1)
+      {
+        *p++ = colorsRGB24toRGB565(c, c, c);
+        continue;
+      }
+
+      /* Chroma: nearest sample (there's only one per MCU at 1/8) */
+      if (scale == JPEG_SCALE_1_8)
+      {
+        cb = jd->mcuCb[0];
+        cr = jd->mcuCr[0];
+      }
+      else
+      {
+        i = (sy * 8 / jd->mcuHeight) * 8 + sx * 8 / jd->mcuWidth;
+        cb = jd->mcuCb[i];
+        cr = jd->mcuCr[i];
+      }
+
+      /* YCbCr to RGB, 16-bit fixed point */
+      r = c + (int16_t)((91881L * (cr - 128)) >> 16);
+      g = c - (int16_t)((22554L * (cb - 128) + 46802L * (cr - 128)) >> 16);
+      b = c + (int16_t)((116130L * (cb - 128)) >> 16);
+      *p++ = colorsRGB24toRGB565(jpegClamp(r), jpegClamp(g), jpegClamp(b));
+    }
+  }
+
+  /* One address window for the whole block */
+  lcdSetWindow(px, py, px + w - 1, py + h - 1);
+  lcdWritePixels(jd->pixels, (uint32_t)w * h);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Resynchronises on an RSTn marker and resets the predictors
+*/
+/**************************************************************************/
+static error_t jpegRestart(jpegDecoder_t *jd)
+{
+  uint8_t b, i;
+
+  /* Discard any remaining bits and find the marker if the bit reader
+     hasn't already run into it */
+  jd->bitBuf = 0;
+  jd->bitCnt = 0;
+  while (!jd->marker)
+  {
+    ASSERT_STATUS(jpegReadByte(jd, &b));
+    if (b == 0xFF)
+    {
+      do
+      {
+        ASSERT_STATUS(jpegReadByte(jd, &b));
+      } while (b == 0xFF);
+      jd->marker = b;
+    }
+  }
+
+  if ((jd->marker & 0xF8) != JPEG_MARKER_RST0)
+  {
+    return ERROR_JPEG_INVALIDFORMAT;
+  }
+  jd->marker = 0;
+
+  for (i = 0; i < jd->numComponents; i++)
+  {
+    jd->comp[i].dcPred = 0;
+  }
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Input function for jpegDrawBuffer
+*/
+/**************************************************************************/
+static uint32_t jpegReadMemory(void *param, uint8_t *buf, uint32_t len)
+{
+  jpegMemorySource_t *src = (jpegMemorySource_t *)param;
+
+  if (len > src->len)
+  {
+    len = src->len;
+  }
+  memcpy(buf, src->data, len);
+  src->data += len;
+  src->len -= len;
+
+  return len;
+}
+
+#ifdef CFG_BSP_SDCARD
+/**************************************************************************/
+/*!
+    @brief  Input function for jpegDrawFile
+*/
+/**************************************************************************/
+static uint32_t jpegReadFile(void *param, uint8_t *buf, uint32_t len)
+{
+  UINT bytesRead = 0;
+
+  if (f_read((FIL *)param, buf, len, &bytesRead) != FR_OK)
+  {
+    return 0;
+  }
+
+  return bytesRead;
+}
+#endif
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Public Methods ------------------------------- */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Reads the JPEG headers up to the start of the image data
+
+    After this returns jd->width and jd->height hold the image size, so
+    that the caller can pick a position or scale factor before calling
+    jpegDecode.
+
+    Only baseline (SOF0/SOF1, 8-bit) images with one (grayscale) or
+    three (YCbCr) components are supported, with 4:4:4, 4:2:2 or 4:2:0
+    chroma subsampling.
+
+    @param[in]  jd
+                Pointer to the decoder state (~3KB, best kept static)
+    @param[in]  input
+                Function used to read the compressed data
+    @param[in]  param
+                Context pointer passed to the input function
+*/
+/**************************************************************************/
+error_t jpegInit(jpegDecoder_t *jd, jpegInputFunc_t input, void *param)
+{
+  uint8_t  b, marker;
+  uint16_t len;
+  bool     frameFound = false;
+
+  if ((jd == NULL) || (input == NULL))
+  {
+    return ERROR_INVALIDPARAMETER;
+  }
+
+  memset(jd, 0, sizeof(jpegDecoder_t));
+  jd->input = input;
+  jd->param = param;
+
+  /* SOI */
+  ASSERT_STATUS(jpegReadByte(jd, &b));
+  ASSERT_STATUS(jpegReadByte(jd, &marker));
+  if ((b != 0xFF) || (marker != JPEG_MARKER_SOI))
+  {
+    return ERROR_JPEG_INVALIDFORMAT;
+  }
+
+  /* Parse marker segments until the start of scan */
+  while (1)
+  {
+    ASSERT_STATUS(jpegReadByte(jd, &b));
+    if (b != 0xFF)
+    {
+      return ERROR_JPEG_INVALIDFORMAT;
+    }
+    do
+    {
+      ASSERT_STATUS(jpegReadByte(jd, &marker));
+    } while (marker == 0xFF);
+
+    ASSERT_STATUS(jpegReadWord(jd, &len));
+    if (len < 2)
+    {
+      return ERROR_JPEG_INVALIDFORMAT;
+    }
+    len -= 2;
+
+    switch (marker)
+    {
+      case JPEG_MARKER_SOF0:
+      case JPEG_MARKER_SOF1:
+        ASSERT_STATUS(jpegParseSOF(jd, len));
+        frameFound = true;
+        break;
+      case JPEG_MARKER_DHT:
+        ASSERT_STATUS(jpegParseDHT(jd, len));
+        break;
+      case JPEG_MARKER_DQT:
+        ASSERT_STATUS(jpegParseDQT(jd, len));
+        break;
+      case JPEG_MARKER_DRI:
+        ASSERT_STATUS(jpegReadWord(jd, &jd->restartInterval));
+        ASSERT_STATUS(jpegSkip(jd, len - 2));
+        break;
+      case JPEG_MARKER_SOS:
+        if (!frameFound)
+        {
+          return ERROR_JPEG_INVALIDFORMAT;
+        }
+        return jpegParseSOS(jd, len);
+      default:
+        /* Progressive, arithmetic coded, lossless, etc. */
+        if ((marker >= 0xC2) && (marker <= 0xCF) && (marker != JPEG_MARKER_DHT) && (marker != 0xC8) && (marker != 0xCC))
+        {
+          return ERROR_JPEG_UNSUPPORTED;
+        }
+        /* APPn, COM, etc. */
+        ASSERT_STATUS(jpegSkip(jd, len));
+        break;
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Decodes the image data and renders it one MCU at a time
+
+    Each MCU (8x8 to 16x16 pixels) is decoded, converted to RGB565 and
+    sent to the display with a single address window, so no frame buffer
+    is required.  The image is clipped to the edge of the display.
+
+    @param[in]  jd
+                Decoder state initialised by jpegInit
+    @param[in]  x
+                The horizontal location of the top-left corner
+    @param[in]  y
+                The vertical location of the top-left corner
+    @param[in]  scale
+                The downscaling factor.  JPEG_SCALE_1_8 skips the IDCT
+                entirely and only uses the DC coefficient of each block,
+                which makes it well suited to thumbnails.
+*/
+/**************************************************************************/
+error_t jpegDecode(jpegDecoder_t *jd, uint16_t x, uint16_t y, jpegScale_t scale)
+{
+  uint16_t mcusX, mcusY, mx, my, restarts;
+  uint8_t  bx, by;
+  bool     dcOnly = (scale == JPEG_SCALE_1_8);
+
+  if ((jd == NULL) || (scale > JPEG_SCALE_1_8) || (jd->mcuWidth == 0))
+  {
+    return ERROR_INVALIDPARAMETER;
+  }
+
+  mcusX = (jd->width + jd->mcuWidth - 1) / jd->mcuWidth;
+  mcusY = (jd->height + jd->mcuHeight - 1) / jd->mcuHeight;
+  restarts = jd->restartInterval;
+
+  for (my = 0; my < mcusY; my++)
+  {
+    for (mx = 0; mx < mcusX; mx++)
+    {
+      if (jd->restartInterval)
+      {
+        if (restarts == 0)
+        {
+          ASSERT_STATUS(jpegRestart(jd));
+          restarts = jd->restartInterval;
+        }
+        restarts--;
+      }
+
+      /* Luma blocks */
+      for (by = 0; by < jd->comp[0].v; by++)
+      {
+        for (bx = 0; bx < jd->comp[0].h; bx++)
+        {
+          ASSERT_STATUS(jpegDecodeBlock(jd, &jd->comp[0], dcOnly));
+          if (dcOnly)
+            jd->mcuY[by * 8 * jd->mcuWidth + bx * 8] = jpegClamp(((jd->block[0] + 4) >> 3) + 128);
+          else
+            jpegIDCT(jd->block, &jd->mcuY[by * 8 * jd->mcuWidth + bx * 8], jd->mcuWidth);
+        }
+      }
+
+      /* Chroma blocks */
+      if (jd->numComponents == 3)
+      {
+        ASSERT_STATUS(jpegDecodeBlock(jd, &jd->comp[1], dcOnly));
+        if (dcOnly)
+          jd->mcuCb[0] = jpegClamp(((jd->block[0] + 4) >> 3) + 128);
+        else
+          jpegIDCT(jd->block, jd->mcuCb, 8);
+        ASSERT_STATUS(jpegDecodeBlock(jd, &jd->comp[2], dcOnly));
+        if (dcOnly)
+          jd->mcuCr[0] = jpegClamp(((jd->block[0] + 4) >> 3) + 128);
+        else
+          jpegIDCT(jd->block, jd->mcuCr, 8);
+      }
+
+      jpegOutputMCU(jd, mx, my, x, y, scale);
+    }
+  }
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Decodes and renders a JPEG image held in memory (in flash,
+            or assembled from protocol messages, etc.)
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/graphic/jpeg.h"
+
+    extern const uint8_t splash_jpg[];
+    extern const uint32_t splash_jpg_len;
+    static jpegDecoder_t jd;
+
+    jpegDrawBuffer(&jd, splash_jpg, splash_jpg_len, 0, 0, JPEG_SCALE_1_1);
+
+    @endcode
+*/
+/**************************************************************************/
+error_t jpegDrawBuffer(jpegDecoder_t *jd, const uint8_t *data, uint32_t len, uint16_t x, uint16_t y, jpegScale_t scale)
+{
+  jpegMemorySource_t src = { data, len };
+
+  ASSERT_STATUS(jpegInit(jd, jpegReadMemory, &src));
+  return jpegDecode(jd, x, y, scale);
+}
+
+#ifdef CFG_BSP_SDCARD
+/**************************************************************************/
+/*!
+    @brief  Decodes and renders a JPEG image from the SD card
+
+    The card must already be mounted.  Data is read one sector-sized
+    chunk at a time, so the whole file never needs to be in memory.
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/graphic/jpeg.h"
+
+    static jpegDecoder_t jd;
+
+    // Draw a quarter-size thumbnail of the photo
+    jpegDrawFile(&jd, "/photos/img001.jpg", 10, 10, JPEG_SCALE_1_4);
+
+    @endcode
+*/
+/**************************************************************************/
+error_t jpegDrawFile(jpegDecoder_t *jd, const char *filename, uint16_t x, uint16_t y, jpegScale_t scale)
+{
+  FIL     file;
+  error_t error;
+
+  if (f_open(&file, filename, FA_READ | FA_OPEN_EXISTING) != FR_OK)
+  {
+    return ERROR_FATFS_UNABLETOOPENFILE;
+  }
+
+  error = jpegInit(jd, jpegReadFile, &file);
+  if (!error)
+  {
+    error = jpegDecode(jd, x, y, scale);
+  }
+
+  f_close(&file);
+  return error;
+}
+#endif
@@ -0,0 +1,129 @@
+/**************************************************************************/
+/*!
+    @file     jpeg.h
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#ifndef __JPEG_H__
+#define __JPEG_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "bspconfig.h"
+#include "lcd.h"
+
+/*=========================================================================
+    JPEG DECODER SETTINGS
+    -----------------------------------------------------------------------
+    JPEG_INPUTBUFFER_LEN    Size in bytes of the input buffer used to
+                            read compressed data from the input function.
+                            512 matches one SD card sector.
+    -----------------------------------------------------------------------*/
+    #define JPEG_INPUTBUFFER_LEN        (512)
+/*=========================================================================*/
+
+typedef enum
+{
+  JPEG_SCALE_1_1 = 0,       // Full size
+  JPEG_SCALE_1_2 = 1,       // 1/2 width and height
+  JPEG_SCALE_1_4 = 2,       // 1/4 width and height
+  JPEG_SCALE_1_8 = 3        // 1/8 width and height (DC only, no IDCT)
+} jpegScale_t;
+
+/* Reads up to len bytes of compressed data into buf, returning the number
+   of bytes actually read (0 at the end of the data) */
+typedef uint32_t (*jpegInputFunc_t)(void *param, uint8_t *buf, uint32_t len);
+
+typedef struct
+{
+  uint16_t mincode[16];     // First code of each length
+  uint16_t maxcode[16];     // Last code of each length + 1
+  uint8_t  valptr[16];      // Index in vals of the first code of each length
+  uint8_t  vals[162];       // Symbols in order of increasing code length
+} jpegHuffTable_t;
+
+typedef struct
+{
+  uint8_t  id;              // Component identifier from the frame header
+  uint8_t  h;               // Horizontal sampling factor
+  uint8_t  v;               // Vertical sampling factor
+  uint8_t  tq;              // Quantization table index
+  uint8_t  td;              // DC Huffman table index
+  uint8_t  ta;              // AC Huffman table index
+  int16_t  dcPred;          // DC predictor
+} jpegComponent_t;
+
+typedef struct
+{
+  // Input
+  jpegInputFunc_t input;
+  void            *param;
+  uint8_t         inBuf[JPEG_INPUTBUFFER_LEN];
+  uint16_t        inPos;
+  uint16_t        inLen;
+  uint32_t        bitBuf;
+  uint8_t         bitCnt;
+  uint8_t         marker;   // Marker found in the entropy-coded data (0 if none)
+
+  // Frame information
+  uint16_t        width;    // Image width in pixels
+  uint16_t        height;   // Image height in pixels
+  uint8_t         numComponents;
+  uint8_t         mcuWidth; // MCU width in pixels (8 or 16)
+  uint8_t         mcuHeight;// MCU height in pixels (8 or 16)
+  uint16_t        restartInterval;
+  jpegComponent_t comp[3];
+  uint8_t         quant[4][64];
+  jpegHuffTable_t huff[4];  // DC0, DC1, AC0, AC1
+
+  // Working buffers for one MCU
+  int16_t         block[64];
+  uint8_t         mcuY[256];
+  uint8_t         mcuCb[64];
+  uint8_t         mcuCr[64];
+  uint16_t        pixels[256];
+} jpegDecoder_t;
+
+error_t jpegInit ( jpegDecoder_t *jd, jpegInputFunc_t input, void *param );
+error_t jpegDecode ( jpegDecoder_t *jd, uint16_t x, uint16_t y, jpegScale_t scale );
+error_t jpegDrawBuffer ( jpegDecoder_t *jd, const uint8_t *data, uint32_t len, uint16_t x, uint16_t y, jpegScale_t scale );
+#ifdef CFG_BSP_SDCARD
+error_t jpegDrawFile ( jpegDecoder_t *jd, const char *filename, uint16_t x, uint16_t y, jpegScale_t scale );
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,151 @@
+/**************************************************************************/
+/*!
+    @file     lcd.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include "lcd.h"
+
+#if defined(LCD_DRIVER) || defined(LCD_MULTIDRIVER)
+
+/* The panel that the lcd* API and the drawing code currently render to.
+   Defaults to the first configured driver in bspconfig.h order. */
+#if defined(CFG_BSP_LCD_ST7735)
+  lcdPanel_t *lcdTarget = &st7735Panel;
+#elif defined(CFG_BSP_LCD_HX8340B)
+  lcdPanel_t *lcdTarget = &hx8340bPanel;
+#else
+  lcdPanel_t *lcdTarget = &hx8347gPanel;
+#endif
+
+#endif
+
+#ifdef LCD_MULTIDRIVER
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Public Methods ------------------------------- */
+/*                                                                        */
+/**************************************************************************/
+
+/* One forwarding function per lcd.h entry point */
+void lcdInit(void)
+{
+  lcdTarget->driver->init(lcdTarget->ctx);
+}
+
+void lcdTest(void)
+{
+  lcdTarget->driver->test(lcdTarget->ctx);
+}
+
+uint16_t lcdGetPixel(uint16_t x, uint16_t y)
+{
+  return lcdTarget->driver->getPixel(lcdTarget->ctx, x, y);
+}
+
+void lcdFillRGB(uint16_t data)
+{
+  lcdTarget->driver->fillRGB(lcdTarget->ctx, data);
+}
+
+void lcdDrawPixel(uint16_t x, uint16_t y, uint16_t color)
+{
+  lcdTarget->driver->drawPixel(lcdTarget->ctx, x, y, color);
+}
+
+void lcdDrawPixels(uint16_t x, uint16_t y, uint16_t *data, uint32_t len)
+{
+  lcdTarget->driver->drawPixels(lcdTarget->ctx, x, y, data, len);
+}
+
+void lcdSetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+  lcdTarget->driver->setWindow(lcdTarget->ctx, x0, y0, x1, y1);
+}
+
+void lcdWritePixels(uint16_t *data, uint32_t len)
+{
+  lcdTarget->driver->writePixels(lcdTarget->ctx, data, len);
+}
+
+void lcdDrawHLine(uint16_t x0, uint16_t x1, uint16_t y, uint16_t color)
+{
+  lcdTarget->driver->drawHLine(lcdTarget->ctx, x0, x1, y, color);
+}
+
+void lcdDrawVLine(uint16_t x, uint16_t y0, uint16_t y1, uint16_t color)
+{
+  lcdTarget->driver->drawVLine(lcdTarget->ctx, x, y0, y1, color);
+}
+
+void lcdBacklight(bool state)
+{
+  lcdTarget->driver->backlight(lcdTarget->ctx, state);
+}
+
+void lcdScroll(int16_t pixels, uint16_t fillColor)
+{
+  lcdTarget->driver->scroll(lcdTarget->ctx, pixels, fillColor);
+}
+
+uint16_t lcdGetWidth(void)
+{
+  return lcdTarget->driver->getWidth(lcdTarget->ctx);
+}
+
+uint16_t lcdGetHeight(void)
+{
+  return lcdTarget->driver->getHeight(lcdTarget->ctx);
+}
+
+void lcdSetOrientation(lcdOrientation_t orientation)
+{
+  lcdTarget->driver->setOrientation(lcdTarget->ctx, orientation);
+}
+
+uint16_t lcdGetControllerID(void)
+{
+  return lcdTarget->driver->getControllerID(lcdTarget->ctx);
+}
+
+lcdOrientation_t lcdGetOrientation(void)
+{
+  return lcdTarget->driver->getOrientation(lcdTarget->ctx);
+}
+
+lcdProperties_t lcdGetProperties(void)
+{
+  return lcdTarget->driver->getProperties(lcdTarget->ctx);
+}
+
+#endif
@@ -55,6 +55,16 @@ typedef enum
   LCD_ORIENTATION_LANDSCAPE = 1
 } lcdOrientation_t;
 
+// Rotation applied in software by the rotated text and bitmap renderers
+// (clockwise).  This doesn't change the orientation of the panel.
+typedef enum
+{
+  LCD_ROTATION_0 = 0,
+  LCD_ROTATION_90 = 1,
+  LCD_ROTATION_180 = 2,
+  LCD_ROTATION_270 = 3
+} lcdRotation_t;
+
 // This struct is used to indicate the capabilities of different LCDs
 typedef struct
 {
@@ -65,14 +75,128 @@ typedef struct
   bool     hwscrolling;   // Whether the LCD support HW scrolling
   bool     fastHLine;     // Whether the driver contains an accelerated horizontal line function
   bool     fastVLine;     // Whether the driver contains an accelerated vertical line function
+  bool     readPixel;     // Whether lcdGetPixel can read pixels back from the panel
 } lcdProperties_t;
 
+// Operations table exported by every panel driver (st7735Driver, etc.).
+// Every operation takes the ctx of the panel it acts on, which is the
+// driver's own per-panel state (st7735_t, etc.), so that several panels,
+// including several driven by the same controller, can be used from the
+// same firmware image.
+typedef struct
+{
+  void             (*init)(void *ctx);
+  void             (*test)(void *ctx);
+  uint16_t         (*getPixel)(void *ctx, uint16_t x, uint16_t y);
+  void             (*fillRGB)(void *ctx, uint16_t data);
+  void             (*drawPixel)(void *ctx, uint16_t x, uint16_t y, uint16_t color);
+  void             (*drawPixels)(void *ctx, uint16_t x, uint16_t y, uint16_t *data, uint32_t len);
+  void             (*setWindow)(void *ctx, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+  void             (*writePixels)(void *ctx, uint16_t *data, uint32_t len);
+  void             (*drawHLine)(void *ctx, uint16_t x0, uint16_t x1, uint16_t y, uint16_t color);
+  void             (*drawVLine)(void *ctx, uint16_t x, uint16_t y0, uint16_t y1, uint16_t color);
+  void             (*backlight)(void *ctx, bool state);
+  void             (*scroll)(void *ctx, int16_t pixels, uint16_t fillColor);
+  uint16_t         (*getWidth)(void *ctx);
+  uint16_t         (*getHeight)(void *ctx);
+  void             (*setOrientation)(void *ctx, lcdOrientation_t orientation);
+  lcdOrientation_t (*getOrientation)(void *ctx);
+  uint16_t         (*getControllerID)(void *ctx);
+  lcdProperties_t  (*getProperties)(void *ctx);
+} lcdDriver_t;
+
+// Handle for one physical panel: the driver that talks to it and that
+// driver's state for this particular panel.  The lcd* functions and the
+// drawing code render to the panel passed to drawSetTarget.
+typedef struct
+{
+  const lcdDriver_t *driver;
+  void              *ctx;
+} lcdPanel_t;
+
+// Each driver also provides a handle for the panel wired to the pins in
+// its header, which is the default target.
+#ifdef CFG_BSP_LCD_ST7735
+extern const lcdDriver_t st7735Driver;
+extern lcdPanel_t        st7735Panel;
+#endif
+#ifdef CFG_BSP_LCD_HX8340B
+extern const lcdDriver_t hx8340bDriver;
+extern lcdPanel_t        hx8340bPanel;
+#endif
+#ifdef CFG_BSP_LCD_HX8347G
+extern const lcdDriver_t hx8347gDriver;
+extern lcdPanel_t        hx8347gPanel;
+#endif
+
+// With a single driver configured the lcd* API below calls that driver's
+// functions directly, so the only cost over a plain function call is
+// fetching the target's ctx.  With several, lcd* dispatches through the
+// target's operations table (see lcd.c).
+#if (defined(CFG_BSP_LCD_ST7735) + defined(CFG_BSP_LCD_HX8340B) + defined(CFG_BSP_LCD_HX8347G)) > 1
+  #define LCD_MULTIDRIVER
+#elif defined(CFG_BSP_LCD_ST7735)
+  #define LCD_DRIVER(name)      st7735##name
+#elif defined(CFG_BSP_LCD_HX8340B)
+  #define LCD_DRIVER(name)      hx8340b##name
+#elif defined(CFG_BSP_LCD_HX8347G)
+  #define LCD_DRIVER(name)      hx8347g##name
+#endif
+
+// The panel that lcd* currently renders to (set with drawSetTarget, which
+// isn't reentrant, so don't switch panels from an ISR)
+extern lcdPanel_t *lcdTarget;
+
+#ifdef LCD_DRIVER
+
+extern void     LCD_DRIVER(Init)(void *ctx);
+extern void     LCD_DRIVER(Test)(void *ctx);
+extern uint16_t LCD_DRIVER(GetPixel)(void *ctx, uint16_t x, uint16_t y);
+extern void     LCD_DRIVER(FillRGB)(void *ctx, uint16_t color);
+extern void     LCD_DRIVER(DrawPixel)(void *ctx, uint16_t x, uint16_t y, uint16_t color);
+extern void     LCD_DRIVER(DrawPixels)(void *ctx, uint16_t x, uint16_t y, uint16_t *data, uint32_t len);
+extern void     LCD_DRIVER(SetWindow)(void *ctx, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+extern void     LCD_DRIVER(WritePixels)(void *ctx, uint16_t *data, uint32_t len);
+extern void     LCD_DRIVER(DrawHLine)(void *ctx, uint16_t x0, uint16_t x1, uint16_t y, uint16_t color);
+extern void     LCD_DRIVER(DrawVLine)(void *ctx, uint16_t x, uint16_t y0, uint16_t y1, uint16_t color);
+extern void     LCD_DRIVER(Backlight)(void *ctx, bool state);
+extern void     LCD_DRIVER(Scroll)(void *ctx, int16_t pixels, uint16_t fillColor);
+extern uint16_t LCD_DRIVER(GetWidth)(void *ctx);
+extern uint16_t LCD_DRIVER(GetHeight)(void *ctx);
+extern void     LCD_DRIVER(SetOrientation)(void *ctx, lcdOrientation_t orientation);
+extern lcdOrientation_t LCD_DRIVER(GetOrientation)(void *ctx);
+extern uint16_t LCD_DRIVER(GetControllerID)(void *ctx);
+extern lcdProperties_t  LCD_DRIVER(GetProperties)(void *ctx);
+
+static inline void     lcdInit(void)                                                    { LCD_DRIVER(Init)(lcdTarget->ctx); }
+static inline void     lcdTest(void)                                                    { LCD_DRIVER(Test)(lcdTarget->ctx); }
+static inline uint16_t lcdGetPixel(uint16_t x, uint16_t y)                              { return LCD_DRIVER(GetPixel)(lcdTarget->ctx, x, y); }
+static inline void     lcdFillRGB(uint16_t data)                                        { LCD_DRIVER(FillRGB)(lcdTarget->ctx, data); }
+static inline void     lcdDrawPixel(uint16_t x, uint16_t y, uint16_t color)             { LCD_DRIVER(DrawPixel)(lcdTarget->ctx, x, y, color); }
+static inline void     lcdDrawPixels(uint16_t x, uint16_t y, uint16_t *data, uint32_t len) { LCD_DRIVER(DrawPixels)(lcdTarget->ctx, x, y, data, len); }
+static inline void     lcdSetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) { LCD_DRIVER(SetWindow)(lcdTarget->ctx, x0, y0, x1, y1); }
+static inline void     lcdWritePixels(uint16_t *data, uint32_t len)                     { LCD_DRIVER(WritePixels)(lcdTarget->ctx, data, len); }
+static inline void     lcdDrawHLine(uint16_t x0, uint16_t x1, uint16_t y, uint16_t color) { LCD_DRIVER(DrawHLine)(lcdTarget->ctx, x0, x1, y, color); }
+static inline void     lcdDrawVLine(uint16_t x, uint16_t y0, uint16_t y1, uint16_t color) { LCD_DRIVER(DrawVLine)(lcdTarget->ctx, x, y0, y1, color); }
+static inline void     lcdBacklight(bool state)                                         { LCD_DRIVER(Backlight)(lcdTarget->ctx, state); }
+static inline void     lcdScroll(int16_t pixels, uint16_t fillColor)                    { LCD_DRIVER(Scroll)(lcdTarget->ctx, pixels, fillColor); }
+static inline uint16_t lcdGetWidth(void)                                                { return LCD_DRIVER(GetWidth)(lcdTarget->ctx); }
+static inline uint16_t lcdGetHeight(void)                                               { return LCD_DRIVER(GetHeight)(lcdTarget->ctx); }
+static inline void     lcdSetOrientation(lcdOrientation_t orientation)                  { LCD_DRIVER(SetOrientation)(lcdTarget->ctx, orientation); }
+static inline uint16_t lcdGetControllerID(void)                                         { return LCD_DRIVER(GetControllerID)(lcdTarget->ctx); }
+static inline lcdOrientation_t lcdGetOrientation(void)                                  { return LCD_DRIVER(GetOrientation)(lcdTarget->ctx); }
+static inline lcdProperties_t  lcdGetProperties(void)                                   { return LCD_DRIVER(GetProperties)(lcdTarget->ctx); }
+
+#else
+
 extern void     lcdInit(void);
 extern void     lcdTest(void);
 extern uint16_t lcdGetPixel(uint16_t x, uint16_t y);
 extern void     lcdFillRGB(uint16_t data);
 extern void     lcdDrawPixel(uint16_t x, uint16_t y, uint16_t color);
 extern void     lcdDrawPixels(uint16_t x, uint16_t y, uint16_t *data, uint32_t len);
+extern void     lcdSetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+extern void     lcdWritePixels(uint16_t *data, uint32_t len);
 extern void     lcdDrawHLine(uint16_t x0, uint16_t x1, uint16_t y, uint16_t color);
 extern void     lcdDrawVLine(uint16_t x, uint16_t y0, uint16_t y1, uint16_t color);
 extern void     lcdBacklight(bool state);
@@ -84,6 +208,8 @@ extern uint16_t lcdGetControllerID(void);
 extern lcdOrientation_t lcdGetOrientation(void);
 extern lcdProperties_t lcdGetProperties(void);
 
+#endif
+
 #ifdef __cplusplus
 }
 #endif 
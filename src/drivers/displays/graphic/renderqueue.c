@@ -0,0 +1,592 @@
+/**************************************************************************/
+/*!
+    @file     renderqueue.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <string.h>
+
+#include "renderqueue.h"
+#include "core/delay/delay.h"
+
+/* Records are padded so that pointers inside them stay aligned */
+#define RENDERQUEUE_ALIGN(n)  (((n) + sizeof(void *) - 1) & ~(sizeof(void *) - 1))
+
+typedef enum
+{
+  RENDERQUEUE_OP_WRAP = 0,      // Rest of the buffer is unused, next record is at 0
+  RENDERQUEUE_OP_PIXEL,
+  RENDERQUEUE_OP_LINE,
+  RENDERQUEUE_OP_RECT,
+  RENDERQUEUE_OP_RECTFILLED,
+  RENDERQUEUE_OP_CIRCLE,
+  RENDERQUEUE_OP_CIRCLEFILLED,
+  RENDERQUEUE_OP_STRING,
+  RENDERQUEUE_OP_CALL
+} renderqueueOp_t;
+
+/* Common part of every record.  Circles use x0/y0 as the center and x1
+   as the radius; 'aux' is the background color for text, and the next
+   row to draw for filled rectangles. */
+typedef struct
+{
+  uint8_t   op;
+  uint8_t   reserved;
+  uint16_t  size;               // Record size in bytes (padded)
+  uint16_t  color;
+  uint16_t  x0, y0, x1, y1;
+  uint16_t  aux;
+} renderqueueCmd_t;
+
+typedef struct
+{
+  renderqueueCmd_t          cmd;
+  const renderqueueFont_t   *font;
+  char                      text[];
+} renderqueueStringCmd_t;
+
+typedef struct
+{
+  renderqueueCmd_t          cmd;
+  renderqueueFunc_t         func;
+  void                      *arg;
+} renderqueueCallCmd_t;
+
+static void    *_renderqueueBuffer[RENDERQUEUE_SIZE / sizeof(void *)];
+static uint16_t _renderqueueHead = 0;     // Offset the next record is written to
+static uint16_t _renderqueueTail = 0;     // Offset of the oldest record
+static uint16_t _renderqueueUsed = 0;     // Bytes in use, including wrap padding
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Private Methods ------------------------------ */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Returns a free-running microsecond count
+
+    Combines the 1ms delay tick with the current SysTick count, so the
+    SysTick timer needs to be running with a 1ms period (the default
+    delay configuration).
+*/
+/**************************************************************************/
+static uint32_t renderqueueMicros(void)
+{
+  uint32_t ms, val;
+
+  /* Read again if the tick rolled over between the two reads */
+  do
+  {
+    ms = delayGetTicks();
+    val = SysTick->VAL;
+  } while (ms != delayGetTicks());
+
+  return ms * 1000 + ((SysTick->LOAD - val) * 1000) / (SysTick->LOAD + 1);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Reserves a contiguous record in the ring buffer
+
+    @return A pointer to the record with the header filled in, or NULL
+            if there isn't enough room right now
+*/
+/**************************************************************************/
+static renderqueueCmd_t *renderqueueAlloc(renderqueueOp_t op, uint16_t size)
+{
+  renderqueueCmd_t *cmd;
+  uint16_t offset;
+
+  size = RENDERQUEUE_ALIGN(size);
+
+  if (_renderqueueUsed == 0)
+  {
+    /* Start again from the beginning for the largest contiguous space */
+    _renderqueueHead = _renderqueueTail = 0;
+  }
+  else if (_renderqueueUsed == RENDERQUEUE_SIZE)
+  {
+    return NULL;
+  }
+
+  if (_renderqueueHead >= _renderqueueTail)
+  {
+    if (size > RENDERQUEUE_SIZE - _renderqueueHead)
+    {
+      /* Doesn't fit before the end, skip to the start if it fits there */
+      if (size > _renderqueueTail)
+      {
+        return NULL;
+      }
+      ((renderqueueCmd_t *)((uint8_t *)_renderqueueBuffer + _renderqueueHead))->op = RENDERQUEUE_OP_WRAP;
+      _renderqueueUsed += RENDERQUEUE_SIZE - _renderqueueHead;
+      _renderqueueHead = 0;
+    }
+  }
+  else if (size > _renderqueueTail - _renderqueueHead)
+  {
+    return NULL;
+  }
+
+  offset = _renderqueueHead;
+  _renderqueueHead += size;
+  if (_renderqueueHead == RENDERQUEUE_SIZE)
+  {
+    _renderqueueHead = 0;
+  }
+  _renderqueueUsed += size;
+
+  cmd = (renderqueueCmd_t *)((uint8_t *)_renderqueueBuffer + offset);
+  cmd->op = op;
+  cmd->size = size;
+  return cmd;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Queues a command that only uses the common record fields
+*/
+/**************************************************************************/
+static error_t renderqueuePush(renderqueueOp_t op, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color)
+{
+  renderqueueCmd_t *cmd = renderqueueAlloc(op, sizeof(renderqueueCmd_t));
+
+  if (cmd == NULL)
+  {
+    return ERROR_BUFFEROVERFLOW;
+  }
+
+  cmd->color = color;
+  cmd->x0 = x0;
+  cmd->y0 = y0;
+  cmd->x1 = x1;
+  cmd->y1 = y1;
+  cmd->aux = y0;
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the oldest record, or NULL if the queue is empty
+*/
+/**************************************************************************/
+static renderqueueCmd_t *renderqueuePeek(void)
+{
+  renderqueueCmd_t *cmd;
+
+  if (_renderqueueUsed == 0)
+  {
+    return NULL;
+  }
+
+  cmd = (renderqueueCmd_t *)((uint8_t *)_renderqueueBuffer + _renderqueueTail);
+  if (cmd->op == RENDERQUEUE_OP_WRAP)
+  {
+    _renderqueueUsed -= RENDERQUEUE_SIZE - _renderqueueTail;
+    _renderqueueTail = 0;
+    cmd = (renderqueueCmd_t *)_renderqueueBuffer;
+  }
+
+  return cmd;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Removes the oldest record from the queue
+*/
+/**************************************************************************/
+static void renderqueuePop(renderqueueCmd_t *cmd)
+{
+  _renderqueueUsed -= cmd->size;
+  _renderqueueTail += cmd->size;
+  if (_renderqueueTail == RENDERQUEUE_SIZE)
+  {
+    _renderqueueTail = 0;
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Executes one bounded step of a command
+
+    @return true if the command is complete
+*/
+/**************************************************************************/
+static bool renderqueueStep(renderqueueCmd_t *cmd)
+{
+  renderqueueStringCmd_t *str;
+  renderqueueCallCmd_t *call;
+  uint16_t last;
+
+  switch (cmd->op)
+  {
+    case RENDERQUEUE_OP_PIXEL:
+      drawPixel(cmd->x0, cmd->y0, cmd->color);
+      return true;
+    case RENDERQUEUE_OP_LINE:
+      drawLine(cmd->x0, cmd->y0, cmd->x1, cmd->y1, cmd->color);
+      return true;
+    case RENDERQUEUE_OP_RECT:
+      drawRectangle(cmd->x0, cmd->y0, cmd->x1, cmd->y1, cmd->color);
+      return true;
+    case RENDERQUEUE_OP_RECTFILLED:
+      /* Large fills are drawn a band of rows at a time */
+      last = cmd->aux + RENDERQUEUE_ROWSPERSTEP - 1;
+      if (last >= cmd->y1)
+      {
+        drawRectangleFilled(cmd->x0, cmd->aux, cmd->x1, cmd->y1, cmd->color);
+        return true;
+      }
+      drawRectangleFilled(cmd->x0, cmd->aux, cmd->x1, last, cmd->color);
+      cmd->aux = last + 1;
+      return false;
+    case RENDERQUEUE_OP_CIRCLE:
+      drawCircle(cmd->x0, cmd->y0, cmd->x1, cmd->color);
+      return true;
+    case RENDERQUEUE_OP_CIRCLEFILLED:
+      drawCircleFilled(cmd->x0, cmd->y0, cmd->x1, cmd->color);
+      return true;
+    case RENDERQUEUE_OP_STRING:
+      str = (renderqueueStringCmd_t *)cmd;
+      #if CFG_BSP_TFTLCD_USEAAFONTS
+      {
+        uint16_t colorTable[16];
+        aafontsCalculateColorTable(cmd->aux, cmd->color, colorTable, str->font->fontType == AAFONTS_FONTTYPE_AA2 ? 4 : 16);
+        aafontsDrawString(cmd->x0, cmd->y0, colorTable, str->font, str->text);
+      }
+      #else
+        fontsDrawString(cmd->x0, cmd->y0, cmd->color, str->font, str->text);
+      #endif
+      return true;
+    case RENDERQUEUE_OP_CALL:
+      call = (renderqueueCallCmd_t *)cmd;
+      return call->func(call->arg);
+    default:
+      return true;
+  }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Public Methods ------------------------------- */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Queues a fill of the entire screen with the specified color
+
+    The fill is drawn in bands of RENDERQUEUE_ROWSPERSTEP rows, so it
+    can be spread over several renderqueueRun slices.
+
+    @return ERROR_BUFFEROVERFLOW if the queue is full (nothing is queued)
+*/
+/**************************************************************************/
+error_t renderqueueFill(uint16_t color)
+{
+  return renderqueuePush(RENDERQUEUE_OP_RECTFILLED, 0, 0, lcdGetWidth() - 1, lcdGetHeight() - 1, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Queues a drawPixel
+*/
+/**************************************************************************/
+error_t renderqueuePixel(uint16_t x, uint16_t y, uint16_t color)
+{
+  return renderqueuePush(RENDERQUEUE_OP_PIXEL, x, y, x, y, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Queues a drawLine
+*/
+/**************************************************************************/
+error_t renderqueueLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color)
+{
+  return renderqueuePush(RENDERQUEUE_OP_LINE, x0, y0, x1, y1, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Queues a drawRectangle
+*/
+/**************************************************************************/
+error_t renderqueueRectangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color)
+{
+  return renderqueuePush(RENDERQUEUE_OP_RECT, x0, y0, x1, y1, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Queues a drawRectangleFilled
+
+    Like renderqueueFill, the rectangle is drawn a band of rows at a
+    time.
+*/
+/**************************************************************************/
+error_t renderqueueRectangleFilled(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color)
+{
+  /* Store the corners in order so the bands run top to bottom */
+  return renderqueuePush(RENDERQUEUE_OP_RECTFILLED, x0 < x1 ? x0 : x1, y0 < y1 ? y0 : y1,
+                         x0 < x1 ? x1 : x0, y0 < y1 ? y1 : y0, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Queues a drawCircle
+*/
+/**************************************************************************/
+error_t renderqueueCircle(uint16_t xCenter, uint16_t yCenter, uint16_t radius, uint16_t color)
+{
+  return renderqueuePush(RENDERQUEUE_OP_CIRCLE, xCenter, yCenter, radius, 0, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Queues a drawCircleFilled
+*/
+/**************************************************************************/
+error_t renderqueueCircleFilled(uint16_t xCenter, uint16_t yCenter, uint16_t radius, uint16_t color)
+{
+  return renderqueuePush(RENDERQUEUE_OP_CIRCLEFILLED, xCenter, yCenter, radius, 0, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Queues a string, which is copied into the queue
+
+    @param[in]  x
+                Starting x co-ordinate
+    @param[in]  y
+                Starting y co-ordinate
+    @param[in]  color
+                Text color
+    @param[in]  bgColor
+                Background color, only used with anti-aliased fonts to
+                calculate the color table
+    @param[in]  font
+                The font to use
+    @param[in]  str
+                The string to render
+
+    @return ERROR_INVALIDPARAMETER if the string can never fit in the
+            queue, ERROR_BUFFEROVERFLOW if it doesn't fit right now
+*/
+/**************************************************************************/
+error_t renderqueueString(uint16_t x, uint16_t y, uint16_t color, uint16_t bgColor, const renderqueueFont_t *font, const char *str)
+{
+  renderqueueStringCmd_t *cmd;
+  size_t len = strlen(str);
+
+  if (sizeof(renderqueueStringCmd_t) + len + 1 > RENDERQUEUE_SIZE)
+  {
+    return ERROR_INVALIDPARAMETER;
+  }
+
+  cmd = (renderqueueStringCmd_t *)renderqueueAlloc(RENDERQUEUE_OP_STRING, sizeof(renderqueueStringCmd_t) + len + 1);
+  if (cmd == NULL)
+  {
+    return ERROR_BUFFEROVERFLOW;
+  }
+
+  cmd->cmd.x0 = x;
+  cmd->cmd.y0 = y;
+  cmd->cmd.color = color;
+  cmd->cmd.aux = bgColor;
+  cmd->font = font;
+  memcpy(cmd->text, str, len + 1);
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Queues a custom render function
+
+    'func' is called once per step until it returns true, so long
+    renders (images, tilemaps, etc.) can do a bounded amount of work per
+    call and keep their progress in 'arg'.
+
+    @section Example
+
+    @code
+
+    typedef struct { uint16_t row; } stripes_t;
+
+    bool drawStripes(void *arg)
+    {
+      stripes_t *s = (stripes_t *)arg;
+      drawRectangleFilled(0, s->row, lcdGetWidth() - 1, s->row + 3,
+                          s->row & 4 ? COLOR_WHITE : COLOR_BLACK);
+      s->row += 4;
+      return s->row >= lcdGetHeight();
+    }
+
+    static stripes_t stripes = { 0 };
+    renderqueueCall(drawStripes, &stripes);
+
+    @endcode
+*/
+/**************************************************************************/
+error_t renderqueueCall(renderqueueFunc_t func, void *arg)
+{
+  renderqueueCallCmd_t *cmd;
+
+  if (func == NULL)
+  {
+    return ERROR_INVALIDPARAMETER;
+  }
+
+  cmd = (renderqueueCallCmd_t *)renderqueueAlloc(RENDERQUEUE_OP_CALL, sizeof(renderqueueCallCmd_t));
+  if (cmd == NULL)
+  {
+    return ERROR_BUFFEROVERFLOW;
+  }
+
+  cmd->func = func;
+  cmd->arg = arg;
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Renders queued commands for at most 'budget' microseconds
+
+    Commands are executed in the order they were queued.  Large fills
+    and custom render functions are split into steps, and the budget is
+    checked after every step, so a slice overruns by at most one step.
+    At least one step is always executed so the queue keeps draining
+    with a zero budget.
+
+    This is meant to be called from the idle loop between other tasks.
+    The queue isn't interrupt safe: commands should be queued and run
+    from the same context.
+
+    @param[in]  budget
+                Time slice in microseconds
+
+    @return true if there is still work left in the queue
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/graphic/renderqueue.h"
+
+    renderqueueFill(COLOR_BLACK);
+    renderqueueRectangleFilled(10, 10, 229, 60, COLOR_BLUE);
+    renderqueueString(20, 30, COLOR_WHITE, COLOR_BLUE, &dejaVuSans9ptFontInfo, "Updating...");
+
+    while (1)
+    {
+      prot_task(NULL);
+      cliPoll();
+
+      // Spend at most 2ms on the screen per pass
+      renderqueueRun(2000);
+    }
+
+    @endcode
+*/
+/**************************************************************************/
+bool renderqueueRun(uint32_t budget)
+{
+  renderqueueCmd_t *cmd;
+  uint32_t start = renderqueueMicros();
+
+  while ((cmd = renderqueuePeek()) != NULL)
+  {
+    if (renderqueueStep(cmd))
+    {
+      renderqueuePop(cmd);
+    }
+    if (renderqueueMicros() - start >= budget)
+    {
+      break;
+    }
+  }
+
+  return _renderqueueUsed != 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Renders everything in the queue before returning
+*/
+/**************************************************************************/
+void renderqueueFlush(void)
+{
+  renderqueueCmd_t *cmd;
+
+  while ((cmd = renderqueuePeek()) != NULL)
+  {
+    if (renderqueueStep(cmd))
+    {
+      renderqueuePop(cmd);
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Discards every queued command, including one in progress
+*/
+/**************************************************************************/
+void renderqueueClear(void)
+{
+  _renderqueueHead = _renderqueueTail = _renderqueueUsed = 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns true if there is nothing left to render
+*/
+/**************************************************************************/
+bool renderqueueIsEmpty(void)
+{
+  return _renderqueueUsed == 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the number of free bytes in the queue
+
+    Wrap-around padding means a record of this size isn't always
+    guaranteed to fit.
+*/
+/**************************************************************************/
+uint16_t renderqueueGetFree(void)
+{
+  return RENDERQUEUE_SIZE - _renderqueueUsed;
+}
@@ -0,0 +1,92 @@
+/**************************************************************************/
+/*!
+    @file     renderqueue.h
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#ifndef __RENDERQUEUE_H__
+#define __RENDERQUEUE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "bspconfig.h"
+#include "drawing.h"
+
+/*=========================================================================
+    RENDER QUEUE SETTINGS
+    -----------------------------------------------------------------------
+    RENDERQUEUE_SIZE          Size in bytes of the command ring buffer
+                              (multiple of 4).  Most commands take 16
+                              or 20 bytes; text takes 20 bytes plus the
+                              string, rounded up to 4 bytes.
+    RENDERQUEUE_ROWSPERSTEP   Number of rows a filled rectangle draws
+                              before renderqueueRun checks its time
+                              budget again.  Smaller values keep the
+                              slices closer to the budget at the cost of
+                              a few more window setups.
+    -----------------------------------------------------------------------*/
+    #define RENDERQUEUE_SIZE            (512)
+    #define RENDERQUEUE_ROWSPERSTEP     (8)
+/*=========================================================================*/
+
+#if CFG_BSP_TFTLCD_USEAAFONTS
+  typedef aafontsFont_t renderqueueFont_t;
+#else
+  typedef FONT_INFO renderqueueFont_t;
+#endif
+
+/* Custom render step for renderqueueCall.  Return true once the work is
+   complete, or false to be called again in the next step. */
+typedef bool (*renderqueueFunc_t)(void *arg);
+
+error_t   renderqueueFill             ( uint16_t color );
+error_t   renderqueuePixel            ( uint16_t x, uint16_t y, uint16_t color );
+error_t   renderqueueLine             ( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color );
+error_t   renderqueueRectangle        ( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color );
+error_t   renderqueueRectangleFilled  ( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color );
+error_t   renderqueueCircle           ( uint16_t xCenter, uint16_t yCenter, uint16_t radius, uint16_t color );
+error_t   renderqueueCircleFilled     ( uint16_t xCenter, uint16_t yCenter, uint16_t radius, uint16_t color );
+error_t   renderqueueString           ( uint16_t x, uint16_t y, uint16_t color, uint16_t bgColor, const renderqueueFont_t *font, const char *str );
+error_t   renderqueueCall             ( renderqueueFunc_t func, void *arg );
+bool      renderqueueRun              ( uint32_t budget );
+void      renderqueueFlush            ( void );
+void      renderqueueClear            ( void );
+bool      renderqueueIsEmpty          ( void );
+uint16_t  renderqueueGetFree          ( void );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
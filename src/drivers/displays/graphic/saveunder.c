@@ -0,0 +1,281 @@
+/**************************************************************************/
+/*!
+    @file     saveunder.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <string.h>
+
+#include "saveunder.h"
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Private Methods ------------------------------ */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Paints one row of the scene into line, for the len pixels
+            starting at x/y
+*/
+/**************************************************************************/
+static void saveunderReplayRow(const saveunderScene_t *scene, uint16_t x, uint16_t y, uint16_t *line, uint16_t len)
+{
+  const saveunderLayer_t *layer;
+  uint16_t i, x0, x1;
+
+  for (i = 0; i < len; i++)
+  {
+    line[i] = scene->background;
+  }
+
+  for (layer = scene->layers; layer < scene->layers + scene->layerCount; layer++)
+  {
+    /* Skip layers that don't cover any part of this row */
+    if ((y < layer->y) || (y >= layer->y + layer->height))
+      continue;
+    x0 = layer->x > x ? layer->x : x;
+    x1 = layer->x + layer->width < x + len ? layer->x + layer->width : x + len;
+    if (x0 >= x1)
+      continue;
+
+    switch (layer->type)
+    {
+      case SAVEUNDER_LAYER_FILL:
+        for (i = x0; i < x1; i++)
+        {
+          line[i - x] = layer->color;
+        }
+        break;
+      case SAVEUNDER_LAYER_BITMAP:
+        if (layer->pixels)
+        {
+          memcpy(&line[x0 - x],
+                 &layer->pixels[(uint32_t)(y - layer->y) * layer->width + (x0 - layer->x)],
+                 (x1 - x0) * sizeof(uint16_t));
+        }
+        break;
+      case SAVEUNDER_LAYER_RENDER:
+        if (layer->render)
+        {
+          layer->render(layer->param, x0, y, &line[x0 - x], x1 - x0);
+        }
+        break;
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Repaints the saved area from the scene, a row at a time
+
+    This is kept out of saveunderRestore so that the line buffer is
+    only on the stack when the area wasn't captured.
+*/
+/**************************************************************************/
+static void __attribute__ ((noinline)) saveunderReplay(const saveunder_t *su)
+{
+  uint16_t line[SAVEUNDER_MAX_LINEWIDTH];
+  uint16_t row;
+
+  for (row = 0; row < su->height; row++)
+  {
+    saveunderReplayRow(su->scene, su->x, su->y + row, line, su->width);
+    lcdWritePixels(line, su->width);
+  }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Public Methods ------------------------------- */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Initialises a save-under context
+
+    @param[in]  su
+                The save-under context
+    @param[in]  buffer
+                Buffer for the pixels read back from the panel.  It
+                needs room for width * height pixels of the largest area
+                that will be saved.  Can be NULL if the panel can't read
+                pixels back (see lcdGetProperties), since the area is
+                then replayed from the scene.
+    @param[in]  bufferLen
+                The size of buffer in pixels
+    @param[in]  scene
+                Description of what's on the screen, used to repaint the
+                saved area when the panel can't read pixels back.  Can
+                be NULL if the panel supports readback.
+*/
+/**************************************************************************/
+void saveunderInit(saveunder_t *su, uint16_t *buffer, uint32_t bufferLen, const saveunderScene_t *scene)
+{
+  memset(su, 0, sizeof(saveunder_t));
+  su->buffer = buffer;
+  su->bufferLen = buffer ? bufferLen : 0;
+  su->scene = scene;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Saves the area that is about to be covered by a popup, cursor
+            or other overlay
+
+    If the panel can read pixels back and the buffer is large enough,
+    the pixels are copied into the buffer.  Otherwise only the area is
+    recorded, and saveunderRestore will repaint it from the scene.  The
+    area is clipped to the screen.
+
+    @param[in]  su
+                The save-under context
+    @param[in]  x, y
+                Top-left corner of the area to save
+    @param[in]  width, height
+                Size of the area to save in pixels
+
+    @return     ERROR_DISPLAY_READBACKUNSUPPORTED if the area can't be
+                captured and there is no scene to replay
+*/
+/**************************************************************************/
+error_t saveunderSave(saveunder_t *su, uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+  uint16_t sw, sh, px, py;
+  uint16_t *p;
+
+  if (su == NULL)
+    return ERROR_INVALIDPARAMETER;
+
+  su->saved = false;
+  su->captured = false;
+
+  /* Clip to the screen */
+  sw = lcdGetWidth();
+  sh = lcdGetHeight();
+  if ((x >= sw) || (y >= sh) || (width == 0) || (height == 0))
+    return ERROR_NONE;
+  if (width > sw - x)
+    width = sw - x;
+  if (height > sh - y)
+    height = sh - y;
+
+  su->x = x;
+  su->y = y;
+  su->width = width;
+  su->height = height;
+
+  if ((su->buffer) && ((uint32_t)width * height <= su->bufferLen) && lcdGetProperties().readPixel)
+  {
+    p = su->buffer;
+    for (py = y; py < y + height; py++)
+    {
+      for (px = x; px < x + width; px++)
+      {
+        *p++ = lcdGetPixel(px, py);
+      }
+    }
+    su->captured = true;
+  }
+  else if ((su->scene == NULL) || (width > SAVEUNDER_MAX_LINEWIDTH))
+  {
+    return ERROR_DISPLAY_READBACKUNSUPPORTED;
+  }
+
+  su->saved = true;
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Puts back the area saved by saveunderSave
+
+    The whole area is sent as a single window write.  Captured pixels
+    go straight from the buffer to the panel.  Replayed areas are
+    painted one row at a time from the scene, but still stream into the
+    same window.
+
+    @param[in]  su
+                The save-under context
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/graphic/drawing.h"
+    #include "drivers/displays/graphic/saveunder.h"
+    #include "drivers/displays/icons16.h"
+
+    static uint16_t cursorBuffer[16 * 16];
+    saveunder_t cursor;
+
+    saveunderInit(&cursor, cursorBuffer, 16 * 16, NULL);
+
+    // Draw the cursor at x/y
+    saveunderSave(&cursor, x, y, 16, 16);
+    drawIcon16(x, y, COLOR_WHITE, icons16_pointer);
+
+    // Move it to newX/newY without repainting the screen
+    saveunderRestore(&cursor);
+    saveunderSave(&cursor, newX, newY, 16, 16);
+    drawIcon16(newX, newY, COLOR_WHITE, icons16_pointer);
+
+    @endcode
+*/
+/**************************************************************************/
+error_t saveunderRestore(saveunder_t *su)
+{
+  if (su == NULL)
+    return ERROR_INVALIDPARAMETER;
+
+  if (!su->saved)
+    return ERROR_NONE;
+
+  lcdSetWindow(su->x, su->y, su->x + su->width - 1, su->y + su->height - 1);
+
+  if (su->captured)
+  {
+    lcdWritePixels(su->buffer, (uint32_t)su->width * su->height);
+  }
+  else
+  {
+    saveunderReplay(su);
+  }
+
+  su->saved = false;
+  su->captured = false;
+
+  return ERROR_NONE;
+}
@@ -0,0 +1,111 @@
+/**************************************************************************/
+/*!
+    @file     saveunder.h
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#ifndef __SAVEUNDER_H__
+#define __SAVEUNDER_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "bspconfig.h"
+#include "lcd.h"
+
+/*=========================================================================
+    SAVE-UNDER SETTINGS
+    -----------------------------------------------------------------------
+    SAVEUNDER_MAX_LINEWIDTH   The widest area that can be replayed
+                              without a capture buffer, in pixels.  Each
+                              pixel costs 2 bytes of stack space while
+                              the area is being restored.
+    -----------------------------------------------------------------------*/
+    #define SAVEUNDER_MAX_LINEWIDTH     (240)
+/*=========================================================================*/
+
+typedef enum
+{
+  SAVEUNDER_LAYER_FILL = 0,     // Solid rectangle of 'color'
+  SAVEUNDER_LAYER_BITMAP,       // RGB565 image, row by row ('pixels')
+  SAVEUNDER_LAYER_RENDER        // Pixels are generated by 'render'
+} saveunderLayerType_t;
+
+/* Fills buf with len pixels starting at x/y (screen coordinates) */
+typedef void (*saveunderRenderFunc_t)(void *param, uint16_t x, uint16_t y, uint16_t *buf, uint16_t len);
+
+/* One element of the description of what's on the screen */
+typedef struct
+{
+  saveunderLayerType_t  type;
+  uint16_t              x;          // Area covered by the layer
+  uint16_t              y;
+  uint16_t              width;
+  uint16_t              height;
+  uint16_t              color;      // SAVEUNDER_LAYER_FILL
+  const uint16_t        *pixels;    // SAVEUNDER_LAYER_BITMAP, width * height pixels
+  saveunderRenderFunc_t render;     // SAVEUNDER_LAYER_RENDER
+  void                  *param;     // Passed to render
+} saveunderLayer_t;
+
+/* Replayable description of the screen for panels without readback.
+   Layers are painted in table order, so later layers are on top. */
+typedef struct
+{
+  const saveunderLayer_t *layers;
+  uint8_t                layerCount;
+  uint16_t               background;  // Color of areas not covered by any layer
+} saveunderScene_t;
+
+typedef struct
+{
+  uint16_t               *buffer;     // Capture buffer (can be NULL when replaying a scene)
+  uint32_t               bufferLen;   // Size of the capture buffer in pixels
+  const saveunderScene_t *scene;      // Scene to replay when readback isn't available (can be NULL)
+  uint16_t               x;           // The saved area
+  uint16_t               y;
+  uint16_t               width;
+  uint16_t               height;
+  bool                   saved;       // An area has been saved and not yet restored
+  bool                   captured;    // The buffer holds pixels read back from the panel
+} saveunder_t;
+
+void    saveunderInit    ( saveunder_t *su, uint16_t *buffer, uint32_t bufferLen, const saveunderScene_t *scene );
+error_t saveunderSave    ( saveunder_t *su, uint16_t x, uint16_t y, uint16_t width, uint16_t height );
+error_t saveunderRestore ( saveunder_t *su );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
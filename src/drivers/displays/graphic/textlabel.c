@@ -0,0 +1,380 @@
+/**************************************************************************/
+/*!
+    @file     textlabel.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <string.h>
+
+#include "textlabel.h"
+#include "drawing.h"
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Private Methods ------------------------------ */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Reads the next character from 'str' and returns a character
+            the label's font can render
+
+    Anti-aliased labels decode UTF-8, and aafontsDrawString already
+    skips characters the font doesn't have.  Bitmap fonts take one byte
+    per character and don't range-check them, so anything outside the
+    font is shown as a space (or the font's first character if the font
+    has no space).
+*/
+/**************************************************************************/
+static uint16_t textlabelNextChar(const textlabel_t *label, const char **str)
+{
+  uint8_t c;
+
+  if (label->font == NULL)
+  {
+    return aafontsUtf8Next(str);
+  }
+
+  c = (uint8_t)*(*str)++;
+  if ((c >= label->font->startChar) && (c <= label->font->endChar))
+  {
+    return c;
+  }
+  if ((' ' >= label->font->startChar) && (' ' <= label->font->endChar))
+  {
+    return ' ';
+  }
+  return label->font->startChar;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the horizontal advance of a character in pixels,
+            including the blank column that follows bitmap glyphs
+*/
+/**************************************************************************/
+static uint16_t textlabelCharWidth(const textlabel_t *label, uint16_t code)
+{
+  if (label->aaFont != NULL)
+  {
+    const aafontsCharInfo_t *charInfo = aafontsGetCharInfo(label->aaFont, code);
+
+    return charInfo != NULL ? charInfo->width : label->aaFont->unknownCharWidth;
+  }
+
+  if (label->font->charInfo != NULL)
+  {
+    return label->font->charInfo[code - label->font->startChar].widthBits + 1;
+  }
+  return 5 + 1;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws 'len' characters of 'text' starting at screen x
+
+    The characters are turned back into a string for the font's string
+    renderer, encoded as UTF-8 for anti-aliased fonts.
+*/
+/**************************************************************************/
+static void textlabelDrawRun(const textlabel_t *label, uint16_t x, const uint16_t *text, uint8_t len)
+{
+  char    run[TEXTLABEL_MAXLENGTH * 3 + 1];
+  char    *p = run;
+  uint8_t i;
+
+  for (i = 0; i < len; i++)
+  {
+    if ((label->aaFont == NULL) || (text[i] < 0x80))
+    {
+      *p++ = (char)text[i];
+    }
+    else if (text[i] < 0x800)
+    {
+      *p++ = (char)(0xC0 | (text[i] >> 6));
+      *p++ = (char)(0x80 | (text[i] & 0x3F));
+    }
+    else
+    {
+      *p++ = (char)(0xE0 | (text[i] >> 12));
+      *p++ = (char)(0x80 | ((text[i] >> 6) & 0x3F));
+      *p++ = (char)(0x80 | (text[i] & 0x3F));
+    }
+  }
+  *p = '\0';
+
+  if (label->aaFont != NULL)
+  {
+    aafontsDrawString(x, label->y, label->colorTable, label->aaFont, run);
+  }
+  else
+  {
+    fontsDrawString(x, label->y, label->color, label->font, run);
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Fills the label background between screen x positions
+            lo (inclusive) and hi (exclusive)
+*/
+/**************************************************************************/
+static void textlabelClearSpan(const textlabel_t *label, uint16_t lo, uint16_t hi)
+{
+  if (hi > lo)
+  {
+    drawRectangleFilled(lo, label->y, hi - 1, label->y + label->height - 1, label->bgColor);
+  }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Public Methods ------------------------------- */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Sets up a label using a bitmap (FONT_INFO) font
+
+    Nothing is drawn until the first call to textlabelSet.
+
+    @param[in]  label
+                The label to initialise
+    @param[in]  x
+                Left edge of the text, or one past its right edge with
+                TEXTLABEL_ALIGN_RIGHT
+    @param[in]  y
+                Top edge of the text
+    @param[in]  align
+                Text alignment relative to x
+    @param[in]  color
+                Text color
+    @param[in]  bgColor
+                Background color, used to erase glyphs that changed
+    @param[in]  font
+                The font to render with
+*/
+/**************************************************************************/
+void textlabelInit(textlabel_t *label, uint16_t x, uint16_t y, textlabelAlign_t align, uint16_t color, uint16_t bgColor, const FONT_INFO *font)
+{
+  memset(label, 0, sizeof(textlabel_t));
+  label->x = x;
+  label->y = y;
+  label->align = align;
+  label->color = color;
+  label->bgColor = bgColor;
+  label->font = font;
+  label->height = font->height;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Sets up a label using an anti-aliased font
+
+    The color table is calculated from color and bgColor, so the label
+    needs to sit on a solid bgColor background.
+
+    @param[in]  label
+                The label to initialise
+    @param[in]  x
+                Left edge of the text, or one past its right edge with
+                TEXTLABEL_ALIGN_RIGHT
+    @param[in]  y
+                Top edge of the text
+    @param[in]  align
+                Text alignment relative to x
+    @param[in]  color
+                Text color
+    @param[in]  bgColor
+                Background color
+    @param[in]  font
+                The anti-aliased font to render with
+*/
+/**************************************************************************/
+void textlabelInitAA(textlabel_t *label, uint16_t x, uint16_t y, textlabelAlign_t align, uint16_t color, uint16_t bgColor, const aafontsFont_t *font)
+{
+  memset(label, 0, sizeof(textlabel_t));
+  label->x = x;
+  label->y = y;
+  label->align = align;
+  label->color = color;
+  label->bgColor = bgColor;
+  label->aaFont = font;
+  label->height = font->fontHeight;
+  aafontsCalculateColorTable(bgColor, color, label->colorTable, font->fontType == AAFONTS_FONTTYPE_AA2 ? 4 : 16);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Changes the label text, redrawing only what changed
+
+    The new string is laid out and compared glyph by glyph with what is
+    on the screen.  A glyph is left alone if the same character is
+    already drawn at the same position.  Each run of changed glyphs is
+    erased (covering both the old and the new glyph cells) and drawn
+    again in one call, and cells left over when the text gets shorter
+    are erased.
+
+    With TEXTLABEL_ALIGN_LEFT, or with fixed-width digits, only the
+    digits that actually changed are redrawn when a number updates.
+
+    @param[in]  label
+                The label
+    @param[in]  str
+                The new text, decoded as UTF-8 with anti-aliased fonts.
+                Only the first TEXTLABEL_MAXLENGTH characters are used.
+
+    @return     The number of glyphs that were drawn
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/graphic/textlabel.h"
+    #include "drivers/displays/graphic/aafonts/aa2/FontFranklinGothicBold99_Numbers_AA2.h"
+
+    textlabel_t speed;
+    char buffer[8];
+
+    textlabelInitAA(&speed, 230, 60, TEXTLABEL_ALIGN_RIGHT, COLOR_WHITE, COLOR_BLACK,
+                    &FontFranklinGothicBold99_Numbers_AA2);
+
+    while (1)
+    {
+      sprintf(buffer, "%d", readSpeed());
+      textlabelSet(&speed, buffer);
+    }
+
+    @endcode
+*/
+/**************************************************************************/
+uint8_t textlabelSet(textlabel_t *label, const char *str)
+{
+  uint16_t text[TEXTLABEL_MAXLENGTH];
+  uint16_t pos[TEXTLABEL_MAXLENGTH + 1];
+  uint16_t origin, lo, hi;
+  uint8_t  len, count, i, start, drawn = 0;
+
+  /* Lay out the new string, relative to the label origin first */
+  pos[0] = 0;
+  for (len = 0; (len < TEXTLABEL_MAXLENGTH) && (*str != '\0'); len++)
+  {
+    text[len] = textlabelNextChar(label, &str);
+    pos[len + 1] = pos[len] + textlabelCharWidth(label, text[len]);
+  }
+
+  origin = label->x;
+  if (label->align == TEXTLABEL_ALIGN_RIGHT)
+  {
+    origin = pos[len] < label->x ? label->x - pos[len] : 0;
+  }
+  for (i = 0; i <= len; i++)
+  {
+    pos[i] += origin;
+  }
+
+  /* Walk both strings, treating consecutive changed glyphs as one run */
+  count = len > label->length ? len : label->length;
+  i = 0;
+  while (i < count)
+  {
+    if ((i < len) && (i < label->length) && (text[i] == label->text[i]) && (pos[i] == label->pos[i]))
+    {
+      i++;
+      continue;
+    }
+
+    start = i;
+    lo = 0xFFFF;
+    hi = 0;
+    while ((i < count) &&
+           !((i < len) && (i < label->length) && (text[i] == label->text[i]) && (pos[i] == label->pos[i])))
+    {
+      /* The run covers the old cell and the new cell of each glyph */
+      if (i < label->length)
+      {
+        lo = label->pos[i] < lo ? label->pos[i] : lo;
+        hi = label->pos[i + 1] > hi ? label->pos[i + 1] : hi;
+      }
+      if (i < len)
+      {
+        lo = pos[i] < lo ? pos[i] : lo;
+        hi = pos[i + 1] > hi ? pos[i + 1] : hi;
+      }
+      i++;
+    }
+
+    textlabelClearSpan(label, lo, hi);
+    if (start < len)
+    {
+      textlabelDrawRun(label, pos[start], &text[start], (i < len ? i : len) - start);
+      drawn += (i < len ? i : len) - start;
+    }
+  }
+
+  memcpy(label->text, text, sizeof(uint16_t) * len);
+  memcpy(label->pos, pos, sizeof(uint16_t) * (len + 1));
+  label->length = len;
+
+  return drawn;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Erases and redraws the whole label, for example after the
+            screen behind it has been cleared
+*/
+/**************************************************************************/
+void textlabelRedraw(textlabel_t *label)
+{
+  if (label->length)
+  {
+    textlabelClearSpan(label, label->pos[0], label->pos[label->length]);
+    textlabelDrawRun(label, label->pos[0], label->text, label->length);
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Erases the label from the screen and empties it
+*/
+/**************************************************************************/
+void textlabelClear(textlabel_t *label)
+{
+  if (label->length)
+  {
+    textlabelClearSpan(label, label->pos[0], label->pos[label->length]);
+  }
+  label->length = 0;
+}
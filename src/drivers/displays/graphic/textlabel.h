@@ -0,0 +1,90 @@
+/**************************************************************************/
+/*!
+    @file     textlabel.h
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#ifndef __TEXTLABEL_H__
+#define __TEXTLABEL_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "bspconfig.h"
+#include "fonts.h"
+#include "aafonts.h"
+
+/*=========================================================================
+    TEXT LABEL SETTINGS
+    -----------------------------------------------------------------------
+    TEXTLABEL_MAXLENGTH   Maximum number of characters a label can show.
+                          Each character costs 4 bytes in textlabel_t.
+    -----------------------------------------------------------------------*/
+    #define TEXTLABEL_MAXLENGTH         (16)
+/*=========================================================================*/
+
+typedef enum
+{
+  TEXTLABEL_ALIGN_LEFT = 0,     // x is the left edge of the text
+  TEXTLABEL_ALIGN_RIGHT         // x is the right edge of the text (+1)
+} textlabelAlign_t;
+
+/* A label keeps the string it last rendered and where each glyph went,
+   so that textlabelSet only has to redraw the glyphs that changed */
+typedef struct
+{
+  uint16_t            x;
+  uint16_t            y;
+  textlabelAlign_t    align;
+  uint16_t            color;
+  uint16_t            bgColor;
+  uint16_t            height;
+  const FONT_INFO     *font;          // Set for bitmap fonts
+  const aafontsFont_t *aaFont;        // Set for anti-aliased fonts
+  uint16_t            colorTable[16]; // Anti-aliased fonts only
+  uint8_t             length;         // Characters currently on screen
+  uint16_t            text[TEXTLABEL_MAXLENGTH];    // Characters on screen (code points with aaFont)
+  uint16_t            pos[TEXTLABEL_MAXLENGTH + 1]; // Left edge of each glyph, then the right edge of the text
+} textlabel_t;
+
+void      textlabelInit       ( textlabel_t *label, uint16_t x, uint16_t y, textlabelAlign_t align, uint16_t color, uint16_t bgColor, const FONT_INFO *font );
+void      textlabelInitAA     ( textlabel_t *label, uint16_t x, uint16_t y, textlabelAlign_t align, uint16_t color, uint16_t bgColor, const aafontsFont_t *font );
+uint8_t   textlabelSet        ( textlabel_t *label, const char *str );
+void      textlabelRedraw     ( textlabel_t *label );
+void      textlabelClear      ( textlabel_t *label );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,705 @@
+/**************************************************************************/
+/*!
+    @file     textlayout.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <string.h>
+
+#include "textlayout.h"
+
+#ifdef CFG_BSP_TFTLCD
+
+#include "drawing.h"
+
+/* A measured run, matched on the font and the run's bytes */
+typedef struct
+{
+  const void          *font;
+  uint16_t            width;
+  uint16_t            lastUsed;
+  uint8_t             length;
+  char                run[TEXTLAYOUT_CACHEDRUNLENGTH];
+} textlayoutRun_t;
+
+static textlayoutRun_t        _textlayoutRuns[TEXTLAYOUT_CACHESIZE];
+static uint16_t               _textlayoutTick = 0;
+static textlayoutCacheStats_t _textlayoutStats;
+
+static const char             _textlayoutEllipsis[] = "...";
+
+#define TEXTLAYOUT_FNV_OFFSET   (2166136261UL)
+#define TEXTLAYOUT_FNV_PRIME    (16777619UL)
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Private Methods ------------------------------ */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Returns an FNV-1a hash of the text and of the settings the
+            line breaks depend on
+*/
+/**************************************************************************/
+static uint32_t textlayoutHash(const textlayout_t *layout, const char *text)
+{
+  uint32_t hash = TEXTLAYOUT_FNV_OFFSET;
+  uint16_t settings[4];
+  uint8_t i;
+
+  settings[0] = layout->width;
+  settings[1] = layout->height;
+  settings[2] = layout->flags;
+  settings[3] = layout->lineSpacing;
+  for (i = 0; i < sizeof(settings); i++)
+  {
+    hash = (hash ^ ((const uint8_t *)settings)[i]) * TEXTLAYOUT_FNV_PRIME;
+  }
+  while (*text != '\0')
+  {
+    hash = (hash ^ (uint8_t)*text++) * TEXTLAYOUT_FNV_PRIME;
+  }
+
+  return hash;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Adds up the advance of every character in len bytes of str
+*/
+/**************************************************************************/
+static uint16_t textlayoutMeasure(const textlayout_t *layout, const char *str, uint16_t len)
+{
+  const char *end = str + len;
+  uint16_t width = 0;
+
+  while ((str < end) && (*str != '\0'))
+  {
+    width += fontGetCharWidth(&layout->font, fontNextChar(&layout->font, &str));
+  }
+
+  return width;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the advance of a run of text, using the cache for
+            runs up to TEXTLAYOUT_CACHEDRUNLENGTH bytes
+*/
+/**************************************************************************/
+static uint16_t textlayoutMeasureRun(const textlayout_t *layout, const char *str, uint16_t len)
+{
+  const void *font = layout->font.data.bitmap;   // Every member is the same font pointer
+  textlayoutRun_t *run, *victim;
+  uint16_t i;
+
+  if (len > TEXTLAYOUT_CACHEDRUNLENGTH)
+  {
+    _textlayoutStats.uncached++;
+    return textlayoutMeasure(layout, str, len);
+  }
+
+  /* Restart the LRU ages rather than letting them wrap */
+  if (++_textlayoutTick == 0)
+  {
+    for (i = 0; i < TEXTLAYOUT_CACHESIZE; i++)
+    {
+      _textlayoutRuns[i].lastUsed = 0;
+    }
+    _textlayoutTick = 1;
+  }
+
+  victim = &_textlayoutRuns[0];
+  for (i = 0; i < TEXTLAYOUT_CACHESIZE; i++)
+  {
+    run = &_textlayoutRuns[i];
+    if ((run->font == font) && (run->length == len) && !memcmp(run->run, str, len))
+    {
+      run->lastUsed = _textlayoutTick;
+      _textlayoutStats.hits++;
+      return run->width;
+    }
+    if (run->lastUsed < victim->lastUsed)
+    {
+      victim = run;
+    }
+  }
+
+  /* Replace the least recently used run */
+  victim->font = font;
+  victim->length = len;
+  victim->width = textlayoutMeasure(layout, str, len);
+  victim->lastUsed = _textlayoutTick;
+  memcpy(victim->run, str, len);
+  _textlayoutStats.misses++;
+
+  return victim->width;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Takes as much of str (up to end) as fits in avail pixels
+
+    Whole words are measured through the cache, and only the word that
+    crosses the edge is measured character by character.  The line is
+    also limited to TEXTLAYOUT_MAXLINELENGTH bytes from lineStart.
+
+    @return The end of the text that fits, with its advance added to
+            *advance
+*/
+/**************************************************************************/
+static const char *textlayoutFit(const textlayout_t *layout, const char *lineStart, const char *str, const char *end, uint16_t avail, uint16_t *advance)
+{
+  const char *runEnd, *next;
+  uint16_t width = 0, w;
+
+  while (str < end)
+  {
+    runEnd = str + 1;
+    if (*str != ' ')
+    {
+      for (runEnd = str; (runEnd < end) && (*runEnd != ' '); runEnd++);
+    }
+    w = textlayoutMeasureRun(layout, str, runEnd - str);
+    if ((width + w <= avail) && (runEnd - lineStart <= TEXTLAYOUT_MAXLINELENGTH))
+    {
+      width += w;
+      str = runEnd;
+      continue;
+    }
+
+    /* Split the run that crosses the edge */
+    while (str < runEnd)
+    {
+      next = str;
+      w = fontGetCharWidth(&layout->font, fontNextChar(&layout->font, &next));
+      if ((width + w > avail) || (next - lineStart > TEXTLAYOUT_MAXLINELENGTH))
+      {
+        break;
+      }
+      width += w;
+      str = next;
+    }
+    break;
+  }
+
+  *advance += width;
+  return str;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Shortens a line so that "..." fits after it
+
+    The line is refilled from its start up to the end of its source
+    line, so it may show more of the text than before if the ellipsis
+    is narrower than what was cut off.
+*/
+/**************************************************************************/
+static void textlayoutAddEllipsis(textlayout_t *layout, textlayoutLine_t *line)
+{
+  const char *start = layout->text + line->start;
+  const char *end = strchr(start, '\n');
+  uint16_t gap = fontGetSpacing(&layout->font);
+  uint16_t ellipsis = textlayoutMeasure(layout, _textlayoutEllipsis, sizeof(_textlayoutEllipsis) - 1);
+  uint16_t advance = 0;
+  const char *last;
+
+  if (end == NULL)
+  {
+    end = start + strlen(start);
+  }
+  if (layout->width + gap < ellipsis)
+  {
+    return;
+  }
+
+  last = textlayoutFit(layout, start, start, end, layout->width + gap - ellipsis, &advance);
+
+  /* Don't leave spaces between the text and the ellipsis */
+  while ((last > start) && (last[-1] == ' '))
+  {
+    last--;
+    advance -= fontGetCharWidth(&layout->font, ' ');
+  }
+
+  line->length = last - start;
+  line->width = advance + ellipsis - gap;
+  line->ellipsis = 1;
+}
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Public Methods ------------------------------- */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Sets up a layout using a bitmap font
+
+    Set lineSpacing in the layout before calling textlayoutSetText to
+    add extra space between lines.
+
+    @param[in]  layout
+                The layout to initialise
+    @param[in]  x
+                Left edge of the box
+    @param[in]  y
+                Top edge of the box
+    @param[in]  width
+                Box width in pixels
+    @param[in]  height
+                Box height in pixels, lines that don't fit completely
+                aren't shown
+    @param[in]  align
+                Alignment of each line within the box
+    @param[in]  flags
+                Any of TEXTLAYOUT_FLAG_WRAP and TEXTLAYOUT_FLAG_ELLIPSIS
+    @param[in]  color
+                Text color
+    @param[in]  bgColor
+                Background color, used by textlayoutClear
+    @param[in]  font
+                The font to render with
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/graphic/textlayout.h"
+    #include "drivers/displays/graphic/fonts/dejavusans9.h"
+
+    textlayout_t layout;
+
+    textlayoutInit(&layout, 10, 10, 100, 40, TEXTLAYOUT_ALIGN_CENTER,
+                   TEXTLAYOUT_FLAG_WRAP | TEXTLAYOUT_FLAG_ELLIPSIS,
+                   COLOR_WHITE, COLOR_BLACK, &dejaVuSans9ptFontInfo);
+    textlayoutSetText(&layout, "Wrapped, centered and clipped to the box");
+    textlayoutClear(&layout);
+    textlayoutDraw(&layout);
+
+    @endcode
+*/
+/**************************************************************************/
+void textlayoutInit(textlayout_t *layout, uint16_t x, uint16_t y, uint16_t width, uint16_t height, textlayoutAlign_t align, uint8_t flags, uint16_t color, uint16_t bgColor, const FONT_INFO *font)
+{
+  memset(layout, 0, sizeof(textlayout_t));
+  layout->x = x;
+  layout->y = y;
+  layout->width = width;
+  layout->height = height;
+  layout->align = align;
+  layout->flags = flags;
+  layout->color = color;
+  layout->bgColor = bgColor;
+  layout->font.format = FONT_FORMAT_BITMAP;
+  layout->font.data.bitmap = font;
+  layout->lineHeight = font->height;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Sets up a layout using an anti-aliased font
+
+    The color table is calculated from color and bgColor, so the box
+    needs to have a solid bgColor background (see textlayoutClear).
+    Text is decoded as UTF-8.
+
+    @param[in]  layout
+                The layout to initialise
+    @param[in]  x
+                Left edge of the box
+    @param[in]  y
+                Top edge of the box
+    @param[in]  width
+                Box width in pixels
+    @param[in]  height
+                Box height in pixels
+    @param[in]  align
+                Alignment of each line within the box
+    @param[in]  flags
+                Any of TEXTLAYOUT_FLAG_WRAP and TEXTLAYOUT_FLAG_ELLIPSIS
+    @param[in]  color
+                Text color
+    @param[in]  bgColor
+                Background color
+    @param[in]  font
+                The anti-aliased font to render with
+*/
+/**************************************************************************/
+void textlayoutInitAA(textlayout_t *layout, uint16_t x, uint16_t y, uint16_t width, uint16_t height, textlayoutAlign_t align, uint8_t flags, uint16_t color, uint16_t bgColor, const aafontsFont_t *font)
+{
+  memset(layout, 0, sizeof(textlayout_t));
+  layout->x = x;
+  layout->y = y;
+  layout->width = width;
+  layout->height = height;
+  layout->align = align;
+  layout->flags = flags;
+  layout->color = color;
+  layout->bgColor = bgColor;
+  layout->font.format = FONT_FORMAT_AA;
+  layout->font.data.aa = font;
+  layout->lineHeight = font->fontHeight;
+  aafontsCalculateColorTable(bgColor, color, layout->colorTable, font->fontType == AAFONTS_FONTTYPE_AA2 ? 4 : 16);
+}
+
+#if CFG_BSP_TFTLCD_INCLUDESMALLFONTS
+/**************************************************************************/
+/*!
+    @brief  Sets up a layout using a small font
+
+    @param[in]  layout
+                The layout to initialise
+    @param[in]  x
+                Left edge of the box
+    @param[in]  y
+                Top edge of the box
+    @param[in]  width
+                Box width in pixels
+    @param[in]  height
+                Box height in pixels
+    @param[in]  align
+                Alignment of each line within the box
+    @param[in]  flags
+                Any of TEXTLAYOUT_FLAG_WRAP and TEXTLAYOUT_FLAG_ELLIPSIS
+    @param[in]  color
+                Text color
+    @param[in]  bgColor
+                Background color, used by textlayoutClear
+    @param[in]  font
+                The small font to render with (Font_System5x8, etc.)
+*/
+/**************************************************************************/
+void textlayoutInitSmall(textlayout_t *layout, uint16_t x, uint16_t y, uint16_t width, uint16_t height, textlayoutAlign_t align, uint8_t flags, uint16_t color, uint16_t bgColor, const struct FONT_DEF *font)
+{
+  memset(layout, 0, sizeof(textlayout_t));
+  layout->x = x;
+  layout->y = y;
+  layout->width = width;
+  layout->height = height;
+  layout->align = align;
+  layout->flags = flags;
+  layout->color = color;
+  layout->bgColor = bgColor;
+  layout->font.format = FONT_FORMAT_SMALL;
+  layout->font.data.small = font;
+  layout->lineHeight = font->u8Height + 1;
+}
+#endif
+
+/**************************************************************************/
+/*!
+    @brief  Breaks text into lines that fit the layout's box
+
+    Lines end at '\n', and with TEXTLAYOUT_FLAG_WRAP also before a word
+    that doesn't fit.  A word wider than the box is broken where it
+    reaches the edge.  Without wrapping, lines that are too wide are
+    cut short.  Lines past the bottom of the box are dropped, and with
+    TEXTLAYOUT_FLAG_ELLIPSIS the last line shown (and any line that was
+    cut short) ends in "...".
+
+    Setting the same text again (same pointer, contents and box) keeps
+    the existing lines after a single hashing pass over the string,
+    without measuring anything.  Otherwise words are measured through a
+    small cache shared by all layouts.  The layout keeps a pointer to
+    text, which must stay valid until the layout is drawn for the last
+    time or given a new string.
+
+    @param[in]  layout
+                The layout to use
+    @param[in]  text
+                NULL-terminated string to lay out
+
+    @return The number of lines that fit in the box
+*/
+/**************************************************************************/
+uint8_t textlayoutSetText(textlayout_t *layout, const char *text)
+{
+  uint16_t gap = fontGetSpacing(&layout->font);
+  uint16_t limit = layout->width + gap;
+  uint16_t maxLines, advance, pending, w;
+  const char *p = text, *start, *end, *wordEnd;
+  textlayoutLine_t *line;
+  bool cut, dropped = false;
+  uint32_t hash = textlayoutHash(layout, text);
+
+  if ((text == layout->text) && (hash == layout->textHash))
+  {
+    return layout->lineCount;
+  }
+
+  layout->text = text;
+  layout->textHash = hash;
+  layout->lineCount = 0;
+  layout->truncated = 0;
+
+  maxLines = (layout->height + layout->lineSpacing) / (layout->lineHeight + layout->lineSpacing);
+  if (maxLines > TEXTLAYOUT_MAXLINES)
+  {
+    maxLines = TEXTLAYOUT_MAXLINES;
+  }
+
+  while (*p != '\0')
+  {
+    if (layout->lineCount == maxLines)
+    {
+      layout->truncated = 1;
+      dropped = true;
+      break;
+    }
+
+    start = end = p;
+    advance = 0;
+    pending = 0;
+    cut = false;
+
+    for (;;)
+    {
+      if ((*p == '\0') || (*p == '\n'))
+      {
+        break;
+      }
+      if (*p == ' ')
+      {
+        /* Spaces only count once a word follows them */
+        pending += fontGetCharWidth(&layout->font, ' ');
+        p++;
+        continue;
+      }
+
+      for (wordEnd = p; (*wordEnd != '\0') && (*wordEnd != ' ') && (*wordEnd != '\n'); wordEnd++);
+      w = textlayoutMeasureRun(layout, p, wordEnd - p);
+      if ((advance + pending + w <= limit) && (wordEnd - start <= TEXTLAYOUT_MAXLINELENGTH))
+      {
+        advance += pending + w;
+        pending = 0;
+        p = end = wordEnd;
+        continue;
+      }
+
+      if (!(layout->flags & TEXTLAYOUT_FLAG_WRAP))
+      {
+        /* Cut the line short and skip to the next one */
+        advance = 0;
+        end = textlayoutFit(layout, start, start, wordEnd, limit, &advance);
+        for (p = wordEnd; (*p != '\0') && (*p != '\n'); p++);
+        cut = true;
+        break;
+      }
+      if (end == start)
+      {
+        /* A single word wider than the box, always taking at least one
+           character so that the layout moves forward */
+        advance = 0;
+        end = textlayoutFit(layout, start, start, wordEnd, limit, &advance);
+        if (end == start)
+        {
+          fontNextChar(&layout->font, &end);
+          advance = textlayoutMeasure(layout, start, end - start);
+        }
+        p = end;
+      }
+      break;
+    }
+
+    line = &layout->lines[layout->lineCount++];
+    line->start = start - text;
+    line->length = end - start;
+    line->width = advance > gap ? advance - gap : 0;
+    line->ellipsis = 0;
+    if (cut)
+    {
+      layout->truncated = 1;
+      if (layout->flags & TEXTLAYOUT_FLAG_ELLIPSIS)
+      {
+        textlayoutAddEllipsis(layout, line);
+      }
+    }
+
+    /* A newline ends the line, while a wrapped line swallows the
+       spaces it was broken at */
+    if (*p == '\n')
+    {
+      p++;
+    }
+    else
+    {
+      while (*p == ' ')
+      {
+        p++;
+      }
+    }
+  }
+
+  if (dropped && layout->lineCount && (layout->flags & TEXTLAYOUT_FLAG_ELLIPSIS))
+  {
+    line = &layout->lines[layout->lineCount - 1];
+    if (!line->ellipsis)
+    {
+      textlayoutAddEllipsis(layout, line);
+    }
+  }
+
+  return layout->lineCount;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws the lines worked out by textlayoutSetText
+
+    Text is drawn over whatever is already there, call textlayoutClear
+    first to erase the box.
+
+    @param[in]  layout
+                The layout to draw
+*/
+/**************************************************************************/
+void textlayoutDraw(const textlayout_t *layout)
+{
+  char buffer[TEXTLAYOUT_MAXLINELENGTH + sizeof(_textlayoutEllipsis)];
+  const textlayoutLine_t *line;
+  uint16_t colorTable[2] = { layout->color, layout->color };
+  uint16_t x, y, i;
+
+  for (i = 0; i < layout->lineCount; i++)
+  {
+    line = &layout->lines[i];
+    y = layout->y + i * (layout->lineHeight + layout->lineSpacing);
+    x = layout->x;
+
+    /* A single character wider than the box stays at the left edge */
+    if ((layout->align == TEXTLAYOUT_ALIGN_CENTER) && (line->width < layout->width))
+    {
+      x += (layout->width - line->width) / 2;
+    }
+    else if ((layout->align == TEXTLAYOUT_ALIGN_RIGHT) && (line->width < layout->width))
+    {
+      x += layout->width - line->width;
+    }
+
+    memcpy(buffer, layout->text + line->start, line->length);
+    strcpy(&buffer[line->length], line->ellipsis ? _textlayoutEllipsis : "");
+
+    if (layout->font.format == FONT_FORMAT_AA)
+    {
+      /* Goes through the anti-aliased glyph cache */
+      aafontsDrawString(x, y, layout->colorTable, layout->font.data.aa, buffer);
+    }
+    else
+    {
+      drawText(x, y, &layout->font, buffer, colorTable);
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Fills the layout's box with its background color
+
+    @param[in]  layout
+                The layout to clear
+*/
+/**************************************************************************/
+void textlayoutClear(const textlayout_t *layout)
+{
+  if (layout->width && layout->height)
+  {
+    drawRectangleFilled(layout->x, layout->y, layout->x + layout->width - 1, layout->y + layout->height - 1, layout->bgColor);
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the width in pixels of len bytes of str in the
+            layout's font, measuring words through the cache
+
+    @param[in]  layout
+                The layout whose font is used
+    @param[in]  str
+                The text to measure
+    @param[in]  len
+                Number of bytes to measure (the NULL terminator also
+                ends the text)
+*/
+/**************************************************************************/
+uint16_t textlayoutGetRunWidth(const textlayout_t *layout, const char *str, uint16_t len)
+{
+  uint16_t advance = 0, gap = fontGetSpacing(&layout->font);
+  const char *end = str + len;
+  const char *runEnd;
+
+  while ((str < end) && (*str != '\0'))
+  {
+    runEnd = str + 1;
+    if (*str != ' ')
+    {
+      for (runEnd = str; (runEnd < end) && (*runEnd != '\0') && (*runEnd != ' '); runEnd++);
+    }
+    advance += textlayoutMeasureRun(layout, str, runEnd - str);
+    str = runEnd;
+  }
+
+  return advance > gap ? advance - gap : 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Empties the measurement cache
+
+    Call this if a font's data changes at an address that was already
+    used, since the cache matches runs on the font's address.
+*/
+/**************************************************************************/
+void textlayoutCacheFlush(void)
+{
+  memset(_textlayoutRuns, 0, sizeof(_textlayoutRuns));
+  _textlayoutTick = 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the measurement cache hit and miss counters
+
+    @param[out] stats
+                Filled with the counters since power-up
+*/
+/**************************************************************************/
+void textlayoutGetCacheStats(textlayoutCacheStats_t *stats)
+{
+  *stats = _textlayoutStats;
+}
+
+#endif
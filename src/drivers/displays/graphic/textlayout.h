@@ -0,0 +1,138 @@
+/**************************************************************************/
+/*!
+    @file     textlayout.h
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#ifndef __TEXTLAYOUT_H__
+#define __TEXTLAYOUT_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "bspconfig.h"
+#include "fonts.h"
+#include "aafonts.h"
+#include "drivers/displays/font.h"
+
+/*=========================================================================
+    TEXT LAYOUT SETTINGS
+    -----------------------------------------------------------------------
+    TEXTLAYOUT_MAXLINES         Maximum number of lines in a layout.  Each
+                                line costs 6 bytes in textlayout_t.
+    TEXTLAYOUT_MAXLINELENGTH    Maximum number of bytes on one line, the
+                                rest is wrapped or truncated.  A line is
+                                copied to a buffer of this size (+4) on
+                                the stack while it is drawn.
+    TEXTLAYOUT_CACHESIZE        Number of measured runs (words) kept in
+                                the measurement cache, shared by every
+                                layout.  Each entry costs 24 bytes.
+    TEXTLAYOUT_CACHEDRUNLENGTH  Longest run in bytes that is cached, longer
+                                words are measured every time
+    -----------------------------------------------------------------------*/
+    #define TEXTLAYOUT_MAXLINES         (8)
+    #define TEXTLAYOUT_MAXLINELENGTH    (64)
+    #define TEXTLAYOUT_CACHESIZE        (16)
+    #define TEXTLAYOUT_CACHEDRUNLENGTH  (12)
+/*=========================================================================*/
+
+typedef enum
+{
+  TEXTLAYOUT_ALIGN_LEFT = 0,
+  TEXTLAYOUT_ALIGN_CENTER,
+  TEXTLAYOUT_ALIGN_RIGHT
+} textlayoutAlign_t;
+
+typedef enum
+{
+  TEXTLAYOUT_FLAG_NONE      = 0x00,
+  TEXTLAYOUT_FLAG_WRAP      = 0x01,   // Wrap words onto the next line, otherwise lines only end at '\n'
+  TEXTLAYOUT_FLAG_ELLIPSIS  = 0x02    // End truncated text with "..."
+} textlayoutFlags_t;
+
+/* One laid out line, as a byte range of the text */
+typedef struct
+{
+  uint16_t            start;          // Offset of the first byte in the text
+  uint8_t             length;         // Bytes on the line, trailing spaces excluded
+  uint8_t             ellipsis;       // Non-zero if "..." follows the line
+  uint16_t            width;          // Width in pixels, including any ellipsis
+} textlayoutLine_t;
+
+/* Text wrapped and aligned inside a box.  The lines are worked out by
+   textlayoutSetText and kept, so textlayoutDraw doesn't measure again */
+typedef struct
+{
+  uint16_t            x;
+  uint16_t            y;
+  uint16_t            width;
+  uint16_t            height;
+  textlayoutAlign_t   align;
+  uint8_t             flags;
+  uint8_t             lineSpacing;    // Extra pixels between lines
+  uint16_t            lineHeight;
+  uint16_t            color;
+  uint16_t            bgColor;
+  font_t              font;
+  uint16_t            colorTable[16]; // Anti-aliased fonts only
+  const char          *text;
+  uint32_t            textHash;       // Text and box the lines were worked out for
+  uint8_t             lineCount;
+  uint8_t             truncated;      // Non-zero if some of the text didn't fit
+  textlayoutLine_t    lines[TEXTLAYOUT_MAXLINES];
+} textlayout_t;
+
+typedef struct
+{
+  uint32_t            hits;           // Runs found in the cache
+  uint32_t            misses;         // Runs measured and added to the cache
+  uint32_t            uncached;       // Runs too long to cache
+} textlayoutCacheStats_t;
+
+void      textlayoutInit          ( textlayout_t *layout, uint16_t x, uint16_t y, uint16_t width, uint16_t height, textlayoutAlign_t align, uint8_t flags, uint16_t color, uint16_t bgColor, const FONT_INFO *font );
+void      textlayoutInitAA        ( textlayout_t *layout, uint16_t x, uint16_t y, uint16_t width, uint16_t height, textlayoutAlign_t align, uint8_t flags, uint16_t color, uint16_t bgColor, const aafontsFont_t *font );
+#if CFG_BSP_TFTLCD_INCLUDESMALLFONTS
+void      textlayoutInitSmall     ( textlayout_t *layout, uint16_t x, uint16_t y, uint16_t width, uint16_t height, textlayoutAlign_t align, uint8_t flags, uint16_t color, uint16_t bgColor, const struct FONT_DEF *font );
+#endif
+uint8_t   textlayoutSetText       ( textlayout_t *layout, const char *text );
+void      textlayoutDraw          ( const textlayout_t *layout );
+void      textlayoutClear         ( const textlayout_t *layout );
+uint16_t  textlayoutGetRunWidth   ( const textlayout_t *layout, const char *str, uint16_t len );
+void      textlayoutCacheFlush    ( void );
+void      textlayoutGetCacheStats ( textlayoutCacheStats_t *stats );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,299 @@
+/**************************************************************************/
+/*!
+    @file     tilemap.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <string.h>
+
+#include "tilemap.h"
+
+/* Palette indices for the current scanline (bank << 4 | color) */
+static uint8_t  tilemapIndexLine[TILEMAP_MAX_LINEWIDTH];
+
+/* RGB565 pixels for the current scanline */
+static uint16_t tilemapPixelLine[TILEMAP_MAX_LINEWIDTH];
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Private Methods ------------------------------ */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Returns the 4-bit color of pixel x (0..7) in a tile row
+*/
+/**************************************************************************/
+static inline uint8_t tilemapGetTilePixel(const uint8_t *row, uint8_t x)
+{
+  return (x & 1) ? (row[x >> 1] & 0x0F) : (row[x >> 1] >> 4);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Fills order with the indices of the visible sprites, sorted
+            by ascending priority (stable, so table order breaks ties),
+            and returns the number of entries
+*/
+/**************************************************************************/
+static uint8_t tilemapSortSprites(const tilemap_t *tm, uint8_t order[TILEMAP_MAX_SPRITES])
+{
+  uint8_t i, j, n, count;
+
+  count = tm->spriteCount > TILEMAP_MAX_SPRITES ? TILEMAP_MAX_SPRITES : tm->spriteCount;
+  n = 0;
+  for (i = 0; i < count; i++)
+  {
+    if (tm->sprites[i].flags & TILEMAP_SPRITE_HIDDEN)
+      continue;
+
+    /* Insertion sort: the table is small and usually already in order */
+    for (j = n; (j > 0) && (tm->sprites[order[j - 1]].priority > tm->sprites[i].priority); j--)
+    {
+      order[j] = order[j - 1];
+    }
+    order[j] = i;
+    n++;
+  }
+
+  return n;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Renders one row of the background into the index line,
+            leaving pixels that use color 0 untouched
+*/
+/**************************************************************************/
+static void tilemapDrawBackgroundLine(const tilemap_t *tm, uint16_t mapY, uint16_t width)
+{
+  const uint8_t *mapRow = &tm->map[(mapY / TILEMAP_TILE_SIZE) * tm->mapWidth];
+  const uint8_t *src;
+  uint16_t mapX = tm->scrollX % (tm->mapWidth * TILEMAP_TILE_SIZE);
+  uint8_t  col = mapX / TILEMAP_TILE_SIZE;
+  uint8_t  sub = mapX % TILEMAP_TILE_SIZE;
+  uint8_t  row = mapY % TILEMAP_TILE_SIZE;
+  uint8_t  c;
+  uint16_t i = 0;
+
+  while (i < width)
+  {
+    src = &tm->tiles[mapRow[col] * TILEMAP_TILE_BYTES + row * (TILEMAP_TILE_SIZE / 2)];
+    for (; (sub < TILEMAP_TILE_SIZE) && (i < width); sub++, i++)
+    {
+      c = tilemapGetTilePixel(src, sub);
+      if (c)
+      {
+        tilemapIndexLine[i] = c;
+      }
+    }
+    sub = 0;
+    if (++col >= tm->mapWidth)
+    {
+      col = 0;
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Renders the part of a sprite that falls on scanline 'line'
+            into the index line
+*/
+/**************************************************************************/
+static void tilemapDrawSpriteLine(const tilemap_t *tm, const tilemapSprite_t *s, uint16_t line, uint16_t width)
+{
+  int16_t  sy, sx, fx, sxStart, sxEnd, pixelWidth;
+  uint8_t  c, bank;
+  const uint8_t *rowBase;
+
+  sy = (int16_t)line - s->y;
+  if ((sy < 0) || (sy >= s->height * TILEMAP_TILE_SIZE))
+  {
+    return;
+  }
+  if (s->flags & TILEMAP_SPRITE_VFLIP)
+  {
+    sy = s->height * TILEMAP_TILE_SIZE - 1 - sy;
+  }
+
+  /* Clip horizontally to the rendered area */
+  pixelWidth = s->width * TILEMAP_TILE_SIZE;
+  sxStart = s->x < 0 ? -s->x : 0;
+  sxEnd = s->x + pixelWidth > (int16_t)width ? (int16_t)width - s->x : pixelWidth;
+
+  /* First tile of the sprite's tile row, offset to the pixel row */
+  rowBase = &tm->tiles[(s->tile + (sy / TILEMAP_TILE_SIZE) * s->width) * TILEMAP_TILE_BYTES +
+                       (sy % TILEMAP_TILE_SIZE) * (TILEMAP_TILE_SIZE / 2)];
+  bank = s->palette << 4;
+
+  for (sx = sxStart; sx < sxEnd; sx++)
+  {
+    fx = (s->flags & TILEMAP_SPRITE_HFLIP) ? pixelWidth - 1 - sx : sx;
+    c = tilemapGetTilePixel(&rowBase[(fx / TILEMAP_TILE_SIZE) * TILEMAP_TILE_BYTES], fx % TILEMAP_TILE_SIZE);
+    if (c)
+    {
+      tilemapIndexLine[s->x + sx] = bank | c;
+    }
+  }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Public Methods ------------------------------- */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Renders the tilemap and sprites into the specified area of
+            the screen, one scanline at a time
+
+    No frame buffer is used and nothing is read back from the display:
+    each scanline is composited in a small line buffer (backdrop, sprites
+    flagged TILEMAP_SPRITE_BEHIND, background tiles, then the remaining
+    sprites by ascending priority) and streamed to the panel inside a
+    single address window.  Moving a sprite or scrolling the background
+    is just a change to the tilemap_t followed by another call.
+
+    @param[in]  tm
+                The tilemap and sprite table to render
+    @param[in]  x
+                The horizontal location of the top-left corner
+    @param[in]  y
+                The vertical location of the top-left corner
+    @param[in]  width
+                The width of the area in pixels (up to
+                TILEMAP_MAX_LINEWIDTH)
+    @param[in]  height
+                The height of the area in pixels
+
+    The area is clipped to the right and bottom edges of the screen, and
+    the columns and rows beyond them aren't rendered.
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/graphic/tilemap.h"
+
+    extern const uint8_t  gameTiles[];      // 4bpp tile data
+    extern const uint16_t gamePalette[];    // 2 banks of 16 RGB565 colors
+    extern const uint8_t  gameMap[32*20];   // Tile indices
+
+    tilemapSprite_t sprites[1] = { { 0, 100, 12, 2, 2, 1, 0, 0 } };
+    tilemap_t tm = { gameTiles, gamePalette, gameMap, 32, 20, 0, 0, sprites, 1 };
+
+    while (1)
+    {
+      // Scroll the background and move the sprite along with it
+      tm.scrollX++;
+      sprites[0].x = (sprites[0].x + 2) % 240;
+      tilemapRender(&tm, 0, 0, 240, 160);
+    }
+
+    @endcode
+*/
+/**************************************************************************/
+error_t tilemapRender(const tilemap_t *tm, uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+  uint8_t  order[TILEMAP_MAX_SPRITES];
+  uint8_t  numSprites, i;
+  uint16_t line, px, mapY, mapPixelHeight;
+  const tilemapSprite_t *s;
+
+  if ((tm == NULL) || (tm->tiles == NULL) || (tm->palette == NULL) || (tm->map == NULL) ||
+      (tm->mapWidth == 0) || (tm->mapHeight == 0) ||
+      (width == 0) || (height == 0) || (width > TILEMAP_MAX_LINEWIDTH))
+  {
+    return ERROR_INVALIDPARAMETER;
+  }
+
+  /* Clip to the panel, since lcdSetWindow doesn't */
+  if ((x >= lcdGetWidth()) || (y >= lcdGetHeight()))
+  {
+    return ERROR_NONE;
+  }
+  if (width > lcdGetWidth() - x)
+  {
+    width = lcdGetWidth() - x;
+  }
+  if (height > lcdGetHeight() - y)
+  {
+    height = lcdGetHeight() - y;
+  }
+
+  numSprites = tm->sprites ? tilemapSortSprites(tm, order) : 0;
+  mapPixelHeight = tm->mapHeight * TILEMAP_TILE_SIZE;
+  mapY = tm->scrollY % mapPixelHeight;
+
+  lcdSetWindow(x, y, x + width - 1, y + height - 1);
+
+  for (line = 0; line < height; line++)
+  {
+    /* Backdrop */
+    memset(tilemapIndexLine, 0, width);
+
+    /* Sprites behind the background */
+    for (i = 0; i < numSprites; i++)
+    {
+      s = &tm->sprites[order[i]];
+      if (s->flags & TILEMAP_SPRITE_BEHIND)
+        tilemapDrawSpriteLine(tm, s, line, width);
+    }
+
+    /* Background */
+    tilemapDrawBackgroundLine(tm, mapY, width);
+    if (++mapY >= mapPixelHeight)
+    {
+      mapY = 0;
+    }
+
+    /* Sprites in front of the background */
+    for (i = 0; i < numSprites; i++)
+    {
+      s = &tm->sprites[order[i]];
+      if (!(s->flags & TILEMAP_SPRITE_BEHIND))
+        tilemapDrawSpriteLine(tm, s, line, width);
+    }
+
+    /* Expand through the palette and send the line */
+    for (px = 0; px < width; px++)
+    {
+      tilemapPixelLine[px] = tm->palette[tilemapIndexLine[px]];
+    }
+    lcdWritePixels(tilemapPixelLine, width);
+  }
+
+  return ERROR_NONE;
+}
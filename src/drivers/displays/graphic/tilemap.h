@@ -0,0 +1,102 @@
+/**************************************************************************/
+/*!
+    @file     tilemap.h
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#ifndef __TILEMAP_H__
+#define __TILEMAP_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "bspconfig.h"
+#include "lcd.h"
+
+/*=========================================================================
+    TILEMAP ENGINE SETTINGS
+    -----------------------------------------------------------------------
+    TILEMAP_MAX_LINEWIDTH   The widest area that can be rendered, in
+                            pixels.  Each pixel costs 3 bytes of RAM for
+                            the scanline buffers.
+    TILEMAP_MAX_SPRITES     The maximum number of entries in the sprite
+                            table
+    -----------------------------------------------------------------------*/
+    #define TILEMAP_MAX_LINEWIDTH       (240)
+    #define TILEMAP_MAX_SPRITES         (16)
+/*=========================================================================*/
+
+/* Tiles are 8x8 pixels, 4 bits per pixel (16 colors), packed two pixels
+   per byte with the left pixel in the upper nibble */
+#define TILEMAP_TILE_SIZE               (8)
+#define TILEMAP_TILE_BYTES              (32)
+
+/* Sprite flags */
+#define TILEMAP_SPRITE_HIDDEN           (0x01)  // Sprite is not rendered
+#define TILEMAP_SPRITE_HFLIP            (0x02)  // Mirror horizontally
+#define TILEMAP_SPRITE_VFLIP            (0x04)  // Mirror vertically
+#define TILEMAP_SPRITE_BEHIND           (0x08)  // Only visible through color 0 of the background
+
+typedef struct
+{
+  int16_t  x;               // Position relative to the top-left of the rendered area
+  int16_t  y;
+  uint8_t  tile;            // First tile; a multi-tile sprite uses consecutive tiles, row by row
+  uint8_t  width;           // Width in tiles
+  uint8_t  height;          // Height in tiles
+  uint8_t  palette;         // Palette bank (16 colors each), color 0 is transparent
+  uint8_t  priority;        // Sprites with a higher priority are drawn on top
+  uint8_t  flags;           // TILEMAP_SPRITE_* flags
+} tilemapSprite_t;
+
+typedef struct
+{
+  const uint8_t   *tiles;       // Tile data, TILEMAP_TILE_BYTES per tile (usually in flash)
+  const uint16_t  *palette;     // RGB565 palette banks, 16 entries each. Bank 0 is used by the
+                                // background, and color 0 of bank 0 is the backdrop color
+  const uint8_t   *map;         // Background tile indices, row by row
+  uint8_t         mapWidth;     // Background width in tiles
+  uint8_t         mapHeight;    // Background height in tiles
+  uint16_t        scrollX;      // Background scroll offset in pixels (wraps around)
+  uint16_t        scrollY;
+  tilemapSprite_t *sprites;     // Sprite table (can be NULL)
+  uint8_t         spriteCount;  // Number of entries in the sprite table
+} tilemap_t;
+
+error_t tilemapRender ( const tilemap_t *tm, uint16_t x, uint16_t y, uint16_t width, uint16_t height );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,758 @@
+/**************************************************************************/
+/*!
+    @file     qrcode.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <string.h>
+
+#include "qrcode.h"
+
+/* Error correction codewords per block, indexed by [ecc][version - 1] */
+static const uint8_t qrcodeEccCodewordsPerBlock[4][QRCODE_VERSION_MAX] =
+{
+  {  7, 10, 15, 20, 26, 18, 20, 24, 30, 18 },   /* Low */
+  { 10, 16, 26, 18, 24, 16, 18, 22, 22, 26 },   /* Medium */
+  { 13, 22, 18, 26, 18, 24, 18, 22, 20, 24 },   /* Quartile */
+  { 17, 28, 22, 16, 22, 28, 26, 26, 24, 28 }    /* High */
+};
+
+/* Number of error correction blocks, indexed by [ecc][version - 1] */
+static const uint8_t qrcodeEccBlocks[4][QRCODE_VERSION_MAX] =
+{
+  {  1,  1,  1,  1,  1,  2,  2,  2,  2,  4 },   /* Low */
+  {  1,  1,  1,  2,  2,  4,  4,  4,  5,  5 },   /* Medium */
+  {  1,  1,  2,  2,  4,  4,  6,  6,  8,  8 },   /* Quartile */
+  {  1,  1,  2,  4,  4,  4,  5,  6,  8,  8 }    /* High */
+};
+
+/* Two bit ECC level indicator used in the format information */
+static const uint8_t qrcodeEccFormatBits[4] = { 0x01, 0x00, 0x03, 0x02 };
+
+/* Penalty weights used when selecting the mask pattern */
+#define QRCODE_PENALTY_N1             (3)
+#define QRCODE_PENALTY_N2             (3)
+#define QRCODE_PENALTY_N3             (40)
+#define QRCODE_PENALTY_N4             (10)
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Private Methods ------------------------------ */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Sets or clears a single module in the packed bitset
+*/
+/**************************************************************************/
+static void qrcodeSetModule(qrcode_t *qr, uint8_t x, uint8_t y, bool dark)
+{
+  uint16_t index = (uint16_t)y * qr->size + x;
+
+  if (dark)
+    qr->modules[index >> 3] |= (1 << (index & 7));
+  else
+    qr->modules[index >> 3] &= ~(1 << (index & 7));
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the number of modules available for data and ECC
+            codewords (everything except function patterns) in bits
+*/
+/**************************************************************************/
+static uint16_t qrcodeGetRawDataModules(uint8_t version)
+{
+  uint16_t result = (16 * version + 128) * version + 64;
+  uint8_t  numAlign;
+
+  if (version >= 2)
+  {
+    numAlign = version / 7 + 2;
+    result -= (25 * numAlign - 10) * numAlign - 55;
+    if (version >= 7)
+    {
+      result -= 36;
+    }
+  }
+
+  return result;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the number of data codewords (excluding ECC) that
+            fit in the specified version at the specified ECC level
+*/
+/**************************************************************************/
+static uint16_t qrcodeGetDataCodewords(uint8_t version, qrcodeEcc_t ecc)
+{
+  return qrcodeGetRawDataModules(version) / 8 -
+         qrcodeEccCodewordsPerBlock[ecc][version - 1] * qrcodeEccBlocks[ecc][version - 1];
+}
+
+/**************************************************************************/
+/*!
+    @brief  Fills positions with the alignment pattern centers for the
+            specified version, and returns the number of entries
+*/
+/**************************************************************************/
+static uint8_t qrcodeGetAlignmentPositions(uint8_t version, uint8_t positions[3])
+{
+  uint8_t numAlign, step, i, pos;
+
+  if (version == 1)
+  {
+    return 0;
+  }
+
+  numAlign = version / 7 + 2;
+  step = (version * 4 + numAlign * 2 + 1) / (numAlign * 2 - 2) * 2;
+  positions[0] = 6;
+  for (i = numAlign - 1, pos = QRCODE_SIZE(version) - 7; i >= 1; i--, pos -= step)
+  {
+    positions[i] = pos;
+  }
+
+  return numAlign;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns true if the module at x/y belongs to a function
+            pattern (finder, separator, timing, alignment, format or
+            version information) rather than the data area
+
+    Computing this on the fly avoids keeping a second bitset around
+    while the codewords are placed and the masks are evaluated.
+*/
+/**************************************************************************/
+static bool qrcodeIsFunctionModule(uint8_t version, uint8_t x, uint8_t y)
+{
+  uint8_t size = QRCODE_SIZE(version);
+  uint8_t positions[3];
+  uint8_t numAlign, i, j;
+
+  /* Finder patterns, separators and format information */
+  if ((x < 9) && (y < 9)) return true;
+  if ((x >= size - 8) && (y < 9)) return true;
+  if ((x < 9) && (y >= size - 8)) return true;
+
+  /* Timing patterns */
+  if ((x == 6) || (y == 6)) return true;
+
+  /* Version information blocks */
+  if (version >= 7)
+  {
+    if ((x < 6) && (y >= size - 11) && (y < size - 8)) return true;
+    if ((y < 6) && (x >= size - 11) && (x < size - 8)) return true;
+  }
+
+  /* Alignment patterns (skipping the three that overlap the finders) */
+  numAlign = qrcodeGetAlignmentPositions(version, positions);
+  for (i = 0; i < numAlign; i++)
+  {
+    for (j = 0; j < numAlign; j++)
+    {
+      if (((i == 0) && (j == 0)) || ((i == 0) && (j == numAlign - 1)) || ((i == numAlign - 1) && (j == 0)))
+        continue;
+      if ((x + 2 >= positions[i]) && (x <= positions[i] + 2) &&
+          (y + 2 >= positions[j]) && (y <= positions[j] + 2))
+        return true;
+    }
+  }
+
+  return false;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Multiplies two values in GF(2^8) modulo x^8+x^4+x^3+x^2+1
+*/
+/**************************************************************************/
+static uint8_t qrcodeGFMultiply(uint8_t x, uint8_t y)
+{
+  uint8_t z = 0;
+  int8_t  i;
+
+  for (i = 7; i >= 0; i--)
+  {
+    z = (uint8_t)((z << 1) ^ ((z >> 7) * 0x1D));
+    if ((y >> i) & 1) z ^= x;
+  }
+
+  return z;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Computes the Reed-Solomon generator polynomial of the
+            specified degree (leading 1 coefficient omitted)
+*/
+/**************************************************************************/
+static void qrcodeRSComputeDivisor(uint8_t degree, uint8_t *result)
+{
+  uint8_t root = 1;
+  uint8_t i, j;
+
+  memset(result, 0, degree);
+  result[degree - 1] = 1;
+
+  for (i = 0; i < degree; i++)
+  {
+    /* Multiply the current product by (x - root) */
+    for (j = 0; j < degree; j++)
+    {
+      result[j] = qrcodeGFMultiply(result[j], root);
+      if (j + 1 < degree)
+      {
+        result[j] ^= result[j + 1];
+      }
+    }
+    root = qrcodeGFMultiply(root, 0x02);
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Computes the Reed-Solomon ECC codewords for one block
+*/
+/**************************************************************************/
+static void qrcodeRSComputeRemainder(const uint8_t *data, uint8_t len, const uint8_t *divisor, uint8_t degree, uint8_t *result)
+{
+  uint8_t i, j, factor;
+
+  memset(result, 0, degree);
+  for (i = 0; i < len; i++)
+  {
+    factor = data[i] ^ result[0];
+    memmove(&result[0], &result[1], degree - 1);
+    result[degree - 1] = 0;
+    for (j = 0; j < degree; j++)
+    {
+      result[j] ^= qrcodeGFMultiply(divisor[j], factor);
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Splits the data codewords into blocks, appends the ECC
+            codewords to each block and interleaves everything into
+            the final codeword sequence
+
+    @param[in]  data
+                Data codewords.  Must have room for one block of ECC
+                codewords past the end of the data, which is used as
+                scratch space.
+    @param[out] result
+                The interleaved data and ECC codewords
+*/
+/**************************************************************************/
+static void qrcodeAddEccAndInterleave(uint8_t *data, uint8_t version, qrcodeEcc_t ecc, uint8_t *result)
+{
+  uint8_t  numBlocks    = qrcodeEccBlocks[ecc][version - 1];
+  uint8_t  blockEccLen  = qrcodeEccCodewordsPerBlock[ecc][version - 1];
+  uint16_t rawCodewords = qrcodeGetRawDataModules(version) / 8;
+  uint16_t dataLen      = qrcodeGetDataCodewords(version, ecc);
+  uint8_t  numShortBlocks    = numBlocks - rawCodewords % numBlocks;
+  uint8_t  shortBlockDataLen = rawCodewords / numBlocks - blockEccLen;
+  uint8_t  divisor[30];
+  uint8_t  *eccBuffer = &data[dataLen];
+  const uint8_t *block = data;
+  uint8_t  i, j, blockLen;
+  uint16_t k;
+
+  qrcodeRSComputeDivisor(blockEccLen, divisor);
+
+  for (i = 0; i < numBlocks; i++)
+  {
+    blockLen = shortBlockDataLen + (i < numShortBlocks ? 0 : 1);
+    qrcodeRSComputeRemainder(block, blockLen, divisor, blockEccLen, eccBuffer);
+
+    /* Data codewords (long blocks have one extra codeword at the end) */
+    for (j = 0, k = i; j < blockLen; j++, k += numBlocks)
+    {
+      if (j == shortBlockDataLen)
+      {
+        k -= numShortBlocks;
+      }
+      result[k] = block[j];
+    }
+
+    /* ECC codewords */
+    for (j = 0, k = dataLen + i; j < blockEccLen; j++, k += numBlocks)
+    {
+      result[k] = eccBuffer[j];
+    }
+
+    block += blockLen;
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws the finder, timing, alignment and version patterns
+*/
+/**************************************************************************/
+static void qrcodeDrawFunctionPatterns(qrcode_t *qr)
+{
+  uint8_t positions[3];
+  uint8_t numAlign, i, j, dist;
+  int8_t  dx, dy;
+  int16_t px, py;
+  uint8_t centers[3][2] = { { 3, 3 }, { qr->size - 4, 3 }, { 3, qr->size - 4 } };
+  uint32_t rem, bits;
+
+  /* Timing patterns */
+  for (i = 0; i < qr->size; i++)
+  {
+    qrcodeSetModule(qr, 6, i, (i % 2) == 0);
+    qrcodeSetModule(qr, i, 6, (i % 2) == 0);
+  }
+
+  /* Finder patterns, including the light separators around them */
+  for (i = 0; i < 3; i++)
+  {
+    for (dy = -4; dy <= 4; dy++)
+    {
+      for (dx = -4; dx <= 4; dx++)
+      {
+        px = centers[i][0] + dx;
+        py = centers[i][1] + dy;
+        if ((px < 0) || (px >= qr->size) || (py < 0) || (py >= qr->size))
+          continue;
+        dist = (dx < 0 ? -dx : dx) > (dy < 0 ? -dy : dy) ? (dx < 0 ? -dx : dx) : (dy < 0 ? -dy : dy);
+        qrcodeSetModule(qr, px, py, (dist != 2) && (dist != 4));
+      }
+    }
+  }
+
+  /* Alignment patterns */
+  numAlign = qrcodeGetAlignmentPositions(qr->version, positions);
+  for (i = 0; i < numAlign; i++)
+  {
+    for (j = 0; j < numAlign; j++)
+    {
+      if (((i == 0) && (j == 0)) || ((i == 0) && (j == numAlign - 1)) || ((i == numAlign - 1) && (j == 0)))
+        continue;
+      for (dy = -2; dy <= 2; dy++)
+      {
+        for (dx = -2; dx <= 2; dx++)
+        {
+          qrcodeSetModule(qr, positions[i] + dx, positions[j] + dy, (dx == -2) || (dx == 2) || (dy == -2) || (dy == 2) || ((dx == 0) && (dy == 0)));
+        }
+      }
+    }
+  }
+
+  /* Version information (18 bits, BCH(18,6) encoded) */
+  if (qr->version >= 7)
+  {
+    rem = qr->version;
+    for (i = 0; i < 12; i++)
+    {
+      rem = (rem << 1) ^ ((rem >> 11) * 0x1F25);
+    }
+    bits = ((uint32_t)qr->version << 12) | rem;
+    for (i = 0; i < 18; i++)
+    {
+      j = qr->size - 11 + i % 3;
+      qrcodeSetModule(qr, j, i / 3, (bits >> i) & 1);
+      qrcodeSetModule(qr, i / 3, j, (bits >> i) & 1);
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws both copies of the 15-bit format information
+*/
+/**************************************************************************/
+static void qrcodeDrawFormatBits(qrcode_t *qr, uint8_t mask)
+{
+  uint16_t data = (qrcodeEccFormatBits[qr->ecc] << 3) | mask;
+  uint16_t rem = data;
+  uint16_t bits;
+  uint8_t  i;
+
+  /* BCH(15,5) remainder, then XOR with the fixed format mask */
+  for (i = 0; i < 10; i++)
+  {
+    rem = (rem << 1) ^ ((rem >> 9) * 0x537);
+  }
+  bits = ((data << 10) | rem) ^ 0x5412;
+
+  /* First copy, around the top-left finder */
+  for (i = 0; i <= 5; i++)
+  {
+    qrcodeSetModule(qr, 8, i, (bits >> i) & 1);
+  }
+  qrcodeSetModule(qr, 8, 7, (bits >> 6) & 1);
+  qrcodeSetModule(qr, 8, 8, (bits >> 7) & 1);
+  qrcodeSetModule(qr, 7, 8, (bits >> 8) & 1);
+  for (i = 9; i < 15; i++)
+  {
+    qrcodeSetModule(qr, 14 - i, 8, (bits >> i) & 1);
+  }
+
+  /* Second copy, split between the other two finders */
+  for (i = 0; i < 8; i++)
+  {
+    qrcodeSetModule(qr, qr->size - 1 - i, 8, (bits >> i) & 1);
+  }
+  for (i = 8; i < 15; i++)
+  {
+    qrcodeSetModule(qr, 8, qr->size - 15 + i, (bits >> i) & 1);
+  }
+
+  /* The 'dark module' is always set */
+  qrcodeSetModule(qr, 8, qr->size - 8, true);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Places the interleaved codewords in the data area using the
+            standard two-column zig-zag pattern
+*/
+/**************************************************************************/
+static void qrcodeDrawCodewords(qrcode_t *qr, const uint8_t *codewords, uint16_t len)
+{
+  uint16_t bit = 0;
+  int16_t  right;
+  uint8_t  vert, j, x, y;
+  bool     upward;
+
+  for (right = qr->size - 1; right >= 1; right -= 2)
+  {
+    /* Skip the vertical timing pattern */
+    if (right == 6)
+    {
+      right = 5;
+    }
+    upward = ((right + 1) & 2) == 0;
+    for (vert = 0; vert < qr->size; vert++)
+    {
+      for (j = 0; j < 2; j++)
+      {
+        x = right - j;
+        y = upward ? qr->size - 1 - vert : vert;
+        if (!qrcodeIsFunctionModule(qr->version, x, y) && (bit < len * 8))
+        {
+          qrcodeSetModule(qr, x, y, (codewords[bit >> 3] >> (7 - (bit & 7))) & 1);
+          bit++;
+        }
+      }
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  XORs the specified mask pattern over the data area (calling
+            this twice with the same mask restores the original symbol)
+*/
+/**************************************************************************/
+static void qrcodeApplyMask(qrcode_t *qr, uint8_t mask)
+{
+  uint8_t  x, y;
+  uint16_t index;
+  bool     invert;
+
+  for (y = 0; y < qr->size; y++)
+  {
+    for (x = 0; x < qr->size; x++)
+    {
+      if (qrcodeIsFunctionModule(qr->version, x, y))
+        continue;
+      switch (mask)
+      {
+        case 0:  invert = (x + y) % 2 == 0;                       break;
+        case 1:  invert = y % 2 == 0;                             break;
+        case 2:  invert = x % 3 == 0;                             break;
+        case 3:  invert = (x + y) % 3 == 0;                       break;
+        case 4:  invert = (x / 3 + y / 2) % 2 == 0;               break;
+        case 5:  invert = x * y % 2 + x * y % 3 == 0;             break;
+        case 6:  invert = (x * y % 2 + x * y % 3) % 2 == 0;       break;
+        default: invert = ((x + y) % 2 + x * y % 3) % 2 == 0;     break;
+      }
+      if (invert)
+      {
+        index = (uint16_t)y * qr->size + x;
+        qr->modules[index >> 3] ^= (1 << (index & 7));
+      }
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Calculates the penalty score used to pick the mask pattern
+            that is least likely to confuse a scanner (lower is better)
+*/
+/**************************************************************************/
+static uint32_t qrcodeGetPenaltyScore(const qrcode_t *qr)
+{
+  uint32_t penalty = 0;
+  uint16_t dark = 0;
+  uint16_t total = (uint16_t)qr->size * qr->size;
+  uint16_t history;
+  uint8_t  x, y, run, pass;
+  bool     color, prev, module;
+  int32_t  k;
+
+  /* Pass 0 scans rows, pass 1 scans columns */
+  for (pass = 0; pass < 2; pass++)
+  {
+    for (y = 0; y < qr->size; y++)
+    {
+      run = 0;
+      prev = false;
+      history = 0;
+      for (x = 0; x < qr->size; x++)
+      {
+        module = pass ? qrcodeGetModule(qr, y, x) : qrcodeGetModule(qr, x, y);
+
+        /* Adjacent modules of the same color (N1) */
+        if ((x > 0) && (module == prev))
+        {
+          run++;
+          if (run == 5)
+            penalty += QRCODE_PENALTY_N1;
+          else if (run > 5)
+            penalty++;
+        }
+        else
+        {
+          run = 1;
+        }
+        prev = module;
+
+        /* 1:1:3:1:1 finder-like pattern with four light modules (N3) */
+        history = ((history << 1) | module) & 0x7FF;
+        if ((x >= 10) && ((history == 0x05D) || (history == 0x5D0)))
+        {
+          penalty += QRCODE_PENALTY_N3;
+        }
+      }
+    }
+  }
+
+  /* 2x2 blocks of the same color (N2) and dark module count */
+  for (y = 0; y < qr->size; y++)
+  {
+    for (x = 0; x < qr->size; x++)
+    {
+      color = qrcodeGetModule(qr, x, y);
+      if (color)
+      {
+        dark++;
+      }
+      if ((x + 1 < qr->size) && (y + 1 < qr->size) &&
+          (color == qrcodeGetModule(qr, x + 1, y)) &&
+          (color == qrcodeGetModule(qr, x, y + 1)) &&
+          (color == qrcodeGetModule(qr, x + 1, y + 1)))
+      {
+        penalty += QRCODE_PENALTY_N2;
+      }
+    }
+  }
+
+  /* Balance of dark and light modules (N4), in 5% steps from 50% */
+  k = (((int32_t)dark * 20 - (int32_t)total * 10) < 0 ? -((int32_t)dark * 20 - (int32_t)total * 10) : ((int32_t)dark * 20 - (int32_t)total * 10));
+  k = (k + total - 1) / total - 1;
+  penalty += k * QRCODE_PENALTY_N4;
+
+  return penalty;
+}
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Public Methods ------------------------------- */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Encodes the supplied data as a byte-mode QR code, using the
+            smallest version (1..10) that can hold the data at the
+            requested error correction level
+
+    Only the final module matrix is kept (as a packed bitset in qr),
+    which is 407 bytes for the largest supported version.  workBuffer
+    is only used while the symbol is being built and can be reused for
+    something else (a line buffer, etc.) as soon as this returns.
+
+    @param[out] qr
+                Pointer to the qrcode_t that will hold the symbol
+    @param[in]  data
+                The bytes to encode
+    @param[in]  len
+                The number of bytes in data
+    @param[in]  ecc
+                The error correction level to use
+    @param[in]  workBuffer
+                Scratch buffer of at least QRCODE_BUFFER_LEN_MAX bytes
+
+    @return     ERROR_NONE if the symbol was generated,
+                ERROR_QRCODE_DATATOOLONG if the data doesn't fit in a
+                version 10 symbol at this ECC level
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/qrcode.h"
+    #include "drivers/displays/graphic/drawing.h"
+
+    static qrcode_t qr;
+    uint8_t work[QRCODE_BUFFER_LEN_MAX];
+    char *id = "SN:0123456789";
+
+    if (!qrcodeEncode(&qr, (uint8_t *)id, strlen(id), QRCODE_ECC_MEDIUM, work))
+    {
+      // Render the symbol with 3x3 pixel modules
+      drawQRCode(10, 10, &qr, 3, COLOR_BLACK, COLOR_WHITE);
+    }
+
+    @endcode
+*/
+/**************************************************************************/
+error_t qrcodeEncode(qrcode_t *qr, const uint8_t *data, uint16_t len, qrcodeEcc_t ecc, uint8_t *workBuffer)
+{
+  uint8_t  version, i, mask, countBits;
+  uint16_t capacity, bitLen, bit, n;
+  uint32_t penalty, minPenalty;
+
+  if ((qr == NULL) || (workBuffer == NULL) || ((data == NULL) && len) || (ecc > QRCODE_ECC_HIGH))
+  {
+    return ERROR_INVALIDPARAMETER;
+  }
+
+  /* Find the smallest version that fits (mode + count + payload) */
+  for (version = QRCODE_VERSION_MIN; ; version++)
+  {
+    if (version > QRCODE_VERSION_MAX)
+    {
+      return ERROR_QRCODE_DATATOOLONG;
+    }
+    countBits = version < 10 ? 8 : 16;
+    capacity = qrcodeGetDataCodewords(version, ecc) * 8;
+    if ((len < (1UL << countBits)) && (4 + countBits + (uint32_t)len * 8 <= capacity))
+    {
+      break;
+    }
+  }
+
+  qr->version = version;
+  qr->size = QRCODE_SIZE(version);
+  qr->ecc = ecc;
+
+  /* Build the data bit stream in the module buffer (it's big enough
+     for the data codewords plus one block of ECC scratch space) */
+  memset(qr->modules, 0, sizeof(qr->modules));
+  bitLen = 0;
+  #define QRCODE_APPEND_BITS(val, count)                                    \
+    for (n = (count); n > 0; n--, bitLen++)                                 \
+      qr->modules[bitLen >> 3] |= (((val) >> (n - 1)) & 1) << (7 - (bitLen & 7));
+  QRCODE_APPEND_BITS(0x4, 4);                         /* Byte mode indicator */
+  QRCODE_APPEND_BITS(len, countBits);                 /* Character count */
+  for (bit = 0; bit < len; bit++)
+  {
+    QRCODE_APPEND_BITS(data[bit], 8);
+  }
+  #undef QRCODE_APPEND_BITS
+
+  /* Terminator (up to four zero bits), then pad to a byte boundary */
+  bitLen += (capacity - bitLen) < 4 ? (capacity - bitLen) : 4;
+  bitLen = (bitLen + 7) & ~7;
+
+  /* Fill the remaining capacity with alternating pad bytes */
+  for (i = 0; bitLen < capacity; bitLen += 8, i ^= 1)
+  {
+    qr->modules[bitLen >> 3] = i ? 0x11 : 0xEC;
+  }
+
+  /* Add ECC and interleave the blocks into workBuffer */
+  qrcodeAddEccAndInterleave(qr->modules, version, ecc, workBuffer);
+
+  /* Lay out the symbol */
+  memset(qr->modules, 0, sizeof(qr->modules));
+  qrcodeDrawFunctionPatterns(qr);
+  qrcodeDrawCodewords(qr, workBuffer, qrcodeGetRawDataModules(version) / 8);
+
+  /* Try every mask and keep the one with the lowest penalty */
+  minPenalty = 0xFFFFFFFF;
+  qr->mask = 0;
+  for (mask = 0; mask < 8; mask++)
+  {
+    qrcodeApplyMask(qr, mask);
+    qrcodeDrawFormatBits(qr, mask);
+    penalty = qrcodeGetPenaltyScore(qr);
+    if (penalty < minPenalty)
+    {
+      minPenalty = penalty;
+      qr->mask = mask;
+    }
+    qrcodeApplyMask(qr, mask);
+  }
+  qrcodeApplyMask(qr, qr->mask);
+  qrcodeDrawFormatBits(qr, qr->mask);
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns true if the module at the specified position is dark
+
+    @param[in]  qr
+                Pointer to an encoded qrcode_t
+    @param[in]  x
+                The module column (0..size-1)
+    @param[in]  y
+                The module row (0..size-1)
+*/
+/**************************************************************************/
+bool qrcodeGetModule(const qrcode_t *qr, uint8_t x, uint8_t y)
+{
+  uint16_t index;
+
+  if ((x >= qr->size) || (y >= qr->size))
+  {
+    return false;
+  }
+
+  index = (uint16_t)y * qr->size + x;
+  return (qr->modules[index >> 3] >> (index & 7)) & 1;
+}
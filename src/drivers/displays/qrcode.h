@@ -0,0 +1,81 @@
+/**************************************************************************/
+/*!
+    @file     qrcode.h
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#ifndef __QRCODE_H__
+#define __QRCODE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "bspconfig.h"
+
+// Only versions 1..10 are supported to keep the module buffer small
+#define QRCODE_VERSION_MIN            (1)
+#define QRCODE_VERSION_MAX            (10)
+
+// Number of light modules that should surround the symbol when rendered
+#define QRCODE_QUIETZONE              (4)
+
+// Symbol width/height in modules, and packed buffer size in bytes
+#define QRCODE_SIZE(ver)              ((ver) * 4 + 17)
+#define QRCODE_BUFFER_LEN(ver)        ((QRCODE_SIZE(ver) * QRCODE_SIZE(ver) + 7) / 8)
+#define QRCODE_BUFFER_LEN_MAX         QRCODE_BUFFER_LEN(QRCODE_VERSION_MAX)
+
+typedef enum
+{
+  QRCODE_ECC_LOW      = 0,              /* Recovers ~7% of the symbol */
+  QRCODE_ECC_MEDIUM   = 1,              /* Recovers ~15% of the symbol */
+  QRCODE_ECC_QUARTILE = 2,              /* Recovers ~25% of the symbol */
+  QRCODE_ECC_HIGH     = 3               /* Recovers ~30% of the symbol */
+} qrcodeEcc_t;
+
+typedef struct
+{
+  uint8_t     version;                  /* Symbol version (1..10) */
+  uint8_t     size;                     /* Width and height in modules */
+  qrcodeEcc_t ecc;                      /* Error correction level */
+  uint8_t     mask;                     /* Mask pattern that was applied (0..7) */
+  uint8_t     modules[QRCODE_BUFFER_LEN_MAX];  /* Packed module bitset, row major, 1 = dark */
+} qrcode_t;
+
+error_t qrcodeEncode    ( qrcode_t *qr, const uint8_t *data, uint16_t len, qrcodeEcc_t ecc, uint8_t *workBuffer );
+bool    qrcodeGetModule ( const qrcode_t *qr, uint8_t x, uint8_t y );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
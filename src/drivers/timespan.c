@@ -58,7 +58,7 @@ error_t timespanCreate(int64_t ticks, timespan_t *timespan)
     return ERROR_INVALIDPARAMETER;
   }
 
-  memcpy(timespan, 0, sizeof(timespan_t));
+  memset(timespan, 0, sizeof(timespan_t));
 
   timespan->days = (ticks / TIMESPAN_NANOSPERDAY);
   timespan->hours = (ticks / TIMESPAN_NANOSPERHOUR) % 24;
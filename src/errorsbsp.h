@@ -107,6 +107,24 @@ extern "C" {
   /*=======================================================================*/
 
 
+  /*=======================================================================
+    DISPLAY ERRORS                                         0x0170 .. 0x019F
+    -----------------------------------------------------------------------
+    Errors relating to the display drivers and graphics helpers
+    -----------------------------------------------------------------------*/
+#define ERROR_QRCODE_DATATOOLONG                    (0x171)  /**< Data doesn't fit in the largest supported QR code version */
+#define ERROR_JPEG_INVALIDFORMAT                    (0x172)  /**< Corrupt or missing JPEG marker segment */
+#define ERROR_JPEG_UNSUPPORTED                      (0x173)  /**< JPEG uses an unsupported feature (progressive, 12-bit, sampling factors, etc.) */
+#define ERROR_JPEG_ENDOFDATA                        (0x174)  /**< Input ended before the image was fully decoded */
+#define ERROR_DISPLAY_READBACKUNSUPPORTED           (0x175)  /**< The display driver can't read pixels back from the panel */
+#define ERROR_DISPLAY_BUSY                          (0x176)  /**< A background display transfer is still in progress */
+#define ERROR_ASSETS_INVALIDFORMAT                  (0x177)  /**< Missing or corrupt asset pack header, index or font */
+#define ERROR_ASSETS_NOTFOUND                       (0x178)  /**< No asset with the requested ID in the pack */
+#define ERROR_ASSETS_READFAILED                     (0x179)  /**< Reading the asset pack from external storage failed */
+#define ERROR_FLOODFILL_OVERFLOW                    (0x17A)  /**< Flood fill overflowed its seed stack on a surface too big for FLOODFILL_MAPSIZE */
+  /*=======================================================================*/
+
+
   /*=======================================================================
     USB ERRORS                                             0x0200 .. 0x02FF
     -----------------------------------------------------------------------
@@ -0,0 +1,279 @@
+/**************************************************************************/
+/*!
+    @file     protcmd_draw.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <string.h>
+
+#include "bspconfig.h"
+
+#if defined(CFG_BSP_PROTOCOL) && defined(CFG_BSP_TFTLCD)
+
+#include "protcmd_draw.h"
+
+/* Fonts that can be selected with the font ID in DRAWOP_TEXT */
+static const protcmdDrawFont_t * const *_protcmdDrawFonts = NULL;
+static uint8_t _protcmdDrawFontCount = 0;
+
+/* Pixels left in the window opened by DRAWOP_WINDOW */
+static uint32_t _protcmdDrawWindowLeft = 0;
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Private Methods ------------------------------ */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Reads a little-endian U16 from the payload
+*/
+/**************************************************************************/
+static inline uint16_t protcmd_drawU16(uint8_t const *p)
+{
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+/**************************************************************************/
+/*!
+    @brief  Renders a DRAWOP_TEXT string with the selected font
+*/
+/**************************************************************************/
+static void protcmd_drawText(uint16_t x, uint16_t y, uint16_t color, uint16_t bgColor,
+                             const protcmdDrawFont_t *font, uint8_t const *chars, uint8_t len)
+{
+  char text[PROT_MAX_MSG_SIZE];
+
+  memcpy(text, chars, len);
+  text[len] = '\0';
+
+  #if CFG_BSP_TFTLCD_USEAAFONTS
+    uint16_t colorTable[16];
+    aafontsCalculateColorTable(bgColor, color, colorTable, font->fontType == AAFONTS_FONTTYPE_AA2 ? 4 : 16);
+    aafontsDrawString(x, y, colorTable, font, text);
+  #else
+    (void)bgColor;
+    fontsDrawString(x, y, color, font, text);
+  #endif
+}
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Public Methods ------------------------------- */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Sets the fonts that DRAWOP_TEXT can select by ID
+
+    @param[in]  fonts
+                Array of font pointers, indexed by font ID
+    @param[in]  count
+                Number of entries in fonts
+*/
+/**************************************************************************/
+void protcmd_drawSetFonts(const protcmdDrawFont_t * const *fonts, uint8_t count)
+{
+  _protcmdDrawFonts = fonts;
+  _protcmdDrawFontCount = fonts ? count : 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Executes a sequence of drawing opcodes (see drawops.h)
+
+    Opcodes are executed in order until the end of the payload.  The
+    response payload contains the number of opcodes executed (U8).  If
+    an opcode is unknown or truncated, or uses an unknown font ID,
+    execution stops and ERROR_PROT_INVALIDPAYLOAD is returned; the
+    opcodes before it have already been drawn.
+
+    This handler needs to be added to the application's protocol
+    command table (protocol_cmd_tbl).
+
+    @section Example
+
+    @code
+
+    #include "protocol/commands/protcmd_draw.h"
+    #include "drivers/displays/graphic/fonts/dejavusans9.h"
+    #include "drivers/displays/graphic/fonts/verdana14.h"
+
+    static const FONT_INFO * const fonts[] =
+    {
+      &dejaVuSans9ptFontInfo,      // Font ID 0
+      &verdana14ptFontInfo         // Font ID 1
+    };
+
+    protcmd_drawSetFonts(fonts, 2);
+
+    // Commands sent with the draw command ID are now executed by
+    // prot_task, for example a filled rectangle and a label:
+    //
+    // [10] [ID ID] [1F]
+    //   [02] [0A 00] [0A 00] [6E 00] [28 00] [1F 00]
+    //   [05] [0F 00] [14 00] [FF FF] [1F 00] [00] [05] 'H' 'e' 'l' 'l' 'o'
+
+    @endcode
+*/
+/**************************************************************************/
+error_t protcmd_draw(uint8_t length, uint8_t const payload[], protMsgResponse_t* mess_response)
+{
+  uint8_t const *p = payload;
+  uint8_t const *end = payload + length;
+  uint16_t pixels[(PROT_MAX_MSG_SIZE - 6) / 2];
+  uint16_t color, count, x0, y0, x1, y1;
+  uint8_t  executed = 0, len, i;
+
+  while (p < end)
+  {
+    switch (*p)
+    {
+      case DRAWOP_FILL:
+        if (end - p < DRAWOP_FILL_LEN)
+          goto invalid;
+        drawFill(protcmd_drawU16(p + 1));
+        _protcmdDrawWindowLeft = 0;
+        p += DRAWOP_FILL_LEN;
+        break;
+
+      case DRAWOP_RECT:
+      case DRAWOP_LINE:
+        if (end - p < DRAWOP_RECT_LEN)
+          goto invalid;
+        if (*p == DRAWOP_RECT)
+        {
+          drawRectangleFilled(protcmd_drawU16(p + 1), protcmd_drawU16(p + 3),
+                              protcmd_drawU16(p + 5), protcmd_drawU16(p + 7), protcmd_drawU16(p + 9));
+        }
+        else
+        {
+          drawLine(protcmd_drawU16(p + 1), protcmd_drawU16(p + 3),
+                   protcmd_drawU16(p + 5), protcmd_drawU16(p + 7), protcmd_drawU16(p + 9));
+        }
+        _protcmdDrawWindowLeft = 0;
+        p += DRAWOP_RECT_LEN;
+        break;
+
+      case DRAWOP_PIXEL:
+        if (end - p < DRAWOP_PIXEL_LEN)
+          goto invalid;
+        drawPixel(protcmd_drawU16(p + 1), protcmd_drawU16(p + 3), protcmd_drawU16(p + 5));
+        _protcmdDrawWindowLeft = 0;
+        p += DRAWOP_PIXEL_LEN;
+        break;
+
+      case DRAWOP_TEXT:
+        if (end - p < DRAWOP_TEXT_LEN(0))
+          goto invalid;
+        len = p[10];
+        if ((end - p < DRAWOP_TEXT_LEN(len)) || (p[9] >= _protcmdDrawFontCount))
+          goto invalid;
+        protcmd_drawText(protcmd_drawU16(p + 1), protcmd_drawU16(p + 3), protcmd_drawU16(p + 5),
+                         protcmd_drawU16(p + 7), _protcmdDrawFonts[p[9]], p + 11, len);
+        _protcmdDrawWindowLeft = 0;
+        p += DRAWOP_TEXT_LEN(len);
+        break;
+
+      case DRAWOP_WINDOW:
+        if (end - p < DRAWOP_WINDOW_LEN)
+          goto invalid;
+        x0 = protcmd_drawU16(p + 1);
+        y0 = protcmd_drawU16(p + 3);
+        x1 = protcmd_drawU16(p + 5);
+        y1 = protcmd_drawU16(p + 7);
+        /* The drivers don't clip the window, so it must be on-screen */
+        if ((x1 < x0) || (y1 < y0) || (x1 >= lcdGetWidth()) || (y1 >= lcdGetHeight()))
+          goto invalid;
+        lcdSetWindow(x0, y0, x1, y1);
+        _protcmdDrawWindowLeft = (uint32_t)(x1 - x0 + 1) * (y1 - y0 + 1);
+        p += DRAWOP_WINDOW_LEN;
+        break;
+
+      case DRAWOP_PIXELS:
+        if (end - p < DRAWOP_PIXELS_LEN(0))
+          goto invalid;
+        count = p[1];
+        if (end - p < DRAWOP_PIXELS_LEN(count))
+          goto invalid;
+        if (count > _protcmdDrawWindowLeft)
+          count = _protcmdDrawWindowLeft;
+        for (i = 0; i < count; i++)
+        {
+          pixels[i] = protcmd_drawU16(p + 2 + i * 2);
+        }
+        lcdWritePixels(pixels, count);
+        _protcmdDrawWindowLeft -= count;
+        p += DRAWOP_PIXELS_LEN(p[1]);
+        break;
+
+      case DRAWOP_RUN:
+        if (end - p < DRAWOP_RUN_LEN)
+          goto invalid;
+        count = protcmd_drawU16(p + 1);
+        color = protcmd_drawU16(p + 3);
+        if (count > _protcmdDrawWindowLeft)
+          count = _protcmdDrawWindowLeft;
+        _protcmdDrawWindowLeft -= count;
+        for (i = 0; i < sizeof(pixels) / sizeof(pixels[0]); i++)
+        {
+          pixels[i] = color;
+        }
+        while (count)
+        {
+          len = count > sizeof(pixels) / sizeof(pixels[0]) ? sizeof(pixels) / sizeof(pixels[0]) : count;
+          lcdWritePixels(pixels, len);
+          count -= len;
+        }
+        p += DRAWOP_RUN_LEN;
+        break;
+
+      default:
+        goto invalid;
+    }
+
+    executed++;
+  }
+
+  mess_response->length = 1;
+  mess_response->payload[0] = executed;
+
+  return ERROR_NONE;
+
+invalid:
+  _protcmdDrawWindowLeft = 0;
+  return ERROR_PROT_INVALIDPAYLOAD;
+}
+
+#endif
@@ -0,0 +1,61 @@
+/**************************************************************************/
+/*!
+    @file     protcmd_draw.h
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#ifndef _PROTCMD_DRAW_H_
+#define _PROTCMD_DRAW_H_
+
+#include "bspconfig.h"
+#include "protocol/protocol.h"
+#include "protocol/drawops.h"
+#include "drivers/displays/graphic/drawing.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if CFG_BSP_TFTLCD_USEAAFONTS
+  typedef aafontsFont_t protcmdDrawFont_t;
+#else
+  typedef FONT_INFO protcmdDrawFont_t;
+#endif
+
+void    protcmd_drawSetFonts ( const protcmdDrawFont_t * const *fonts, uint8_t count );
+error_t protcmd_draw         ( uint8_t length, uint8_t const payload[], protMsgResponse_t* mess_response );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
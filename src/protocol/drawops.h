@@ -0,0 +1,104 @@
+/**************************************************************************/
+/*!
+    @file     drawops.h
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+/*  REMOTE DRAWING OPCODES
+    ======================
+
+    The payload of a draw command (see protcmd_draw) is a sequence of
+    drawing opcodes, packed back to back, so that several drawing
+    operations fit in one 64 byte message instead of pushing raw pixels.
+    Each opcode is a one byte identifier followed by its parameters.  All
+    values are little endian, and all colors are RGB565.
+
+    |--------+---------+--------------------------------------+------------|
+    | Opcode | ID (U8) | Parameters                           | Size       |
+    |--------+---------+--------------------------------------+------------|
+    | FILL   | 0x01    | color U16                            | 3          |
+    | RECT   | 0x02    | x0, y0, x1, y1 U16, color U16        | 11         |
+    | LINE   | 0x03    | x0, y0, x1, y1 U16, color U16        | 11         |
+    | PIXEL  | 0x04    | x, y U16, color U16                  | 7          |
+    | TEXT   | 0x05    | x, y U16, color, bgColor U16,        | 11 + len   |
+    |        |         | font ID U8, len U8, chars U8[len]    |            |
+    | WINDOW | 0x06    | x0, y0, x1, y1 U16                   | 9          |
+    | PIXELS | 0x07    | count U8, pixels U16[count]          | 2 + 2*cnt  |
+    | RUN    | 0x08    | count U16, color U16                 | 5          |
+    |--------+---------+--------------------------------------+------------|
+
+    - TEXT looks the font ID up in the table registered on the device
+      with protcmd_drawSetFonts.  bgColor is only used by anti-aliased
+      fonts, to calculate the color table.
+    - WINDOW starts a bitmap.  The window must be on-screen with
+      x0 <= x1 and y0 <= y1, or the payload is rejected.  PIXELS and RUN
+      (run-length encoded pixels) then fill the window left to right,
+      top to bottom, and can span several messages.  Any other opcode ends the bitmap, and
+      pixels beyond the end of the window are ignored.
+
+    This header has no dependencies so that host tools can share it.
+*/
+
+#ifndef _DRAWOPS_H_
+#define _DRAWOPS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum
+{
+  DRAWOP_FILL                   = 0x01,
+  DRAWOP_RECT                   = 0x02,
+  DRAWOP_LINE                   = 0x03,
+  DRAWOP_PIXEL                  = 0x04,
+  DRAWOP_TEXT                   = 0x05,
+  DRAWOP_WINDOW                 = 0x06,
+  DRAWOP_PIXELS                 = 0x07,
+  DRAWOP_RUN                    = 0x08
+} drawOpcode_t;
+
+/* Encoded size of each opcode, including the opcode byte */
+#define DRAWOP_FILL_LEN               (3)
+#define DRAWOP_RECT_LEN               (11)
+#define DRAWOP_LINE_LEN               (11)
+#define DRAWOP_PIXEL_LEN              (7)
+#define DRAWOP_TEXT_LEN(len)          (11 + (len))
+#define DRAWOP_WINDOW_LEN             (9)
+#define DRAWOP_PIXELS_LEN(count)      (2 + 2 * (count))
+#define DRAWOP_RUN_LEN                (5)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
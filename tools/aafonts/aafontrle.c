@@ -0,0 +1,461 @@
+/**************************************************************************/
+/*!
+    @file     aafontrle.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+
+/*  AA FONT COMPRESSOR
+    ==================
+
+    Converts an anti-aliased font source file, as found under
+    src/drivers/displays/graphic/aafonts, into the same font with run-
+    length encoded glyphs (AAFONTS_ENCODING_RLE).  The font keeps its
+    name, so the output is a drop-in replacement for the original .c
+    file and the font's header doesn't change.
+
+        aafontrle [-q] input.c [output.c]
+
+    The output goes to stdout if no output file is given.  A summary of
+    the glyph data size before and after is written to stderr (unless
+    -q is used), and every glyph is decoded again and compared with the
+    original before anything is written.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "aafonts_rle.h"
+
+#define AAFONTRLE_MAXGLYPHS           (1024)
+#define AAFONTRLE_MAXNAME             (96)
+
+typedef struct
+{
+  char     name[AAFONTRLE_MAXNAME];
+  char     comment[AAFONTRLE_MAXNAME];  // "code 0021, EXCLAMATION MARK"
+  uint8_t  *data;
+  uint32_t size;
+  uint8_t  width;
+  uint8_t  bytesPerRow;
+  uint8_t  rows;                        // Rows stored in data
+  uint8_t  *rle;
+  uint32_t rleSize;
+} aafontrleGlyph_t;
+
+static aafontrleGlyph_t glyphs[AAFONTRLE_MAXGLYPHS];
+static int              glyphCount;
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Private Methods ------------------------------ */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Reads a whole file into a NULL terminated buffer
+*/
+/**************************************************************************/
+static char *aafontrleLoad(const char *fileName)
+{
+  FILE *f = fopen(fileName, "rb");
+  char *buffer;
+  long len;
+
+  if (f == NULL)
+  {
+    perror(fileName);
+    return NULL;
+  }
+  fseek(f, 0, SEEK_END);
+  len = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  buffer = malloc(len + 1);
+  if (fread(buffer, 1, len, f) != (size_t)len)
+  {
+    perror(fileName);
+    fclose(f);
+    free(buffer);
+    return NULL;
+  }
+  buffer[len] = '\0';
+  fclose(f);
+
+  return buffer;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Copies the C identifier at p into name and returns the
+            position after it
+*/
+/**************************************************************************/
+static const char *aafontrleIdent(const char *p, char *name)
+{
+  int n = 0;
+
+  while (isspace((unsigned char)*p))
+    p++;
+  while ((isalnum((unsigned char)*p) || (*p == '_')) && (n < AAFONTRLE_MAXNAME - 1))
+    name[n++] = *p++;
+  name[n] = '\0';
+
+  return p;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the glyph with the specified array name
+*/
+/**************************************************************************/
+static aafontrleGlyph_t *aafontrleFind(const char *name)
+{
+  int i;
+
+  for (i = 0; i < glyphCount; i++)
+  {
+    if (!strcmp(glyphs[i].name, name))
+      return &glyphs[i];
+  }
+
+  return NULL;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Parses every 'const uint8_t NAME[n] = { ... };' glyph array
+*/
+/**************************************************************************/
+static int aafontrleParseGlyphs(const char *src)
+{
+  const char *p = src, *end, *c;
+  aafontrleGlyph_t *g;
+  unsigned long value;
+  char *next;
+  int n;
+
+  while ((p = strstr(p, "const uint8_t ")) != NULL)
+  {
+    if (glyphCount == AAFONTRLE_MAXGLYPHS)
+    {
+      fprintf(stderr, "More than %d glyphs\n", AAFONTRLE_MAXGLYPHS);
+      return -1;
+    }
+    g = &glyphs[glyphCount++];
+    p = aafontrleIdent(p + 14, g->name);
+    p = strchr(p, '{');
+    end = p ? strchr(p, '}') : NULL;
+    if (end == NULL)
+    {
+      fprintf(stderr, "Unterminated array %s\n", g->name);
+      return -1;
+    }
+
+    /* Keep the 'code 0021, EXCLAMATION MARK' comment */
+    g->comment[0] = '\0';
+    c = strstr(p, "/*");
+    if ((c != NULL) && (c < end))
+    {
+      for (c += 2; *c == ' '; c++);
+      for (n = 0; (c[n] != '\0') && (c[n] != '\n') && strncmp(&c[n], " */", 3) && (n < AAFONTRLE_MAXNAME - 1); n++)
+        g->comment[n] = c[n];
+      g->comment[n] = '\0';
+      p = strstr(c, "*/") + 2;
+    }
+    else
+    {
+      p++;
+    }
+
+    g->data = malloc(end - p);
+    g->size = 0;
+    while (p < end)
+    {
+      value = strtoul(p, &next, 0);
+      if (next == p)
+      {
+        p++;
+        continue;
+      }
+      g->data[g->size++] = (uint8_t)value;
+      p = next;
+    }
+    p = end;
+  }
+
+  return 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Parses the '{ width, bytesPerRow, yOffset, height, NAME }'
+            charTable entries (or '{ width, bytesPerRow, NAME }' in older
+            fonts, where every glyph is fontHeight rows)
+*/
+/**************************************************************************/
+static int aafontrleParseCharTable(const char *src, unsigned fontHeight)
+{
+  const char *p = strstr(src, "aafontsCharInfo_t ");
+  const char *end;
+  char name[AAFONTRLE_MAXNAME];
+  aafontrleGlyph_t *g;
+  unsigned width, bytesPerRow, yOffset, rows;
+  int n;
+
+  if ((p == NULL) || ((p = strchr(p, '{')) == NULL) || ((end = strstr(p, "};")) == NULL))
+  {
+    fprintf(stderr, "No charTable found\n");
+    return -1;
+  }
+
+  for (p++; (p = strchr(p, '{')) != NULL && (p < end); p++)
+  {
+    if (sscanf(p, "{ %u , %u , %u , %u , %n", &width, &bytesPerRow, &yOffset, &rows, &n) != 4)
+    {
+      rows = fontHeight;
+      if (sscanf(p, "{ %u , %u , %n", &width, &bytesPerRow, &n) != 2)
+      {
+        fprintf(stderr, "Bad charTable entry\n");
+        return -1;
+      }
+    }
+    /* Blank glyphs have no rows and no data */
+    aafontrleIdent(p + n, name);
+    if (!strcmp(name, "NULL"))
+      continue;
+    g = aafontrleFind(name);
+    if (g == NULL)
+    {
+      fprintf(stderr, "charTable refers to unknown glyph %s\n", name);
+      return -1;
+    }
+    g->width = width;
+    g->bytesPerRow = bytesPerRow;
+    g->rows = rows;
+  }
+
+  return 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Writes count bytes as a C initializer, 12 per line
+*/
+/**************************************************************************/
+static void aafontrleWriteBytes(FILE *out, const uint8_t *data, uint32_t count)
+{
+  uint32_t i;
+
+  for (i = 0; i < count; i++)
+  {
+    fprintf(out, "%s0x%02X%s", i % 12 ? " " : "  ", data[i], i + 1 < count ? "," : "");
+    if ((i % 12 == 11) || (i + 1 == count))
+      fprintf(out, "\n");
+  }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Public Methods ------------------------------- */
+/*                                                                        */
+/**************************************************************************/
+
+int main(int argc, char *argv[])
+{
+  const char *inName = NULL, *outName = NULL;
+  const char *p, *fontStart, *fontEnd, *last, *eol, *table;
+  char fontName[AAFONTRLE_MAXNAME];
+  uint32_t rawSize = 0, rleSize = 0, pixels;
+  unsigned height = 0;
+  uint8_t *unpacked, *check;
+  uint8_t bits;
+  bool quiet = false;
+  int i, fields, column;
+  uint32_t x, y;
+  FILE *out = stdout;
+  char *src;
+
+  for (i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "-q"))
+      quiet = true;
+    else if ((argv[i][0] != '-') && (inName == NULL))
+      inName = argv[i];
+    else if ((argv[i][0] != '-') && (outName == NULL))
+      outName = argv[i];
+    else
+      break;
+  }
+  if ((i < argc) || (inName == NULL))
+  {
+    fprintf(stderr, "Usage: %s [-q] input.c [output.c]\n", argv[0]);
+    return 1;
+  }
+
+  if ((src = aafontrleLoad(inName)) == NULL)
+    return 1;
+
+  /* The font definition: 'aafontsFont_t NAME = { type, height, ... };' */
+  fontStart = strstr(src, "aafontsFont_t ");
+  while ((fontStart != NULL) && (fontStart > src) && (fontStart[-1] != '\n'))
+    fontStart = strstr(fontStart + 1, "aafontsFont_t ");
+  if ((fontStart == NULL) || ((p = strchr(fontStart, '{')) == NULL) || ((fontEnd = strstr(p, "};")) == NULL))
+  {
+    fprintf(stderr, "%s: no aafontsFont_t definition found\n", inName);
+    return 1;
+  }
+  aafontrleIdent(fontStart + 14, fontName);
+  if (strstr(p, "AAFONTS_ENCODING_") && (strstr(p, "AAFONTS_ENCODING_") < fontEnd))
+  {
+    fprintf(stderr, "%s: font already has an encoding\n", inName);
+    return 1;
+  }
+  bits = (strstr(p, "AAFONTS_FONTTYPE_AA4") && (strstr(p, "AAFONTS_FONTTYPE_AA4") < fontEnd)) ? 4 : 2;
+
+  /* Count the fields and find the height (second field), skipping comments */
+  fields = 1;
+  last = p;
+  for (p++; p < fontEnd; p++)
+  {
+    if ((p[0] == '/') && (p[1] == '*'))
+    {
+      p = strstr(p, "*/") + 1;
+      continue;
+    }
+    if (*p == ',')
+    {
+      fields++;
+    }
+    else if (!isspace((unsigned char)*p) && (fields == 2) && (height == 0))
+    {
+      height = strtoul(p, NULL, 0);
+    }
+    if (!isspace((unsigned char)*p))
+      last = p;
+  }
+  if (((fields != 9) && (fields != 11)) || (height == 0))
+  {
+    fprintf(stderr, "%s: unexpected aafontsFont_t layout\n", inName);
+    return 1;
+  }
+
+  if (aafontrleParseGlyphs(src) || aafontrleParseCharTable(src, height))
+    return 1;
+
+  /* Compress every glyph, and check it against the original */
+  for (i = 0; i < glyphCount; i++)
+  {
+    aafontrleGlyph_t *g = &glyphs[i];
+
+    pixels = g->width * g->rows;
+    if ((g->bytesPerRow * g->rows != g->size) || (g->width * bits > g->bytesPerRow * 8))
+    {
+      fprintf(stderr, "%s: %s is %u bytes, expected %u rows of %u bytes\n", inName, g->name, g->size, g->rows, g->bytesPerRow);
+      return 1;
+    }
+
+    unpacked = malloc(pixels + 1);
+    check = malloc(pixels + 1);
+    for (y = 0; y < g->rows; y++)
+    {
+      for (x = 0; x < g->width; x++)
+      {
+        unpacked[y * g->width + x] = (g->data[y * g->bytesPerRow + x * bits / 8] >> (8 - bits - (x * bits) % 8)) & ((1 << bits) - 1);
+      }
+    }
+    g->rle = malloc(AAFONTS_RLE_MAXSIZE(pixels, bits));
+    g->rleSize = aafontsRleEncode(unpacked, pixels, bits, g->rle);
+    if ((aafontsRleDecode(g->rle, g->rleSize, bits, check, pixels) != g->rleSize) || memcmp(unpacked, check, pixels))
+    {
+      fprintf(stderr, "%s: %s doesn't decode to the original glyph\n", inName, g->name);
+      return 1;
+    }
+    rawSize += g->size;
+    rleSize += g->rleSize;
+    free(unpacked);
+    free(check);
+  }
+
+  if (outName && ((out = fopen(outName, "w")) == NULL))
+  {
+    perror(outName);
+    return 1;
+  }
+
+  /* Everything up to the first glyph (license header and includes) */
+  p = strstr(src, "const uint8_t ");
+  fwrite(src, 1, p - src, out);
+
+  /* The glyphs */
+  for (i = 0; i < glyphCount; i++)
+  {
+    fprintf(out, "const uint8_t %s[%3u] = { /* %s (RLE) */\n", glyphs[i].name, glyphs[i].rleSize, glyphs[i].comment);
+    aafontrleWriteBytes(out, glyphs[i].rle, glyphs[i].rleSize);
+    fprintf(out, "};\n\n");
+  }
+
+  /* The charTable and font definition, with the encoding appended and
+     the comments lined up with the existing ones */
+  table = strstr(src, "const aafontsCharInfo_t ");
+  if (table == NULL)
+    table = strstr(src, "aafontsCharInfo_t ");
+  eol = strchr(last, '\n');
+  for (p = last; (p > src) && (p[-1] != '\n'); p--);
+  for (p--; (p > src) && (p[-1] != '\n'); p--);
+  column = strstr(p, "/*") && (strstr(p, "/*") < last) ? (int)(strstr(p, "/*") - p) : 40;
+  fwrite(table, 1, last + 1 - table, out);
+  fputc(',', out);
+  fwrite(last + 1, 1, eol - last - 1, out);
+  if (fields == 9)
+  {
+    fprintf(out, "\n%-*s/* Character ranges (dense table) */", column, "  NULL,");
+    fprintf(out, "\n%-*s/* Number of character ranges */", column, "  0,");
+  }
+  fprintf(out, "\n%-*s/* Glyph data encoding */", column, "  AAFONTS_ENCODING_RLE");
+  fputs(eol, out);
+
+  if (outName)
+    fclose(out);
+
+  if (!quiet)
+  {
+    fprintf(stderr, "%-40s %5d glyphs %7u -> %7u bytes, %6u saved (%.1f%%)\n",
+            fontName, glyphCount, rawSize, rleSize, rawSize - rleSize,
+            rawSize ? 100.0 * (rawSize - rleSize) / rawSize : 0.0);
+  }
+
+  return 0;
+}
@@ -0,0 +1,200 @@
+/**************************************************************************/
+/*!
+    @file     aafonts_rle.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+
+/*  Run-length encoding for anti-aliased glyphs, matching the decoder in
+    aafontsGlyphReaderNext (src/drivers/displays/graphic/aafonts.c):
+
+    0nnnnnnn    n + 1 background (0) pixels
+    10nnnnnn    n + 1 solid foreground (3 or 15) pixels
+    11nnnnnn    n + 1 literal pixels, packed MSB first at 2 or 4 bits
+                per pixel in the following bytes, padded to a whole byte
+
+    The pixel stream covers the rows stored for the glyph (charInfo
+    height) in row order, with runs continuing from one row to the next.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "aafonts_rle.h"
+
+#define AAFONTS_RLE_MAXBACKGROUND     (128)
+#define AAFONTS_RLE_MAXRUN            (64)
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Public Methods ------------------------------- */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Encodes count pixel values (0 .. 2^bits - 1) and returns the
+            size of the encoded data
+
+    The token sequence is chosen by dynamic programming over the pixel
+    stream, so the output is the smallest possible in this format.  out
+    must hold at least AAFONTS_RLE_MAXSIZE(count, bits) bytes.
+*/
+/**************************************************************************/
+uint32_t aafontsRleEncode(const uint8_t *pixels, uint32_t count, uint8_t bits, uint8_t *out)
+{
+  uint32_t *cost = malloc((count + 1) * sizeof(uint32_t));
+  uint8_t  *token = malloc(count + 1);
+  uint8_t  solid = (1 << bits) - 1;
+  uint32_t i, len, c, size = 0;
+  uint8_t  shift;
+
+  /* cost[i] is the smallest encoding of pixels i .. count - 1, and
+     token[i] the first token of it */
+  cost[count] = 0;
+  for (i = count; i-- > 0; )
+  {
+    cost[i] = UINT32_MAX;
+    for (len = 1; (len <= AAFONTS_RLE_MAXRUN) && (i + len <= count); len++)
+    {
+      c = 1 + (len * bits + 7) / 8 + cost[i + len];
+      if (c < cost[i])
+      {
+        cost[i] = c;
+        token[i] = 0xC0 | (len - 1);
+      }
+    }
+    for (len = 1; (len <= AAFONTS_RLE_MAXBACKGROUND) && (i + len <= count) && (pixels[i + len - 1] == 0); len++)
+    {
+      if (1 + cost[i + len] <= cost[i])
+      {
+        cost[i] = 1 + cost[i + len];
+        token[i] = len - 1;
+      }
+    }
+    for (len = 1; (len <= AAFONTS_RLE_MAXRUN) && (i + len <= count) && (pixels[i + len - 1] == solid); len++)
+    {
+      if (1 + cost[i + len] <= cost[i])
+      {
+        cost[i] = 1 + cost[i + len];
+        token[i] = 0x80 | (len - 1);
+      }
+    }
+  }
+
+  /* Emit the chosen tokens */
+  for (i = 0; i < count; i += len)
+  {
+    out[size++] = token[i];
+    if (!(token[i] & 0x80))
+    {
+      len = token[i] + 1;
+    }
+    else
+    {
+      len = (token[i] & 0x3F) + 1;
+      if (token[i] & 0x40)
+      {
+        out[size] = 0;
+        for (c = 0, shift = 8; c < len; c++)
+        {
+          shift -= bits;
+          out[size] |= pixels[i + c] << shift;
+          if ((shift == 0) && (c + 1 < len))
+          {
+            out[++size] = 0;
+            shift = 8;
+          }
+        }
+        size++;
+      }
+    }
+  }
+
+  free(cost);
+  free(token);
+
+  return size;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Decodes RLE glyph data back into count pixel values
+
+    @return The number of bytes of data used, or 0 if the data is
+            truncated or describes more than count pixels
+*/
+/**************************************************************************/
+uint32_t aafontsRleDecode(const uint8_t *data, uint32_t size, uint8_t bits, uint8_t *pixels, uint32_t count)
+{
+  uint32_t pos = 0, i = 0, len, c;
+  uint8_t  token, shift;
+
+  while (i < count)
+  {
+    if (pos >= size)
+      return 0;
+    token = data[pos++];
+    len = token & 0x80 ? (token & 0x3F) + 1 : token + 1;
+    if (i + len > count)
+      return 0;
+
+    if (!(token & 0x80))
+    {
+      memset(&pixels[i], 0, len);
+    }
+    else if (!(token & 0x40))
+    {
+      memset(&pixels[i], (1 << bits) - 1, len);
+    }
+    else
+    {
+      if (pos + (len * bits + 7) / 8 > size)
+        return 0;
+      for (c = 0, shift = 8; c < len; c++)
+      {
+        shift -= bits;
+        pixels[i + c] = (data[pos] >> shift) & ((1 << bits) - 1);
+        if (shift == 0)
+        {
+          pos++;
+          shift = 8;
+        }
+      }
+      if (shift != 8)
+        pos++;
+    }
+    i += len;
+  }
+
+  return pos;
+}
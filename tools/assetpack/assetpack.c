@@ -0,0 +1,598 @@
+/**************************************************************************/
+/*!
+    @file     assetpack.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+
+/*  ASSET PACKER
+    ============
+
+    Bundles fonts, images and other data into one asset pack (see
+    src/drivers/displays/assets.h), which the firmware can use from
+    flash or stream from the SD card.
+
+        assetpack [-a align] [-c] [-o name] id:NAME:type:file ...
+
+    -a  Alignment of each asset in the pack, a multiple of 4 (default 4).
+        -a 512 starts every asset on its own SD card sector, so the
+        first block read for it is never shared with another asset.
+    -c  Also write the pack as a C array (name.c), to be built into
+        the firmware and opened with assetsOpen
+    -o  Base name of the output files, defaults to "assets"
+
+    Each asset gets the numeric ID 'id' and a define ASSET_NAME in the
+    generated name.h.  IDs must be unique, and can be kept stable from
+    one version of a pack to the next so that firmware and packs can be
+    updated separately.  Types are:
+
+      raw     The file as is, read with assetsRead
+      image   Binary PPM (P6), converted to RGB565 for assetsDrawImage
+      jpeg    Baseline JPEG, for assetsDrawJpeg
+      font    AA font written by fontc -b, for assetsOpenFont
+
+    The pack goes to name.pak.  A summary of the assets goes to stderr,
+    including the largest glyph of each font, which is the glyph buffer
+    needed to draw it from a streamed pack.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define ASSETPACK_MAXASSETS           (1024)
+#define ASSETPACK_MAXNAME             (64)
+
+/* These match assets.h */
+#define ASSETPACK_MAGIC               (0x4B504141)
+#define ASSETPACK_VERSION             (1)
+#define ASSETPACK_HEADERSIZE          (16)
+#define ASSETPACK_ENTRYSIZE           (16)
+#define ASSETPACK_FONTHEADERSIZE      (20)
+#define ASSETPACK_FONTGLYPHSIZE       (12)
+
+typedef enum
+{
+  ASSETPACK_TYPE_RAW = 0,
+  ASSETPACK_TYPE_IMAGE = 1,
+  ASSETPACK_TYPE_JPEG = 2,
+  ASSETPACK_TYPE_FONT = 3
+} assetpackType_t;
+
+static const char *assetpackTypeNames[] = { "raw", "image", "jpeg", "font" };
+
+typedef struct
+{
+  unsigned        id;
+  char            name[ASSETPACK_MAXNAME];
+  assetpackType_t type;
+  const char      *path;
+  uint8_t         *data;
+  uint32_t        size;
+  uint16_t        width;
+  uint16_t        height;
+  uint32_t        offset;
+  uint32_t        maxGlyph;             // Largest glyph (fonts)
+} assetpackAsset_t;
+
+static assetpackAsset_t assetpackAssets[ASSETPACK_MAXASSETS];
+static int              assetpackCount = 0;
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Private Methods ------------------------------ */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Reads a little endian value
+*/
+/**************************************************************************/
+static uint32_t assetpackGet(const uint8_t *p, int bytes)
+{
+  uint32_t value = 0;
+
+  while (bytes--)
+    value = (value << 8) | p[bytes];
+
+  return value;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Writes a little endian value
+*/
+/**************************************************************************/
+static void assetpackPut(FILE *out, uint32_t value, int bytes)
+{
+  while (bytes--)
+  {
+    fputc(value & 0xFF, out);
+    value >>= 8;
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Reads a whole file into memory
+*/
+/**************************************************************************/
+static uint8_t *assetpackLoad(const char *path, uint32_t *size)
+{
+  uint8_t *data;
+  long len;
+  FILE *in;
+
+  if ((in = fopen(path, "rb")) == NULL)
+  {
+    perror(path);
+    return NULL;
+  }
+  fseek(in, 0, SEEK_END);
+  len = ftell(in);
+  fseek(in, 0, SEEK_SET);
+  data = malloc(len + 1);
+  if ((len < 0) || (fread(data, 1, len, in) != (size_t)len))
+  {
+    fprintf(stderr, "%s: read error\n", path);
+    fclose(in);
+    free(data);
+    return NULL;
+  }
+  fclose(in);
+  *size = len;
+
+  return data;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Reads the next number from a PPM header, skipping comments
+*/
+/**************************************************************************/
+static long assetpackPpmNumber(const uint8_t *data, uint32_t size, uint32_t *pos)
+{
+  long value = -1;
+
+  while (*pos < size)
+  {
+    if (data[*pos] == '#')
+    {
+      while ((*pos < size) && (data[*pos] != '\n'))
+        (*pos)++;
+    }
+    else if ((data[*pos] >= '0') && (data[*pos] <= '9'))
+    {
+      value = 0;
+      while ((*pos < size) && (data[*pos] >= '0') && (data[*pos] <= '9') && (value < 65536))
+        value = value * 10 + data[(*pos)++] - '0';
+      return value;
+    }
+    else
+      (*pos)++;
+  }
+
+  return value;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Converts a binary PPM image to RGB565 pixels
+*/
+/**************************************************************************/
+static int assetpackConvertImage(assetpackAsset_t *asset)
+{
+  uint32_t pos = 2, i, pixels;
+  long width, height, maxval;
+  uint8_t *rgb565, *p;
+  uint16_t color;
+
+  if ((asset->size < 2) || memcmp(asset->data, "P6", 2))
+  {
+    fprintf(stderr, "%s: not a binary PPM (P6) image\n", asset->path);
+    return -1;
+  }
+  width = assetpackPpmNumber(asset->data, asset->size, &pos);
+  height = assetpackPpmNumber(asset->data, asset->size, &pos);
+  maxval = assetpackPpmNumber(asset->data, asset->size, &pos);
+  pos++;
+  if ((width <= 0) || (width > 0xFFFF) || (height <= 0) || (height > 0xFFFF) || (maxval != 255) ||
+      (asset->size < pos + (uint32_t)(width * height * 3)))
+  {
+    fprintf(stderr, "%s: unsupported or truncated PPM image (8-bit channels only)\n", asset->path);
+    return -1;
+  }
+
+  pixels = width * height;
+  rgb565 = malloc(pixels * 2);
+  for (i = 0, p = &asset->data[pos]; i < pixels; i++, p += 3)
+  {
+    color = ((p[0] & 0xF8) << 8) | ((p[1] & 0xFC) << 3) | (p[2] >> 3);
+    rgb565[i * 2] = color & 0xFF;
+    rgb565[i * 2 + 1] = color >> 8;
+  }
+
+  free(asset->data);
+  asset->data = rgb565;
+  asset->size = pixels * 2;
+  asset->width = width;
+  asset->height = height;
+
+  return 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Checks a JPEG file and reads its size from the frame header
+*/
+/**************************************************************************/
+static int assetpackCheckJpeg(assetpackAsset_t *asset)
+{
+  const uint8_t *d = asset->data;
+  uint32_t pos = 2;
+
+  if ((asset->size < 4) || (d[0] != 0xFF) || (d[1] != 0xD8))
+  {
+    fprintf(stderr, "%s: not a JPEG file\n", asset->path);
+    return -1;
+  }
+
+  /* Walk the marker segments up to the first SOFn */
+  while (pos + 4 <= asset->size)
+  {
+    if (d[pos] != 0xFF)
+      break;
+    if ((d[pos + 1] >= 0xC0) && (d[pos + 1] <= 0xCF) &&
+        (d[pos + 1] != 0xC4) && (d[pos + 1] != 0xC8) && (d[pos + 1] != 0xCC))
+    {
+      if (pos + 9 > asset->size)
+        break;
+      if (d[pos + 1] > 0xC1)
+        fprintf(stderr, "%s: warning, not a baseline JPEG, assetsDrawJpeg won't decode it\n", asset->path);
+      asset->height = (d[pos + 5] << 8) | d[pos + 6];
+      asset->width = (d[pos + 7] << 8) | d[pos + 8];
+      return 0;
+    }
+    pos += 2 + ((d[pos + 2] << 8) | d[pos + 3]);
+  }
+
+  fprintf(stderr, "%s: no frame header found\n", asset->path);
+  return -1;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Checks a font written by fontc -b and finds its largest glyph
+*/
+/**************************************************************************/
+static int assetpackCheckFont(assetpackAsset_t *asset)
+{
+  const uint8_t *d = asset->data;
+  uint32_t glyphs, count, offset, length, i;
+
+  if (asset->size < ASSETPACK_FONTHEADERSIZE)
+    goto invalid;
+
+  count = assetpackGet(&d[18], 2);
+  glyphs = ASSETPACK_FONTHEADERSIZE + ((assetpackGet(&d[16], 2) * 6 + 3) & ~3);
+  if (((d[0] != 2) && (d[0] != 4)) || (d[1] > 1) || (count == 0) ||
+      (asset->size < glyphs + count * ASSETPACK_FONTGLYPHSIZE))
+    goto invalid;
+
+  for (i = 0; i < count; i++)
+  {
+    offset = assetpackGet(&d[glyphs + i * ASSETPACK_FONTGLYPHSIZE + 4], 4);
+    length = assetpackGet(&d[glyphs + i * ASSETPACK_FONTGLYPHSIZE + 8], 4);
+    if (offset && ((offset > asset->size) || (length > asset->size - offset)))
+      goto invalid;
+    if (length > asset->maxGlyph)
+      asset->maxGlyph = length;
+  }
+  asset->height = assetpackGet(&d[2], 2);
+
+  return 0;
+
+invalid:
+  fprintf(stderr, "%s: not a font written by fontc -b\n", asset->path);
+  return -1;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Sorts assets by ID, for the binary search in assetsFind
+*/
+/**************************************************************************/
+static int assetpackCompare(const void *a, const void *b)
+{
+  return (int)((const assetpackAsset_t *)a)->id - (int)((const assetpackAsset_t *)b)->id;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Writes the pack itself
+*/
+/**************************************************************************/
+static uint32_t assetpackWritePack(FILE *out, uint32_t align)
+{
+  assetpackAsset_t *asset;
+  uint32_t offset, size;
+  int i;
+
+  /* Lay out the data after the index */
+  offset = ASSETPACK_HEADERSIZE + assetpackCount * ASSETPACK_ENTRYSIZE;
+  for (i = 0; i < assetpackCount; i++)
+  {
+    asset = &assetpackAssets[i];
+    offset = (offset + align - 1) / align * align;
+    asset->offset = offset;
+    offset += asset->size;
+  }
+  size = (offset + 3) & ~3;
+
+  assetpackPut(out, ASSETPACK_MAGIC, 4);
+  assetpackPut(out, ASSETPACK_VERSION, 2);
+  assetpackPut(out, assetpackCount, 2);
+  assetpackPut(out, size, 4);
+  assetpackPut(out, 0, 4);
+  for (i = 0; i < assetpackCount; i++)
+  {
+    asset = &assetpackAssets[i];
+    assetpackPut(out, asset->id, 2);
+    assetpackPut(out, asset->type, 1);
+    assetpackPut(out, 0, 1);
+    assetpackPut(out, asset->width, 2);
+    assetpackPut(out, asset->height, 2);
+    assetpackPut(out, asset->offset, 4);
+    assetpackPut(out, asset->size, 4);
+  }
+  for (i = 0; i < assetpackCount; i++)
+  {
+    asset = &assetpackAssets[i];
+    while ((uint32_t)ftell(out) < asset->offset)
+      fputc(0, out);
+    fwrite(asset->data, 1, asset->size, out);
+  }
+  while ((uint32_t)ftell(out) < size)
+    fputc(0, out);
+
+  return size;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Writes the pack as a C array
+*/
+/**************************************************************************/
+static int assetpackWriteSource(const char *baseName)
+{
+  char fileName[ASSETPACK_MAXNAME + 8];
+  FILE *in, *out;
+  uint32_t i = 0;
+  int c;
+
+  sprintf(fileName, "%s.pak", baseName);
+  if ((in = fopen(fileName, "rb")) == NULL)
+  {
+    perror(fileName);
+    return -1;
+  }
+  sprintf(fileName, "%s.c", baseName);
+  if ((out = fopen(fileName, "w")) == NULL)
+  {
+    perror(fileName);
+    fclose(in);
+    return -1;
+  }
+
+  fprintf(out, "/* Generated by tools/assetpack, do not edit */\n");
+  fprintf(out, "#include \"%s.h\"\n\n", baseName);
+  fprintf(out, "const uint8_t %s_pack[] __attribute__ ((aligned (4))) =\n{\n", baseName);
+  while ((c = fgetc(in)) != EOF)
+  {
+    fprintf(out, "%s0x%02X,", i % 12 ? " " : "  ", c);
+    if (i++ % 12 == 11)
+      fprintf(out, "\n");
+  }
+  fprintf(out, "%s};\n", i % 12 ? "\n" : "");
+
+  fclose(in);
+  fclose(out);
+
+  return 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Writes the header with the asset IDs
+*/
+/**************************************************************************/
+static int assetpackWriteHeader(const char *baseName, bool source)
+{
+  char fileName[ASSETPACK_MAXNAME + 8];
+  char guard[ASSETPACK_MAXNAME + 8];
+  char value[16];
+  FILE *out;
+  int i;
+
+  for (i = 0; baseName[i] && (i < ASSETPACK_MAXNAME); i++)
+    guard[i] = (baseName[i] >= 'a') && (baseName[i] <= 'z') ? baseName[i] - 'a' + 'A' : baseName[i];
+  guard[i] = '\0';
+
+  sprintf(fileName, "%s.h", baseName);
+  if ((out = fopen(fileName, "w")) == NULL)
+  {
+    perror(fileName);
+    return -1;
+  }
+
+  fprintf(out, "/* Generated by tools/assetpack, do not edit */\n");
+  fprintf(out, "#ifndef __%s_H__\n#define __%s_H__\n\n", guard, guard);
+  fprintf(out, "#ifdef __cplusplus\nextern \"C\" {\n#endif\n\n");
+  fprintf(out, "#include \"bspconfig.h\"\n\n");
+  for (i = 0; i < assetpackCount; i++)
+  {
+    sprintf(value, "(%u)", assetpackAssets[i].id);
+    fprintf(out, "#define ASSET_%-24s %-8s /* %s */\n", assetpackAssets[i].name, value,
+            assetpackTypeNames[assetpackAssets[i].type]);
+  }
+  if (source)
+    fprintf(out, "\nextern const uint8_t %s_pack[];\n", baseName);
+  fprintf(out, "\n#ifdef __cplusplus\n}\n#endif\n\n#endif\n");
+  fclose(out);
+
+  return 0;
+}
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Public Methods ------------------------------- */
+/*                                                                        */
+/**************************************************************************/
+
+int main(int argc, char *argv[])
+{
+  const char *baseName = "assets";
+  char fileName[ASSETPACK_MAXNAME + 8];
+  assetpackAsset_t *asset;
+  uint32_t align = 4, size;
+  bool source = false;
+  char *fields[4], *p;
+  FILE *out;
+  int i, f;
+
+  for (i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "-a") && (i + 1 < argc))
+    {
+      align = strtoul(argv[++i], NULL, 0);
+      if ((align == 0) || (align % 4))
+        break;
+    }
+    else if (!strcmp(argv[i], "-c"))
+      source = true;
+    else if (!strcmp(argv[i], "-o") && (i + 1 < argc))
+      baseName = argv[++i];
+    else if ((argv[i][0] != '-') && (assetpackCount < ASSETPACK_MAXASSETS))
+    {
+      /* id:NAME:type:file, the file name may contain ':' */
+      for (f = 0, p = argv[i]; f < 3; f++)
+      {
+        fields[f] = p;
+        if ((p = strchr(p, ':')) == NULL)
+          break;
+        *p++ = '\0';
+      }
+      if ((f < 3) || (strlen(fields[1]) == 0) || (strlen(fields[1]) >= ASSETPACK_MAXNAME))
+        break;
+      fields[3] = p;
+
+      asset = &assetpackAssets[assetpackCount];
+      asset->id = strtoul(fields[0], &p, 0);
+      if ((*p != '\0') || (asset->id > 0xFFFF))
+        break;
+      strcpy(asset->name, fields[1]);
+      for (f = 0; f < 4; f++)
+      {
+        if (!strcmp(fields[2], assetpackTypeNames[f]))
+          break;
+      }
+      if (f == 4)
+        break;
+      asset->type = (assetpackType_t)f;
+      asset->path = fields[3];
+      assetpackCount++;
+    }
+    else
+      break;
+  }
+  if ((i < argc) || (assetpackCount == 0))
+  {
+    fprintf(stderr, "Usage: %s [-a align] [-c] [-o name] id:NAME:raw|image|jpeg|font:file ...\n", argv[0]);
+    return 1;
+  }
+  if (strlen(baseName) >= ASSETPACK_MAXNAME)
+    return 1;
+
+  for (i = 0; i < assetpackCount; i++)
+  {
+    asset = &assetpackAssets[i];
+    if ((asset->data = assetpackLoad(asset->path, &asset->size)) == NULL)
+      return 1;
+    if ((asset->type == ASSETPACK_TYPE_IMAGE) && assetpackConvertImage(asset))
+      return 1;
+    if ((asset->type == ASSETPACK_TYPE_JPEG) && assetpackCheckJpeg(asset))
+      return 1;
+    if ((asset->type == ASSETPACK_TYPE_FONT) && assetpackCheckFont(asset))
+      return 1;
+  }
+
+  qsort(assetpackAssets, assetpackCount, sizeof(assetpackAsset_t), assetpackCompare);
+  for (i = 1; i < assetpackCount; i++)
+  {
+    if (assetpackAssets[i].id == assetpackAssets[i - 1].id)
+    {
+      fprintf(stderr, "%s and %s both have ID %u\n", assetpackAssets[i - 1].name, assetpackAssets[i].name, assetpackAssets[i].id);
+      return 1;
+    }
+  }
+
+  sprintf(fileName, "%s.pak", baseName);
+  if ((out = fopen(fileName, "wb")) == NULL)
+  {
+    perror(fileName);
+    return 1;
+  }
+  size = assetpackWritePack(out, align);
+  fclose(out);
+
+  if ((source && assetpackWriteSource(baseName)) || assetpackWriteHeader(baseName, source))
+    return 1;
+
+  /* Summary */
+  for (i = 0; i < assetpackCount; i++)
+  {
+    asset = &assetpackAssets[i];
+    fprintf(stderr, "%5u %-24s %-5s %8u bytes at %8u", asset->id, asset->name,
+            assetpackTypeNames[asset->type], asset->size, asset->offset);
+    if (asset->type == ASSETPACK_TYPE_FONT)
+      fprintf(stderr, ", %u px high, largest glyph %u bytes", asset->height, asset->maxGlyph);
+    else if (asset->width)
+      fprintf(stderr, ", %ux%u", asset->width, asset->height);
+    fprintf(stderr, "\n");
+  }
+  fprintf(stderr, "%d assets, %u bytes\n", assetpackCount, size);
+
+  return 0;
+}
@@ -0,0 +1,410 @@
+/**************************************************************************/
+/*!
+    @file     drawops_bench.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+
+/*  REMOTE DRAWING REPLAY BENCHMARK
+    ===============================
+
+    Replays a trace of drawing operations through two encoders and
+    reports how many 64 byte protocol messages each screen update needs,
+    and how many updates per second that allows at a given message rate:
+
+    - 'raw pixels' pushes the bounding box of every operation as pixel
+      data (WINDOW + PIXELS), which is what a host does today
+    - 'draw opcodes' sends the operations themselves, with bitmaps
+      run-length encoded
+
+    Usage: drawops_bench [-r msgs/s] [-W width] [-H height]
+                         [-c charW] [-l lineH] [-v] [trace]
+
+    The default message rate of 1000/s is one USB HID packet per 1ms
+    frame.  Text bounding boxes for the raw encoder are estimated as
+    charW x lineH per character.  Without a trace file a built-in
+    dashboard sequence is replayed.  Trace files contain one operation
+    per line (numbers can be decimal or 0x hex):
+
+      fill   color
+      rect   x0 y0 x1 y1 color
+      line   x0 y0 x1 y1 color
+      pixel  x y color
+      text   x y color bgColor fontId string...
+      bitmap x y width height solid|gradient|photo
+      frame                           (ends one screen update)
+      # comment
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "drawops_encoder.h"
+
+#define BENCH_MAX_BITMAP    (320 * 240)
+
+static uint16_t  benchWidth = 240;
+static uint16_t  benchHeight = 320;
+static uint16_t  benchCharWidth = 7;
+static uint16_t  benchLineHeight = 12;
+static bool      benchVerbose = false;
+static uint16_t  benchPixels[BENCH_MAX_BITMAP];
+
+static const char *benchDemo[] =
+{
+  "# Full dashboard, then 9 updates of the live values",
+  "fill 0x0000",
+  "rect 0 0 239 23 0x001F",
+  "text 6 6 0xFFFF 0x001F 1 Sensor dashboard",
+  "bitmap 4 30 32 32 gradient",
+  "bitmap 4 70 32 32 gradient",
+  "bitmap 4 110 32 32 solid",
+  "bitmap 4 150 32 32 photo",
+  "text 42 40 0xFFFF 0x0000 0 Temperature",
+  "text 42 80 0xFFFF 0x0000 0 Humidity",
+  "text 42 120 0xFFFF 0x0000 0 Pressure",
+  "text 42 160 0xFFFF 0x0000 0 Light",
+  "rect 10 200 229 309 0x2104",
+  "line 10 255 229 255 0x8410",
+  "frame",
+  NULL
+};
+
+static const char *benchDemoUpdate[] =
+{
+  "rect 150 40 229 52 0x0000",
+  "text 150 40 0x07E0 0x0000 0 23.4 C",
+  "rect 150 80 229 92 0x0000",
+  "text 150 80 0x07E0 0x0000 0 41 %",
+  "rect 150 120 229 132 0x0000",
+  "text 150 120 0x07E0 0x0000 0 1013 hPa",
+  "rect 150 160 229 172 0x0000",
+  "text 150 160 0x07E0 0x0000 0 320 lux",
+  "rect 10 178 229 186 0x2104",
+  "rect 10 178 120 186 0x07E0",
+  "line 30 240 50 230 0xFFE0",
+  "line 50 230 70 250 0xFFE0",
+  "line 70 250 90 235 0xFFE0",
+  "frame",
+  NULL
+};
+
+typedef struct
+{
+  drawopsEncoder_t enc;
+  uint32_t         bytes;
+  uint32_t         frames;
+  uint32_t         lastMessages;
+  uint32_t         worstFrame;
+} benchEncoder_t;
+
+/**************************************************************************/
+/*!
+    @brief  Counts (and optionally dumps) each message
+*/
+/**************************************************************************/
+static void benchSend(void *param, const uint8_t msg[DRAWOPS_MSG_SIZE])
+{
+  benchEncoder_t *b = (benchEncoder_t *)param;
+  int i;
+
+  b->bytes += DRAWOPS_MSG_SIZE;
+  if (benchVerbose)
+  {
+    for (i = 0; i < 4 + msg[3]; i++)
+    {
+      printf("%02X ", msg[i]);
+    }
+    printf("\n");
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Fills benchPixels with a synthetic width x height image
+*/
+/**************************************************************************/
+static void benchMakeBitmap(uint16_t width, uint16_t height, const char *pattern)
+{
+  uint32_t i, seed = 12345;
+  uint16_t x, y;
+
+  for (y = 0; y < height; y++)
+  {
+    for (x = 0; x < width; x++)
+    {
+      i = (uint32_t)y * width + x;
+      if (!strcmp(pattern, "gradient"))
+      {
+        /* Vertical gradient: each row is a single run */
+        benchPixels[i] = (uint16_t)(((y * 31 / height) << 11) | (x < 2 ? 0x07E0 : 0));
+      }
+      else if (!strcmp(pattern, "photo"))
+      {
+        seed = seed * 1103515245 + 12345;
+        benchPixels[i] = (uint16_t)(seed >> 16);
+      }
+      else
+      {
+        benchPixels[i] = 0xF800;
+      }
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Sends the bounding box of an operation as raw pixels
+*/
+/**************************************************************************/
+static void benchRawBox(benchEncoder_t *b, int x0, int y0, int x1, int y1)
+{
+  int t;
+  uint16_t width, height;
+
+  if (x1 < x0) { t = x0; x0 = x1; x1 = t; }
+  if (y1 < y0) { t = y0; y0 = y1; y1 = t; }
+  if (x0 >= benchWidth || y0 >= benchHeight)
+    return;
+  if (x1 >= benchWidth)
+    x1 = benchWidth - 1;
+  if (y1 >= benchHeight)
+    y1 = benchHeight - 1;
+
+  width = x1 - x0 + 1;
+  height = y1 - y0 + 1;
+  memset(benchPixels, 0, (size_t)width * height * sizeof(uint16_t));
+  drawopsBitmap(&b->enc, x0, y0, width, height, benchPixels, false);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Ends a screen update
+*/
+/**************************************************************************/
+static void benchFrame(benchEncoder_t *b)
+{
+  uint32_t n;
+
+  drawopsFlush(&b->enc);
+  n = b->enc.messages - b->lastMessages;
+  if (n > b->worstFrame)
+    b->worstFrame = n;
+  b->lastMessages = b->enc.messages;
+  b->frames++;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Replays one trace line through both encoders
+*/
+/**************************************************************************/
+static int benchReplay(const char *line, benchEncoder_t *raw, benchEncoder_t *ops)
+{
+  char     op[16], pattern[16], text[128];
+  long     v[6];
+  int      n, consumed = 0;
+
+  while (*line == ' ' || *line == '\t')
+    line++;
+  if ((*line == '#') || (*line == '\0') || (*line == '\n') || (*line == '\r'))
+    return 0;
+  if (sscanf(line, "%15s%n", op, &consumed) != 1)
+    return 0;
+  line += consumed;
+
+  #define BENCH_ARGS(count) \
+    (sscanf(line, "%li %li %li %li %li %li", &v[0], &v[1], &v[2], &v[3], &v[4], &v[5]) >= (count))
+
+  if (!strcmp(op, "frame"))
+  {
+    benchFrame(raw);
+    benchFrame(ops);
+  }
+  else if (!strcmp(op, "fill") && BENCH_ARGS(1))
+  {
+    benchRawBox(raw, 0, 0, benchWidth - 1, benchHeight - 1);
+    drawopsFill(&ops->enc, (uint16_t)v[0]);
+  }
+  else if ((!strcmp(op, "rect") || !strcmp(op, "line")) && BENCH_ARGS(5))
+  {
+    benchRawBox(raw, v[0], v[1], v[2], v[3]);
+    if (op[0] == 'r')
+      drawopsRect(&ops->enc, v[0], v[1], v[2], v[3], v[4]);
+    else
+      drawopsLine(&ops->enc, v[0], v[1], v[2], v[3], v[4]);
+  }
+  else if (!strcmp(op, "pixel") && BENCH_ARGS(3))
+  {
+    benchRawBox(raw, v[0], v[1], v[0], v[1]);
+    drawopsPixel(&ops->enc, v[0], v[1], v[2]);
+  }
+  else if (!strcmp(op, "text") &&
+           (sscanf(line, "%li %li %li %li %li %n", &v[0], &v[1], &v[2], &v[3], &v[4], &n) >= 5))
+  {
+    strncpy(text, line + n, sizeof(text) - 1);
+    text[sizeof(text) - 1] = '\0';
+    text[strcspn(text, "\r\n")] = '\0';
+    benchRawBox(raw, v[0], v[1], v[0] + strlen(text) * benchCharWidth - 1, v[1] + benchLineHeight - 1);
+    if (drawopsText(&ops->enc, v[0], v[1], v[2], v[3], v[4], text))
+    {
+      fprintf(stderr, "Text too long: %s\n", text);
+      return -1;
+    }
+  }
+  else if (!strcmp(op, "bitmap") &&
+           (sscanf(line, "%li %li %li %li %15s", &v[0], &v[1], &v[2], &v[3], pattern) == 5) &&
+           (v[2] * v[3] <= BENCH_MAX_BITMAP))
+  {
+    benchRawBox(raw, v[0], v[1], v[0] + v[2] - 1, v[1] + v[3] - 1);
+    benchMakeBitmap(v[2], v[3], pattern);
+    drawopsBitmap(&ops->enc, v[0], v[1], v[2], v[3], benchPixels, true);
+  }
+  else
+  {
+    fprintf(stderr, "Invalid trace line: %s", line);
+    return -1;
+  }
+
+  #undef BENCH_ARGS
+
+  return 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Prints the results for one encoder
+*/
+/**************************************************************************/
+static void benchReport(const char *name, benchEncoder_t *b, double rate)
+{
+  double perFrame = b->frames ? (double)b->enc.messages / b->frames : 0;
+
+  printf("%-14s %10u %12.1f %12u %14.1f\n", name, b->enc.messages, perFrame, b->worstFrame,
+         perFrame > 0 ? rate / perFrame : 0);
+}
+
+int main(int argc, char *argv[])
+{
+  benchEncoder_t raw, ops;
+  const char *traceName = NULL;
+  double rate = 1000;
+  char line[256];
+  FILE *f;
+  int i, j;
+
+  for (i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "-r") && (i + 1 < argc))
+      rate = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-W") && (i + 1 < argc))
+      benchWidth = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-H") && (i + 1 < argc))
+      benchHeight = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-c") && (i + 1 < argc))
+      benchCharWidth = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-l") && (i + 1 < argc))
+      benchLineHeight = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-v"))
+      benchVerbose = true;
+    else if (argv[i][0] != '-')
+      traceName = argv[i];
+    else
+    {
+      fprintf(stderr, "Usage: %s [-r msgs/s] [-W width] [-H height] [-c charW] [-l lineH] [-v] [trace]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  if ((benchWidth == 0) || (benchHeight == 0) || ((uint32_t)benchWidth * benchHeight > BENCH_MAX_BITMAP))
+  {
+    fprintf(stderr, "Screen size must be between 1x1 and %u pixels\n", BENCH_MAX_BITMAP);
+    return 1;
+  }
+
+  memset(&raw, 0, sizeof(raw));
+  memset(&ops, 0, sizeof(ops));
+  drawopsInit(&raw.enc, 0, benchSend, &raw);
+  drawopsInit(&ops.enc, 0, benchSend, &ops);
+
+  /* Only dump the opcode stream */
+  if (benchVerbose)
+    raw.enc.send = NULL;
+
+  if (traceName)
+  {
+    f = fopen(traceName, "r");
+    if (f == NULL)
+    {
+      perror(traceName);
+      return 1;
+    }
+    while (fgets(line, sizeof(line), f))
+    {
+      if (benchReplay(line, &raw, &ops))
+      {
+        fclose(f);
+        return 1;
+      }
+    }
+    fclose(f);
+  }
+  else
+  {
+    traceName = "built-in dashboard";
+    for (i = 0; benchDemo[i]; i++)
+      benchReplay(benchDemo[i], &raw, &ops);
+    for (j = 0; j < 9; j++)
+      for (i = 0; benchDemoUpdate[i]; i++)
+        benchReplay(benchDemoUpdate[i], &raw, &ops);
+  }
+
+  /* Count anything after the last 'frame' as one more update */
+  if (raw.enc.msg[3] || ops.enc.msg[3])
+  {
+    benchFrame(&raw);
+    benchFrame(&ops);
+  }
+
+  printf("Trace: %s, %u updates, %ux%u screen, %.0f messages/s\n\n",
+         traceName, ops.frames, benchWidth, benchHeight, rate);
+  printf("%-14s %10s %12s %12s %14s\n", "Encoding", "Messages", "Msgs/update", "Worst", "Updates/s");
+  benchReport("raw pixels", &raw, rate);
+  benchReport("draw opcodes", &ops, rate);
+  if (ops.enc.messages)
+  {
+    printf("\nSpeedup: %.1fx\n", (double)raw.enc.messages / ops.enc.messages);
+  }
+
+  return 0;
+}
@@ -0,0 +1,325 @@
+/**************************************************************************/
+/*!
+    @file     drawops_encoder.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <string.h>
+
+#include "drawops_encoder.h"
+
+#define DRAWOPS_MSGTYPE_COMMAND       (0x10)
+
+/* Runs shorter than this are cheaper as literal pixels */
+#define DRAWOPS_MIN_RUN               (3)
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Private Methods ------------------------------ */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Returns a pointer to len free payload bytes, sending the
+            current message first if they don't fit
+*/
+/**************************************************************************/
+static uint8_t *drawopsReserve(drawopsEncoder_t *enc, uint8_t len)
+{
+  uint8_t *p;
+
+  if (enc->msg[3] + len > DRAWOPS_MAX_PAYLOAD)
+  {
+    drawopsFlush(enc);
+  }
+
+  p = &enc->msg[4 + enc->msg[3]];
+  enc->msg[3] += len;
+  enc->opcodes++;
+
+  return p;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Writes a little-endian U16 and returns the next position
+*/
+/**************************************************************************/
+static uint8_t *drawopsPutU16(uint8_t *p, uint16_t value)
+{
+  p[0] = value & 0xFF;
+  p[1] = value >> 8;
+  return p + 2;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Encodes a RECT or LINE opcode
+*/
+/**************************************************************************/
+static void drawopsShape(drawopsEncoder_t *enc, uint8_t opcode, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color)
+{
+  uint8_t *p = drawopsReserve(enc, DRAWOP_RECT_LEN);
+
+  *p++ = opcode;
+  p = drawopsPutU16(p, x0);
+  p = drawopsPutU16(p, y0);
+  p = drawopsPutU16(p, x1);
+  p = drawopsPutU16(p, y1);
+  drawopsPutU16(p, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Encodes count literal pixels, split over as many PIXELS
+            opcodes (and messages) as needed
+*/
+/**************************************************************************/
+static void drawopsLiteral(drawopsEncoder_t *enc, const uint16_t *pixels, uint32_t count)
+{
+  uint8_t  *p;
+  uint32_t n, space, i;
+
+  while (count)
+  {
+    /* Use the rest of the current message if at least one pixel fits */
+    space = DRAWOPS_MAX_PAYLOAD - enc->msg[3];
+    if (space < DRAWOP_PIXELS_LEN(1))
+    {
+      drawopsFlush(enc);
+      space = DRAWOPS_MAX_PAYLOAD;
+    }
+    n = (space - DRAWOP_PIXELS_LEN(0)) / 2;
+    if (n > count)
+      n = count;
+
+    p = drawopsReserve(enc, DRAWOP_PIXELS_LEN(n));
+    *p++ = DRAWOP_PIXELS;
+    *p++ = (uint8_t)n;
+    for (i = 0; i < n; i++)
+    {
+      p = drawopsPutU16(p, pixels[i]);
+    }
+
+    pixels += n;
+    count -= n;
+  }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Public Methods ------------------------------- */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Initialises an encoder
+
+    @param[in]  enc
+                The encoder
+    @param[in]  cmdId
+                Command ID that protcmd_draw has in the device's
+                protocol command table
+    @param[in]  send
+                Called with each complete 64 byte message
+    @param[in]  param
+                Passed to send
+*/
+/**************************************************************************/
+void drawopsInit(drawopsEncoder_t *enc, uint16_t cmdId, drawopsSendFunc_t send, void *param)
+{
+  memset(enc, 0, sizeof(drawopsEncoder_t));
+  enc->cmdId = cmdId;
+  enc->send = send;
+  enc->param = param;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Sends the current message if it contains any opcodes.  Call
+            this at the end of each screen update.
+*/
+/**************************************************************************/
+void drawopsFlush(drawopsEncoder_t *enc)
+{
+  if (enc->msg[3] == 0)
+    return;
+
+  enc->msg[0] = DRAWOPS_MSGTYPE_COMMAND;
+  enc->msg[1] = enc->cmdId & 0xFF;
+  enc->msg[2] = enc->cmdId >> 8;
+  if (enc->send)
+  {
+    enc->send(enc->param, enc->msg);
+  }
+  enc->messages++;
+
+  memset(enc->msg, 0, sizeof(enc->msg));
+}
+
+/**************************************************************************/
+/*!
+    @brief  Fills the whole screen
+*/
+/**************************************************************************/
+void drawopsFill(drawopsEncoder_t *enc, uint16_t color)
+{
+  uint8_t *p = drawopsReserve(enc, DRAWOP_FILL_LEN);
+
+  *p++ = DRAWOP_FILL;
+  drawopsPutU16(p, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws a filled rectangle (drawRectangleFilled)
+*/
+/**************************************************************************/
+void drawopsRect(drawopsEncoder_t *enc, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color)
+{
+  drawopsShape(enc, DRAWOP_RECT, x0, y0, x1, y1, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws a line (drawLine)
+*/
+/**************************************************************************/
+void drawopsLine(drawopsEncoder_t *enc, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color)
+{
+  drawopsShape(enc, DRAWOP_LINE, x0, y0, x1, y1, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Sets a single pixel (drawPixel)
+*/
+/**************************************************************************/
+void drawopsPixel(drawopsEncoder_t *enc, uint16_t x, uint16_t y, uint16_t color)
+{
+  uint8_t *p = drawopsReserve(enc, DRAWOP_PIXEL_LEN);
+
+  *p++ = DRAWOP_PIXEL;
+  p = drawopsPutU16(p, x);
+  p = drawopsPutU16(p, y);
+  drawopsPutU16(p, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws a string with one of the fonts registered on the device
+
+    @return 0, or -1 if the string is longer than DRAWOPS_MAX_TEXT
+            characters (the host doesn't know the font metrics, so it
+            can't split the string itself)
+*/
+/**************************************************************************/
+int drawopsText(drawopsEncoder_t *enc, uint16_t x, uint16_t y, uint16_t color, uint16_t bgColor, uint8_t fontId, const char *str)
+{
+  size_t  len = strlen(str);
+  uint8_t *p;
+
+  if (len > DRAWOPS_MAX_TEXT)
+    return -1;
+
+  p = drawopsReserve(enc, DRAWOP_TEXT_LEN(len));
+  *p++ = DRAWOP_TEXT;
+  p = drawopsPutU16(p, x);
+  p = drawopsPutU16(p, y);
+  p = drawopsPutU16(p, color);
+  p = drawopsPutU16(p, bgColor);
+  *p++ = fontId;
+  *p++ = (uint8_t)len;
+  memcpy(p, str, len);
+
+  return 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Sends an RGB565 bitmap as a WINDOW followed by pixel data,
+            split over as many messages as needed
+
+    @param[in]  rle
+                If true, runs of DRAWOPS_MIN_RUN or more identical
+                pixels are sent as RUN opcodes, and everything else as
+                literal PIXELS.  If false every pixel is sent literally,
+                which is the same as pushing raw pixels.
+*/
+/**************************************************************************/
+void drawopsBitmap(drawopsEncoder_t *enc, uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint16_t *pixels, bool rle)
+{
+  uint8_t  *p;
+  uint32_t total, i, run, literal;
+
+  if ((width == 0) || (height == 0))
+    return;
+
+  p = drawopsReserve(enc, DRAWOP_WINDOW_LEN);
+  *p++ = DRAWOP_WINDOW;
+  p = drawopsPutU16(p, x);
+  p = drawopsPutU16(p, y);
+  p = drawopsPutU16(p, x + width - 1);
+  drawopsPutU16(p, y + height - 1);
+
+  total = (uint32_t)width * height;
+  if (!rle)
+  {
+    drawopsLiteral(enc, pixels, total);
+    return;
+  }
+
+  i = 0;
+  literal = 0;
+  while (i < total)
+  {
+    for (run = 1; (i + run < total) && (run < 0xFFFF) && (pixels[i + run] == pixels[i]); run++);
+
+    if (run >= DRAWOPS_MIN_RUN)
+    {
+      drawopsLiteral(enc, &pixels[literal], i - literal);
+      p = drawopsReserve(enc, DRAWOP_RUN_LEN);
+      *p++ = DRAWOP_RUN;
+      p = drawopsPutU16(p, (uint16_t)run);
+      drawopsPutU16(p, pixels[i]);
+      i += run;
+      literal = i;
+    }
+    else
+    {
+      i += run;
+    }
+  }
+  drawopsLiteral(enc, &pixels[literal], total - literal);
+}
@@ -0,0 +1,81 @@
+/**************************************************************************/
+/*!
+    @file     drawops_encoder.h
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#ifndef _DRAWOPS_ENCODER_H_
+#define _DRAWOPS_ENCODER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "drawops.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Must match PROT_MAX_MSG_SIZE in protocol.h */
+#define DRAWOPS_MSG_SIZE              (64)
+#define DRAWOPS_MAX_PAYLOAD           (DRAWOPS_MSG_SIZE - 4)
+
+/* Longest string a single DRAWOP_TEXT can carry */
+#define DRAWOPS_MAX_TEXT              (DRAWOPS_MAX_PAYLOAD - DRAWOP_TEXT_LEN(0))
+
+/* Called with each complete 64 byte command message */
+typedef void (*drawopsSendFunc_t)(void *param, const uint8_t msg[DRAWOPS_MSG_SIZE]);
+
+typedef struct
+{
+  uint16_t          cmdId;          // Command ID of protcmd_draw in the device's table
+  drawopsSendFunc_t send;
+  void              *param;         // Passed to send
+  uint8_t           msg[DRAWOPS_MSG_SIZE];
+  uint32_t          messages;       // Messages sent so far
+  uint32_t          opcodes;        // Opcodes encoded so far
+} drawopsEncoder_t;
+
+void drawopsInit   ( drawopsEncoder_t *enc, uint16_t cmdId, drawopsSendFunc_t send, void *param );
+void drawopsFlush  ( drawopsEncoder_t *enc );
+void drawopsFill   ( drawopsEncoder_t *enc, uint16_t color );
+void drawopsRect   ( drawopsEncoder_t *enc, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color );
+void drawopsLine   ( drawopsEncoder_t *enc, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color );
+void drawopsPixel  ( drawopsEncoder_t *enc, uint16_t x, uint16_t y, uint16_t color );
+int  drawopsText   ( drawopsEncoder_t *enc, uint16_t x, uint16_t y, uint16_t color, uint16_t bgColor, uint8_t fontId, const char *str );
+void drawopsBitmap ( drawopsEncoder_t *enc, uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint16_t *pixels, bool rle );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,921 @@
+/**************************************************************************/
+/*!
+    @file     fontc.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+
+/*  FONT COMPILER
+    =============
+
+    Generates anti-aliased (aafonts.h) and bitmap (FONT_INFO, fonts.h)
+    font tables from TrueType, OpenType, BDF or PCF sources, using
+    FreeType to read and render them.
+
+        fontc [-t aa2|aa4|bitmap] [-r first-last]... [-c] [-b] [-o name]
+              source:size:Name [source:size:Name ...]
+
+    -t  Output format (default aa2)
+    -r  Code points to include, e.g. -r 0x20-0x7E -r 0x410-0x44F.
+        Defaults to printable ASCII.  AA fonts with gaps between the
+        ranges (or missing glyphs) get a sparse range table; bitmap
+        fonts take a single range within 0x00..0xFF.
+    -c  Run-length encode the AA glyphs (AAFONTS_ENCODING_RLE)
+    -b  Write each AA font to Name.font, as an asset (assets.h) to be
+        bundled into an asset pack by tools/assetpack, instead of
+        writing C source
+    -o  Base name of the output files (name.c and name.h), defaults
+        to the first font's name
+
+    Each source is rendered at 'size' pixels and written out as a font
+    called 'Name'.  Several fonts, typically the variants of one family,
+    can be compiled into the same file, in which case identical glyph
+    bitmaps are only stored once and shared between them.
+
+    Blank rows are trimmed from every glyph and recorded in its yOffset
+    and height metrics, so they are neither stored nor drawn.  A summary
+    of the glyph data saved by trimming and sharing goes to stderr.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include "aafonts_rle.h"
+
+#define FONTC_MAXFONTS                (8)
+#define FONTC_MAXRANGES               (16)
+#define FONTC_MAXGLYPHS               (8192)
+#define FONTC_MAXNAME                 (64)
+
+typedef enum
+{
+  FONTC_TYPE_AA2,
+  FONTC_TYPE_AA4,
+  FONTC_TYPE_BITMAP
+} fontcType_t;
+
+typedef struct
+{
+  uint32_t first;
+  uint32_t last;
+} fontcRange_t;
+
+typedef struct
+{
+  uint16_t code;
+  uint8_t  width;                       // Advance (AA) or bitmap width (FONT_INFO)
+  uint8_t  bytesPerRow;
+  uint8_t  yOffset;
+  uint8_t  height;                      // Rows stored, 0 for a blank glyph
+  int      blob;                        // Index of the glyph data in fontcBlobs, or -1
+} fontcGlyph_t;
+
+typedef struct
+{
+  const char   *source;
+  unsigned     size;
+  char         name[FONTC_MAXNAME];
+  unsigned     height;
+  unsigned     baseline;
+  unsigned     unknownWidth;
+  unsigned     upperHeight;
+  unsigned     lowerHeight;
+  fontcGlyph_t *glyphs;
+  unsigned     count;
+  uint32_t     fullSize;                // Glyph data at full height
+  uint32_t     trimmedSize;             // Glyph data with blank rows trimmed
+} fontcFont_t;
+
+/* A glyph bitmap, possibly shared by several glyphs */
+typedef struct
+{
+  uint8_t  *data;
+  uint32_t size;
+  uint32_t offset;                      // Offset in the shared bitmap array (FONT_INFO)
+  int      font;                        // First user, for the array name and comment
+  uint16_t code;
+  int      users;
+} fontcBlob_t;
+
+static fontcType_t  fontcType = FONTC_TYPE_AA2;
+static bool         fontcRle = false;
+static bool         fontcAsset = false;
+static fontcRange_t fontcRanges[FONTC_MAXRANGES];
+static int          fontcRangeCount = 0;
+static fontcFont_t  fontcFonts[FONTC_MAXFONTS];
+static int          fontcFontCount = 0;
+static fontcBlob_t  fontcBlobs[FONTC_MAXGLYPHS];
+static int          fontcBlobCount = 0;
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Private Methods ------------------------------ */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Returns the index of an identical bitmap, or stores a new one
+*/
+/**************************************************************************/
+static int fontcAddBlob(const uint8_t *data, uint32_t size, int font, uint16_t code)
+{
+  int i;
+
+  for (i = 0; i < fontcBlobCount; i++)
+  {
+    if ((fontcBlobs[i].size == size) && !memcmp(fontcBlobs[i].data, data, size))
+    {
+      fontcBlobs[i].users++;
+      return i;
+    }
+  }
+
+  fontcBlobs[i].data = malloc(size);
+  memcpy(fontcBlobs[i].data, data, size);
+  fontcBlobs[i].size = size;
+  fontcBlobs[i].font = font;
+  fontcBlobs[i].code = code;
+  fontcBlobs[i].users = 1;
+
+  return fontcBlobCount++;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the coverage (0..255) of pixel x/y of a rendered glyph
+*/
+/**************************************************************************/
+static unsigned fontcCoverage(const FT_Bitmap *bitmap, int x, int y)
+{
+  const uint8_t *row = bitmap->buffer + y * bitmap->pitch;
+
+  if (bitmap->pixel_mode == FT_PIXEL_MODE_MONO)
+    return row[x / 8] & (0x80 >> (x % 8)) ? 255 : 0;
+
+  return row[x];
+}
+
+/**************************************************************************/
+/*!
+    @brief  Selects the pixel size to render at, picking the nearest
+            strike for bitmap-only (BDF/PCF) sources
+*/
+/**************************************************************************/
+static int fontcSetSize(FT_Face face, unsigned size)
+{
+  int i, best = 0;
+
+  if (FT_IS_SCALABLE(face))
+    return FT_Set_Pixel_Sizes(face, 0, size);
+
+  for (i = 1; i < face->num_fixed_sizes; i++)
+  {
+    if (abs(face->available_sizes[i].height - (int)size) < abs(face->available_sizes[best].height - (int)size))
+      best = i;
+  }
+
+  return FT_Select_Size(face, best);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Renders a glyph into its character cell as pixel values,
+            and stores its trimmed bitmap
+*/
+/**************************************************************************/
+static int fontcCompileGlyph(FT_Face face, int fontIndex, uint16_t code, fontcGlyph_t *glyph)
+{
+  fontcFont_t *font = &fontcFonts[fontIndex];
+  FT_GlyphSlot slot = face->glyph;
+  unsigned bits = fontcType == FONTC_TYPE_AA4 ? 4 : fontcType == FONTC_TYPE_AA2 ? 2 : 1;
+  unsigned max = (1 << bits) - 1;
+  int x, y, cx, cy, left, advance, top, bottom, x0, x1;
+  uint8_t *cell, *packed;
+  uint32_t size, pixels;
+  unsigned v;
+
+  if (FT_Load_Char(face, code, FT_LOAD_RENDER | (bits == 1 ? FT_LOAD_TARGET_MONO : FT_LOAD_TARGET_NORMAL)))
+  {
+    fprintf(stderr, "%s: can't render code point %04X\n", font->source, code);
+    return -1;
+  }
+
+  advance = (slot->advance.x + 32) >> 6;
+  left = slot->bitmap_left;
+  x0 = 0;
+  x1 = advance - 1;
+
+  /* Bitmap fonts are stored at their ink width, blank glyphs at their
+     advance less the column fontsDrawString adds after every character */
+  if (bits == 1)
+  {
+    x0 = slot->bitmap.width;
+    x1 = -1;
+    for (y = 0; y < (int)slot->bitmap.rows; y++)
+    {
+      for (x = 0; x < (int)slot->bitmap.width; x++)
+      {
+        if (fontcCoverage(&slot->bitmap, x, y) >= 128)
+        {
+          x0 = x < x0 ? x : x0;
+          x1 = x > x1 ? x : x1;
+        }
+      }
+    }
+    if (x1 < x0)
+    {
+      x0 = 0;
+      x1 = (advance > 1 ? advance - 1 : 1) - 1;
+      left = 0;
+    }
+    else
+    {
+      x0 += left;
+      x1 += left;
+    }
+  }
+
+  if ((x1 - x0 + 1 > 255) || (font->height > 255))
+  {
+    fprintf(stderr, "%s: code point %04X is too large\n", font->source, code);
+    return -1;
+  }
+  glyph->code = code;
+  glyph->width = x1 - x0 + 1 > 0 ? x1 - x0 + 1 : 0;
+
+  /* Pixel values for the whole character cell, clipped to it */
+  cell = calloc(glyph->width * font->height + 1, 1);
+  for (y = 0; y < (int)slot->bitmap.rows; y++)
+  {
+    cy = font->baseline - slot->bitmap_top + y;
+    for (x = 0; x < (int)slot->bitmap.width; x++)
+    {
+      cx = slot->bitmap_left + x - x0;
+      if ((cy < 0) || (cy >= (int)font->height) || (cx < 0) || (cx >= glyph->width))
+        continue;
+      v = fontcCoverage(&slot->bitmap, x, y);
+      cell[cy * glyph->width + cx] = bits == 1 ? v >= 128 : (v * max + 127) / 255;
+    }
+  }
+
+  /* Trim the blank rows */
+  for (top = 0; (top < (int)font->height); top++)
+  {
+    for (x = 0; (x < glyph->width) && !cell[top * glyph->width + x]; x++);
+    if (x < glyph->width)
+      break;
+  }
+  for (bottom = font->height - 1; bottom >= top; bottom--)
+  {
+    for (x = 0; (x < glyph->width) && !cell[bottom * glyph->width + x]; x++);
+    if (x < glyph->width)
+      break;
+  }
+  glyph->yOffset = top < (int)font->height ? top : 0;
+  glyph->height = bottom >= top ? bottom - top + 1 : 0;
+  glyph->bytesPerRow = (glyph->width * bits + 7) / 8;
+
+  font->fullSize += glyph->bytesPerRow * font->height;
+  font->trimmedSize += glyph->bytesPerRow * glyph->height;
+
+  /* Pack the stored rows, MSB first */
+  pixels = glyph->width * glyph->height;
+  size = glyph->bytesPerRow * glyph->height;
+  packed = calloc(size + 1, 1);
+  for (y = 0; y < glyph->height; y++)
+  {
+    for (x = 0; x < glyph->width; x++)
+    {
+      v = cell[(glyph->yOffset + y) * glyph->width + x];
+      packed[y * glyph->bytesPerRow + x * bits / 8] |= v << (8 - bits - (x * bits) % 8);
+    }
+  }
+
+  if (pixels == 0)
+  {
+    glyph->blob = -1;
+  }
+  else if (fontcRle && (bits > 1))
+  {
+    uint8_t *rle = malloc(AAFONTS_RLE_MAXSIZE(pixels, bits));
+    uint8_t *value = malloc(pixels);
+    for (y = 0; y < glyph->height; y++)
+      memcpy(&value[y * glyph->width], &cell[(glyph->yOffset + y) * glyph->width], glyph->width);
+    glyph->blob = fontcAddBlob(rle, aafontsRleEncode(value, pixels, bits, rle), fontIndex, code);
+    free(rle);
+    free(value);
+  }
+  else
+  {
+    glyph->blob = fontcAddBlob(packed, size, fontIndex, code);
+  }
+
+  free(cell);
+  free(packed);
+
+  return 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Loads and renders one source font
+*/
+/**************************************************************************/
+static int fontcCompileFont(FT_Library library, int fontIndex)
+{
+  fontcFont_t *font = &fontcFonts[fontIndex];
+  fontcGlyph_t *glyph;
+  FT_Face face;
+  uint32_t code;
+  int r, i;
+
+  if (FT_New_Face(library, font->source, 0, &face) || fontcSetSize(face, font->size))
+  {
+    fprintf(stderr, "%s: can't load font at %u pixels\n", font->source, font->size);
+    return -1;
+  }
+
+  font->baseline = (face->size->metrics.ascender + 63) >> 6;
+  font->height = font->baseline + ((-face->size->metrics.descender + 63) >> 6);
+  font->glyphs = calloc(FONTC_MAXGLYPHS, sizeof(fontcGlyph_t));
+
+  for (r = 0; r < fontcRangeCount; r++)
+  {
+    for (code = fontcRanges[r].first; code <= fontcRanges[r].last; code++)
+    {
+      glyph = &font->glyphs[font->count];
+
+      /* AA fonts leave missing glyphs out of the range table, bitmap
+         fonts are dense so they get a blank glyph */
+      if (FT_Get_Char_Index(face, code) == 0)
+      {
+        if (fontcType != FONTC_TYPE_BITMAP)
+          continue;
+        memset(glyph, 0, sizeof(fontcGlyph_t));
+        glyph->code = code;
+        glyph->width = font->size / 4 ? font->size / 4 : 1;
+        glyph->blob = -1;
+      }
+      else if (fontcCompileGlyph(face, fontIndex, code, glyph))
+      {
+        return -1;
+      }
+      if (++font->count == FONTC_MAXGLYPHS)
+      {
+        fprintf(stderr, "%s: more than %d glyphs\n", font->source, FONTC_MAXGLYPHS);
+        return -1;
+      }
+    }
+  }
+
+  /* Metrics used by aafontsFont_t */
+  font->unknownWidth = font->size / 4 ? font->size / 4 : 1;
+  for (i = 0; i < (int)font->count; i++)
+  {
+    if (font->glyphs[i].code == ' ')
+      font->unknownWidth = font->glyphs[i].width;
+    if (font->glyphs[i].code == 'X')
+      font->upperHeight = font->glyphs[i].height;
+    if (font->glyphs[i].code == 'x')
+      font->lowerHeight = font->glyphs[i].height;
+  }
+
+  FT_Done_Face(face);
+
+  return font->count ? 0 : -1;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Writes count bytes as a C initializer, 12 per line
+*/
+/**************************************************************************/
+static void fontcWriteBytes(FILE *out, const uint8_t *data, uint32_t count)
+{
+  uint32_t i;
+
+  for (i = 0; i < count; i++)
+  {
+    fprintf(out, "%s0x%02X%s", i % 12 ? " " : "  ", data[i], i + 1 < count ? "," : "");
+    if ((i % 12 == 11) || (i + 1 == count))
+      fprintf(out, "\n");
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Writes one aafontsFont_t field with its comment aligned
+*/
+/**************************************************************************/
+static void fontcWriteField(FILE *out, const char *value, const char *comment)
+{
+  fprintf(out, "  %-44s /* %s */\n", value, comment);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Writes the glyph arrays and font definitions for aafonts
+*/
+/**************************************************************************/
+static void fontcWriteAA(FILE *out)
+{
+  fontcFont_t *font;
+  fontcGlyph_t *glyph;
+  char value[FONTC_MAXNAME + 24];
+  int f, i, ranges, start;
+
+  for (i = 0; i < fontcBlobCount; i++)
+  {
+    fprintf(out, "const uint8_t %s_%04X[%3u] = { /* code %04X%s */\n",
+            fontcFonts[fontcBlobs[i].font].name, fontcBlobs[i].code, fontcBlobs[i].size,
+            fontcBlobs[i].code, fontcBlobs[i].users > 1 ? ", shared" : "");
+    fontcWriteBytes(out, fontcBlobs[i].data, fontcBlobs[i].size);
+    fprintf(out, "};\n\n");
+  }
+
+  for (f = 0; f < fontcFontCount; f++)
+  {
+    font = &fontcFonts[f];
+
+    fprintf(out, "const aafontsCharInfo_t charTable_%s[%u] = \n{\n", font->name, font->count);
+    for (i = 0; i < (int)font->count; i++)
+    {
+      glyph = &font->glyphs[i];
+      if (glyph->blob < 0)
+        fprintf(out, "  { %3u, %3u, %3u, %3u, NULL }", glyph->width, glyph->bytesPerRow, glyph->yOffset, glyph->height);
+      else
+        fprintf(out, "  { %3u, %3u, %3u, %3u, %s_%04X }", glyph->width, glyph->bytesPerRow, glyph->yOffset, glyph->height,
+                fontcFonts[fontcBlobs[glyph->blob].font].name, fontcBlobs[glyph->blob].code);
+      fprintf(out, "%s /* code %04X */\n", i + 1 < (int)font->count ? "," : " ", glyph->code);
+    }
+    fprintf(out, "};\n\n");
+
+    /* Runs of consecutive code points */
+    for (i = 1, ranges = 1; i < (int)font->count; i++)
+    {
+      if (font->glyphs[i].code != font->glyphs[i - 1].code + 1)
+        ranges++;
+    }
+    if (ranges > 1)
+    {
+      fprintf(out, "const aafontsCharRange_t charRanges_%s[%d] = \n{\n", font->name, ranges);
+      for (i = 1, start = 0; i <= (int)font->count; i++)
+      {
+        if ((i == (int)font->count) || (font->glyphs[i].code != font->glyphs[i - 1].code + 1))
+        {
+          fprintf(out, "  { 0x%04X, 0x%04X, %4d }%s\n", font->glyphs[start].code, font->glyphs[i - 1].code, start,
+                  i < (int)font->count ? "," : "");
+          start = i;
+        }
+      }
+      fprintf(out, "};\n\n");
+    }
+
+    fprintf(out, "const aafontsFont_t %s = \n{\n", font->name);
+    fontcWriteField(out, fontcType == FONTC_TYPE_AA4 ? "AAFONTS_FONTTYPE_AA4," : "AAFONTS_FONTTYPE_AA2,", "Font type (anti-aliasing level)");
+    sprintf(value, "%u,", font->height);
+    fontcWriteField(out, value, "Font height in pixels");
+    sprintf(value, "%u,", font->unknownWidth);
+    fontcWriteField(out, value, "Width to insert for unknown characters");
+    sprintf(value, "%u,", font->upperHeight);
+    fontcWriteField(out, value, "Height of upper-case characters");
+    sprintf(value, "%u,", font->lowerHeight);
+    fontcWriteField(out, value, "Height of lower-case characters");
+    sprintf(value, "%u,", font->baseline);
+    fontcWriteField(out, value, "Font baseline");
+    sprintf(value, "0x%04X,", font->glyphs[0].code);
+    fontcWriteField(out, value, "Unicode address of first character");
+    sprintf(value, "0x%04X,", font->glyphs[font->count - 1].code);
+    fontcWriteField(out, value, "Unicode address of last character");
+    sprintf(value, "&charTable_%s[0],", font->name);
+    fontcWriteField(out, value, "Font char data");
+    if (ranges > 1)
+      sprintf(value, "&charRanges_%s[0],", font->name);
+    else
+      strcpy(value, "NULL,");
+    fontcWriteField(out, value, "Sparse character ranges");
+    sprintf(value, "%d,", ranges > 1 ? ranges : 0);
+    fontcWriteField(out, value, "Number of character ranges");
+    fontcWriteField(out, fontcRle ? "AAFONTS_ENCODING_RLE" : "AAFONTS_ENCODING_RAW", "Glyph data encoding");
+    fprintf(out, "};\n\n");
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Writes the shared bitmap array and FONT_INFO definitions
+*/
+/**************************************************************************/
+static void fontcWriteBitmap(FILE *out, const char *baseName)
+{
+  fontcFont_t *font;
+  fontcGlyph_t *glyph;
+  uint32_t offset = 0, i, row, x;
+  int f, g, b, width;
+
+  /* One array for every font, so that bitmaps can be shared */
+  fprintf(out, "/* Character bitmaps, shared by every font in this file */\n");
+  fprintf(out, "const uint8_t %sBitmaps[] = \n{\n", baseName);
+  for (b = 0; b < fontcBlobCount; b++)
+  {
+    /* Find a glyph using the blob for its width */
+    for (f = 0, width = 0; (f < fontcFontCount) && !width; f++)
+      for (g = 0; (g < (int)fontcFonts[f].count) && !width; g++)
+        if (fontcFonts[f].glyphs[g].blob == b)
+          width = fontcFonts[f].glyphs[g].width;
+
+    fontcBlobs[b].offset = offset;
+    fprintf(out, "\t/* @%u '%c' (%d pixels wide)%s */\n", offset,
+            fontcBlobs[b].code >= 0x20 && fontcBlobs[b].code < 0x7F ? fontcBlobs[b].code : '?', width,
+            fontcBlobs[b].users > 1 ? ", shared" : "");
+    for (row = 0; row < fontcBlobs[b].size; row += (width + 7) / 8)
+    {
+      fprintf(out, "\t");
+      for (i = 0; i < (uint32_t)(width + 7) / 8; i++)
+        fprintf(out, "0x%02X, ", fontcBlobs[b].data[row + i]);
+      fprintf(out, "/* ");
+      for (x = 0; x < (uint32_t)width; x++)
+        fputc(fontcBlobs[b].data[row + x / 8] & (0x80 >> (x % 8)) ? '#' : ' ', out);
+      fprintf(out, " */\n");
+    }
+    fprintf(out, "\n");
+    offset += fontcBlobs[b].size;
+  }
+  fprintf(out, "};\n\n");
+
+  for (f = 0; f < fontcFontCount; f++)
+  {
+    font = &fontcFonts[f];
+
+    fprintf(out, "/* Character descriptors for %s */\n", font->name);
+    fprintf(out, "/* { [Char width in bits], [Offset into %sBitmaps in bytes] } */\n", baseName);
+    fprintf(out, "const FONT_CHAR_INFO %sDescriptors[] = \n{\n", font->name);
+    for (g = 0; g < (int)font->count; g++)
+    {
+      glyph = &font->glyphs[g];
+      fprintf(out, "\t{%u, %u}, \t\t/* %c */\n", glyph->width, glyph->blob < 0 ? 0 : fontcBlobs[glyph->blob].offset,
+              glyph->code >= 0x20 && glyph->code < 0x7F ? glyph->code : '?');
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "/* Rows covered by each bitmap for %s */\n", font->name);
+    fprintf(out, "/* { [First row], [Rows in the bitmap] } */\n");
+    fprintf(out, "const FONT_CHAR_METRICS %sMetrics[] = \n{\n", font->name);
+    for (g = 0; g < (int)font->count; g++)
+    {
+      glyph = &font->glyphs[g];
+      fprintf(out, "\t{%u, %u}, \t\t/* %c */\n", glyph->yOffset, glyph->height,
+              glyph->code >= 0x20 && glyph->code < 0x7F ? glyph->code : '?');
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "/* Font information for %s */\n", font->name);
+    fprintf(out, "const FONT_INFO %s =\n{\n", font->name);
+    fprintf(out, "\t%u, /*  Character height */\n", font->height);
+    fprintf(out, "\t0x%02X, /*  Start character */\n", font->glyphs[0].code);
+    fprintf(out, "\t0x%02X, /*  End character */\n", font->glyphs[font->count - 1].code);
+    fprintf(out, "\t%sDescriptors, /*  Character descriptor array */\n", font->name);
+    fprintf(out, "\t%sBitmaps, /*  Character bitmap array */\n", baseName);
+    fprintf(out, "\t%sMetrics, /*  Character metrics array */\n", font->name);
+    fprintf(out, "};\n\n");
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Writes the header declaring every font
+*/
+/**************************************************************************/
+static void fontcWriteHeader(FILE *out, const char *baseName)
+{
+  char guard[FONTC_MAXNAME + 8];
+  int i;
+
+  for (i = 0; baseName[i] && (i < FONTC_MAXNAME); i++)
+    guard[i] = (baseName[i] >= 'a') && (baseName[i] <= 'z') ? baseName[i] - 'a' + 'A' : baseName[i];
+  guard[i] = '\0';
+
+  fprintf(out, "/* Generated by tools/fontc, do not edit */\n");
+  fprintf(out, "#ifndef __%s_H__\n#define __%s_H__\n\n", guard, guard);
+  fprintf(out, "#ifdef __cplusplus\nextern \"C\" {\n#endif\n\n");
+  fprintf(out, "#include \"bspconfig.h\"\n");
+  if (fontcType == FONTC_TYPE_BITMAP)
+    fprintf(out, "#include \"drivers/displays/graphic/fonts.h\"\n\n");
+  else
+    fprintf(out, "#include \"drivers/displays/graphic/aafonts.h\"\n\n");
+  for (i = 0; i < fontcFontCount; i++)
+    fprintf(out, "extern const %s %s;\n", fontcType == FONTC_TYPE_BITMAP ? "FONT_INFO" : "aafontsFont_t", fontcFonts[i].name);
+  fprintf(out, "\n#ifdef __cplusplus\n}\n#endif\n\n#endif\n");
+}
+
+/**************************************************************************/
+/*!
+    @brief  Writes the generated .c and .h files
+*/
+/**************************************************************************/
+static int fontcWriteSource(const char *baseName)
+{
+  char fileName[FONTC_MAXNAME + 8];
+  FILE *out;
+  int i;
+
+  /* Source file */
+  sprintf(fileName, "%s.c", baseName);
+  if ((out = fopen(fileName, "w")) == NULL)
+  {
+    perror(fileName);
+    return -1;
+  }
+  fprintf(out, "/**************************************************************************/\n");
+  fprintf(out, "/*!\n    @file     %s.c\n\n    Generated by tools/fontc from:\n\n", baseName);
+  for (i = 0; i < fontcFontCount; i++)
+    fprintf(out, "      %s: %s at %u pixels\n", fontcFonts[i].name,
+            strrchr(fontcFonts[i].source, '/') ? strrchr(fontcFonts[i].source, '/') + 1 : fontcFonts[i].source, fontcFonts[i].size);
+  fprintf(out, "*/\n/**************************************************************************/\n");
+  fprintf(out, "#include \"%s.h\"\n\n", baseName);
+  if (fontcType == FONTC_TYPE_BITMAP)
+    fontcWriteBitmap(out, baseName);
+  else
+    fontcWriteAA(out);
+  fclose(out);
+
+  /* Header */
+  sprintf(fileName, "%s.h", baseName);
+  if ((out = fopen(fileName, "w")) == NULL)
+  {
+    perror(fileName);
+    return -1;
+  }
+  fontcWriteHeader(out, baseName);
+  fclose(out);
+
+  return 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Writes a little endian value to a binary file
+*/
+/**************************************************************************/
+static void fontcPut(FILE *out, uint32_t value, int bytes)
+{
+  while (bytes--)
+  {
+    fputc(value & 0xFF, out);
+    value >>= 8;
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Writes a font as an ASSETS_TYPE_FONT asset (see the layout
+            in assets.h).  Identical bitmaps are shared within the font.
+*/
+/**************************************************************************/
+static int fontcWriteAsset(int fontIndex)
+{
+  fontcFont_t *font = &fontcFonts[fontIndex];
+  fontcGlyph_t *glyph;
+  char fileName[FONTC_MAXNAME + 8];
+  uint32_t *offsets, offset;
+  int i, ranges, start;
+  FILE *out;
+
+  sprintf(fileName, "%s.font", font->name);
+  if ((out = fopen(fileName, "wb")) == NULL)
+  {
+    perror(fileName);
+    return -1;
+  }
+
+  /* Runs of consecutive code points, only stored if there's a gap */
+  for (i = 1, ranges = 1; i < (int)font->count; i++)
+  {
+    if (font->glyphs[i].code != font->glyphs[i - 1].code + 1)
+      ranges++;
+  }
+  if (ranges == 1)
+    ranges = 0;
+
+  fontcPut(out, fontcType == FONTC_TYPE_AA4 ? 4 : 2, 1);
+  fontcPut(out, fontcRle ? 1 : 0, 1);
+  fontcPut(out, font->height, 2);
+  fontcPut(out, font->unknownWidth, 2);
+  fontcPut(out, font->upperHeight, 2);
+  fontcPut(out, font->lowerHeight, 2);
+  fontcPut(out, font->baseline, 2);
+  fontcPut(out, font->glyphs[0].code, 2);
+  fontcPut(out, font->glyphs[font->count - 1].code, 2);
+  fontcPut(out, ranges, 2);
+  fontcPut(out, font->count, 2);
+
+  for (i = 1, start = 0; ranges && (i <= (int)font->count); i++)
+  {
+    if ((i == (int)font->count) || (font->glyphs[i].code != font->glyphs[i - 1].code + 1))
+    {
+      fontcPut(out, font->glyphs[start].code, 2);
+      fontcPut(out, font->glyphs[i - 1].code, 2);
+      fontcPut(out, start, 2);
+      start = i;
+    }
+  }
+  if (ranges & 1)
+    fontcPut(out, 0, 2);
+
+  /* Glyph records, then each bitmap the first time it's used */
+  offsets = calloc(fontcBlobCount, sizeof(uint32_t));
+  offset = 20 + ((ranges * 6 + 3) & ~3) + font->count * 12;
+  for (i = 0; i < (int)font->count; i++)
+  {
+    glyph = &font->glyphs[i];
+    if ((glyph->blob >= 0) && !offsets[glyph->blob])
+    {
+      offsets[glyph->blob] = offset;
+      offset += fontcBlobs[glyph->blob].size;
+    }
+    fontcPut(out, glyph->width, 1);
+    fontcPut(out, glyph->bytesPerRow, 1);
+    fontcPut(out, glyph->yOffset, 1);
+    fontcPut(out, glyph->height, 1);
+    fontcPut(out, glyph->blob >= 0 ? offsets[glyph->blob] : 0, 4);
+    fontcPut(out, glyph->blob >= 0 ? fontcBlobs[glyph->blob].size : 0, 4);
+  }
+  for (i = 0; i < (int)font->count; i++)
+  {
+    glyph = &font->glyphs[i];
+    if ((glyph->blob >= 0) && (offsets[glyph->blob] == (uint32_t)ftell(out)))
+      fwrite(fontcBlobs[glyph->blob].data, 1, fontcBlobs[glyph->blob].size, out);
+  }
+
+  free(offsets);
+  fclose(out);
+
+  return 0;
+}
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Public Methods ------------------------------- */
+/*                                                                        */
+/**************************************************************************/
+
+int main(int argc, char *argv[])
+{
+  const char *baseName = NULL;
+  uint32_t full = 0, trimmed = 0, stored = 0;
+  FT_Library library;
+  fontcFont_t *font;
+  char *p, *q;
+  int i;
+
+  for (i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "-t") && (i + 1 < argc))
+    {
+      i++;
+      if (!strcmp(argv[i], "aa2"))
+        fontcType = FONTC_TYPE_AA2;
+      else if (!strcmp(argv[i], "aa4"))
+        fontcType = FONTC_TYPE_AA4;
+      else if (!strcmp(argv[i], "bitmap"))
+        fontcType = FONTC_TYPE_BITMAP;
+      else
+        break;
+    }
+    else if (!strcmp(argv[i], "-r") && (i + 1 < argc) && (fontcRangeCount < FONTC_MAXRANGES))
+    {
+      fontcRanges[fontcRangeCount].first = strtoul(argv[++i], &p, 0);
+      fontcRanges[fontcRangeCount].last = *p == '-' ? strtoul(p + 1, NULL, 0) : fontcRanges[fontcRangeCount].first;
+      if ((fontcRanges[fontcRangeCount].last < fontcRanges[fontcRangeCount].first) || (fontcRanges[fontcRangeCount].last > 0xFFFF))
+        break;
+      fontcRangeCount++;
+    }
+    else if (!strcmp(argv[i], "-c"))
+      fontcRle = true;
+    else if (!strcmp(argv[i], "-b"))
+      fontcAsset = true;
+    else if (!strcmp(argv[i], "-o") && (i + 1 < argc))
+      baseName = argv[++i];
+    else if ((argv[i][0] != '-') && (fontcFontCount < FONTC_MAXFONTS))
+    {
+      /* source:size:Name, split from the right */
+      font = &fontcFonts[fontcFontCount];
+      p = strrchr(argv[i], ':');
+      if ((p == NULL) || (p == argv[i]))
+        break;
+      *p = '\0';
+      q = strrchr(argv[i], ':');
+      if ((q == NULL) || (strlen(p + 1) == 0) || (strlen(p + 1) >= FONTC_MAXNAME))
+        break;
+      *q = '\0';
+      font->source = argv[i];
+      font->size = atoi(q + 1);
+      strcpy(font->name, p + 1);
+      fontcFontCount++;
+    }
+    else
+      break;
+  }
+  if ((i < argc) || (fontcFontCount == 0))
+  {
+    fprintf(stderr, "Usage: %s [-t aa2|aa4|bitmap] [-r first-last]... [-c] [-b] [-o name] source:size:Name ...\n", argv[0]);
+    return 1;
+  }
+
+  if (fontcRangeCount == 0)
+  {
+    fontcRanges[0].first = 0x20;
+    fontcRanges[0].last = 0x7E;
+    fontcRangeCount = 1;
+  }
+  if ((fontcType == FONTC_TYPE_BITMAP) && ((fontcRangeCount > 1) || (fontcRanges[0].last > 0xFF)))
+  {
+    fprintf(stderr, "Bitmap fonts take a single range within 0x00..0xFF\n");
+    return 1;
+  }
+  if ((fontcType == FONTC_TYPE_BITMAP) && fontcAsset)
+  {
+    fprintf(stderr, "Only AA fonts can be written as assets\n");
+    return 1;
+  }
+  if (baseName == NULL)
+    baseName = fontcFonts[0].name;
+  if (strlen(baseName) >= FONTC_MAXNAME)
+    return 1;
+
+  if (FT_Init_FreeType(&library))
+    return 1;
+  for (i = 0; i < fontcFontCount; i++)
+  {
+    if (fontcCompileFont(library, i))
+      return 1;
+  }
+  FT_Done_FreeType(library);
+
+  if (fontcAsset)
+  {
+    for (i = 0; i < fontcFontCount; i++)
+    {
+      if (fontcWriteAsset(i))
+        return 1;
+    }
+  }
+  else if (fontcWriteSource(baseName))
+  {
+    return 1;
+  }
+
+  /* Summary */
+  for (i = 0; i < fontcFontCount; i++)
+  {
+    font = &fontcFonts[i];
+    fprintf(stderr, "%-32s %5u glyphs, %2u px high, %7u bytes at full height, %7u trimmed\n",
+            font->name, font->count, font->height, font->fullSize, font->trimmedSize);
+    full += font->fullSize;
+    trimmed += font->trimmedSize;
+  }
+  for (i = 0; i < fontcBlobCount; i++)
+    stored += fontcBlobs[i].size;
+  fprintf(stderr, "%d unique glyph bitmaps, %u bytes stored (%s%s), %.1f%% less than at full height\n",
+          fontcBlobCount, stored, fontcRle ? "RLE, " : "",
+          trimmed > stored || fontcRle ? "after sharing" : "no duplicates",
+          full ? 100.0 * (full - stored) / full : 0.0);
+
+  return 0;
+}